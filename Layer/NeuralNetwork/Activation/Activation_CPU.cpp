@@ -11,6 +11,8 @@
 
 #include"Activation_CPU.h"
 #include"Activation_LayerData_CPU.h"
+
+#define DACTIVATION_CODE	L"DActivation"
 
 using namespace Gravisbell;
 using namespace Gravisbell::Layer::NeuralNetwork;
@@ -30,6 +32,9 @@ namespace NeuralNetwork {
 		,	outputBufferCount				(0)		/**< o̓obt@ */
 		,	func_activation					(&Activation_CPU::func_activation_sigmoid)
 		,	func_dactivation				(&Activation_CPU::func_dactivation_sigmoid)
+		,	lpDActivation					(NULL)	/**< Zɋ߂֐̔l */
+		,	temporaryMemoryManager			(i_temporaryMemoryManager)	/**< ꎞobt@Ǘ */
+		,	dActivationBufferHandle	(Gravisbell::Common::INVALID_TEMPORARY_BUFFER_HANDLE)
 	{
 	}
 	/** fXgN^ */
@@ -86,7 +91,22 @@ namespace NeuralNetwork {
 		this->m_lppDInputBuffer.resize(this->GetBatchSize(), NULL);
 		this->m_lppDOutputBuffer.resize(this->GetBatchSize(), NULL);
 
-		return ErrorCode::ERROR_CODE_NONE;
+		// ֐̔l̕ێpobt@̃TCYo^
+		this->dActivationBufferHandle = this->temporaryMemoryManager.RegisterBuffer(this->GetGUID(), DACTIVATION_CODE, sizeof(F32) * this->outputBufferCount * this->GetBatchSize());
+
+		return ErrorCode::ERROR_CODE_NONE;
+	}
+
+
+	/** Z̒ԒlwKɍėpꍇɁAZwK܂ŕێꎞobt@̃TCY߂.
+		ZO(wKp)œo^obt@͒Ԓlėpꍇ̂ݗ\񂳂邽߁A̒lƂČς. */
+	U64 Activation_CPU::GetPlannedReuseIntermediateByteCount(U32 i_batchSize)const
+	{
+		// lenear͔l萔̂ߕێȂ
+		if(this->layerData.layerStructure.ActivationType == Gravisbell::Layer::NeuralNetwork::Activation::LayerStructure::ActivationType_lenear)
+			return 0;
+
+		return (U64)sizeof(F32) * this->GetOutputBufferCount() * i_batchSize;
 	}
 
 
@@ -109,6 +129,9 @@ namespace NeuralNetwork {
 		// /o̓obt@ۑp̃AhXz쐬
 		this->m_lppInputBuffer.resize(this->GetBatchSize(), NULL);
 		this->m_lppOutputBuffer.resize(this->GetBatchSize(), NULL);
+
+		// ێĂl̓obt@TCYς邽ߔj
+		this->RestoreDActivationBuffer();
 
 
 		// ֐ݒ
@@ -185,6 +208,53 @@ namespace NeuralNetwork {
 		return ErrorCode::ERROR_CODE_NONE;
 	}
 
+
+	/** Zʂ͂ƈv邩mF.
+		jA֐̏ꍇ̂true. */
+	bool Activation_CPU::CheckIsIdentity()
+	{
+		return this->layerData.layerStructure.ActivationType == Gravisbell::Layer::NeuralNetwork::Activation::LayerStructure::ActivationType_lenear;
+	}
+
+	/** OiC[̏o͂̌㏈Ƃē\mF.
+		vfPʂŊȂSoftMaxnȊOtrue. */
+	bool Activation_CPU::CheckCanEpilogue()
+	{
+		switch(this->layerData.layerStructure.ActivationType)
+		{
+		case Gravisbell::Layer::NeuralNetwork::Activation::LayerStructure::ActivationType_softmax_ALL:
+		case Gravisbell::Layer::NeuralNetwork::Activation::LayerStructure::ActivationType_softmax_CH:
+		case Gravisbell::Layer::NeuralNetwork::Activation::LayerStructure::ActivationType_softmax_ALL_crossEntropy:
+		case Gravisbell::Layer::NeuralNetwork::Activation::LayerStructure::ActivationType_softmax_CH_crossEntropy:
+			return false;
+		default:
+			return true;
+		}
+	}
+
+	/** ㏈ƂāAobt@̊evfɊ֐Kp.
+		@param	io_lpBuffer		KpΏۂ̃obt@. ʂŏ㏑.
+		@param	i_bufferCount	vf */
+	ErrorCode Activation_CPU::CalculateEpilogue_device(BATCH_BUFFER_POINTER io_lpBuffer, U32 i_bufferCount)
+	{
+		for(U32 i=0; i<i_bufferCount; i++)
+			io_lpBuffer[i] = (this->*func_activation)(io_lpBuffer[i]);
+
+		return ErrorCode::ERROR_CODE_NONE;
+	}
+
+	/** ㏈ƂāAo͌덷Ɋ֐̔lZ.
+		@param	i_lpOutputBuffer	㏈Kp̏o.
+		@param	i_lpDOutputBuffer	o͌덷.
+		@param	o_lpDInputBuffer	Zʂ̊i[. o͌덷ƓAhXł悢.
+		@param	i_bufferCount		vf */
+	ErrorCode Activation_CPU::CalculateDEpilogue_device(CONST_BATCH_BUFFER_POINTER i_lpOutputBuffer, CONST_BATCH_BUFFER_POINTER i_lpDOutputBuffer, BATCH_BUFFER_POINTER o_lpDInputBuffer, U32 i_bufferCount)
+	{
+		for(U32 i=0; i<i_bufferCount; i++)
+			o_lpDInputBuffer[i] = (this->*func_dactivation)(i_lpOutputBuffer[i]) * i_lpDOutputBuffer[i];
+
+		return ErrorCode::ERROR_CODE_NONE;
+	}
 
 	/** Zs.
 		@param lpInputBuffer	̓f[^obt@. GetInputBufferCountŎ擾l̗vfKv
@@ -197,6 +267,12 @@ namespace NeuralNetwork {
 			this->m_lppInputBuffer[batchNum]  = &i_lppInputBuffer[batchNum * this->inputBufferCount];
 			this->m_lppOutputBuffer[batchNum] = &o_lppOutputBuffer[batchNum * this->outputBufferCount];
 		}
+
+		// ̊wKōėpꍇ͔lێ. lenear͔l萔̂ߕێȂ
+		if(this->GetReuseIntermediateFlag() && this->layerData.layerStructure.ActivationType != Gravisbell::Layer::NeuralNetwork::Activation::LayerStructure::ActivationType_lenear)
+			this->lpDActivation = (F32*)this->temporaryMemoryManager.ReserveBuffer(this->dActivationBufferHandle);
+		else
+			this->RestoreDActivationBuffer();
 
 		
 		switch(this->layerData.layerStructure.ActivationType)
@@ -292,6 +368,18 @@ namespace NeuralNetwork {
 			break;
 		}
 
+		// o͂m肵̂Ŕl߂Ă
+		if(this->lpDActivation)
+		{
+			for(U32 batchNum=0; batchNum<this->GetBatchSize(); batchNum++)
+			{
+				for(U32 outputNum=0; outputNum<this->outputBufferCount; outputNum++)
+				{
+					this->lpDActivation[batchNum*this->outputBufferCount + outputNum] = (this->*func_dactivation)(this->m_lppOutputBuffer[batchNum][outputNum]);
+				}
+			}
+		}
+
 		return ErrorCode::ERROR_CODE_NONE;
 	}
 
@@ -318,6 +406,18 @@ namespace NeuralNetwork {
 				this->m_lppDOutputBuffer[batchNum] = &i_lppDOutputBuffer[batchNum * this->outputBufferCount];
 			}
 
+			// Z̔lێĂꍇ͍ėp
+			if(this->lpDActivation)
+			{
+				const U32 bufferCount = this->inputBufferCount * this->GetBatchSize();
+				for(U32 bufNum=0; bufNum<bufferCount; bufNum++)
+				{
+					o_lppDInputBuffer[bufNum] = this->lpDActivation[bufNum] * i_lppDOutputBuffer[bufNum];
+				}
+
+				return ErrorCode::ERROR_CODE_NONE;
+			}
+
 			// ͌덷vZ
 			for(U32 batchNum=0; batchNum<this->GetBatchSize(); batchNum++)
 			{
@@ -337,7 +437,22 @@ namespace NeuralNetwork {
 		ǑvZʂgp */
 	ErrorCode Activation_CPU::Training_device(CONST_BATCH_BUFFER_POINTER i_lppInputBuffer, BATCH_BUFFER_POINTER o_lppDInputBuffer, CONST_BATCH_BUFFER_POINTER i_lppOutputBuffer, CONST_BATCH_BUFFER_POINTER i_lppDOutputBuffer)
 	{
-		return this->CalculateDInput_device(i_lppInputBuffer, o_lppDInputBuffer, i_lppOutputBuffer, i_lppDOutputBuffer);
+		ErrorCode err = this->CalculateDInput_device(i_lppInputBuffer, o_lppDInputBuffer, i_lppOutputBuffer, i_lppDOutputBuffer);
+
+		// l͊wKŎgI邽ߊJ
+		this->RestoreDActivationBuffer();
+
+		return err;
+	}
+
+	/** ֐̔l̕ێpobt@J */
+	void Activation_CPU::RestoreDActivationBuffer()
+	{
+		if(this->lpDActivation == NULL)
+			return;
+
+		this->temporaryMemoryManager.RestoreBuffer(this->dActivationBufferHandle);
+		this->lpDActivation = NULL;
 	}
 
 
@@ -35,6 +35,12 @@ private:
 	U32 outputBufferCount;				/**< o̓obt@ */
 
 	std::vector<F32>						lpCalculateSum;	/**< ꎞvZp̃obt@[z][y][x]̃TCY */
+
+	// wKp̃f[^
+	F32* lpDActivation;		/**< Zɋ߂֐̔l <ob`><o̓obt@>. wKɍėp. ێĂȂꍇNULL */
+
+	Gravisbell::Common::ITemporaryMemoryManager& temporaryMemoryManager;	/**< ꎞobt@Ǘ */
+	Gravisbell::Common::TemporaryBufferHandle dActivationBufferHandle;	/**< ֐̔l̈ꎞobt@̃nh */
 
 
 	// ֐
@@ -82,6 +88,8 @@ public:
 		NN쐬AZsOɈxKs邱ƁBf[^ƂɎsKv͂Ȃ.
 		sꍇCalculateȍ~͎̏ss. */
 	ErrorCode PreProcessCalculate();
+	/** Z̒ԒlwKɍėpꍇɁAZwK܂ŕێꎞobt@̃TCY߂. */
+	U64 GetPlannedReuseIntermediateByteCount(U32 i_batchSize)const;
 
 
 	/** [v̏.f[^Zbg̎sJnOɎs
@@ -89,6 +97,26 @@ public:
 	ErrorCode PreProcessLoop();
 
 
+	/** Zʂ͂ƈv邩mF.
+		jA֐̏ꍇ̂true. */
+	bool CheckIsIdentity();
+
+	/** OiC[̏o͂̌㏈Ƃē\mF.
+		vfPʂŊȂSoftMaxnȊOtrue. */
+	bool CheckCanEpilogue();
+
+	/** ㏈ƂāAobt@̊evfɊ֐Kp.
+		@param	io_lpBuffer		KpΏۂ̃obt@. ʂŏ㏑.
+		@param	i_bufferCount	vf */
+	ErrorCode CalculateEpilogue_device(BATCH_BUFFER_POINTER io_lpBuffer, U32 i_bufferCount);
+
+	/** ㏈ƂāAo͌덷Ɋ֐̔lZ.
+		@param	i_lpOutputBuffer	㏈Kp̏o.
+		@param	i_lpDOutputBuffer	o͌덷.
+		@param	o_lpDInputBuffer	Zʂ̊i[. o͌덷ƓAhXł悢.
+		@param	i_bufferCount		vf */
+	ErrorCode CalculateDEpilogue_device(CONST_BATCH_BUFFER_POINTER i_lpOutputBuffer, CONST_BATCH_BUFFER_POINTER i_lpDOutputBuffer, BATCH_BUFFER_POINTER o_lpDInputBuffer, U32 i_bufferCount);
+
 	/** Zs.
 		@param lpInputBuffer	̓f[^obt@. GetInputBufferCountŎ擾l̗vfKv
 		@return ꍇ0Ԃ */
@@ -111,6 +139,10 @@ public:
 		ǑvZʂgp */
 	ErrorCode Training_device(CONST_BATCH_BUFFER_POINTER i_lppInputBuffer, BATCH_BUFFER_POINTER o_lppDInputBuffer, CONST_BATCH_BUFFER_POINTER i_lppOutputBuffer, CONST_BATCH_BUFFER_POINTER i_lppDOutputBuffer);
 
+private:
+	/** ֐̔l̕ێpobt@J */
+	void RestoreDActivationBuffer();
+
 
 protected:
 	//================================
@@ -11,6 +11,8 @@
 
 #include"Activation_GPU.cuh"
 #include"Activation_LayerData_GPU.cuh"
+
+#include"../_LayerBase/CLayerBase_GPU.cuh"
 
 using namespace Gravisbell;
 using namespace Gravisbell::Layer::NeuralNetwork;
@@ -56,10 +58,12 @@ namespace NeuralNetwork {
 		,	activDesc		(NULL)
 		,	inputTensorDesc	(NULL)
 		,	outputTensorDesc	(NULL)
+		,	epilogueTensorDesc	(NULL)
 	{
 		cudnnCreate(&cudnnHandle);
 		cudnnCreateTensorDescriptor(&inputTensorDesc);
 		cudnnCreateTensorDescriptor(&outputTensorDesc);
+		cudnnCreateTensorDescriptor(&epilogueTensorDesc);
 		cudnnCreateActivationDescriptor(&activDesc);
 	}
 	/** fXgN^ */
@@ -67,6 +71,7 @@ namespace NeuralNetwork {
 	{
 		if(inputTensorDesc)		cudnnDestroyTensorDescriptor(inputTensorDesc);
 		if(outputTensorDesc)	cudnnDestroyTensorDescriptor(outputTensorDesc);
+		if(epilogueTensorDesc)	cudnnDestroyTensorDescriptor(epilogueTensorDesc);
 		if(activDesc)			cudnnDestroyActivationDescriptor(activDesc);
 		if(cudnnHandle)			cudnnDestroy(cudnnHandle);
 	}
@@ -221,6 +226,23 @@ namespace NeuralNetwork {
 		case Gravisbell::Layer::NeuralNetwork::Activation::LayerStructure::ActivationType_softmax_CH_crossEntropy:
 			break;
 		}
+
+		return ErrorCode::ERROR_CODE_NONE;
+	}
+
+	/** ob`TCYύX̏.
+		cuDNÑf[^\̃ob`XV.
+		@param i_prevBatchSize	ύXÕob`TCY */
+	ErrorCode Activation_GPU::ChangeBatchSize(U32 i_prevBatchSize)
+	{
+		// lenearcuDNNgpȂ
+		if(this->layerData.layerStructure.ActivationType == Gravisbell::Layer::NeuralNetwork::Activation::LayerStructure::ActivationType_lenear)
+			return ErrorCode::ERROR_CODE_NONE;
+
+		if(ChangeTensorDescriptorBatchSize(this->inputTensorDesc, i_prevBatchSize, this->GetBatchSize()) != CUDNN_STATUS_SUCCESS)
+			return ErrorCode::ERROR_CODE_CUDA_INITIALIZE;
+		if(ChangeTensorDescriptorBatchSize(this->outputTensorDesc, i_prevBatchSize, this->GetBatchSize()) != CUDNN_STATUS_SUCCESS)
+			return ErrorCode::ERROR_CODE_CUDA_INITIALIZE;
 
 		return ErrorCode::ERROR_CODE_NONE;
 	}
@@ -233,6 +255,191 @@ namespace NeuralNetwork {
 		return Gravisbell::ErrorCode::ERROR_CODE_NONE;
 	}
 
+
+	/** Zʂ͂ƈv邩mF.
+		jA֐̏ꍇ̂true. */
+	bool Activation_GPU::CheckIsIdentity()
+	{
+		return this->layerData.layerStructure.ActivationType == Gravisbell::Layer::NeuralNetwork::Activation::LayerStructure::ActivationType_lenear;
+	}
+
+	/** OiC[̏o͂̌㏈Ƃē\mF.
+		vfPʂŊȂSoftMaxnȊOtrue. */
+	bool Activation_GPU::CheckCanEpilogue()
+	{
+		switch(this->layerData.layerStructure.ActivationType)
+		{
+		case Gravisbell::Layer::NeuralNetwork::Activation::LayerStructure::ActivationType_softmax_ALL:
+		case Gravisbell::Layer::NeuralNetwork::Activation::LayerStructure::ActivationType_softmax_CH:
+		case Gravisbell::Layer::NeuralNetwork::Activation::LayerStructure::ActivationType_softmax_ALL_crossEntropy:
+		case Gravisbell::Layer::NeuralNetwork::Activation::LayerStructure::ActivationType_softmax_CH_crossEntropy:
+			return false;
+		default:
+			return true;
+		}
+	}
+
+	/** ㏈ƂāAobt@̊evfɊ֐Kp.
+		@param	io_lpBuffer		KpΏۂ̃obt@. ʂŏ㏑.
+		@param	i_bufferCount	vf */
+	ErrorCode Activation_GPU::CalculateEpilogue_device(BATCH_BUFFER_POINTER io_lpBuffer, U32 i_bufferCount)
+	{
+		switch(this->layerData.layerStructure.ActivationType)
+		{
+			// lenear
+		case Gravisbell::Layer::NeuralNetwork::Activation::LayerStructure::ActivationType_lenear:
+			break;
+
+		default:
+			// Sigmoid
+		case Gravisbell::Layer::NeuralNetwork::Activation::LayerStructure::ActivationType_sigmoid:
+		case Gravisbell::Layer::NeuralNetwork::Activation::LayerStructure::ActivationType_sigmoid_crossEntropy:
+			// ReLU
+		case Gravisbell::Layer::NeuralNetwork::Activation::LayerStructure::ActivationType_ReLU:
+			// tanh
+		case Gravisbell::Layer::NeuralNetwork::Activation::LayerStructure::ActivationType_tanh:
+			{
+				// vfPʂ̏̂߁ASvf1̃e\ƂĈ
+				if(cudnnSetTensor4dDescriptor(this->epilogueTensorDesc, CUDNN_TENSOR_NCHW, CUDNN_DATA_FLOAT, 1, 1, 1, i_bufferCount) != CUDNN_STATUS_SUCCESS)
+					return ErrorCode::ERROR_CODE_CUDA_INITIALIZE;
+
+				F32 alpha = 1.0f;
+				F32 beta = 0.0f;
+				if(cudnnActivationForward(
+					this->cudnnHandle,
+					this->activDesc,
+					&alpha,
+					this->epilogueTensorDesc,
+					io_lpBuffer,
+					&beta,
+					this->epilogueTensorDesc,
+					io_lpBuffer) != CUDNN_STATUS_SUCCESS)
+				{
+					return ErrorCode::ERROR_CODE_CUDA_CALCULATE;
+				}
+			}
+			break;
+
+			// Leaky-ReLU
+		case Gravisbell::Layer::NeuralNetwork::Activation::LayerStructure::ActivationType_LeakyReLU:
+			{
+				U32 MAX_BUFFER_SIZE = 32768;
+				U32 remainingSize = i_bufferCount;
+				while(remainingSize > 0)
+				{
+					U32 bufferCount = min(remainingSize, MAX_BUFFER_SIZE);
+					dim3 grid((bufferCount +(BLOCK_SIZE - 1))/BLOCK_SIZE , 1, 1);
+					dim3 block(BLOCK_SIZE, 1, 1);
+
+					U32 offset = i_bufferCount - remainingSize;
+
+					cuda_func_activation_LeakyReLU<<<grid, block>>>(
+						&io_lpBuffer[offset],
+						&io_lpBuffer[offset],
+						this->layerData.layerStructure.LeakyReLU_alpha,
+						bufferCount);
+
+					remainingSize = max(0, (S32)remainingSize-(S32)MAX_BUFFER_SIZE);
+				}
+			}
+			break;
+
+			// softmax
+		case Gravisbell::Layer::NeuralNetwork::Activation::LayerStructure::ActivationType_softmax_ALL:
+		case Gravisbell::Layer::NeuralNetwork::Activation::LayerStructure::ActivationType_softmax_CH:
+		case Gravisbell::Layer::NeuralNetwork::Activation::LayerStructure::ActivationType_softmax_ALL_crossEntropy:
+		case Gravisbell::Layer::NeuralNetwork::Activation::LayerStructure::ActivationType_softmax_CH_crossEntropy:
+			return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+		}
+
+		return ErrorCode::ERROR_CODE_NONE;
+	}
+
+	/** ㏈ƂāAo͌덷Ɋ֐̔lZ.
+		@param	i_lpOutputBuffer	㏈Kp̏o.
+		@param	i_lpDOutputBuffer	o͌덷.
+		@param	o_lpDInputBuffer	Zʂ̊i[. o͌덷ƓAhXł悢.
+		@param	i_bufferCount		vf */
+	ErrorCode Activation_GPU::CalculateDEpilogue_device(CONST_BATCH_BUFFER_POINTER i_lpOutputBuffer, CONST_BATCH_BUFFER_POINTER i_lpDOutputBuffer, BATCH_BUFFER_POINTER o_lpDInputBuffer, U32 i_bufferCount)
+	{
+		switch(this->layerData.layerStructure.ActivationType)
+		{
+			// lenear
+		case Gravisbell::Layer::NeuralNetwork::Activation::LayerStructure::ActivationType_lenear:
+		case Gravisbell::Layer::NeuralNetwork::Activation::LayerStructure::ActivationType_sigmoid_crossEntropy:
+			if(o_lpDInputBuffer != i_lpDOutputBuffer)
+				cudaMemcpy(o_lpDInputBuffer, i_lpDOutputBuffer, sizeof(F32)*i_bufferCount, cudaMemcpyDeviceToDevice);
+			break;
+
+		default:
+			// Sigmoid
+		case Gravisbell::Layer::NeuralNetwork::Activation::LayerStructure::ActivationType_sigmoid:
+			// ReLU
+		case Gravisbell::Layer::NeuralNetwork::Activation::LayerStructure::ActivationType_ReLU:
+			// tanh
+		case Gravisbell::Layer::NeuralNetwork::Activation::LayerStructure::ActivationType_tanh:
+			{
+				if(cudnnSetTensor4dDescriptor(this->epilogueTensorDesc, CUDNN_TENSOR_NCHW, CUDNN_DATA_FLOAT, 1, 1, 1, i_bufferCount) != CUDNN_STATUS_SUCCESS)
+					return ErrorCode::ERROR_CODE_CUDA_INITIALIZE;
+
+				// l͏o͂狁܂邽߁A͂ɂ͏o͂n
+				F32 alpha = 1.0f;
+				F32 beta = 0.0f;
+				if(cudnnActivationBackward(
+					this->cudnnHandle,
+					this->activDesc,
+					&alpha,
+					this->epilogueTensorDesc,
+					i_lpOutputBuffer,	// o
+					this->epilogueTensorDesc,
+					i_lpDOutputBuffer,	// o͌덷
+					this->epilogueTensorDesc,
+					i_lpOutputBuffer,	// 
+					&beta,
+					this->epilogueTensorDesc,
+					o_lpDInputBuffer	// ͌덷
+					) != CUDNN_STATUS_SUCCESS)
+				{
+					return ErrorCode::ERROR_CODE_CUDA_CALCULATE;
+				}
+			}
+			break;
+
+			// Leaky-ReLU
+		case Gravisbell::Layer::NeuralNetwork::Activation::LayerStructure::ActivationType_LeakyReLU:
+			{
+				U32 MAX_BUFFER_SIZE = 32768;
+				U32 remainingSize = i_bufferCount;
+				while(remainingSize > 0)
+				{
+					U32 bufferCount = min(remainingSize, MAX_BUFFER_SIZE);
+					dim3 grid((bufferCount +(BLOCK_SIZE - 1))/BLOCK_SIZE , 1, 1);
+					dim3 block(BLOCK_SIZE, 1, 1);
+
+					U32 offset = i_bufferCount - remainingSize;
+
+					cuda_func_dactivation_LeakyReLU<<<grid, block>>>(
+						&i_lpOutputBuffer[offset],
+						&i_lpDOutputBuffer[offset],
+						&o_lpDInputBuffer[offset],
+						this->layerData.layerStructure.LeakyReLU_alpha,
+						bufferCount);
+
+					remainingSize = max(0, (S32)remainingSize-(S32)MAX_BUFFER_SIZE);
+				}
+			}
+			break;
+
+			// softmax
+		case Gravisbell::Layer::NeuralNetwork::Activation::LayerStructure::ActivationType_softmax_ALL:
+		case Gravisbell::Layer::NeuralNetwork::Activation::LayerStructure::ActivationType_softmax_CH:
+		case Gravisbell::Layer::NeuralNetwork::Activation::LayerStructure::ActivationType_softmax_ALL_crossEntropy:
+		case Gravisbell::Layer::NeuralNetwork::Activation::LayerStructure::ActivationType_softmax_CH_crossEntropy:
+			return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+		}
+
+		return ErrorCode::ERROR_CODE_NONE;
+	}
 
 	/** Zs.
 		@param lpInputBuffer	̓f[^obt@. GetInputBufferCountŎ擾l̗vfKv
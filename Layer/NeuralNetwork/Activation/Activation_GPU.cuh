@@ -44,6 +44,7 @@ private:
     cudnnActivationDescriptor_t  activDesc;
 	cudnnTensorDescriptor_t inputTensorDesc;
 	cudnnTensorDescriptor_t outputTensorDesc;
+	cudnnTensorDescriptor_t epilogueTensorDesc;	/**< ㏈p. ĂяoƂɗvfݒ肷 */
 
 protected:
 
@@ -89,6 +90,11 @@ public:
 		sꍇCalculateȍ~͎̏ss. */
 	ErrorCode PreProcessCalculate();
 
+	/** ob`TCYύX̏.
+		cuDNÑf[^\̃ob`XV.
+		@param i_prevBatchSize	ύXÕob`TCY */
+	ErrorCode ChangeBatchSize(U32 i_prevBatchSize);
+
 
 	/** [v̏.f[^Zbg̎sJnOɎs
 		sꍇCalculateȍ~͎̏ss. */
@@ -96,6 +102,26 @@ public:
 
 
 
+	/** Zʂ͂ƈv邩mF.
+		jA֐̏ꍇ̂true. */
+	bool CheckIsIdentity();
+
+	/** OiC[̏o͂̌㏈Ƃē\mF.
+		vfPʂŊȂSoftMaxnȊOtrue. */
+	bool CheckCanEpilogue();
+
+	/** ㏈ƂāAobt@̊evfɊ֐Kp.
+		@param	io_lpBuffer		KpΏۂ̃obt@. ʂŏ㏑.
+		@param	i_bufferCount	vf */
+	ErrorCode CalculateEpilogue_device(BATCH_BUFFER_POINTER io_lpBuffer, U32 i_bufferCount);
+
+	/** ㏈ƂāAo͌덷Ɋ֐̔lZ.
+		@param	i_lpOutputBuffer	㏈Kp̏o.
+		@param	i_lpDOutputBuffer	o͌덷.
+		@param	o_lpDInputBuffer	Zʂ̊i[. o͌덷ƓAhXł悢.
+		@param	i_bufferCount		vf */
+	ErrorCode CalculateDEpilogue_device(CONST_BATCH_BUFFER_POINTER i_lpOutputBuffer, CONST_BATCH_BUFFER_POINTER i_lpDOutputBuffer, BATCH_BUFFER_POINTER o_lpDInputBuffer, U32 i_bufferCount);
+
 	/** Zs.
 		@param lpInputBuffer	̓f[^obt@. GetInputBufferCountŎ擾l̗vfKv
 		@return ꍇ0Ԃ */
@@ -11,6 +11,8 @@
 
 #include"Activation_Discriminator_GPU.cuh"
 #include"Activation_Discriminator_LayerData_GPU.cuh"
+
+#include"../_LayerBase/CLayerBase_GPU.cuh"
 
 using namespace Gravisbell;
 using namespace Gravisbell::Layer::NeuralNetwork;
@@ -179,6 +181,21 @@ namespace NeuralNetwork {
 		return ErrorCode::ERROR_CODE_NONE;
 	}
 
+	/** ob`TCYύX̏.
+		cuDNÑf[^\̃ob`XV.
+		@param i_prevBatchSize	ύXÕob`TCY */
+	ErrorCode Activation_Discriminator_GPU::ChangeBatchSize(U32 i_prevBatchSize)
+	{
+		if(ChangeTensorDescriptorBatchSize(this->inputTensorDesc, i_prevBatchSize, this->GetBatchSize()) != CUDNN_STATUS_SUCCESS)
+			return ErrorCode::ERROR_CODE_CUDA_INITIALIZE;
+		if(ChangeTensorDescriptorBatchSize(this->outputTensorDesc, i_prevBatchSize, this->GetBatchSize()) != CUDNN_STATUS_SUCCESS)
+			return ErrorCode::ERROR_CODE_CUDA_INITIALIZE;
+		if(ChangeTensorDescriptorBatchSize(this->tmpOutputTensorDesc, i_prevBatchSize, this->GetBatchSize()) != CUDNN_STATUS_SUCCESS)
+			return ErrorCode::ERROR_CODE_CUDA_INITIALIZE;
+
+		return ErrorCode::ERROR_CODE_NONE;
+	}
+
 	/** [v̏.f[^Zbg̎sJnOɎs
 		sꍇCalculateȍ~͎̏ss. */
 	ErrorCode Activation_Discriminator_GPU::PreProcessLoop()
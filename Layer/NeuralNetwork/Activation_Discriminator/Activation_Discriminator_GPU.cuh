@@ -96,6 +96,11 @@ public:
 		sꍇCalculateȍ~͎̏ss. */
 	ErrorCode PreProcessCalculate();
 
+	/** ob`TCYύX̏.
+		cuDNÑf[^\̃ob`XV.
+		@param i_prevBatchSize	ύXÕob`TCY */
+	ErrorCode ChangeBatchSize(U32 i_prevBatchSize);
+
 	/** [v̏.f[^Zbg̎sJnOɎs
 		sꍇCalculateȍ~͎̏ss. */
 	ErrorCode PreProcessLoop();
@@ -11,6 +11,8 @@
 #include"BatchNormalization_CPU.h"
 #include"BatchNormalization_LayerData_CPU.h"
 
+
+#define NORMALIZED_VALUE_CODE	L"NormalizedValue"
 
 using namespace Gravisbell;
 using namespace Gravisbell::Layer::NeuralNetwork;
@@ -30,7 +32,9 @@ namespace NeuralNetwork {
 		,	channeclBufferCount		(0)				/**< 1`l̃obt@ */
 		,	onLearnMode				(false)			/**< wKtO */
 		,	learnCount				(0)				/**< wKs */
+		,	lpNormalizedValue		(NULL)			/**< Zɋ߂Kl */
 		,	temporaryMemoryManager	(i_temporaryMemoryManager)	/**< ꎞobt@Ǘ */
+		,	normalizedValueBufferHandle	(Gravisbell::Common::INVALID_TEMPORARY_BUFFER_HANDLE)
 	{
 	}
 	/** fXgN^ */
@@ -97,7 +101,18 @@ namespace NeuralNetwork {
 		this->lpDBias.resize(this->layerData.lpBias.size());
 		this->lpDScale.resize(this->layerData.lpScale.size());
 
-		return ErrorCode::ERROR_CODE_NONE;
+		// Kl̕ێpobt@̃TCYo^
+		this->normalizedValueBufferHandle = this->temporaryMemoryManager.RegisterBuffer(this->GetGUID(), NORMALIZED_VALUE_CODE, sizeof(F32) * this->inputBufferCount * this->GetBatchSize());
+
+		return ErrorCode::ERROR_CODE_NONE;
+	}
+
+
+	/** Z̒ԒlwKɍėpꍇɁAZwK܂ŕێꎞobt@̃TCY߂.
+		ZO(wKp)œo^obt@͒Ԓlėpꍇ̂ݗ\񂳂邽߁A̒lƂČς. */
+	U64 BatchNormalization_CPU::GetPlannedReuseIntermediateByteCount(U32 i_batchSize)const
+	{
+		return (U64)sizeof(F32) * this->GetInputBufferCount() * i_batchSize;
 	}
 
 
@@ -125,10 +140,22 @@ namespace NeuralNetwork {
 		// /o̓obt@ۑp̃AhXz쐬
 		this->lppBatchInputBuffer.resize(this->GetBatchSize(), NULL);
 		this->lppBatchOutputBuffer.resize(this->GetBatchSize());
+
+		// ێĂ鐳Kl̓obt@TCYς邽ߔj
+		this->RestoreNormalizedValueBuffer();
 
 		// ,Uꎞobt@Ɉڂ
 		this->lpTmpMean = this->layerData.lpMean;
 		this->lpTmpVariance = this->layerData.lpVariance;
+
+		// Zp̏ꍇ͊wKp̃obt@
+		if(this->GetProcessType() == ProcessType::PROCESSTYPE_CALCULATE)
+		{
+			std::vector<F32>().swap(this->lpDBias);
+			std::vector<F32>().swap(this->lpDScale);
+			std::vector<BATCH_BUFFER_POINTER>().swap(this->lppBatchDInputBuffer);
+			std::vector<CONST_BATCH_BUFFER_POINTER>().swap(this->lppBatchDOutputBuffer);
+		}
 
 		return ErrorCode::ERROR_CODE_NONE;
 	}
@@ -177,6 +204,12 @@ namespace NeuralNetwork {
 			this->lppBatchOutputBuffer[batchNum] = &o_lppOutputBuffer[batchNum * this->outputBufferCount];
 		}
 
+		// ̊wKōėpꍇ͐Klێ
+		if(this->GetReuseIntermediateFlag())
+			this->lpNormalizedValue = (F32*)this->temporaryMemoryManager.ReserveBuffer(this->normalizedValueBufferHandle);
+		else
+			this->RestoreNormalizedValueBuffer();
+
 		// wKȂΕρAU߂
 		if(this->onLearnMode)
 		{
@@ -226,6 +259,8 @@ namespace NeuralNetwork {
 
 					// K
 					F32 value2 = (value - mean) / sqrtVariance;
+					if(this->lpNormalizedValue)
+						this->lpNormalizedValue[batchNum*this->inputBufferCount + this->channeclBufferCount*ch + bufNum] = value2;
 
 					// XP[OƃoCAX
 					this->lppBatchOutputBuffer[batchNum][this->channeclBufferCount*ch + bufNum] = this->layerData.lpScale[ch] * value2 + this->layerData.lpBias[ch];
@@ -285,11 +320,17 @@ namespace NeuralNetwork {
 			{
 				for(U32 bufNum=0; bufNum<this->channeclBufferCount; bufNum++)
 				{
-					F32 value  = this->lppBatchInputBuffer[batchNum][this->channeclBufferCount*ch + bufNum];
 					F32 dOutput = this->lppBatchDOutputBuffer[batchNum][this->channeclBufferCount*ch + bufNum];
 					F32 dValue2 = dOutput * scale;
 
-					dVariance += dValue2 * (value - mean) * (-1) / 2 / sqrtVariance3;
+					// Z̐KlێĂꍇ͓͂QƂȂ
+					F32 diff;
+					if(this->lpNormalizedValue)
+						diff = this->lpNormalizedValue[batchNum*this->inputBufferCount + this->channeclBufferCount*ch + bufNum] * sqrtVariance;
+					else
+						diff = this->lppBatchInputBuffer[batchNum][this->channeclBufferCount*ch + bufNum] - mean;
+
+					dVariance += dValue2 * diff * (-1) / 2 / sqrtVariance3;
 					dMean     += dValue2 * (-1) / sqrtVariance;
 				}
 			}
@@ -301,13 +342,18 @@ namespace NeuralNetwork {
 				{
 					for(U32 bufNum=0; bufNum<this->channeclBufferCount; bufNum++)
 					{
-						F32 value  = this->lppBatchInputBuffer[batchNum][this->channeclBufferCount*ch + bufNum];
 						F32 dOutput = this->lppBatchDOutputBuffer[batchNum][this->channeclBufferCount*ch + bufNum];
 						F32 dValue2 = dOutput * scale;
 
+						F32 diff;
+						if(this->lpNormalizedValue)
+							diff = this->lpNormalizedValue[batchNum*this->inputBufferCount + this->channeclBufferCount*ch + bufNum] * sqrtVariance;
+						else
+							diff = this->lppBatchInputBuffer[batchNum][this->channeclBufferCount*ch + bufNum] - mean;
+
 						this->lppBatchDInputBuffer[batchNum][this->channeclBufferCount*ch + bufNum]
 							= dValue2 / sqrtVariance
-							+ dVariance * 2 * (value - mean) / (this->channeclBufferCount * this->GetBatchSize())
+							+ dVariance * 2 * diff / (this->channeclBufferCount * this->GetBatchSize())
 							+ dMean / (this->channeclBufferCount * this->GetBatchSize());
 					}
 				}
@@ -364,10 +410,17 @@ namespace NeuralNetwork {
 			{
 				for(U32 bufNum=0; bufNum<this->channeclBufferCount; bufNum++)
 				{
-					F32 value = this->lppBatchInputBuffer[batchNum][this->channeclBufferCount*ch + bufNum];
-
-					// K
-					F32 value2 = (F32)( (value - mean) * sqrtVarianceInv );
+					// K. Z̐KlێĂꍇ͍ėp
+					F32 value2;
+					if(this->lpNormalizedValue)
+					{
+						value2 = this->lpNormalizedValue[batchNum*this->inputBufferCount + this->channeclBufferCount*ch + bufNum];
+					}
+					else
+					{
+						F32 value = this->lppBatchInputBuffer[batchNum][this->channeclBufferCount*ch + bufNum];
+						value2 = (F32)( (value - mean) * sqrtVarianceInv );
+					}
 
 					this->lpDScale[ch] += this->lppBatchDOutputBuffer[batchNum][this->channeclBufferCount*ch + bufNum] * value2;
 					this->lpDBias[ch]  += this->lppBatchDOutputBuffer[batchNum][this->channeclBufferCount*ch + bufNum];
@@ -385,7 +438,20 @@ namespace NeuralNetwork {
 		if(this->layerData.m_pOptimizer_bias)
 			this->layerData.m_pOptimizer_bias->UpdateParameter(&this->layerData.lpBias[0], &this->lpDBias[0]);
 
+		// Kl͊wKŎgI邽ߊJ
+		this->RestoreNormalizedValueBuffer();
+
 		return ErrorCode::ERROR_CODE_NONE;
+	}
+
+	/** Kl̕ێpobt@J */
+	void BatchNormalization_CPU::RestoreNormalizedValueBuffer()
+	{
+		if(this->lpNormalizedValue == NULL)
+			return;
+
+		this->temporaryMemoryManager.RestoreBuffer(this->normalizedValueBufferHandle);
+		this->lpNormalizedValue = NULL;
 	}
 
 
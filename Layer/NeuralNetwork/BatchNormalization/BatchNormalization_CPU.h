@@ -41,12 +41,14 @@ private:
 	U32 learnCount;		/**< wKs */
 	std::vector<F32> lpTmpMean;			/**< ϒli[p̈ꎞϐ */
 	std::vector<F32> lpTmpVariance;		/**< Uli[p̈ꎞϐ */
+	F32* lpNormalizedValue;				/**< Zɋ߂Kl. wKɍėp. ێĂȂꍇNULL */
 
 	// Zp̃obt@
 	std::vector<F32> lpDBias;	/**< oCAX̕ω */
 	std::vector<F32> lpDScale;	/**< XP[̕ω */
 
 	Gravisbell::Common::ITemporaryMemoryManager& temporaryMemoryManager;	/**< ꎞobt@Ǘ */
+	Gravisbell::Common::TemporaryBufferHandle normalizedValueBufferHandle;	/**< K̒l̈ꎞobt@̃nh */
 
 public:
 	/** RXgN^ */
@@ -89,6 +91,8 @@ public:
 		NN쐬AZsOɈxKs邱ƁBf[^ƂɎsKv͂Ȃ.
 		sꍇCalculateȍ~͎̏ss. */
 	ErrorCode PreProcessCalculate();
+	/** Z̒ԒlwKɍėpꍇɁAZwK܂ŕێꎞobt@̃TCY߂. */
+	U64 GetPlannedReuseIntermediateByteCount(U32 i_batchSize)const;
 
 	
 	/** [v̏.f[^Zbg̎sJnOɎs
@@ -122,6 +126,10 @@ public:
 		ǑvZʂgp */
 	ErrorCode Training_device(CONST_BATCH_BUFFER_POINTER i_lppInputBuffer, BATCH_BUFFER_POINTER o_lppDInputBuffer, CONST_BATCH_BUFFER_POINTER i_lppOutputBuffer, CONST_BATCH_BUFFER_POINTER i_lppDOutputBuffer);
 
+private:
+	/** Kl̕ێpobt@J */
+	void RestoreNormalizedValueBuffer();
+
 };
 
 
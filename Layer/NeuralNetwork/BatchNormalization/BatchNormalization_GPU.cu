@@ -10,6 +10,8 @@
 
 #include"BatchNormalization_GPU.cuh"
 #include"BatchNormalization_LayerData_GPU.cuh"
+
+#include"../_LayerBase/CLayerBase_GPU.cuh"
 
 #define WORKSPACE_CODE			L"WorkSpace"
 
@@ -31,6 +33,7 @@ namespace NeuralNetwork {
 		,	channeclBufferCount		(0)				/**< 1`l̃obt@ */
 		,	learnCount				(0)				/**< wKs */
 		,	temporaryMemoryManager	(i_temporaryMemoryManager)
+		,	workSpaceBufferHandle	(Gravisbell::Common::INVALID_TEMPORARY_BUFFER_HANDLE)
 	{
         cudnnCreate(&this->cudnnHandle);
 		cudnnCreateTensorDescriptor(&this->paramTensorDesc);
@@ -101,7 +104,16 @@ namespace NeuralNetwork {
 		this->lpDScale.resize(this->layerData.lpScale.size());
 
 		// ꎞobt@̃TCY߂
-		this->temporaryMemoryManager.SetBufferSize(this->GetGUID(), WORKSPACE_CODE, sizeof(F32)*this->inputBufferCount*this->GetBatchSize());
+		this->workSpaceBufferHandle = this->temporaryMemoryManager.RegisterBuffer(this->GetGUID(), WORKSPACE_CODE, sizeof(F32)*this->inputBufferCount*this->GetBatchSize());
+
+		return ErrorCode::ERROR_CODE_NONE;
+	}
+
+
+	/** ZO(wKp)œo^ꎞobt@̃TCYAobt@mۂɓo^. */
+	ErrorCode BatchNormalization_GPU::RegisterPlannedTemporaryBuffer(Gravisbell::Common::ITemporaryMemoryManager& o_temporaryMemoryManager, U32 i_batchSize)const
+	{
+		o_temporaryMemoryManager.RegisterBuffer(this->GetGUID(), WORKSPACE_CODE, sizeof(F32)*this->GetInputBufferCount()*i_batchSize);
 
 		return ErrorCode::ERROR_CODE_NONE;
 	}
@@ -292,6 +304,19 @@ namespace NeuralNetwork {
 			&dimParam[0],
 			&dimParamStride[0]);
 		if(err_cudnn != 0)
+			return ErrorCode::ERROR_CODE_CUDA_INITIALIZE;
+
+		return ErrorCode::ERROR_CODE_NONE;
+	}
+
+	/** ob`TCYύX̏.
+		cuDNÑf[^\̃ob`XV.
+		@param i_prevBatchSize	ύXÕob`TCY */
+	ErrorCode BatchNormalization_GPU::ChangeBatchSize(U32 i_prevBatchSize)
+	{
+		if(ChangeTensorDescriptorBatchSize(this->inputTensorDesc, i_prevBatchSize, this->GetBatchSize()) != CUDNN_STATUS_SUCCESS)
+			return ErrorCode::ERROR_CODE_CUDA_INITIALIZE;
+		if(ChangeTensorDescriptorBatchSize(this->outputTensorDesc, i_prevBatchSize, this->GetBatchSize()) != CUDNN_STATUS_SUCCESS)
 			return ErrorCode::ERROR_CODE_CUDA_INITIALIZE;
 
 		return ErrorCode::ERROR_CODE_NONE;
@@ -424,7 +449,7 @@ namespace NeuralNetwork {
 		if(o_lppDInputBuffer == NULL)
 		{
 			// ͌덷obt@݂ȂꍇwKłȂ߁Aփobt@m
-			o_lppDInputBuffer = (F32*)this->temporaryMemoryManager.ReserveBuffer(this->GetGUID(), WORKSPACE_CODE);
+			o_lppDInputBuffer = (F32*)this->temporaryMemoryManager.ReserveBuffer(this->workSpaceBufferHandle);
 		}
 
 
@@ -472,7 +497,7 @@ namespace NeuralNetwork {
 #endif
 
 		// ꎞobt@J
-		this->temporaryMemoryManager.RestoreBuffer(this->GetGUID(), WORKSPACE_CODE);
+		this->temporaryMemoryManager.RestoreBuffer(this->workSpaceBufferHandle);
 
 		return ErrorCode::ERROR_CODE_NONE;
 	}
@@ -489,7 +514,7 @@ namespace NeuralNetwork {
 		if(o_lppDInputBuffer == NULL)
 		{
 			// ͌덷obt@݂ȂꍇwKłȂ߁Aփobt@m
-			o_lppDInputBuffer = (F32*)this->temporaryMemoryManager.ReserveBuffer(this->GetGUID(), WORKSPACE_CODE);
+			o_lppDInputBuffer = (F32*)this->temporaryMemoryManager.ReserveBuffer(this->workSpaceBufferHandle);
 		}
 
 
@@ -572,7 +597,7 @@ namespace NeuralNetwork {
 #endif
 
 		// ꎞobt@J
-		this->temporaryMemoryManager.RestoreBuffer(this->GetGUID(), WORKSPACE_CODE);
+		this->temporaryMemoryManager.RestoreBuffer(this->workSpaceBufferHandle);
 
 		return ErrorCode::ERROR_CODE_NONE;
 	}
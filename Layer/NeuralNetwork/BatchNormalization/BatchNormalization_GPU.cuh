@@ -57,6 +57,7 @@ private:
 	thrust::device_vector<F32> lpDScale;		/**< XP[̕ω */
 
 	Gravisbell::Common::ITemporaryMemoryManager& temporaryMemoryManager;	/**< ꎞobt@Ǘ */
+	Gravisbell::Common::TemporaryBufferHandle workSpaceBufferHandle;	/**< Ɨ̈̈ꎞobt@̃nh */
 
 public:
 	/** RXgN^ */
@@ -99,7 +100,14 @@ public:
 		NN쐬AZsOɈxKs邱ƁBf[^ƂɎsKv͂Ȃ.
 		sꍇCalculateȍ~͎̏ss. */
 	ErrorCode PreProcessCalculate();
-
+	/** ZO(wKp)œo^ꎞobt@̃TCYAobt@mۂɓo^. */
+	ErrorCode RegisterPlannedTemporaryBuffer(Gravisbell::Common::ITemporaryMemoryManager& o_temporaryMemoryManager, U32 i_batchSize)const;
+
+	/** ob`TCYύX̏.
+		cuDNÑf[^\̃ob`XV.
+		@param i_prevBatchSize	ύXÕob`TCY */
+	ErrorCode ChangeBatchSize(U32 i_prevBatchSize);
+
 
 	/** [v̏.f[^Zbg̎sJnOɎs
 		sꍇCalculateȍ~͎̏ss. */
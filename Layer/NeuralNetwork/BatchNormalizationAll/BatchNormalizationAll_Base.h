@@ -44,6 +44,12 @@ namespace NeuralNetwork {
 		// C[
 		//===========================
 	public:
+		/** ZʂČvZŕł邩mF.
+			wK̉Zŕ/U̓vXV邽ߍČvZs. */
+		bool CheckCanRecompute()const
+		{
+			return false;
+		}
 	};
 
 }	// NeuralNetwork
@@ -122,6 +122,15 @@ namespace NeuralNetwork {
 		// ,Uꎞobt@Ɉڂ
 		this->lpTmpMean = this->layerData.lpMean;
 		this->lpTmpVariance = this->layerData.lpVariance;
+
+		// Zp̏ꍇ͊wKp̃obt@
+		if(this->GetProcessType() == ProcessType::PROCESSTYPE_CALCULATE)
+		{
+			std::vector<F32>().swap(this->lpDBias);
+			std::vector<F32>().swap(this->lpDScale);
+			std::vector<BATCH_BUFFER_POINTER>().swap(this->lppBatchDInputBuffer);
+			std::vector<CONST_BATCH_BUFFER_POINTER>().swap(this->lppBatchDOutputBuffer);
+		}
 
 		return ErrorCode::ERROR_CODE_NONE;
 	}
@@ -10,6 +10,8 @@
 
 #include"BatchNormalizationAll_GPU.cuh"
 #include"BatchNormalizationAll_LayerData_GPU.cuh"
+
+#include"../_LayerBase/CLayerBase_GPU.cuh"
 
 #define WORKSPACE_CODE			L"WorkSpace"
 
@@ -30,6 +32,7 @@ namespace NeuralNetwork {
 		,	outputBufferCount		(0)				/**< o̓obt@ */
 		,	learnCount				(0)				/**< wKs */
 		,	temporaryMemoryManager	(i_temporaryMemoryManager)
+		,	workSpaceBufferHandle	(Gravisbell::Common::INVALID_TEMPORARY_BUFFER_HANDLE)
 	{
         cudnnCreate(&this->cudnnHandle);
 		cudnnCreateTensorDescriptor(&this->paramTensorDesc);
@@ -100,7 +103,16 @@ namespace NeuralNetwork {
 		this->lpDScale.resize(this->layerData.lpScale.size());
 
 		// ꎞobt@̃TCY߂
-		this->temporaryMemoryManager.SetBufferSize(this->GetGUID(), WORKSPACE_CODE, sizeof(F32)*this->inputBufferCount*this->GetBatchSize());
+		this->workSpaceBufferHandle = this->temporaryMemoryManager.RegisterBuffer(this->GetGUID(), WORKSPACE_CODE, sizeof(F32)*this->inputBufferCount*this->GetBatchSize());
+
+		return ErrorCode::ERROR_CODE_NONE;
+	}
+
+
+	/** ZO(wKp)œo^ꎞobt@̃TCYAobt@mۂɓo^. */
+	ErrorCode BatchNormalizationAll_GPU::RegisterPlannedTemporaryBuffer(Gravisbell::Common::ITemporaryMemoryManager& o_temporaryMemoryManager, U32 i_batchSize)const
+	{
+		o_temporaryMemoryManager.RegisterBuffer(this->GetGUID(), WORKSPACE_CODE, sizeof(F32)*this->GetInputBufferCount()*i_batchSize);
 
 		return ErrorCode::ERROR_CODE_NONE;
 	}
@@ -202,6 +214,19 @@ namespace NeuralNetwork {
 			&dimParam[0],
 			&dimParamStride[0]);
 		if(err_cudnn != 0)
+			return ErrorCode::ERROR_CODE_CUDA_INITIALIZE;
+
+		return ErrorCode::ERROR_CODE_NONE;
+	}
+
+	/** ob`TCYύX̏.
+		cuDNÑf[^\̃ob`XV.
+		@param i_prevBatchSize	ύXÕob`TCY */
+	ErrorCode BatchNormalizationAll_GPU::ChangeBatchSize(U32 i_prevBatchSize)
+	{
+		if(ChangeTensorDescriptorBatchSize(this->inputTensorDesc, i_prevBatchSize, this->GetBatchSize()) != CUDNN_STATUS_SUCCESS)
+			return ErrorCode::ERROR_CODE_CUDA_INITIALIZE;
+		if(ChangeTensorDescriptorBatchSize(this->outputTensorDesc, i_prevBatchSize, this->GetBatchSize()) != CUDNN_STATUS_SUCCESS)
 			return ErrorCode::ERROR_CODE_CUDA_INITIALIZE;
 
 		return ErrorCode::ERROR_CODE_NONE;
@@ -333,7 +358,7 @@ namespace NeuralNetwork {
 		if(o_lppDInputBuffer == NULL)
 		{
 			// ͌덷obt@݂ȂꍇwKłȂ߁Aփobt@m
-			o_lppDInputBuffer = (F32*)this->temporaryMemoryManager.ReserveBuffer(this->GetGUID(), WORKSPACE_CODE);
+			o_lppDInputBuffer = (F32*)this->temporaryMemoryManager.ReserveBuffer(this->workSpaceBufferHandle);
 		}
 
 
@@ -380,6 +405,9 @@ namespace NeuralNetwork {
 		cudaMemcpy(&lpTmpDInputBuffer[0], o_lppDInputBuffer, sizeof(float)*lpTmpDInputBuffer.size(), cudaMemcpyDeviceToHost);
 #endif
 
+		// ꎞobt@J
+		this->temporaryMemoryManager.RestoreBuffer(this->workSpaceBufferHandle);
+
 		return ErrorCode::ERROR_CODE_NONE;
 	}
 
@@ -394,7 +422,7 @@ namespace NeuralNetwork {
 		if(o_lppDInputBuffer == NULL)
 		{
 			// ͌덷obt@݂ȂꍇwKłȂ߁Aփobt@m
-			o_lppDInputBuffer = (F32*)this->temporaryMemoryManager.ReserveBuffer(this->GetGUID(), WORKSPACE_CODE);
+			o_lppDInputBuffer = (F32*)this->temporaryMemoryManager.ReserveBuffer(this->workSpaceBufferHandle);
 		}
 
 
@@ -476,6 +504,9 @@ namespace NeuralNetwork {
 		cudaMemcpy(&lpTmpDInputBuffer[0], o_lppDInputBuffer, sizeof(float)*lpTmpDInputBuffer.size(), cudaMemcpyDeviceToHost);
 #endif
 
+		// ꎞobt@J
+		this->temporaryMemoryManager.RestoreBuffer(this->workSpaceBufferHandle);
+
 		return ErrorCode::ERROR_CODE_NONE;
 	}
 
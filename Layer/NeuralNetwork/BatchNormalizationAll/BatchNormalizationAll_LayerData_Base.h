@@ -107,6 +107,8 @@ namespace NeuralNetwork {
 		ErrorCode SetOptimizerHyperParameter(const wchar_t i_parameterID[], F32 i_value);
 		ErrorCode SetOptimizerHyperParameter(const wchar_t i_parameterID[], S32 i_value);
 		ErrorCode SetOptimizerHyperParameter(const wchar_t i_parameterID[], const wchar_t i_value[]);
+		/** ێĂSẴIveB}CU[wIDł邩mF */
+		bool CheckOptimizerID(const wchar_t i_optimizerID[])const;
 	};
 
 } // Gravisbell;
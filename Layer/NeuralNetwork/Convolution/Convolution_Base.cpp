@@ -14,10 +14,39 @@ using namespace Gravisbell::Layer::NeuralNetwork;
 /** RXgN^ */
 Convolution_Base::Convolution_Base(Gravisbell::GUID guid, const IODataStruct& i_inputDataStruct, const IODataStruct& i_outputDataStruct)
 	:	CNNSingle2SingleLayerBase(guid, ::CreateRuntimeParameter(), i_inputDataStruct, i_outputDataStruct)
+	,	pEpilogueLayer	(NULL)	/**< o͂ɓēKp㏈C[ */
 {
 }
 
 /** fXgN^ */
 Convolution_Base::~Convolution_Base()
 {
-}
\ No newline at end of file
+}
+
+
+//===========================
+// ㏈̓
+//===========================
+/** o͂ɓēKp㏈C[ݒ肷.
+	@param	i_pEpilogueLayer	㏈C[. NULL̏ꍇ͉. */
+ErrorCode Convolution_Base::SetEpilogueLayer(INNSingle2SingleLayer* i_pEpilogueLayer)
+{
+	if(i_pEpilogueLayer)
+	{
+		// vfƂɓƗẐݓł
+		if(!i_pEpilogueLayer->CheckCanEpilogue())
+			return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+
+		// g̏o͂̂܂ܓ͂Ƃ郌C[̂ݓł
+		if(i_pEpilogueLayer->GetInputBufferCount() != this->GetOutputBufferCount())
+			return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+
+		// foCXقȂꍇ̓obt@𒼐ڎ󂯓nȂ
+		if((i_pEpilogueLayer->GetLayerKind() & Layer::ELayerKind::LAYER_KIND_CALCTYPE) != (this->GetLayerKind() & Layer::ELayerKind::LAYER_KIND_CALCTYPE))
+			return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+	}
+
+	this->pEpilogueLayer = i_pEpilogueLayer;
+
+	return ErrorCode::ERROR_CODE_NONE;
+}
@@ -31,6 +31,17 @@ namespace NeuralNetwork {
 		/** fXgN^ */
 		virtual ~Convolution_Base();
 
+	protected:
+		INNSingle2SingleLayer* pEpilogueLayer;	/**< o͂ɓēKp㏈C[. ĂȂꍇNULL */
+
+		//==========================================
+		// ㏈̓
+		//==========================================
+	public:
+		/** o͂ɓēKp㏈C[ݒ肷.
+			@param	i_pEpilogueLayer	㏈C[. NULL̏ꍇ͉. */
+		ErrorCode SetEpilogueLayer(INNSingle2SingleLayer* i_pEpilogueLayer);
+
 	};
 
 }	// NeuralNetwork
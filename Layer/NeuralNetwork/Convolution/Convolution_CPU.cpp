@@ -126,6 +126,14 @@ namespace NeuralNetwork {
 		this->lppBatchInputBuffer.resize(this->GetBatchSize());
 		this->lppBatchOutputBuffer.resize(this->GetBatchSize());
 
+		// Zp̏ꍇ͊wKp̃obt@
+		if(this->GetProcessType() == ProcessType::PROCESSTYPE_CALCULATE)
+		{
+			std::vector<F32>().swap(this->lpDBias);
+			std::vector<F32>().swap(this->lpDNeuron);
+			std::vector<F32*>().swap(this->lppBatchDInputBuffer);
+			std::vector<const F32*>().swap(this->lppBatchDOutputBuffer);
+		}
 
 		return ErrorCode::ERROR_CODE_NONE;
 	}
@@ -162,7 +170,7 @@ namespace NeuralNetwork {
 			do
 			{
 				// Zs
-				ErrorCode err = this->Calculate_base(i_lppInputBuffer, o_lppOutputBuffer, &lpTmpWeight[0], &lpTmpBias[0]);
+				ErrorCode err = this->Calculate_base(i_lppInputBuffer, o_lppOutputBuffer, &lpTmpWeight[0], &lpTmpBias[0], false);
 				if(err != ErrorCode::ERROR_CODE_NONE)
 					return err;
 
@@ -212,10 +220,18 @@ namespace NeuralNetwork {
 			
 			// d݂XV
 			this->layerData.pWeightData->SetData(&lpTmpWeight[0], &lpTmpBias[0]);
+
+			// U͌㏈̓KpȌo͂ŋ߂邽߁A㏈͍Ōɂ܂Ƃ߂ēKp
+			if(this->pEpilogueLayer)
+			{
+				ErrorCode err = this->pEpilogueLayer->CalculateEpilogue_device(o_lppOutputBuffer, this->outputBufferCount * this->GetBatchSize());
+				if(err != ErrorCode::ERROR_CODE_NONE)
+					return err;
+			}
 		}
 		else
 		{
-			ErrorCode err = this->Calculate_base(i_lppInputBuffer, o_lppOutputBuffer, this->layerData.pWeightData->GetWeight(), this->layerData.pWeightData->GetBias());
+			ErrorCode err = this->Calculate_base(i_lppInputBuffer, o_lppOutputBuffer, this->layerData.pWeightData->GetWeight(), this->layerData.pWeightData->GetBias(), true);
 			if(err != ErrorCode::ERROR_CODE_NONE)
 				return err;
 		}
@@ -223,7 +239,9 @@ namespace NeuralNetwork {
 		return ErrorCode::ERROR_CODE_NONE;
 	}
 
-	ErrorCode Convolution_CPU::Calculate_base(CONST_BATCH_BUFFER_POINTER i_lppInputBuffer, BATCH_BUFFER_POINTER o_lppOutputBuffer, const F32* lpWeight, const F32* lpBias)
+	/** Zs.
+		@param	i_onEpilogue	㏈𓝍ĂꍇɁAob`Ƃ̏o͂̊m蒼Ɍ㏈Kp. */
+	ErrorCode Convolution_CPU::Calculate_base(CONST_BATCH_BUFFER_POINTER i_lppInputBuffer, BATCH_BUFFER_POINTER o_lppOutputBuffer, const F32* lpWeight, const F32* lpBias, bool i_onEpilogue)
 	{
 		// ̓obt@̃AhXzɊi[
 		for(U32 batchNum=0; batchNum<this->GetBatchSize(); batchNum++)
@@ -287,6 +305,14 @@ namespace NeuralNetwork {
 					}
 				}
 			}
+
+			// ㏈Ao͂LbVɎcĂ邤ɓKp
+			if(i_onEpilogue && this->pEpilogueLayer)
+			{
+				ErrorCode err = this->pEpilogueLayer->CalculateEpilogue_device(this->lppBatchOutputBuffer[batchNum], this->outputBufferCount);
+				if(err != ErrorCode::ERROR_CODE_NONE)
+					return err;
+			}
 		}
 
 		return ErrorCode::ERROR_CODE_NONE;
@@ -329,8 +355,22 @@ namespace NeuralNetwork {
 		memset(&this->lpDBias[0], 0, sizeof(F32)*this->lpDBias.size());
 		memset(&this->lpDNeuron[0], 0, sizeof(F32)*this->lpDNeuron.size());
 
+		// ㏈̔l̊i[
+		if(this->pEpilogueLayer && this->lpDOutputEpilogue.size() < this->outputBufferCount)
+			this->lpDOutputEpilogue.resize(this->outputBufferCount);
+
 		for(U32 batchNum=0; batchNum<this->GetBatchSize(); batchNum++)
 		{
+			// ㏈̔lAob`Ƃɏo͌덷֏Z
+			if(this->pEpilogueLayer)
+			{
+				ErrorCode err = this->pEpilogueLayer->CalculateDEpilogue_device(this->lppBatchOutputBuffer[batchNum], this->lppBatchDOutputBuffer[batchNum], &this->lpDOutputEpilogue[0], this->outputBufferCount);
+				if(err != ErrorCode::ERROR_CODE_NONE)
+					return err;
+
+				this->lppBatchDOutputBuffer[batchNum] = &this->lpDOutputEpilogue[0];
+			}
+
 			// ͌덷vZ
 			for(S32 neuronNum=0; neuronNum<this->layerData.layerStructure.Output_Channel; neuronNum++)
 			{
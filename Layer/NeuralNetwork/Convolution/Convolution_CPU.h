@@ -29,6 +29,7 @@ private:
 
 	std::vector<F32>			lpDNeuron;	/**< j[̊wK */
 	std::vector<F32>			lpDBias;	/**< oCAX̊wK */
+	std::vector<F32>			lpDOutputEpilogue;	/**< ㏈̔lZo͌덷 <o̓obt@> */
 
 	// Get֐gƏsނ̂ňꎞۑp. PreCalculateŒli[.
 	U32 filterSize;						/**< tB^TCY */
@@ -93,7 +94,9 @@ public:
 		@param lpInputBuffer	̓f[^obt@. GetInputBufferCountŎ擾l̗vfKv
 		@return ꍇ0Ԃ */
 	ErrorCode Calculate_device(CONST_BATCH_BUFFER_POINTER i_lppInputBuffer, BATCH_BUFFER_POINTER o_lppOutputBuffer);
-	ErrorCode Calculate_base(CONST_BATCH_BUFFER_POINTER i_lppInputBuffer, BATCH_BUFFER_POINTER o_lppOutputBuffer, const F32* lpWeight, const F32* lpBias);
+	/** Zs.
+		@param	i_onEpilogue	㏈𓝍ĂꍇɁAob`Ƃ̏o͂̊m蒼Ɍ㏈Kp. */
+	ErrorCode Calculate_base(CONST_BATCH_BUFFER_POINTER i_lppInputBuffer, BATCH_BUFFER_POINTER o_lppOutputBuffer, const F32* lpWeight, const F32* lpBias, bool i_onEpilogue);
 
 public:
 	//================================
@@ -10,6 +10,8 @@
 
 #include"Convolution_GPU.cuh"
 #include"Convolution_LayerData_GPU.cuh"
+
+#include"../_LayerBase/CLayerBase_GPU.cuh"
 
 #include"Library/NeuralNetwork/Optimizer.h"
 
@@ -40,6 +42,7 @@ namespace NeuralNetwork {
 		,	filterDesc			(NULL)
 		,	convDesc			(NULL)
 		,	temporaryMemoryManager	(i_temporaryMemoryManager)
+		,	workSpaceBufferHandle	(Gravisbell::Common::INVALID_TEMPORARY_BUFFER_HANDLE)
 	{
 		cudnnCreate(&cudnnHandle);
 		cudnnCreateTensorDescriptor(&inputTensorDesc);
@@ -110,6 +113,16 @@ namespace NeuralNetwork {
 		this->lpDBias.resize(this->layerData.pWeightData->GetBiasSize());
 		this->lpDNeuron.resize(this->layerData.pWeightData->GetWeigthSize());
 
+
+		return ErrorCode::ERROR_CODE_NONE;
+	}
+
+
+	/** ZO(wKp)œo^ꎞobt@̃TCYAobt@mۂɓo^. */
+	ErrorCode Convolution_GPU::RegisterPlannedTemporaryBuffer(Gravisbell::Common::ITemporaryMemoryManager& o_temporaryMemoryManager, U32 i_batchSize)const
+	{
+		// ASY͎gp\ȃ̏w肵đI邽߁ÃTCYŌς
+		o_temporaryMemoryManager.RegisterBuffer(this->GetGUID(), WORKSPACE_CODE, TEMPORARY_MEMORY_MAX);
 
 		return ErrorCode::ERROR_CODE_NONE;
 	}
@@ -488,7 +501,7 @@ namespace NeuralNetwork {
 
 
 		// pobt@̊m
-		this->temporaryMemoryManager.SetBufferSize(this->GetGUID(), WORKSPACE_CODE, (U32)max(workSpaceSizeByte_forward, max(workSpaceSizeByte_backwardData, workSpaceSizeByte_backwardFilter)));
+		this->workSpaceBufferHandle = this->temporaryMemoryManager.RegisterBuffer(this->GetGUID(), WORKSPACE_CODE, (U32)max(workSpaceSizeByte_forward, max(workSpaceSizeByte_backwardData, workSpaceSizeByte_backwardFilter)));
 
 		// oCAX̃f[^\ݒ
 		err_cudnn = cudnnSetTensorNdDescriptor(
@@ -501,6 +514,19 @@ namespace NeuralNetwork {
 		return ErrorCode::ERROR_CODE_NONE;
 	}
 
+	/** ob`TCYύX̏.
+		cuDNÑf[^\̃ob`XV.
+		@param i_prevBatchSize	ύXÕob`TCY */
+	ErrorCode Convolution_GPU::ChangeBatchSize(U32 i_prevBatchSize)
+	{
+		if(ChangeTensorDescriptorBatchSize(this->inputTensorDesc, i_prevBatchSize, this->GetBatchSize()) != CUDNN_STATUS_SUCCESS)
+			return ErrorCode::ERROR_CODE_CUDA_INITIALIZE;
+		if(ChangeTensorDescriptorBatchSize(this->outputTensorDesc, i_prevBatchSize, this->GetBatchSize()) != CUDNN_STATUS_SUCCESS)
+			return ErrorCode::ERROR_CODE_CUDA_INITIALIZE;
+
+		return ErrorCode::ERROR_CODE_NONE;
+	}
+
 
 	/** [v̏.f[^Zbg̎sJnOɎs
 		sꍇCalculateȍ~͎̏ss. */
@@ -602,6 +628,13 @@ namespace NeuralNetwork {
 				return err;
 		}
 
+		// ㏈Ao̓obt@߂ɂ̂܂ܓKp
+		if(this->pEpilogueLayer)
+		{
+			ErrorCode err = this->pEpilogueLayer->CalculateEpilogue_device(o_lppOutputBuffer, this->outputBufferCount * this->GetBatchSize());
+			if(err != ErrorCode::ERROR_CODE_NONE)
+				return err;
+		}
 
 		return ErrorCode::ERROR_CODE_NONE;
 	}
@@ -622,8 +655,8 @@ namespace NeuralNetwork {
 				lpWeight,
 				this->convDesc,
 				this->useForwardAlgorithm,
-				this->temporaryMemoryManager.ReserveBuffer(this->GetGUID(), WORKSPACE_CODE),
-				this->temporaryMemoryManager.GetBufferSize(this->GetGUID(), WORKSPACE_CODE),
+				this->temporaryMemoryManager.ReserveBuffer(this->workSpaceBufferHandle),
+				this->temporaryMemoryManager.GetBufferSize(this->workSpaceBufferHandle),
 				&beta,
 				this->outputTensorDesc,
 				o_lppOutputBuffer);
@@ -649,7 +682,7 @@ namespace NeuralNetwork {
 		}
 
 		// ꎞobt@
-		this->temporaryMemoryManager.RestoreBuffer(this->GetGUID(), WORKSPACE_CODE);
+		this->temporaryMemoryManager.RestoreBuffer(this->workSpaceBufferHandle);
 
 		return ErrorCode::ERROR_CODE_NONE;
 	}
@@ -667,6 +700,11 @@ namespace NeuralNetwork {
 	{
 		cudnnStatus_t err_cudnn;
 
+		// ㏈̔lo͌덷ɏZ
+		Gravisbell::ErrorCode errCode = this->CalculateDEpilogue(i_lppOutputBuffer, i_lppDOutputBuffer);
+		if(errCode != ErrorCode::ERROR_CODE_NONE)
+			return errCode;
+
 		// ͌덷vZ
 		if(o_lppDInputBuffer)
 		{
@@ -682,21 +720,21 @@ namespace NeuralNetwork {
 				i_lppDOutputBuffer,
 				this->convDesc,
 				this->useBackwardDataAlgorithm,
-				this->temporaryMemoryManager.ReserveBuffer(this->GetGUID(), WORKSPACE_CODE),
-				this->temporaryMemoryManager.GetBufferSize(this->GetGUID(), WORKSPACE_CODE),
+				this->temporaryMemoryManager.ReserveBuffer(this->workSpaceBufferHandle),
+				this->temporaryMemoryManager.GetBufferSize(this->workSpaceBufferHandle),
 				&beta,
 				this->inputTensorDesc,
 				o_lppDInputBuffer);
 			if(err_cudnn != 0)
 			{
 				// ꎞobt@
-				this->temporaryMemoryManager.RestoreBuffer(this->GetGUID(), WORKSPACE_CODE);
+				this->temporaryMemoryManager.RestoreBuffer(this->workSpaceBufferHandle);
 
 				return ErrorCode::ERROR_CODE_CUDA_CALCULATE;
 			}
 
 			// ꎞobt@
-			this->temporaryMemoryManager.RestoreBuffer(this->GetGUID(), WORKSPACE_CODE);
+			this->temporaryMemoryManager.RestoreBuffer(this->workSpaceBufferHandle);
 		}
 
 		return ErrorCode::ERROR_CODE_NONE;
@@ -710,8 +748,13 @@ namespace NeuralNetwork {
 	{
 		cudnnStatus_t err_cudnn;
 
+		// ㏈̔lo͌덷ɏZ. Z̏o͌덷͌덷ƃp[^ωʂ̗Ŏgp
+		Gravisbell::ErrorCode errCode = this->CalculateDEpilogue(i_lppOutputBuffer, i_lppDOutputBuffer);
+		if(errCode != ErrorCode::ERROR_CODE_NONE)
+			return errCode;
+
 		// ͌덷vZ
-		Gravisbell::ErrorCode errCode = this->CalculateDInput_device(i_lppInputBuffer, o_lppDInputBuffer, i_lppOutputBuffer, i_lppDOutputBuffer);
+		errCode = this->CalculateDInput_device(i_lppInputBuffer, o_lppDInputBuffer, i_lppOutputBuffer, i_lppDOutputBuffer);
 		if(errCode != ErrorCode::ERROR_CODE_NONE)
 			return errCode;
 
@@ -730,8 +773,8 @@ namespace NeuralNetwork {
 				i_lppDOutputBuffer,
 				this->convDesc,
 				this->useBackwardFilterAlgorithm,
-				this->temporaryMemoryManager.ReserveBuffer(this->GetGUID(), WORKSPACE_CODE),
-				this->temporaryMemoryManager.GetBufferSize(this->GetGUID(), WORKSPACE_CODE),
+				this->temporaryMemoryManager.ReserveBuffer(this->workSpaceBufferHandle),
+				this->temporaryMemoryManager.GetBufferSize(this->workSpaceBufferHandle),
 				&beta,
 				this->filterDesc,
 				thrust::raw_pointer_cast(&this->lpDNeuron[0]));
@@ -760,12 +803,35 @@ namespace NeuralNetwork {
 		this->layerData.pWeightData->UpdateData(thrust::raw_pointer_cast(&this->lpDNeuron[0]), thrust::raw_pointer_cast(&this->lpDBias[0]));
 
 		// ꎞobt@
-		this->temporaryMemoryManager.RestoreBuffer(this->GetGUID(), WORKSPACE_CODE);
+		this->temporaryMemoryManager.RestoreBuffer(this->workSpaceBufferHandle);
 
 
 		return ErrorCode::ERROR_CODE_NONE;
 	}
 
+	/** ㏈̔lo͌덷ɏZ.
+		㏈𓝍ĂȂꍇAZς݂̏ꍇ͏o͌덷̂܂܎gp.
+		@param	io_lppDOutputBuffer	o͌덷. Zʂ̃AhXɒu. */
+	ErrorCode Convolution_GPU::CalculateDEpilogue(CONST_BATCH_BUFFER_POINTER i_lppOutputBuffer, CONST_BATCH_BUFFER_POINTER& io_lppDOutputBuffer)
+	{
+		if(this->pEpilogueLayer == NULL)
+			return ErrorCode::ERROR_CODE_NONE;
+
+		const U32 bufferCount = this->outputBufferCount * this->GetBatchSize();
+		if(this->lpDOutputEpilogue.size() < bufferCount)
+			this->lpDOutputEpilogue.resize(bufferCount);
+		if(io_lppDOutputBuffer == thrust::raw_pointer_cast(&this->lpDOutputEpilogue[0]))
+			return ErrorCode::ERROR_CODE_NONE;
+
+		ErrorCode err = this->pEpilogueLayer->CalculateDEpilogue_device(i_lppOutputBuffer, io_lppDOutputBuffer, thrust::raw_pointer_cast(&this->lpDOutputEpilogue[0]), bufferCount);
+		if(err != ErrorCode::ERROR_CODE_NONE)
+			return err;
+
+		io_lppDOutputBuffer = thrust::raw_pointer_cast(&this->lpDOutputEpilogue[0]);
+
+		return ErrorCode::ERROR_CODE_NONE;
+	}
+
 
 } // Gravisbell;
 } // Layer;
@@ -53,8 +53,10 @@ private:
 
 	thrust::device_vector<F32> lpDBias;		/**< oCAX̕ω */
 	thrust::device_vector<F32> lpDNeuron;	/**< j[̕ω */
+	thrust::device_vector<F32> lpDOutputEpilogue;	/**< ㏈̔lZo͌덷 */
 
 	Gravisbell::Common::ITemporaryMemoryManager& temporaryMemoryManager;	/**< ꎞobt@p̃ǗNX */
+	Gravisbell::Common::TemporaryBufferHandle workSpaceBufferHandle;	/**< Ɨ̈̈ꎞobt@̃nh */
 
 public:
 	/** RXgN^ */
@@ -98,7 +100,14 @@ public:
 		NN쐬AZsOɈxKs邱ƁBf[^ƂɎsKv͂Ȃ.
 		sꍇCalculateȍ~͎̏ss. */
 	ErrorCode PreProcessCalculate();
+	/** ZO(wKp)œo^ꎞobt@̃TCYAobt@mۂɓo^. */
+	ErrorCode RegisterPlannedTemporaryBuffer(Gravisbell::Common::ITemporaryMemoryManager& o_temporaryMemoryManager, U32 i_batchSize)const;
 
+	/** ob`TCYύX̏.
+		cuDNÑf[^\̃ob`XV.
+		@param i_prevBatchSize	ύXÕob`TCY */
+	ErrorCode ChangeBatchSize(U32 i_prevBatchSize);
+
 
 	/** [v̏.f[^Zbg̎sJnOɎs
 		sꍇCalculateȍ~͎̏ss. */
@@ -130,6 +139,12 @@ public:
 		ǑvZʂgp */
 	ErrorCode Training_device(CONST_BATCH_BUFFER_POINTER i_lppInputBuffer, BATCH_BUFFER_POINTER o_lppDInputBuffer, CONST_BATCH_BUFFER_POINTER i_lppOutputBuffer, CONST_BATCH_BUFFER_POINTER i_lppDOutputBuffer);
 
+private:
+	/** ㏈̔lo͌덷ɏZ.
+		㏈𓝍ĂȂꍇAZς݂̏ꍇ͏o͌덷̂܂܎gp.
+		@param	io_lppDOutputBuffer	o͌덷. Zʂ̃AhXɒu. */
+	ErrorCode CalculateDEpilogue(CONST_BATCH_BUFFER_POINTER i_lppOutputBuffer, CONST_BATCH_BUFFER_POINTER& io_lppDOutputBuffer);
+
 };
 
 
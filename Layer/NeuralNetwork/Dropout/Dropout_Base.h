@@ -28,6 +28,22 @@ namespace NeuralNetwork {
 		/** fXgN^ */
 		virtual ~Dropout_Base();
 
+		//===========================
+		// C[
+		//===========================
+	public:
+		/** ZʂČvZŕł邩mF.
+			ZƂɗgp邽ߍČvZs. */
+		bool CheckCanRecompute()const
+		{
+			return false;
+		}
+		/** Zʂ͂ƈv邩mF.
+			hbvAEggpȂꍇA͂̂܂܏o͂. */
+		bool CheckIsIdentity()
+		{
+			return !this->GetRuntimeParameterByStructure().UseDropOut;
+		}
 	};
 
 }	// NeuralNetwork
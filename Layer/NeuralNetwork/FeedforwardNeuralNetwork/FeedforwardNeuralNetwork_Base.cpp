@@ -5,6 +5,8 @@
 #include"stdafx.h"
 
 #include<boost/uuid/uuid_generators.hpp>
+
+#include<string>
 
 #include"FeedforwardNeuralNetwork_Base.h"
 #include"FeedforwardNeuralNetwork_LayerData_Base.h"
@@ -18,6 +20,8 @@
 #include"LayerConnectSingle2Single.h"
 #include"LayerConnectSingle2Mult.h"
 #include"LayerConnectMult2Single.h"
+
+#include"Library/Common/TemporaryMemoryManager.h"
 
 
 namespace Gravisbell {
@@ -28,25 +32,79 @@ namespace NeuralNetwork {
 	{
 		U32							maxBufferSize;	/**< őobt@TCY */
 		std::set<Gravisbell::GUID>	lpUseLayerID;	/**< gp̃C[ID */
+		bool						onPinned;		/**< o͂ێ邽߁Agp҂ȂȂĂėpȂtO */
 
 		BufferInfo()
 			:	maxBufferSize	(0)
 			,	lpUseLayerID	()
+			,	onPinned		(false)
 		{
 		}
 		BufferInfo(const BufferInfo& info)
 			:	maxBufferSize	(info.maxBufferSize)
-			,	lpUseLayerID	(lpUseLayerID)
+			,	lpUseLayerID	(info.lpUseLayerID)
+			,	onPinned		(info.onPinned)
 		{
 		}
 		const BufferInfo& operator=(const BufferInfo& info)
 		{
 			this->maxBufferSize = info.maxBufferSize;
 			this->lpUseLayerID  = info.lpUseLayerID;
+			this->onPinned      = info.onPinned;
 
 			return *this;
 		}
 	};
+	/** C[gp̃obt@. <C[GUID, gp̃obt@ID̈ꗗ> */
+	typedef std::unordered_map<Gravisbell::GUID, std::vector<U32>, Gravisbell::GUIDHash> BufferUseLayerMap;
+
+	/** gp̃obt@擾. gp̃obt@ꍇ͒ǉ.
+		@param	io_lpBufferInfo		obt@̎gp.
+		@param	io_lpFreeBufferID	gp̃obt@ID. ID̏obt@ėp.
+		@return	obt@ID */
+	static U32 ReserveFreeBuffer(std::vector<BufferInfo>& io_lpBufferInfo, std::set<U32>& io_lpFreeBufferID)
+	{
+		if(!io_lpFreeBufferID.empty())
+		{
+			U32 bufferID = *io_lpFreeBufferID.begin();
+			io_lpFreeBufferID.erase(io_lpFreeBufferID.begin());
+
+			return bufferID;
+		}
+
+		io_lpBufferInfo.push_back(BufferInfo());
+
+		return (U32)io_lpBufferInfo.size() - 1;
+	}
+	/** obt@gpɕύX.
+		@param	i_bufferID			obt@ID.
+		@param	i_guid				gp郌C[GUID.
+		@param	io_lpBufferInfo		obt@̎gp.
+		@param	io_lpUseLayer		C[gp̃obt@. */
+	static void UseBuffer(U32 i_bufferID, const Gravisbell::GUID& i_guid, std::vector<BufferInfo>& io_lpBufferInfo, BufferUseLayerMap& io_lpUseLayer)
+	{
+		if(io_lpBufferInfo[i_bufferID].lpUseLayerID.insert(i_guid).second)
+			io_lpUseLayer[i_guid].push_back(i_bufferID);
+	}
+	/** C[gp̃obt@J.
+		@param	i_guid				J郌C[GUID.
+		@param	io_lpBufferInfo		obt@̎gp.
+		@param	io_lpUseLayer		C[gp̃obt@.
+		@param	io_lpFreeBufferID	gp̃obt@ID. gp҂ȂȂobt@ǉ. */
+	static void ReleaseBuffer(const Gravisbell::GUID& i_guid, std::vector<BufferInfo>& io_lpBufferInfo, BufferUseLayerMap& io_lpUseLayer, std::set<U32>& io_lpFreeBufferID)
+	{
+		auto it_use = io_lpUseLayer.find(i_guid);
+		if(it_use == io_lpUseLayer.end())
+			return;
+
+		for(auto bufferID : it_use->second)
+		{
+			io_lpBufferInfo[bufferID].lpUseLayerID.erase(i_guid);
+			if(io_lpBufferInfo[bufferID].lpUseLayerID.empty() && !io_lpBufferInfo[bufferID].onPinned)
+				io_lpFreeBufferID.insert(bufferID);
+		}
+		io_lpUseLayer.erase(it_use);
+	}
 
 	
 	//====================================
@@ -67,11 +125,22 @@ namespace NeuralNetwork {
 		,	m_lppInputBuffer		(NULL)	/**< Oa̓obt@̃AhX(ZfoCXˑ) */
 		,	m_lppDInputBuffer		(NULL)	/**< Oa͌덷obt@̃AhX(ZfoCXˑ) */
 		,	m_lppDOutputBuffer		(NULL)	/**< Oao͌덷obt@̃AhX(ZfoCXˑ) */
+		,	batchSize				(0)
+		,	maxBatchSize			(0)
+		,	onLearnMode				(false)
+		,	onFrozen				(false)
+		,	recomputeOutputBufferOffset	(0)
+		,	outputBufferElementCount	(0)
+		,	dInputBufferElementCount	(0)
 	{
 		for(U32 i=0; i<this->lppInputLayer.size(); i++)
 		{
 			this->lppInputLayer[i] = new LayerConnectInput(*this, i, i_lpInputDataStruct[i]);
+			this->lpInputLayerNo[this->lppInputLayer[i]->GetGUID()] = (S32)i;
 		}
+
+		// OtœKpX쐬
+		CreateDefaultGraphPass(this->lpGraphPass);
 	}
 	/** RXgN^ */
 	FeedforwardNeuralNetwork_Base::FeedforwardNeuralNetwork_Base(const Gravisbell::GUID& i_guid, class FeedforwardNeuralNetwork_LayerData_Base& i_layerData, const IODataStruct i_lpInputDataStruct[], U32 i_inputLayerCount, const IODataStruct& i_outputDataStruct, Gravisbell::Common::ITemporaryMemoryManager& i_temporaryMemoryManager)
@@ -88,11 +157,22 @@ namespace NeuralNetwork {
 		,	m_lppInputBuffer		(NULL)	/**< Oa̓obt@̃AhX(ZfoCXˑ) */
 		,	m_lppDInputBuffer		(NULL)	/**< Oa͌덷obt@̃AhX(ZfoCXˑ) */
 		,	m_lppDOutputBuffer		(NULL)	/**< Oao͌덷obt@̃AhX(ZfoCXˑ) */
+		,	batchSize				(0)
+		,	maxBatchSize			(0)
+		,	onLearnMode				(false)
+		,	onFrozen				(false)
+		,	recomputeOutputBufferOffset	(0)
+		,	outputBufferElementCount	(0)
+		,	dInputBufferElementCount	(0)
 	{
 		for(U32 i=0; i<this->lppInputLayer.size(); i++)
 		{
 			this->lppInputLayer[i] = new LayerConnectInput(*this, i, i_lpInputDataStruct[i]);
+			this->lpInputLayerNo[this->lppInputLayer[i]->GetGUID()] = (S32)i;
 		}
+
+		// OtœKpX쐬
+		CreateDefaultGraphPass(this->lpGraphPass);
 	}
 	/** fXgN^ */
 	FeedforwardNeuralNetwork_Base::~FeedforwardNeuralNetwork_Base()
@@ -130,6 +210,11 @@ namespace NeuralNetwork {
 		for(U32 i=0; i<this->lppInputLayer.size(); i++)
 			delete this->lppInputLayer[i];
 		this->lppInputLayer.clear();
+
+		// OtœKpX폜
+		for(auto& pass : this->lpGraphPass)
+			delete pass.pPass;
+		this->lpGraphPass.clear();
 	}
 
 
@@ -183,6 +268,7 @@ namespace NeuralNetwork {
 			// Ή
 			return ErrorCode::ERROR_CODE_ADDLAYER_NOT_COMPATIBLE;
 		}
+		this->lpLayerGUIDByNum.clear();
 
 		return ErrorCode::ERROR_CODE_NONE;
 	}
@@ -222,6 +308,9 @@ namespace NeuralNetwork {
 
 		if(it->second)
 		{
+			// ڑ̃C[͐ڑς邽߉ZOĎs
+			this->ResetPreProcessedFlag(it->second);
+
 			// ڑ
 			it->second->Disconnect();
 
@@ -231,6 +320,9 @@ namespace NeuralNetwork {
 		
 		// ̈폜
 		this->lpLayerInfo.erase(it);
+		this->lpLayerGUIDByNum.clear();
+		this->lpRecomputeLayerGUID.erase(i_guid);
+		this->ReleaseLayerOutputBuffer(i_guid);
 
 		return ErrorCode::ERROR_CODE_NONE;
 	}
@@ -244,6 +336,9 @@ namespace NeuralNetwork {
 				delete it->second;
 			it = this->lpLayerInfo.erase(it);
 		}
+		this->lpLayerGUIDByNum.clear();
+		this->lpRecomputeLayerGUID.clear();
+		this->lpPreProcessedLayerGUID.clear();
 
 		return ErrorCode::ERROR_CODE_NONE;
 	}
@@ -260,12 +355,16 @@ namespace NeuralNetwork {
 		if(i_layerNum >= this->lpLayerInfo.size())
 			return ErrorCode::ERROR_CODE_COMMON_OUT_OF_ARRAYRANGE;
 
-		// Ce[^i߂
-		auto it = this->lpLayerInfo.begin();
-		for(U32 i=0; i<i_layerNum; i++)
-			it++;
+		// C[̒ǉ/폜Aŏ̎擾ɔԍwp̈ꗗ쐬
+		if(this->lpLayerGUIDByNum.size() != this->lpLayerInfo.size())
+		{
+			this->lpLayerGUIDByNum.clear();
+			this->lpLayerGUIDByNum.reserve(this->lpLayerInfo.size());
+			for(auto& it : this->lpLayerInfo)
+				this->lpLayerGUIDByNum.push_back(it.first);
+		}
 
-		o_guid = it->first;
+		o_guid = this->lpLayerGUIDByNum[i_layerNum];
 
 		return ErrorCode::ERROR_CODE_NONE;
 	}
@@ -295,9 +394,11 @@ namespace NeuralNetwork {
 			return ErrorCode::ERROR_CODE_ADDLAYER_NOT_EXIST;
 
 		// ݂̏o̓C[폜
+		this->ResetPreProcessedFlag(&this->outputLayer);
 		this->outputLayer.Disconnect();
 
 		// w背C[o̓C[ɐڑ
+		this->lpPreProcessedLayerGUID.erase(i_guid);
 		return this->outputLayer.AddInputLayerToLayer(it_layer->second);
 	}
 
@@ -320,6 +421,8 @@ namespace NeuralNetwork {
 		{
 			if(postLayer == pInputLayer->GetGUID())
 			{
+				this->lpPreProcessedLayerGUID.erase(receiveLayer);
+				this->lpPreProcessedLayerGUID.erase(postLayer);
 				return it_receive->second->AddInputLayerToLayer(pInputLayer);
 			}
 		}
@@ -332,6 +435,8 @@ namespace NeuralNetwork {
 				return ErrorCode::ERROR_CODE_ADDLAYER_NOT_EXIST;
 
 			// ǉ
+			this->lpPreProcessedLayerGUID.erase(receiveLayer);
+			this->lpPreProcessedLayerGUID.erase(postLayer);
 			return it_receive->second->AddInputLayerToLayer(it_post->second);
 		}
 	}
@@ -350,6 +455,8 @@ namespace NeuralNetwork {
 		{
 			if(postLayer == pInputLayer->GetGUID())
 			{
+				this->lpPreProcessedLayerGUID.erase(receiveLayer);
+				this->lpPreProcessedLayerGUID.erase(postLayer);
 				return it_receive->second->AddBypassLayerToLayer(pInputLayer);
 			}
 		}
@@ -362,6 +469,8 @@ namespace NeuralNetwork {
 				return ErrorCode::ERROR_CODE_ADDLAYER_NOT_EXIST;
 
 			// ǉ
+			this->lpPreProcessedLayerGUID.erase(receiveLayer);
+			this->lpPreProcessedLayerGUID.erase(postLayer);
 			return it_receive->second->AddBypassLayerToLayer(it_post->second);
 		}
 	}
@@ -375,6 +484,8 @@ namespace NeuralNetwork {
 		if(it_layer == this->lpLayerInfo.end())
 			return ErrorCode::ERROR_CODE_COMMON_NOT_EXIST;
 
+		this->ResetPreProcessedFlag(it_layer->second);
+
 		return it_layer->second->ResetInputLayer();
 	}
 	/** C[̃oCpXC[ݒZbg.
@@ -385,6 +496,8 @@ namespace NeuralNetwork {
 		auto it_layer = this->lpLayerInfo.find(i_layerGUID);
 		if(it_layer == this->lpLayerInfo.end())
 			return ErrorCode::ERROR_CODE_COMMON_NOT_EXIST;
+
+		this->ResetPreProcessedFlag(it_layer->second);
 
 		return it_layer->second->ResetBypassLayer();
 	}
@@ -462,6 +575,34 @@ namespace NeuralNetwork {
 	ErrorCode FeedforwardNeuralNetwork_Base::CheckAllConnection(Gravisbell::GUID& o_errorLayer)
 	{
 		return ErrorCode::ERROR_CODE_NONE;
+	}
+
+	/** C[ƁA̓o͐̃C[ZO̍ĎsΏۂɂ.
+		ڑɉobt@C[邽߁AC[̐ڑOɎs. */
+	void FeedforwardNeuralNetwork_Base::ResetPreProcessedFlag(ILayerConnect* i_pLayer)
+	{
+		if(i_pLayer == NULL)
+			return;
+
+		this->lpPreProcessedLayerGUID.erase(i_pLayer->GetGUID());
+		for(U32 inputNum=0; inputNum<i_pLayer->GetInputLayerCount(); inputNum++)
+		{
+			ILayerConnect* pInputLayer = i_pLayer->GetInputLayerByNum(inputNum);
+			if(pInputLayer)
+				this->lpPreProcessedLayerGUID.erase(pInputLayer->GetGUID());
+		}
+		for(U32 inputNum=0; inputNum<i_pLayer->GetBypassLayerCount(); inputNum++)
+		{
+			ILayerConnect* pBypassLayer = i_pLayer->GetBypassLayerByNum(inputNum);
+			if(pBypassLayer)
+				this->lpPreProcessedLayerGUID.erase(pBypassLayer->GetGUID());
+		}
+		for(U32 outputNum=0; outputNum<i_pLayer->GetOutputToLayerCount(); outputNum++)
+		{
+			ILayerConnect* pOutputLayer = i_pLayer->GetOutputToLayerByNum(outputNum);
+			if(pOutputLayer)
+				this->lpPreProcessedLayerGUID.erase(pOutputLayer->GetGUID());
+		}
 	}
 
 
@@ -469,71 +610,95 @@ namespace NeuralNetwork {
 	//====================================
 	// ͌덷obt@֘A
 	//====================================
-	/** eC[gp͌덷obt@蓖Ă */
-	ErrorCode FeedforwardNeuralNetwork_Base::AllocateDInputBuffer(void)
+	/** eC[ɓ͌덷obt@ID蓖āAobt@Ƃ1Tv̗vf߂. obt@͊mۂȂ.
+		@param	o_lpBufferSize	1Tv̗vf̊i[. Y͓͌덷obt@ID */
+	void FeedforwardNeuralNetwork_Base::PlanDInputBuffer(std::vector<U32>& o_lpBufferSize)
 	{
-		std::map<U32, BufferInfo> lpDInputBufferInfo;	/**< ͌덷obt@̎gp<͌덷obt@ID, gp̃C[GUID>  */
+		std::vector<BufferInfo> lpDInputBufferInfo;	/**< ͌덷obt@̎gp. Y͓͌덷obt@ID */
+		std::set<U32> lpFreeDInputBufferID;			/**< gp̓͌덷obt@ID */
+		BufferUseLayerMap lpUseDInputBufferID;		/**< C[o͌덷ƂĎgp̓͌덷obt@ID */
 
 		auto it_layer = this->lpCalculateLayerList.rbegin();
 		while(it_layer != this->lpCalculateLayerList.rend())
 		{
+			// ZȗĂ郌C[͌덷`s킸A͌C[g̏o͌덷̂܂܎gp.
+			// ̂ߎg̓͌덷obt@͎Agp̓͌덷obt@͌C[Ɉp
+			if((*it_layer)->GetPassThroughFlag())
+			{
+				std::vector<U32> lpUseBufferID;
+				auto it_use = lpUseDInputBufferID.find((*it_layer)->GetGUID());
+				if(it_use != lpUseDInputBufferID.end())
+					lpUseBufferID = it_use->second;
+
+				for(U32 inputNum=0; inputNum<(*it_layer)->GetInputLayerCount(); inputNum++)
+				{
+					(*it_layer)->SetDInputBufferID(inputNum, INVALID_DINPUTBUFFER_ID);
+
+					auto pInputLayer = (*it_layer)->GetInputLayerByNum(inputNum);
+					if(pInputLayer == NULL)
+						continue;
+					for(auto bufferID : lpUseBufferID)
+						UseBuffer(bufferID, pInputLayer->GetGUID(), lpDInputBufferInfo, lpUseDInputBufferID);
+				}
+				ReleaseBuffer((*it_layer)->GetGUID(), lpDInputBufferInfo, lpUseDInputBufferID, lpFreeDInputBufferID);
+
+				it_layer++;
+				continue;
+			}
+
 			// ̓C[𑖍ē͌덷obt@ID蓖Ă
 			for(U32 inputNum=0; inputNum<(*it_layer)->GetInputLayerCount(); inputNum++)
 			{
 				auto pInputLayer = (*it_layer)->GetInputLayerByNum(inputNum);
-				if(this->GetInputLayerNoByGUID(pInputLayer->GetGUID()) >= 0)
+				if(pInputLayer == NULL)
+				{
+					// ͂蓖ĂĂȂ̂ł肦Ȃobt@IDݒ肷
+					(*it_layer)->SetDInputBufferID(inputNum, INVALID_DINPUTBUFFER_ID);
+				}
+				else if(this->GetInputLayerNoByGUID(pInputLayer->GetGUID()) >= 0)
 				{
 					// ̓C[
 					(*it_layer)->SetDInputBufferID(inputNum, (inputNum | NETWORK_DINPUTBUFFER_ID_FLAGBIT) );
 				}
-				else if(pInputLayer == NULL)
-				{
-					// ͂蓖ĂĂȂ̂ł肦Ȃobt@IDݒ肷
-					(*it_layer)->SetDInputBufferID(inputNum, INVALID_DINPUTBUFFER_ID);
-				}
 				else
 				{
 					// ʏ탌C[
 
-					// gp̓͌덷obt@
-					S32 useDInputBufferID = -1;
-					for(auto& it_DInputBuffer : lpDInputBufferInfo)
-					{
-						if(it_DInputBuffer.second.lpUseLayerID.size() == 0)
-						{
-							useDInputBufferID = (S32)it_DInputBuffer.first;
-							break;
-						}
-					}
-					if(useDInputBufferID < 0)
-						useDInputBufferID = (S32)lpDInputBufferInfo.size();
+					// gp̓͌덷obt@擾
+					U32 useDInputBufferID = ReserveFreeBuffer(lpDInputBufferInfo, lpFreeDInputBufferID);
 	
 					// ͌덷obt@gpɕύXAőobt@TCYXV
-					lpDInputBufferInfo[(U32)useDInputBufferID].lpUseLayerID.insert(pInputLayer->GetGUID());
-					lpDInputBufferInfo[(U32)useDInputBufferID].maxBufferSize = max(lpDInputBufferInfo[(U32)useDInputBufferID].maxBufferSize, pInputLayer->GetOutputDataStruct().GetDataCount());
+					UseBuffer(useDInputBufferID, pInputLayer->GetGUID(), lpDInputBufferInfo, lpUseDInputBufferID);
+					lpDInputBufferInfo[useDInputBufferID].maxBufferSize = max(lpDInputBufferInfo[useDInputBufferID].maxBufferSize, pInputLayer->GetOutputDataStruct().GetDataCount());
 	
 					// ͌덷obt@IDo^
-					(*it_layer)->SetDInputBufferID(inputNum, useDInputBufferID);
+					(*it_layer)->SetDInputBufferID(inputNum, (S32)useDInputBufferID);
 				}
 			}
 	
 			// o͌덷ƂĎgpĂ͌덷obt@J
-			for(auto& it_DInputBuffer : lpDInputBufferInfo)
-			{
-				if(it_DInputBuffer.second.lpUseLayerID.count((*it_layer)->GetGUID()) > 0)
-				{
-					it_DInputBuffer.second.lpUseLayerID.erase((*it_layer)->GetGUID());
-				}
-			}
+			ReleaseBuffer((*it_layer)->GetGUID(), lpDInputBufferInfo, lpUseDInputBufferID, lpFreeDInputBufferID);
 	
 			it_layer++;
 		}
 	
+		o_lpBufferSize.resize(lpDInputBufferInfo.size());
+		for(U32 dInputBufferNum=0; dInputBufferNum<lpDInputBufferInfo.size(); dInputBufferNum++)
+			o_lpBufferSize[dInputBufferNum] = lpDInputBufferInfo[dInputBufferNum].maxBufferSize;
+	}
+	/** eC[gp͌덷obt@蓖Ă */
+	ErrorCode FeedforwardNeuralNetwork_Base::AllocateDInputBuffer(void)
+	{
+		std::vector<U32> lpBufferSize;
+		this->PlanDInputBuffer(lpBufferSize);
+
 		// ͌덷obt@mۂ
-		this->SetDInputBufferCount((U32)lpDInputBufferInfo.size());
-		for(U32 dInputBufferNum=0; dInputBufferNum<lpDInputBufferInfo.size(); dInputBufferNum++)
+		this->SetDInputBufferCount((U32)lpBufferSize.size());
+		this->dInputBufferElementCount = 0;
+		for(U32 dInputBufferNum=0; dInputBufferNum<lpBufferSize.size(); dInputBufferNum++)
 		{
-			this->ResizeDInputBuffer(dInputBufferNum, lpDInputBufferInfo[dInputBufferNum].maxBufferSize * this->batchSize);
+			this->ResizeDInputBuffer(dInputBufferNum, lpBufferSize[dInputBufferNum] * this->batchSize);
+			this->dInputBufferElementCount += lpBufferSize[dInputBufferNum];
 		}
 
 		return ErrorCode::ERROR_CODE_NONE;
@@ -542,11 +707,79 @@ namespace NeuralNetwork {
 	//====================================
 	// o̓obt@֘A
 	//====================================
-	/** eC[gpo̓obt@蓖Ă */
-	ErrorCode FeedforwardNeuralNetwork_Base::AllocateOutputBuffer(void)
+	/** eC[ɏo̓obt@ID蓖āAobt@Ƃ1Tv̗vf߂. obt@͊mۂȂ.
+		wKp̏ꍇ͍ČvZԂ쐬AČvZp̃obt@recomputeOutputBufferOffsetȍ~ID蓖Ă.
+		@param	o_lpBufferSize	1Tv̗vf̊i[. Y͏o̓obt@ID
+		@param	o_elementCount	1Tv̗vf̍v̊i[. o͂ێ郌C[Ƃ̗vfƍČvZp̃obt@̗vf̍v */
+	void FeedforwardNeuralNetwork_Base::PlanOutputBuffer(std::vector<U32>& o_lpBufferSize, U32& o_elementCount)
 	{
-		std::map<U32, BufferInfo> lpOutputBufferInfo;	/**< o̓obt@̎gp<o̓obt@ID, gp̃C[GUID>  */
-
+		std::vector<BufferInfo> lpOutputBufferInfo;	/**< o̓obt@̎gp. Y͏o̓obt@ID */
+		std::set<U32> lpFreeOutputBufferID;			/**< gp̏o̓obt@ID */
+		BufferUseLayerMap lpUseOutputBufferID;		/**< C[͂ƂĎgp̏o̓obt@ID */
+		o_elementCount = 0;
+
+		// ČvZԂ쐬.
+		// ԓ̃C[݂̂ɏo͂郌C[͌덷`ɍČvZŏo͂𕜌ł邽߁Ao͂ێȂ.
+		// Ԃ̌덷`͋ԓ̏o͂SĕKvɂȂ邽߁AԂ̃C[m̓obt@LAʂ̋ԂƂ̂݋L.
+		std::map<Gravisbell::GUID, U32> lpRecomputeBufferNo;	/**< o͂ێȂC[̋ԓł̃obt@ԍ <C[GUID, ԓł̃obt@ԍ> */
+		std::vector<U32> lpRecomputeBufferSize;					/**< ԓł̃obt@ԍƂ̍őobt@TCY */
+		this->lpRecomputeSegmentBegin.clear();
+		if(this->onLearnMode)
+		{
+			auto it_begin = this->lpCalculateLayerList.end();
+			for(auto it_layer = this->lpCalculateLayerList.begin(); it_layer != this->lpCalculateLayerList.end(); it_layer++)
+			{
+				if(this->lpRecomputeLayerGUID.count((*it_layer)->GetGUID()) == 0)
+				{
+					it_begin = this->lpCalculateLayerList.end();
+					continue;
+				}
+				if(it_begin == this->lpCalculateLayerList.end())
+					it_begin = it_layer;
+
+				// Ԃ̍Ō̃C[mF
+				auto it_next = it_layer;
+				it_next++;
+				if(it_next != this->lpCalculateLayerList.end() && this->lpRecomputeLayerGUID.count((*it_next)->GetGUID()) > 0)
+					continue;
+
+				// ԓ̃C[
+				std::set<Gravisbell::GUID> lpSegmentLayerGUID;
+				for(auto it = it_begin; it != it_next; it++)
+					lpSegmentLayerGUID.insert((*it)->GetGUID());
+
+				// Ԃ̍Ō̃C[ȊOŁAԊOɏo͂ȂC[ɍČvZp̃obt@蓖Ă
+				U32 bufferNo = 0;
+				for(auto it = it_begin; it != it_layer; it++)
+				{
+					bool onOutputToOuterLayer = false;
+					for(U32 outputNum=0; outputNum<(*it)->GetOutputToLayerCount(); outputNum++)
+					{
+						if(lpSegmentLayerGUID.count((*it)->GetOutputToLayerByNum(outputNum)->GetGUID()) == 0)
+						{
+							onOutputToOuterLayer = true;
+							break;
+						}
+					}
+					if(onOutputToOuterLayer)
+						continue;
+
+					lpRecomputeBufferNo[(*it)->GetGUID()] = bufferNo;
+					if(bufferNo >= lpRecomputeBufferSize.size())
+						lpRecomputeBufferSize.push_back(0);
+					lpRecomputeBufferSize[bufferNo] = max(lpRecomputeBufferSize[bufferNo], (*it)->GetOutputDataStruct().GetDataCount());
+
+					bufferNo++;
+				}
+
+				// o͂ێȂC[ꍇ̂݁A덷`ɍČvZ
+				if(bufferNo > 0)
+					this->lpRecomputeSegmentBegin[(*it_layer)->GetGUID()] = it_begin;
+
+				it_begin = this->lpCalculateLayerList.end();
+			}
+		}
+
 		auto it_layer = this->lpCalculateLayerList.begin();
 		while(it_layer != this->lpCalculateLayerList.end())
 		{
@@ -561,25 +794,54 @@ namespace NeuralNetwork {
 			// o̓C[̏o̓obt@͒ÕC[̏o̓obt@𗬗p
 			if((*it_layer)->GetGUID() == this->outputLayer.GetGUID())
 			{
+				it_layer++;
+				continue;
+			}
+
+			// Zȗ郌C[͓͌C[̏o̓obt@g̏o͂Ƃ.
+			// g̏o͐惌C[gpI܂ŁA͌C[̏o̓obt@gp̂܂܂ɂ
+			if((*it_layer)->GetPassThroughFlag())
+			{
+				(*it_layer)->SetOutputBufferID(INVALID_OUTPUTBUFFER_ID);
+
+				auto it_use = lpUseOutputBufferID.find((*it_layer)->GetGUID());
+				if(it_use != lpUseOutputBufferID.end())
+				{
+					std::vector<U32> lpInputBufferID = it_use->second;
+					for(auto bufferID : lpInputBufferID)
+					{
+						for(U32 outputNum=0; outputNum<(*it_layer)->GetOutputToLayerCount(); outputNum++)
+							UseBuffer(bufferID, (*it_layer)->GetOutputToLayerByNum(outputNum)->GetGUID(), lpOutputBufferInfo, lpUseOutputBufferID);
+
+						// o͂ێ郌C[̏ꍇ́Ag̏o͂ƂȂ͌̃obt@ێ
+						if(this->lpPinnedOutputLayerGUID.count((*it_layer)->GetGUID()))
+							lpOutputBufferInfo[bufferID].onPinned = true;
+					}
+				}
+
+				// gpĂobt@J
+				ReleaseBuffer((*it_layer)->GetGUID(), lpOutputBufferInfo, lpUseOutputBufferID, lpFreeOutputBufferID);
+
+				it_layer++;
+				continue;
+			}
+
+			// o͂ێȂC[͍ČvZp̃obt@gp. ID͑Sobt@mɊ蓖Ă
+			if(lpRecomputeBufferNo.count((*it_layer)->GetGUID()))
+			{
+				// gpĂobt@J
+				ReleaseBuffer((*it_layer)->GetGUID(), lpOutputBufferInfo, lpUseOutputBufferID, lpFreeOutputBufferID);
+
 				it_layer++;
 				continue;
 			}
 
-			// gp̏o̓obt@
-			S32 useBufferID = -1;
-			for(auto& it_DInputBuffer : lpOutputBufferInfo)
-			{
-				if(it_DInputBuffer.second.lpUseLayerID.size() == 0)
-				{
-					useBufferID = (S32)it_DInputBuffer.first;
-					break;
-				}
-			}
-			if(useBufferID < 0)
-				useBufferID = (S32)lpOutputBufferInfo.size();
+			// gp̏o̓obt@擾
+			U32 useBufferID = ReserveFreeBuffer(lpOutputBufferInfo, lpFreeOutputBufferID);
 
 			// o̓obt@IDo^
-			(*it_layer)->SetOutputBufferID(useBufferID);
+			(*it_layer)->SetOutputBufferID((S32)useBufferID);
+			o_elementCount += (*it_layer)->GetOutputDataStruct().GetDataCount();
 
 			// o̓obt@̃TCYXV
 			lpOutputBufferInfo[useBufferID].maxBufferSize = max(lpOutputBufferInfo[useBufferID].maxBufferSize, (*it_layer)->GetOutputDataStruct().GetDataCount());
@@ -589,29 +851,59 @@ namespace NeuralNetwork {
 			{
 				auto pOutputLayer = (*it_layer)->GetOutputToLayerByNum(outputNum);
 
-				lpOutputBufferInfo[useBufferID].lpUseLayerID.insert(pOutputLayer->GetGUID());
+				UseBuffer(useBufferID, pOutputLayer->GetGUID(), lpOutputBufferInfo, lpUseOutputBufferID);
 			}
+			// o͂ێ郌C[̏ꍇ́Aȍ~̃C[Ƀobt@ėpȂ
+			if(this->lpPinnedOutputLayerGUID.count((*it_layer)->GetGUID()))
+				lpOutputBufferInfo[useBufferID].onPinned = true;
+			// o͐悪ꍇ͂ɍėpł
+			else if(lpOutputBufferInfo[useBufferID].lpUseLayerID.empty())
+				lpFreeOutputBufferID.insert(useBufferID);
 
 			// gpĂobt@J
-			for(auto& it_buffer : lpOutputBufferInfo)
-			{
-				if(it_buffer.second.lpUseLayerID.count((*it_layer)->GetGUID()) > 0)
-				{
-					it_buffer.second.lpUseLayerID.erase((*it_layer)->GetGUID());
-				}
-			}
+			ReleaseBuffer((*it_layer)->GetGUID(), lpOutputBufferInfo, lpUseOutputBufferID, lpFreeOutputBufferID);
 
 			it_layer++;
 		}
 
-		// o̓obt@mۂ
-		this->SetOutputBufferCount((U32)lpOutputBufferInfo.size());
+		// ČvZp̃obt@ID蓖Ă
+		this->recomputeOutputBufferOffset = (U32)lpOutputBufferInfo.size();
+		for(auto& it_layer : this->lpCalculateLayerList)
+		{
+			auto it_bufferNo = lpRecomputeBufferNo.find(it_layer->GetGUID());
+			if(it_bufferNo != lpRecomputeBufferNo.end())
+				it_layer->SetOutputBufferID(this->recomputeOutputBufferOffset + it_bufferNo->second);
+		}
+
+		o_lpBufferSize.resize(this->recomputeOutputBufferOffset + lpRecomputeBufferSize.size());
 		for(U32 outputBufferNum=0; outputBufferNum<lpOutputBufferInfo.size(); outputBufferNum++)
-		{
-			this->ResizeOutputBuffer(outputBufferNum, lpOutputBufferInfo[outputBufferNum].maxBufferSize * this->batchSize);
-		}
+			o_lpBufferSize[outputBufferNum] = lpOutputBufferInfo[outputBufferNum].maxBufferSize;
+		for(U32 bufferNo=0; bufferNo<lpRecomputeBufferSize.size(); bufferNo++)
+		{
+			o_lpBufferSize[this->recomputeOutputBufferOffset + bufferNo] = lpRecomputeBufferSize[bufferNo];
+			o_elementCount += lpRecomputeBufferSize[bufferNo];
+		}
+	}
+	/** eC[gpo̓obt@蓖Ă */
+	ErrorCode FeedforwardNeuralNetwork_Base::AllocateOutputBuffer(void)
+	{
+		std::vector<U32> lpBufferSize;
+		this->PlanOutputBuffer(lpBufferSize, this->outputBufferElementCount);
+
+		// o̓obt@mۂ
+		this->SetOutputBufferCount((U32)lpBufferSize.size());
+		for(U32 outputBufferNum=0; outputBufferNum<lpBufferSize.size(); outputBufferNum++)
+		{
+			this->ResizeOutputBuffer(outputBufferNum, lpBufferSize[outputBufferNum] * this->batchSize);
+		}
 
 		return ErrorCode::ERROR_CODE_NONE;
+	}
+
+	/** ČvZC[p̏o̓obt@mF. */
+	bool FeedforwardNeuralNetwork_Base::IsRecomputeOutputBuffer(U32 i_outputBufferNo)const
+	{
+		return i_outputBufferNo >= this->recomputeOutputBufferOffset;
 	}
 
 	//====================================
@@ -814,6 +1106,376 @@ namespace NeuralNetwork {
 	}
 
 
+	//====================================
+	// _p[h
+	//====================================
+	/** _p[hɐݒ肷.
+		C[f[^̃IveB}CU[A͌덷obt@.
+		ȍ~PreProcessLearn, CalculateDInput, Trainings. */
+	ErrorCode FeedforwardNeuralNetwork_Base::Freeze()
+	{
+		// IveB}CU[̓Ԃ
+		ErrorCode err = this->layerData.ChangeOptimizer(L"Frozen");
+		if(err != ErrorCode::ERROR_CODE_NONE)
+			return err;
+
+		this->onFrozen = true;
+		this->onLearnMode = false;
+		this->lpPreProcessedLayerGUID.clear();
+
+		// ͌덷obt@
+		this->dInputBufferElementCount = 0;
+		return this->SetDInputBufferCount(0);
+	}
+	/** _p[hmF */
+	bool FeedforwardNeuralNetwork_Base::IsFrozen()const
+	{
+		return this->onFrozen;
+	}
+
+
+	//====================================
+	// ČvZ(`FbN|Cg)
+	//====================================
+	/** C[ČvZΏۂɐݒ肷.
+		ݒPreProcessLearnĂяoۂɓKp.
+		@param	i_layerGUID		ݒΏۃC[GUID.
+		@param	i_onRecompute	truȅꍇČvZΏ. */
+	ErrorCode FeedforwardNeuralNetwork_Base::SetLayerRecomputeFlag(const Gravisbell::GUID& i_layerGUID, bool i_onRecompute)
+	{
+		if(this->lpLayerInfo.count(i_layerGUID) == 0)
+			return ErrorCode::ERROR_CODE_COMMON_NOT_EXIST;
+
+		// o͂̑փC[͏o̓obt@ȂߑΏۊO
+		if(this->GetInputLayerNoByGUID(i_layerGUID) >= 0 || i_layerGUID == this->outputLayer.GetGUID())
+			return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+
+		// ZʂČvZŕłȂC[͑ΏۊO
+		if(i_onRecompute && !this->lpLayerInfo[i_layerGUID]->CheckCanRecompute())
+			return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+
+		if(i_onRecompute)
+			this->lpRecomputeLayerGUID.insert(i_layerGUID);
+		else
+			this->lpRecomputeLayerGUID.erase(i_layerGUID);
+
+		return ErrorCode::ERROR_CODE_NONE;
+	}
+	/** C[ČvZΏۂmF */
+	bool FeedforwardNeuralNetwork_Base::GetLayerRecomputeFlag(const Gravisbell::GUID& i_layerGUID)const
+	{
+		return this->lpRecomputeLayerGUID.count(i_layerGUID) > 0;
+	}
+
+	/** ČvZԂ̍Ō̃C[̏ꍇAԓ̃C[̉ZĎsďo͂𕜌.
+		Ԃ̍Ō̃C[̏o͕͂ێĂ邽ߍČvZȂ.
+		@param	i_pLayer	덷`sC[. */
+	ErrorCode FeedforwardNeuralNetwork_Base::RecomputeSegment(ILayerConnect* i_pLayer)
+	{
+		auto it_segment = this->lpRecomputeSegmentBegin.find(i_pLayer->GetGUID());
+		if(it_segment == this->lpRecomputeSegmentBegin.end())
+			return ErrorCode::ERROR_CODE_NONE;
+
+		for(auto it = it_segment->second; *it != i_pLayer; it++)
+		{
+			ErrorCode err = (*it)->Calculate();
+			if(err != ErrorCode::ERROR_CODE_NONE)
+				return err;
+		}
+
+		return ErrorCode::ERROR_CODE_NONE;
+	}
+
+
+	//====================================
+	// gp
+	//====================================
+	/** gpʂ̏ob`TCY肵AZO(wKp)s.
+		@param	i_maxByteCount	gpʂ̏. oCgP.
+		@param	i_maxBatchSize	ob`TCY̏.
+		@param	o_batchSize		Iob`TCY̊i[. */
+	ErrorCode FeedforwardNeuralNetwork_Base::PreProcessLearnWithMemoryLimit(U64 i_maxByteCount, U32 i_maxBatchSize, U32& o_batchSize)
+	{
+		ErrorCode err = ErrorCode::ERROR_CODE_NONE;
+
+		// _p̏ꍇ͊wKłȂ
+		if(this->onFrozen)
+			return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+		if(i_maxBatchSize == 0)
+			return ErrorCode::ERROR_CODE_COMMON_OUT_OF_VALUERANGE;
+
+		// wKp̏쐬. obt@͌肵ob`TCYŉZOsۂɊmۂ
+		this->BeginPreProcess(this->maxBatchSize, true);
+		this->onLearnMode = true;
+
+		err = this->EstablishmentConnection();
+		if(err != ErrorCode::ERROR_CODE_NONE)
+			return err;
+
+		err = this->ApplyGraphPass();
+		if(err != ErrorCode::ERROR_CODE_NONE)
+			return err;
+
+		// ݒς݂̍ČvZΏۂŌς
+		std::set<Gravisbell::GUID> lpUserRecomputeLayerGUID = this->lpRecomputeLayerGUID;
+
+		U32 batchSize = 0;
+		err = this->CalculateMaxBatchSizeByMemoryLimit(i_maxByteCount, i_maxBatchSize, batchSize);
+		if(err != ErrorCode::ERROR_CODE_NONE)
+			return err;
+
+		// ɓ͂Ȃꍇ͍ČvZΏۂǉčēxς
+		if(batchSize < i_maxBatchSize)
+		{
+			this->CreateRecomputeSchedule(this->lpRecomputeLayerGUID);
+
+			U32 recomputeBatchSize = 0;
+			err = this->CalculateMaxBatchSizeByMemoryLimit(i_maxByteCount, i_maxBatchSize, recomputeBatchSize);
+			if(err != ErrorCode::ERROR_CODE_NONE)
+			{
+				this->lpRecomputeLayerGUID = lpUserRecomputeLayerGUID;
+				return err;
+			}
+
+			// ob`TCYgłȂꍇ͉Zʂ邾Ȃ̂ō̗pȂ
+			if(recomputeBatchSize > batchSize)
+				batchSize = recomputeBatchSize;
+			else
+				this->lpRecomputeLayerGUID = lpUserRecomputeLayerGUID;
+		}
+
+		if(batchSize == 0)
+			return ErrorCode::ERROR_CODE_COMMON_ALLOCATION_MEMORY;
+
+		// 肵ob`TCYŎOs
+		err = this->PreProcessLearn(batchSize);
+		if(err != ErrorCode::ERROR_CODE_NONE)
+			return err;
+
+		o_batchSize = batchSize;
+
+		return ErrorCode::ERROR_CODE_NONE;
+	}
+	/** ỎZOŊmۂobt@烁gpʂς.
+		@return	oCgP */
+	U64 FeedforwardNeuralNetwork_Base::GetEstimatedMemoryByteCount()const
+	{
+		U64 byteCount = 0;
+
+		// d݁AIveB}CU[
+		byteCount += this->layerData.GetUseBufferByteCount();
+
+		// o̓obt@A͌덷obt@
+		byteCount += (U64)(this->outputBufferElementCount + this->dInputBufferElementCount) * this->maxBatchSize * sizeof(F32);
+
+		// ꎞobt@
+		byteCount += this->temporaryMemoryManager.GetEstimatedByteCount();
+
+		return byteCount;
+	}
+
+	/** ݂̍ČvZΏۂŃgpʂ̏Ɏ܂ő̃ob`TCY߂.
+		obt@͊mۂAobt@̊蓖Čv悩烁gpʂ߂. wKp̏쐬ς݂ł邱.
+		@param	o_batchSize		ob`TCY̊i[. ob`TCY1ł𒴂ꍇ0. */
+	ErrorCode FeedforwardNeuralNetwork_Base::CalculateMaxBatchSizeByMemoryLimit(U64 i_maxByteCount, U32 i_maxBatchSize, U32& o_batchSize)
+	{
+		ErrorCode err = ErrorCode::ERROR_CODE_NONE;
+
+		// 1Tv̏o̓obt@A͌덷obt@̗vf߂
+		U32 elementCount = 0;
+
+		std::vector<U32> lpDInputBufferSize;
+		this->PlanDInputBuffer(lpDInputBufferSize);
+		for(auto bufferSize : lpDInputBufferSize)
+			elementCount += bufferSize;
+
+		std::vector<U32> lpOutputBufferSize;
+		U32 outputElementCount = 0;
+		this->PlanOutputBuffer(lpOutputBufferSize, outputElementCount);
+		elementCount += outputElementCount;
+
+		// ob`TCY1ł𒴂ꍇ͊wKłȂ
+		U64 byteCount = 0;
+		err = this->CalculatePlannedMemoryByteCount(1, elementCount, byteCount);
+		if(err != ErrorCode::ERROR_CODE_NONE)
+			return err;
+		if(byteCount > i_maxByteCount)
+		{
+			o_batchSize = 0;
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+
+		// gpʂ̓ob`TCYɑ΂ĒP邽߁AɎ܂ő̃ob`TCY񕪒T
+		U32 lowerBatchSize = 1;
+		U32 upperBatchSize = i_maxBatchSize;
+		while(lowerBatchSize < upperBatchSize)
+		{
+			U32 batchSize = lowerBatchSize + (upperBatchSize - lowerBatchSize + 1) / 2;
+
+			err = this->CalculatePlannedMemoryByteCount(batchSize, elementCount, byteCount);
+			if(err != ErrorCode::ERROR_CODE_NONE)
+				return err;
+
+			if(byteCount <= i_maxByteCount)
+				lowerBatchSize = batchSize;
+			else
+				upperBatchSize = batchSize - 1;
+		}
+
+		o_batchSize = lowerBatchSize;
+
+		return ErrorCode::ERROR_CODE_NONE;
+	}
+	/** ZO(wKp)sꍇ̃gpʂAobt@mۂɋ߂.
+		@param	i_batchSize		ob`TCY.
+		@param	i_elementCount	1Tv̏o̓obt@A͌덷obt@̗vf̍v.
+		@param	o_byteCount		gpʂ̊i[. oCgP. */
+	ErrorCode FeedforwardNeuralNetwork_Base::CalculatePlannedMemoryByteCount(U32 i_batchSize, U32 i_elementCount, U64& o_byteCount)const
+	{
+		o_byteCount = 0;
+
+		// d݁AIveB}CU[
+		o_byteCount += this->layerData.GetUseBufferByteCount();
+
+		// o̓obt@A͌덷obt@
+		o_byteCount += (U64)i_elementCount * i_batchSize * sizeof(F32);
+
+		// ꎞobt@.
+		// ςp̈ꎞobt@ǗNXɃTCŶ݂o^AC[Ԃł̋Llgpʂ߂
+		Gravisbell::Common::ITemporaryMemoryManager* pTemporaryMemoryManager = Gravisbell::Common::CreateTemporaryMemoryManagerCPU();
+		if(pTemporaryMemoryManager == NULL)
+			return ErrorCode::ERROR_CODE_COMMON_ALLOCATION_MEMORY;
+
+		ErrorCode err = this->RegisterPlannedTemporaryBuffer(*pTemporaryMemoryManager, i_batchSize);
+		if(err == ErrorCode::ERROR_CODE_NONE)
+			o_byteCount += pTemporaryMemoryManager->GetEstimatedByteCount();
+
+		delete pTemporaryMemoryManager;
+
+		// Z̒ԒlwKɍėpꍇ(CalculateAndTraining)́AeC[ZwK܂ŒԒl̃obt@ێ.
+		// SC[ɑ݂LȂ߁AC[Ƃɍv
+		o_byteCount += this->GetPlannedReuseIntermediateByteCount(i_batchSize);
+
+		return err;
+	}
+
+	/** ČvZ\ȃC[Ԋuŋ؂ČvZΏۂ쐬.
+		ČvZ\ȃC[NAꍇANƂɏo͂ێ郌C[c. */
+	void FeedforwardNeuralNetwork_Base::CreateRecomputeSchedule(std::set<Gravisbell::GUID>& o_lpLayerGUID)const
+	{
+		// ؂Ԋu肷
+		U32 recomputeLayerCount = 0;
+		for(auto& it_layer : this->lpCalculateLayerList)
+		{
+			if(it_layer->CheckCanRecompute())
+				recomputeLayerCount++;
+		}
+		U32 interval = 2;
+		while(interval * interval < recomputeLayerCount)
+			interval++;
+
+		// AČvZ\ȃC[̂AintervalƂ1C[̏o͂ێ
+		U32 layerNo = 0;
+		for(auto& it_layer : this->lpCalculateLayerList)
+		{
+			if(!it_layer->CheckCanRecompute())
+			{
+				layerNo = 0;
+				continue;
+			}
+
+			layerNo++;
+			if(layerNo % interval != 0)
+				o_lpLayerGUID.insert(it_layer->GetGUID());
+		}
+	}
+
+
+	//====================================
+	// OtœK
+	//====================================
+	/** OtœKpX̐擾 */
+	U32 FeedforwardNeuralNetwork_Base::GetGraphPassCount()const
+	{
+		return (U32)this->lpGraphPass.size();
+	}
+	/** OtœKpX̖O擾.
+		@param	i_passNum	pX̔ԍ.
+		@return	͈͊ȌꍇNULL */
+	const wchar_t* FeedforwardNeuralNetwork_Base::GetGraphPassName(U32 i_passNum)const
+	{
+		if(i_passNum >= this->lpGraphPass.size())
+			return NULL;
+
+		return this->lpGraphPass[i_passNum].pPass->GetName();
+	}
+	/** OtœKpX̗L/ݒ肷.
+		@param	i_passName	pX̖O.
+		@param	i_onEnable	truȅꍇL. */
+	ErrorCode FeedforwardNeuralNetwork_Base::SetGraphPassEnableFlag(const wchar_t i_passName[], bool i_onEnable)
+	{
+		if(i_passName == NULL)
+			return ErrorCode::ERROR_CODE_COMMON_NULL_REFERENCE;
+
+		for(auto& pass : this->lpGraphPass)
+		{
+			if(std::wstring(pass.pPass->GetName()) == i_passName)
+			{
+				pass.onEnable = i_onEnable;
+				return ErrorCode::ERROR_CODE_NONE;
+			}
+		}
+
+		return ErrorCode::ERROR_CODE_COMMON_NOT_EXIST;
+	}
+	/** ỎZOŃpXύXC[̐擾 */
+	U32 FeedforwardNeuralNetwork_Base::GetGraphPassChangeLayerCount(U32 i_passNum)const
+	{
+		if(i_passNum >= this->lpGraphPass.size())
+			return 0;
+
+		return (U32)this->lpGraphPass[i_passNum].lpChangeLayerGUID.size();
+	}
+	/** ỎZOŃpXύXC[GUIDԍwŎ擾 */
+	ErrorCode FeedforwardNeuralNetwork_Base::GetGraphPassChangeLayerGUID(U32 i_passNum, U32 i_layerNum, Gravisbell::GUID& o_layerGUID)const
+	{
+		if(i_passNum >= this->lpGraphPass.size())
+			return ErrorCode::ERROR_CODE_COMMON_OUT_OF_ARRAYRANGE;
+		if(i_layerNum >= this->lpGraphPass[i_passNum].lpChangeLayerGUID.size())
+			return ErrorCode::ERROR_CODE_COMMON_OUT_OF_ARRAYRANGE;
+
+		o_layerGUID = this->lpGraphPass[i_passNum].lpChangeLayerGUID[i_layerNum];
+
+		return ErrorCode::ERROR_CODE_NONE;
+	}
+
+	/** LȃOtœKpXo^ɓKp.
+		ỎZOł̍œKʂ͔j. */
+	ErrorCode FeedforwardNeuralNetwork_Base::ApplyGraphPass(void)
+	{
+		// O̍œKʂj.
+		// O͏ΏۂC[ɂ㏈Ă\邽߁ASC[ΏۂƂ
+		for(auto& it : this->lpLayerInfo)
+		{
+			it.second->SetPassThroughFlag(false);
+			it.second->SetEpilogueLayer(NULL);
+		}
+
+		for(auto& pass : this->lpGraphPass)
+		{
+			pass.lpChangeLayerGUID.clear();
+			if(!pass.onEnable)
+				continue;
+
+			ErrorCode err = pass.pPass->Apply(*this, this->lpCalculateLayerList, this->onLearnMode, pass.lpChangeLayerGUID);
+			if(err != ErrorCode::ERROR_CODE_NONE)
+				return err;
+		}
+
+		return ErrorCode::ERROR_CODE_NONE;
+	}
+
+
 
 	//===========================
 	// C[
@@ -849,6 +1511,96 @@ namespace NeuralNetwork {
 		return this->batchSize;
 	}
 
+	/** ZɎgpob`TCYύX.
+		ZOŎw肵ob`TCYȉł΁Aڑ̍Ċmobt@̍Ċmۂs킸ɕύXł.
+		Zp̎O(PreProcessCalculate)sĂꍇ̂ݗL.
+		@param batchSize	ɉZsob`̃TCY. 1`GetMaxBatchSize()̖߂l. */
+	ErrorCode FeedforwardNeuralNetwork_Base::SetBatchSize(U32 batchSize)
+	{
+		// wK̓ob`Ŝœv郌C[邽ߕύXłȂ
+		if(this->onLearnMode)
+			return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+		if(batchSize == 0 || batchSize > this->maxBatchSize)
+			return ErrorCode::ERROR_CODE_COMMON_OUT_OF_VALUERANGE;
+		if(batchSize == this->batchSize)
+			return ErrorCode::ERROR_CODE_NONE;
+
+		// eC[̃ob`TCYύX
+		auto it = this->lpCalculateLayerList.begin();
+		while(it != this->lpCalculateLayerList.end())
+		{
+			ErrorCode err = (*it)->SetBatchSize(batchSize);
+			if(err != ErrorCode::ERROR_CODE_NONE)
+			{
+				// ύXς݂̃C[ɖ߂
+				for(auto itPrev = this->lpCalculateLayerList.begin(); itPrev != it; itPrev++)
+					(*itPrev)->SetBatchSize(this->batchSize);
+				return err;
+			}
+
+			it++;
+		}
+
+		this->batchSize = batchSize;
+
+		return ErrorCode::ERROR_CODE_NONE;
+	}
+	/** őob`TCY擾.
+		@return ZOŎw肵ob`̃TCY */
+	U32 FeedforwardNeuralNetwork_Base::GetMaxBatchSize()const
+	{
+		return this->maxBatchSize;
+	}
+
+	/** ZʂČvZŕł邩mF.
+		̑SC[ČvZ\ȏꍇ̂true. */
+	bool FeedforwardNeuralNetwork_Base::CheckCanRecompute()const
+	{
+		for(auto& it_layer : this->lpLayerInfo)
+		{
+			if(!it_layer.second->CheckCanRecompute())
+				return false;
+		}
+
+		return true;
+	}
+	/** ZO(wKp)œo^ꎞobt@̃TCYAobt@mۂɓo^.
+		̑SC[̈ꎞobt@o^. */
+	ErrorCode FeedforwardNeuralNetwork_Base::RegisterPlannedTemporaryBuffer(Gravisbell::Common::ITemporaryMemoryManager& o_temporaryMemoryManager, U32 i_batchSize)const
+	{
+		for(auto& it_layer : this->lpLayerInfo)
+		{
+			ErrorCode err = it_layer.second->RegisterPlannedTemporaryBuffer(o_temporaryMemoryManager, i_batchSize);
+			if(err != ErrorCode::ERROR_CODE_NONE)
+				return err;
+		}
+
+		return ErrorCode::ERROR_CODE_NONE;
+	}
+	/** Z̒ԒlwKɍėpꍇɁAZwK܂ŕێꎞobt@̃TCY߂.
+		ZSC[̍v. */
+	U64 FeedforwardNeuralNetwork_Base::GetPlannedReuseIntermediateByteCount(U32 i_batchSize)const
+	{
+		U64 byteCount = 0;
+		for(auto& it_layer : this->lpCalculateLayerList)
+		{
+			// Zȗ郌C[͒ԒlȂ
+			if(it_layer->GetPassThroughFlag())
+				continue;
+
+			byteCount += it_layer->GetPlannedReuseIntermediateByteCount(i_batchSize);
+		}
+
+		return byteCount;
+	}
+	/** Z̒ԒlwKɍėp邩ݒ肷.
+		̑SC[ɐݒ肷. */
+	void FeedforwardNeuralNetwork_Base::SetReuseIntermediateFlag(bool i_onReuse)
+	{
+		for(auto& it_layer : this->lpCalculateLayerList)
+			it_layer->SetReuseIntermediateFlag(i_onReuse);
+	}
+
 	/** ꎞobt@ǗNX擾 */
 	Common::ITemporaryMemoryManager& FeedforwardNeuralNetwork_Base::GetTemporaryMemoryManager()
 	{
@@ -895,15 +1647,11 @@ namespace NeuralNetwork {
 		@return	̓C[ł͂Ȃꍇ-1,̓C[łꍇ͔ԍ0ȏŕԂ */
 	S32 FeedforwardNeuralNetwork_Base::GetInputLayerNoByGUID(const Gravisbell::GUID& i_guid)const
 	{
-		for(S32 no=0; no<this->lppInputLayer.size(); no++)
-		{
-			if(this->lppInputLayer[no])
-			{
-				if(this->lppInputLayer[no]->GetGUID() == i_guid)
-					return no;
-			}
-		}
-		return -1;
+		auto it = this->lpInputLayerNo.find(i_guid);
+		if(it == this->lpInputLayerNo.end())
+			return -1;
+
+		return it->second;
 	}
 
 	/** ̓f[^\擾.
@@ -961,62 +1709,61 @@ namespace NeuralNetwork {
 		// ڑXgNA
 		this->lpCalculateLayerList.clear();
 
-		// C[GUIDXg𐶐
-		std::set<Gravisbell::GUID> lpLayerGUID;	// SC[Xg
-		err = this->outputLayer.CreateLayerList(lpLayerGUID);
-		if(err != ErrorCode::ERROR_CODE_NONE)
-			return err;
-
-		// Xg̍쐬
-		std::set<Gravisbell::GUID> lpAddedList;	// ǉσC[Xg
-		std::set<ILayerConnect*> lpAddWaitList;	// ǉҋ@ԃXg
-		// ŏ1ڂs
-		err = this->outputLayer.CreateCalculateList(lpLayerGUID, lpCalculateLayerList, lpAddedList, lpAddWaitList);
-		if(err != ErrorCode::ERROR_CODE_NONE)
-			return err;
-		// ҋ@Ԃ̃C[s
-		while(lpAddWaitList.size())
-		{
-			bool onAddElse = false;	// ȏ̃C[ǉ邱Ƃł
-			for(auto it : lpAddWaitList)
-			{
-				bool onHaveNonAddedOutputLayer = false;	// ǉςłȂC[o͑ΏۂɕێĂtO
-				for(U32 outputLayerNum=0; outputLayerNum<it->GetOutputToLayerCount(); outputLayerNum++)
+		// o̓C[͕ɒH郌C[񋓂AeC[̏o͐̐𐔂.
+		// o̓C[HȂo͉͐ZȂߐȂ
+		std::unordered_map<ILayerConnect*, U32> lpRemainOutputCount;	/**< ZXgɖǉ̏o͐̐ <C[, o͐̐> */
+		{
+			std::vector<ILayerConnect*> lpSearchLayer(1, &this->outputLayer);
+			lpRemainOutputCount[&this->outputLayer] = 0;
+			while(!lpSearchLayer.empty())
+			{
+				ILayerConnect* pLayer = lpSearchLayer.back();
+				lpSearchLayer.pop_back();
+
+				for(U32 inputNum=0; inputNum<pLayer->GetInputLayerCount(); inputNum++)
 				{
-					auto pOutputToLayer = it->GetOutputToLayerByNum(outputLayerNum);
-
-					// C[ꗗɊ܂܂Ă邱ƂmF
-					if(lpLayerGUID.count(pOutputToLayer->GetGUID()) == 0)
+					ILayerConnect* pInputLayer = pLayer->GetInputLayerByNum(inputNum);
+					if(pInputLayer == NULL)
 						continue;
 
-					// ǉҋ@ԂɊ܂܂ĂȂƂmF
-					if(lpAddWaitList.count(pOutputToLayer) == 0)
+					auto it_count = lpRemainOutputCount.insert(std::make_pair(pInputLayer, (U32)0));
+					it_count.first->second++;
+					if(it_count.second)
+						lpSearchLayer.push_back(pInputLayer);
+				}
+			}
+		}
+
+		// Xg̍쐬.
+		// o͐悪SĉZXgɒǉꂽC[AZXg̐擪ɒǉĂ
+		{
+			std::vector<ILayerConnect*> lpAddableLayer(1, &this->outputLayer);
+			while(!lpAddableLayer.empty())
+			{
+				ILayerConnect* pLayer = lpAddableLayer.back();
+				lpAddableLayer.pop_back();
+
+				// 擪ɒǉ
+				this->lpCalculateLayerList.push_front(pLayer);
+
+				// ͌C[̖ǉ̏o͐炷. ŏ̓͌珈邽ߋtɐς
+				for(U32 inputNum=pLayer->GetInputLayerCount(); inputNum>0; inputNum--)
+				{
+					ILayerConnect* pInputLayer = pLayer->GetInputLayerByNum(inputNum-1);
+					if(pInputLayer == NULL)
 						continue;
 
-					onHaveNonAddedOutputLayer = true;
-					break;
-				}
-
-				if(onHaveNonAddedOutputLayer == false)
-				{
-					// ǉҋ@ԂɊ܂܂Ăo̓C[݂Ȃ߁AZXgɒǉ\
-
-					// ǉҋ@
-					lpAddWaitList.erase(it);
-
-					// ZXgɒǉ
-					it->CreateCalculateList(lpLayerGUID, this->lpCalculateLayerList, lpAddedList, lpAddWaitList);
-
-					onAddElse = true;
-					break;
+					U32& remainOutputCount = lpRemainOutputCount[pInputLayer];
+					remainOutputCount--;
+					if(remainOutputCount == 0)
+						lpAddableLayer.push_back(pInputLayer);
 				}
 			}
-
-			if(!onAddElse)
-			{
-				// ꂩ̃C[ǉ邱ƂłȂ = ċNɂȂĂ邽߁AG[
-				return ERROR_CODE_COMMON_NOT_COMPATIBLE;
-			}
+		}
+		if(this->lpCalculateLayerList.size() != lpRemainOutputCount.size())
+		{
+			// ꂩ̃C[ǉ邱ƂłȂ = ċNɂȂĂ邽߁AG[
+			return ERROR_CODE_COMMON_NOT_COMPATIBLE;
 		}
 
 
@@ -1032,22 +1779,54 @@ namespace NeuralNetwork {
 		return ErrorCode::ERROR_CODE_NONE;
 	}
 
+	/** ZO̊JnɁAỎZǑʂėpł邩𔻒肷.
+		őob`TCYςꍇ̓C[Ƃ̏o̓obt@ASC[ĎsΏۂɂ.
+		ʂςꍇ͑SC[ĎsΏۂɂ. */
+	void FeedforwardNeuralNetwork_Base::BeginPreProcess(U32 batchSize, bool i_onLearnMode)
+	{
+		if(batchSize != this->maxBatchSize)
+		{
+			for(auto& it : this->lpLayerInfo)
+				this->ReleaseLayerOutputBuffer(it.first);
+			this->lpPreProcessedLayerGUID.clear();
+		}
+		else if(i_onLearnMode != this->onLearnMode)
+		{
+			this->lpPreProcessedLayerGUID.clear();
+		}
+	}
+
 	/** ZOs.(wKp)
 		@param batchSize	ɉZsob`̃TCY.
 		NN쐬AZsOɈxKs邱ƁBf[^ƂɎsKv͂Ȃ.
+		C[̒ǉ/폜Aڑ̕ύXɍēxsꍇAύX̉e󂯂C[̂݉ZOĎs.
 		sꍇPreProcessLearnLoopȍ~͎̏ss. */
 	ErrorCode FeedforwardNeuralNetwork_Base::PreProcessLearn(U32 batchSize)
 	{
 		ErrorCode err = ErrorCode::ERROR_CODE_NONE;
 
+		// _p̏ꍇ͊wKłȂ
+		if(this->onFrozen)
+			return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+
+		// ỎZǑʂėpł邩肷
+		this->BeginPreProcess(batchSize, true);
+
 		// ob`TCYi[
 		this->batchSize = batchSize;
+		this->maxBatchSize = batchSize;
+		this->onLearnMode = true;
 
 		// ڑ̊ms
 		err = this->EstablishmentConnection();
 		if(err != ErrorCode::ERROR_CODE_NONE)
 			return err;
 
+		// OtœKs
+		err = this->ApplyGraphPass();
+		if(err != ErrorCode::ERROR_CODE_NONE)
+			return err;
+
 
 		// C[gp͌덷obt@蓖Ă
 		err = this->AllocateDInputBuffer();
@@ -1060,13 +1839,18 @@ namespace NeuralNetwork {
 			return err;
 
 
-		// wK̎Os
+		// wK̎Os. sς݂̃C[͑Ǒʂėp
 		auto it = this->lpCalculateLayerList.begin();
 		while(it != this->lpCalculateLayerList.end())
 		{
-			err = (*it)->PreProcessLearn(batchSize);
-			if(err != ErrorCode::ERROR_CODE_NONE)
-				return err;
+			if(this->lpPreProcessedLayerGUID.count((*it)->GetGUID()) == 0)
+			{
+				err = (*it)->PreProcessLearn(batchSize);
+				if(err != ErrorCode::ERROR_CODE_NONE)
+					return err;
+
+				this->lpPreProcessedLayerGUID.insert((*it)->GetGUID());
+			}
 
 			it++;
 		}
@@ -1076,18 +1860,35 @@ namespace NeuralNetwork {
 	/** ZOs.(Zp)
 		@param batchSize	ɉZsob`̃TCY.
 		NN쐬AZsOɈxKs邱ƁBf[^ƂɎsKv͂Ȃ.
+		C[̒ǉ/폜Aڑ̕ύXɍēxsꍇAύX̉e󂯂C[̂݉ZOĎs.
 		sꍇCalculateȍ~͎̏ss. */
 	ErrorCode FeedforwardNeuralNetwork_Base::PreProcessCalculate(unsigned int batchSize)
 	{
 		ErrorCode err = ErrorCode::ERROR_CODE_NONE;
+
+		// ỎZǑʂėpł邩肷
+		this->BeginPreProcess(batchSize, false);
 
 		// ob`TCYi[
 		this->batchSize = batchSize;
+		this->maxBatchSize = batchSize;
+		this->onLearnMode = false;
 
 		// ڑ̊ms
 		err = this->EstablishmentConnection();
+		if(err != ErrorCode::ERROR_CODE_NONE)
+			return err;
+
+		// OtœKs
+		err = this->ApplyGraphPass();
+		if(err != ErrorCode::ERROR_CODE_NONE)
+			return err;
+
+		// ȑOɊwKp̎OsĂꍇɔē͌덷obt@
+		err = this->SetDInputBufferCount(0);
 		if(err != ErrorCode::ERROR_CODE_NONE)
 			return err;
+		this->dInputBufferElementCount = 0;
 
 		// C[gpo̓obt@蓖Ă
 		err = this->AllocateOutputBuffer();
@@ -1095,13 +1896,18 @@ namespace NeuralNetwork {
 			return err;
 
 
-		// Z̎Os
+		// Z̎Os. sς݂̃C[͑Ǒʂėp
 		auto it = this->lpCalculateLayerList.begin();
 		while(it != this->lpCalculateLayerList.end())
 		{
-			ErrorCode err = (*it)->PreProcessCalculate(batchSize);
-			if(err != ErrorCode::ERROR_CODE_NONE)
-				return err;
+			if(this->lpPreProcessedLayerGUID.count((*it)->GetGUID()) == 0)
+			{
+				ErrorCode err = (*it)->PreProcessCalculate(batchSize);
+				if(err != ErrorCode::ERROR_CODE_NONE)
+					return err;
+
+				this->lpPreProcessedLayerGUID.insert((*it)->GetGUID());
+			}
 
 			it++;
 		}
@@ -1121,8 +1927,42 @@ namespace NeuralNetwork {
 				return err;
 
 			it++;
+		}
+
+		// sݒ̕ύXŉZȗł郌C[ςꍇ́Ao̓obt@蓖Ē
+		if(!this->onLearnMode)
+		{
+			std::vector<ILayerConnect*> lpPrevPassThroughLayer;
+			for(auto pLayer : this->lpCalculateLayerList)
+			{
+				if(pLayer->GetPassThroughFlag())
+					lpPrevPassThroughLayer.push_back(pLayer);
+			}
+
+			ErrorCode err = this->ApplyGraphPass();
+			if(err != ErrorCode::ERROR_CODE_NONE)
+				return err;
+
+			std::vector<ILayerConnect*> lpPassThroughLayer;
+			for(auto pLayer : this->lpCalculateLayerList)
+			{
+				if(pLayer->GetPassThroughFlag())
+					lpPassThroughLayer.push_back(pLayer);
+			}
+
+			if(lpPassThroughLayer != lpPrevPassThroughLayer)
+			{
+				err = this->AllocateOutputBuffer();
+				if(err != ErrorCode::ERROR_CODE_NONE)
+					return err;
+			}
 		}
 
+		// ŏ̉Z(wK)ňꎞobt@̎L^AsɊÂċL̈̔zu肷.
+		// lbg[N͏ʂ̃lbg[Nƈꎞobt@L邽߁AL҂݂̂L^𐧌䂷
+		if(this->pLocalTemporaryMemoryManager != NULL)
+			this->temporaryMemoryManager.BeginLifetimeRecord();
+
 		return ErrorCode::ERROR_CODE_NONE;
 	}
 
@@ -1135,18 +1975,131 @@ namespace NeuralNetwork {
 		this->m_lppInputBuffer = i_lppInputBuffer;
 
 		// Zs
+		U32 remainTargetCount = (U32)this->lpPartialCalculateTarget.size();
 		auto it = this->lpCalculateLayerList.begin();
 		while(it != this->lpCalculateLayerList.end())
 		{
+			// Z͗vꂽC[̌vZɕKvȃC[̂݉Z
+			if(!this->lpPartialCalculateLayer.empty() && this->lpPartialCalculateLayer.count(*it) == 0)
+			{
+				it++;
+				continue;
+			}
+
 			ErrorCode err = (*it)->Calculate();
 			if(err != ErrorCode::ERROR_CODE_NONE)
 				return err;
+
+			// vꂽC[SĉZꍇ͈ȍ~̃C[ZȂ
+			if(this->lpPartialCalculateTarget.count(*it) > 0)
+			{
+				remainTargetCount--;
+				if(remainTargetCount == 0)
+					break;
+			}
 
 			it++;
 		}
 
 		// ̓obt@J
 		this->m_lppInputBuffer = NULL;
+
+		// ꎞobt@̎̋L^I. wK͌덷̋t`d܂łL^
+		if(this->pLocalTemporaryMemoryManager != NULL && !this->onLearnMode && this->lpPartialCalculateLayer.empty())
+			this->temporaryMemoryManager.EndLifetimeRecord();
+
+		return ErrorCode::ERROR_CODE_NONE;
+	}
+
+	/** w肵C[̏o͂vZ.
+		w背C[̑ĉ݂ZAeC[̏o̓obt@̃AhXԂ.
+		@param	i_lppInputBuffer	̓f[^obt@.
+		@param	i_lpLayerGUID		o͂擾郌C[GUIDz.
+		@param	i_layerCount		o͂擾郌C[.
+		@param	o_lppOutputBuffer	eC[̏o̓obt@̃AhXi[. */
+	ErrorCode FeedforwardNeuralNetwork_Base::CalculateLayerOutput(CONST_BATCH_BUFFER_POINTER i_lppInputBuffer[], const Gravisbell::GUID i_lpLayerGUID[], U32 i_layerCount, CONST_BATCH_BUFFER_POINTER o_lppOutputBuffer[])
+	{
+		if(i_lpLayerGUID == NULL || o_lppOutputBuffer == NULL)
+			return ErrorCode::ERROR_CODE_COMMON_NULL_REFERENCE;
+		if(i_layerCount == 0)
+			return ErrorCode::ERROR_CODE_NONE;
+
+		// vꂽC[擾
+		std::vector<ILayerConnect*> lpTargetLayer(i_layerCount);
+		for(U32 layerNum=0; layerNum<i_layerCount; layerNum++)
+		{
+			auto it_layer = this->lpLayerInfo.find(i_lpLayerGUID[layerNum]);
+			if(it_layer == this->lpLayerInfo.end())
+				return ErrorCode::ERROR_CODE_COMMON_NOT_EXIST;
+
+			// ČvZΏۂ̃C[͏o̓obt@ԊÕC[ƋL邽߁AZɏo͂cȂ
+			if(this->onLearnMode && this->lpRecomputeLayerGUID.count(i_lpLayerGUID[layerNum]) > 0)
+				return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+			// ㏈𓝍C[͏o̓obt@Ɍ㏈Kp̒li[邽߁Ag̏o͂cȂ
+			if(it_layer->second->GetEpilogueLayer() != NULL)
+				return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+
+			lpTargetLayer[layerNum] = it_layer->second;
+		}
+
+		// vꂽC[̑c񋓂
+		std::vector<ILayerConnect*> lpSearchLayer = lpTargetLayer;
+		while(!lpSearchLayer.empty())
+		{
+			ILayerConnect* pLayer = lpSearchLayer.back();
+			lpSearchLayer.pop_back();
+
+			if(!this->lpPartialCalculateLayer.insert(pLayer).second)
+				continue;
+
+			// ͂蓖ĂĂȂꍇNULL̂ߒHȂ
+			for(U32 inputNum=0; inputNum<pLayer->GetInputLayerCount(); inputNum++)
+			{
+				ILayerConnect* pInputLayer = pLayer->GetInputLayerByNum(inputNum);
+				if(pInputLayer)
+					lpSearchLayer.push_back(pInputLayer);
+			}
+			for(U32 inputNum=0; inputNum<pLayer->GetBypassLayerCount(); inputNum++)
+			{
+				ILayerConnect* pBypassLayer = pLayer->GetBypassLayerByNum(inputNum);
+				if(pBypassLayer)
+					lpSearchLayer.push_back(pBypassLayer);
+			}
+		}
+		this->lpPartialCalculateTarget.insert(lpTargetLayer.begin(), lpTargetLayer.end());
+
+		// ̃C[vꂽꍇAɉZC[̏o̓obt@㑱̕ʂ̃C[̑c悪ėpď㏑\.
+		// vꂽC[̏o̓obt@LȂ悤Ɋ蓖Ē. gݍ킹ŌJԂĂяoꍇ͊蓖ĒȂ.
+		// 1C[݂̂̏ꍇ͗vꂽC[̉Zőł؂邽ߏ㏑Ȃ
+		if(i_layerCount > 1)
+		{
+			std::set<Gravisbell::GUID> lpPinnedOutputLayerGUID(i_lpLayerGUID, i_lpLayerGUID + i_layerCount);
+			if(lpPinnedOutputLayerGUID != this->lpPinnedOutputLayerGUID)
+			{
+				this->lpPinnedOutputLayerGUID.swap(lpPinnedOutputLayerGUID);
+
+				ErrorCode err = this->AllocateOutputBuffer();
+				if(err != ErrorCode::ERROR_CODE_NONE)
+				{
+					this->lpPartialCalculateLayer.clear();
+					this->lpPartialCalculateTarget.clear();
+					return err;
+				}
+			}
+		}
+
+		// Zs. ̓obt@̓]͏foCXƂCalculateōs
+		ErrorCode err = this->Calculate(i_lppInputBuffer);
+
+		this->lpPartialCalculateLayer.clear();
+		this->lpPartialCalculateTarget.clear();
+
+		if(err != ErrorCode::ERROR_CODE_NONE)
+			return err;
+
+		// o̓obt@̃AhX擾
+		for(U32 layerNum=0; layerNum<i_layerCount; layerNum++)
+			o_lppOutputBuffer[layerNum] = lpTargetLayer[layerNum]->GetOutputBuffer_d();
 
 		return ErrorCode::ERROR_CODE_NONE;
 	}
@@ -1162,6 +2115,10 @@ namespace NeuralNetwork {
 		ǑvZʂgp */
 	ErrorCode FeedforwardNeuralNetwork_Base::CalculateDInput_device(CONST_BATCH_BUFFER_POINTER* i_lppInputBuffer, BATCH_BUFFER_POINTER* o_lppDInputBuffer, CONST_BATCH_BUFFER_POINTER i_lppOutputBuffer, CONST_BATCH_BUFFER_POINTER i_lppDOutputBuffer)
 	{
+		// wKp̎OsĂȂꍇ͊wKpobt@
+		if(!this->onLearnMode)
+			return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+
 		// ̓obt@ۑ
 		this->m_lppInputBuffer = i_lppInputBuffer;
 
@@ -1174,7 +2131,11 @@ namespace NeuralNetwork {
 			auto it = this->lpCalculateLayerList.rbegin();
 			while(it != this->lpCalculateLayerList.rend())
 			{
-				ErrorCode err = (*it)->CalculateDInput();
+				ErrorCode err = this->RecomputeSegment(*it);
+				if(err != ErrorCode::ERROR_CODE_NONE)
+					return err;
+
+				err = (*it)->CalculateDInput();
 				if(err != ErrorCode::ERROR_CODE_NONE)
 					return err;
 
@@ -1189,6 +2150,10 @@ namespace NeuralNetwork {
 		// ̓obt@J
 		this->m_lppInputBuffer = NULL;
 
+		// ꎞobt@̎̋L^I
+		if(this->pLocalTemporaryMemoryManager != NULL)
+			this->temporaryMemoryManager.EndLifetimeRecord();
+
 		return ErrorCode::ERROR_CODE_NONE;
 	}
 
@@ -1198,6 +2163,10 @@ namespace NeuralNetwork {
 		ǑvZʂgp */
 	ErrorCode FeedforwardNeuralNetwork_Base::Training_device(CONST_BATCH_BUFFER_POINTER* i_lppInputBuffer, BATCH_BUFFER_POINTER* o_lppDInputBuffer, CONST_BATCH_BUFFER_POINTER i_lppOutputBuffer, CONST_BATCH_BUFFER_POINTER i_lppDOutputBuffer)
 	{
+		// wKp̎OsĂȂꍇ͊wKpobt@
+		if(!this->onLearnMode)
+			return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+
 		// ̓obt@ۑ
 		this->m_lppInputBuffer = i_lppInputBuffer;
 
@@ -1210,7 +2179,11 @@ namespace NeuralNetwork {
 			auto it = this->lpCalculateLayerList.rbegin();
 			while(it != this->lpCalculateLayerList.rend())
 			{
-				ErrorCode err = (*it)->Training();
+				ErrorCode err = this->RecomputeSegment(*it);
+				if(err != ErrorCode::ERROR_CODE_NONE)
+					return err;
+
+				err = (*it)->Training();
 				if(err != ErrorCode::ERROR_CODE_NONE)
 					return err;
 
@@ -1218,6 +2191,14 @@ namespace NeuralNetwork {
 			}
 		}
 
+		// xC[̍XVꊇŔf.
+		// ̃lbg[N͎g̊wK̍Ōɔfς݂̂߁AΏۂɊ܂܂Ȃ
+		{
+			ErrorCode err = this->layerData.UpdatePendingParameter();
+			if(err != ErrorCode::ERROR_CODE_NONE)
+				return err;
+		}
+
 		// /o͌덷obt@
 		this->m_lppDInputBuffer  = NULL;
 		this->m_lppDOutputBuffer = NULL;
@@ -1225,9 +2206,46 @@ namespace NeuralNetwork {
 		// ̓obt@J
 		this->m_lppInputBuffer = NULL;
 
+		// ꎞobt@̎̋L^I
+		if(this->pLocalTemporaryMemoryManager != NULL)
+			this->temporaryMemoryManager.EndLifetimeRecord();
+
 		return ErrorCode::ERROR_CODE_NONE;
 	}
 
+	/** ZƊwKAĎs.
+		Z͊eC[̒Ԓl̍ėpLɂ.
+		@param	i_lppInputBuffer		̓f[^obt@.
+		@param	o_lppDInputBuffer		͌덷i[. NULL̏ꍇ͏o͂Ȃ.
+		@param	i_calculateDOutputFunc	Zʂo͌덷vZ֐.
+		@param	i_pUserData				i_calculateDOutputFuncɓnCӂ̃f[^. */
+	ErrorCode FeedforwardNeuralNetwork_Base::CalculateAndTraining(CONST_BATCH_BUFFER_POINTER i_lppInputBuffer[], BATCH_BUFFER_POINTER o_lppDInputBuffer[], CalculateDOutputFunc i_calculateDOutputFunc, void* i_pUserData)
+	{
+		// wKp̎OsĂȂꍇ͊wKłȂ
+		if(!this->onLearnMode)
+			return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+		if(i_calculateDOutputFunc == NULL)
+			return ErrorCode::ERROR_CODE_COMMON_NULL_REFERENCE;
+
+		// ZƊwKob`ŘA邽߁AZ̒ԒlwKɍėp
+		this->SetReuseIntermediateFlag(true);
+
+		ErrorCode err = this->Calculate(i_lppInputBuffer);
+		if(err == ErrorCode::ERROR_CODE_NONE)
+		{
+			// o͌덷vZ
+			CONST_BATCH_BUFFER_POINTER lpDOutputBuffer = i_calculateDOutputFunc(this->GetOutputBuffer(), i_pUserData);
+			if(lpDOutputBuffer == NULL)
+				err = ErrorCode::ERROR_CODE_COMMON_NULL_REFERENCE;
+			else
+				err = this->Training(o_lppDInputBuffer, lpDOutputBuffer);
+		}
+
+		this->SetReuseIntermediateFlag(false);
+
+		return err;
+	}
+
 
 }	// NeuralNetwork
 }	// Layer
@@ -14,10 +14,12 @@
 #include<map>
 #include<set>
 #include<list>
+#include<unordered_map>
 
 #include"LayerConnect.h"
 #include"LayerConnectInput.h"
 #include"LayerConnectOutput.h"
+#include"FeedforwardNeuralNetwork_GraphPass.h"
 
 namespace Gravisbell {
 namespace Layer {
@@ -30,7 +32,9 @@ namespace NeuralNetwork {
 		// f[^{
 		class FeedforwardNeuralNetwork_LayerData_Base& layerData;
 
-		std::map<Gravisbell::GUID, ILayerConnect*>	lpLayerInfo;	/**< SC[̊ǗNX. <C[GUID, C[ڑ̃AhX> */
+		std::unordered_map<Gravisbell::GUID, ILayerConnect*, Gravisbell::GUIDHash>	lpLayerInfo;	/**< SC[̊ǗNX. <C[GUID, C[ڑ̃AhX> */
+		std::vector<Gravisbell::GUID> lpLayerGUIDByNum;	/**< ԍwŎ擾邽߂̃C[GUIDꗗ. C[̒ǉ/폜ɔjA̎擾ɍ쐬 */
+		std::unordered_map<Gravisbell::GUID, S32, Gravisbell::GUIDHash> lpInputLayerNo;	/**< ͐M̑փC[̔ԍ. <փC[GUID, ͔ԍ> */
 		std::vector<ILayerData*>	lpTemporaryLayerData;			/**< ꎞۑꂽC[f[^. */
 
 		std::list<ILayerConnect*> lpCalculateLayerList;		/**< C[ɕׂXg.  */
@@ -41,6 +45,25 @@ namespace NeuralNetwork {
 		SettingData::Standard::IData* pLearnData;		/**< wKݒ`RtBONX */
 
 		U32 batchSize;	/**< ob`TCY */
+		U32 maxBatchSize;	/**< őob`TCY. ZOŎw肵ob`TCY */
+
+		bool onLearnMode;	/**< wKp̎Osς݃tO. Zp̎Oł͊wKpobt@mۂȂ߁AwKۂ */
+		bool onFrozen;		/**< _ptO */
+
+		std::set<Gravisbell::GUID> lpRecomputeLayerGUID;	/**< ČvZΏۂɐݒ肳ꂽC[GUID */
+		std::map<Gravisbell::GUID, std::list<ILayerConnect*>::iterator> lpRecomputeSegmentBegin;	/**< ČvZ. <Ԃ̍Ō̃C[GUID, Ԃ̐擪C[> */
+		U32 recomputeOutputBufferOffset;	/**< ČvZC[p̏o̓obt@̐擪ID. ȍ~ID̃obt@͌덷`ɍČvZŕ */
+
+		U32 outputBufferElementCount;	/**< 1Tv̏o̓obt@̗vf. gpʂ̌ςɎgp */
+		U32 dInputBufferElementCount;	/**< 1Tv̓͌덷obt@̗vf. gpʂ̌ςɎgp */
+
+		std::set<ILayerConnect*> lpPartialCalculateLayer;	/**< ZŉZ郌C[. ̏ꍇ͑SC[Z */
+		std::set<ILayerConnect*> lpPartialCalculateTarget;	/**< Zŏo͂vꂽC[. SĉZ_ŉZł؂ */
+		std::set<Gravisbell::GUID> lpPinnedOutputLayerGUID;	/**< o̓obt@𑼂̃C[ƋLȂC[GUID. Zŕ̃C[̏o͂vꂽꍇɁA㑱̃C[ɂ㏑h */
+
+		std::vector<GraphPassInfo> lpGraphPass;	/**< OtœKpX. ZOœo^ɓKp */
+
+		std::set<Gravisbell::GUID> lpPreProcessedLayerGUID;	/**< ݂̍őob`TCYAʂŉZOsς݂̃C[GUID. ̉ZOł͂Ɋ܂܂ȂC[̂݉ZOs */
 
 	protected:
 		std::vector<LayerConnectInput*> lppInputLayer;	/**< ͐M̑փC[̃AhX. */
@@ -155,10 +178,18 @@ namespace NeuralNetwork {
 			@return	ڑɈُ킪ȂꍇNO_ERROR, ُ킪ꍇُ͈eԂAΏۃC[GUIDo_errorLayerɊi[. */
 		ErrorCode CheckAllConnection(Gravisbell::GUID& o_errorLayer);
 
+	private:
+		/** C[ƁA̓o͐̃C[ZO̍ĎsΏۂɂ.
+			ڑɉobt@C[邽߁AC[̐ڑOɎs. */
+		void ResetPreProcessedFlag(ILayerConnect* i_pLayer);
+
 		//====================================
 		// ͌덷obt@֘A
 		//====================================
 	private:
+		/** eC[ɓ͌덷obt@ID蓖āAobt@Ƃ1Tv̗vf߂. obt@͊mۂȂ.
+			@param	o_lpBufferSize	1Tv̗vf̊i[. Y͓͌덷obt@ID */
+		void PlanDInputBuffer(std::vector<U32>& o_lpBufferSize);
 		/** eC[gp͌덷obt@蓖Ă */
 		ErrorCode AllocateDInputBuffer(void);
 
@@ -180,15 +211,28 @@ namespace NeuralNetwork {
 		// o̓obt@֘A
 		//====================================
 	private:
+		/** eC[ɏo̓obt@ID蓖āAobt@Ƃ1Tv̗vf߂. obt@͊mۂȂ.
+			wKp̏ꍇ͍ČvZԂ쐬AČvZp̃obt@recomputeOutputBufferOffsetȍ~ID蓖Ă.
+			@param	o_lpBufferSize	1Tv̗vf̊i[. Y͏o̓obt@ID
+			@param	o_elementCount	1Tv̗vf̍v̊i[. o͂ێ郌C[Ƃ̗vfƍČvZp̃obt@̗vf̍v */
+		void PlanOutputBuffer(std::vector<U32>& o_lpBufferSize, U32& o_elementCount);
 		/** eC[gpo̓obt@蓖Ă */
 		ErrorCode AllocateOutputBuffer(void);
 
 	protected:
+		/** ČvZC[p̏o̓obt@mF.
+			ČvZC[p̏o̓obt@́AԂ̕ʂ̃C[Ƃ͋LꂸAԊÕC[͎QƂȂ. */
+		bool IsRecomputeOutputBuffer(U32 i_outputBufferNo)const;
+
 		/** o̓obt@̑ݒ肷 */
 		virtual ErrorCode SetOutputBufferCount(U32 i_outputBufferCount) = 0;
 
 		/** o̓obt@̃TCYݒ肷 */
 		virtual ErrorCode ResizeOutputBuffer(U32 i_outputBufferNo, U32 i_bufferSize) = 0;
+
+		/** C[ƂɊmۂo̓obt@.
+			ɎgpۂɌ݂̃ob`TCYōĊmۂ. */
+		virtual void ReleaseLayerOutputBuffer(const Gravisbell::GUID& i_guid) = 0;
 
 	public:
 		/** o̓obt@݂̌̎gp҂擾 */
@@ -272,6 +316,89 @@ namespace NeuralNetwork {
 
 
 		//====================================
+		// _p[h
+		//====================================
+	public:
+		/** _p[hɐݒ肷.
+			C[f[^̃IveB}CU[A͌덷obt@.
+			ȍ~PreProcessLearn, CalculateDInput, Trainings. */
+		ErrorCode Freeze();
+		/** _p[hmF */
+		bool IsFrozen()const;
+
+
+		//====================================
+		// ČvZ(`FbN|Cg)
+		//====================================
+	public:
+		/** C[ČvZΏۂɐݒ肷.
+			ݒPreProcessLearnĂяoۂɓKp.
+			@param	i_layerGUID		ݒΏۃC[GUID.
+			@param	i_onRecompute	truȅꍇČvZΏ. */
+		ErrorCode SetLayerRecomputeFlag(const Gravisbell::GUID& i_layerGUID, bool i_onRecompute);
+		/** C[ČvZΏۂmF */
+		bool GetLayerRecomputeFlag(const Gravisbell::GUID& i_layerGUID)const;
+
+	private:
+		/** ČvZԂ̍Ō̃C[̏ꍇAԓ̃C[̉ZĎsďo͂𕜌.
+			@param	i_pLayer	덷`sC[. */
+		ErrorCode RecomputeSegment(ILayerConnect* i_pLayer);
+
+
+		//====================================
+		// gp
+		//====================================
+	public:
+		/** gpʂ̏ob`TCY肵AZO(wKp)s.
+			@param	i_maxByteCount	gpʂ̏. oCgP.
+			@param	i_maxBatchSize	ob`TCY̏.
+			@param	o_batchSize		Iob`TCY̊i[. */
+		ErrorCode PreProcessLearnWithMemoryLimit(U64 i_maxByteCount, U32 i_maxBatchSize, U32& o_batchSize);
+		/** ỎZOŊmۂobt@烁gpʂς.
+			@return	oCgP */
+		U64 GetEstimatedMemoryByteCount()const;
+
+	private:
+		/** ݂̍ČvZΏۂŃgpʂ̏Ɏ܂ő̃ob`TCY߂.
+			obt@͊mۂAobt@̊蓖Čv悩烁gpʂ߂. wKp̏쐬ς݂ł邱.
+			@param	o_batchSize		ob`TCY̊i[. ob`TCY1ł𒴂ꍇ0. */
+		ErrorCode CalculateMaxBatchSizeByMemoryLimit(U64 i_maxByteCount, U32 i_maxBatchSize, U32& o_batchSize);
+		/** ZO(wKp)sꍇ̃gpʂAobt@mۂɋ߂.
+			@param	i_batchSize		ob`TCY.
+			@param	i_elementCount	1Tv̏o̓obt@A͌덷obt@̗vf̍v.
+			@param	o_byteCount		gpʂ̊i[. oCgP. */
+		ErrorCode CalculatePlannedMemoryByteCount(U32 i_batchSize, U32 i_elementCount, U64& o_byteCount)const;
+		/** ČvZ\ȃC[Ԋuŋ؂ČvZΏۂ쐬.
+			ČvZ\ȃC[NAꍇANƂɏo͂ێ郌C[c. */
+		void CreateRecomputeSchedule(std::set<Gravisbell::GUID>& o_lpLayerGUID)const;
+
+
+		//====================================
+		// OtœK
+		//====================================
+	public:
+		/** OtœKpX̐擾 */
+		U32 GetGraphPassCount()const;
+		/** OtœKpX̖O擾.
+			@param	i_passNum	pX̔ԍ.
+			@return	͈͊ȌꍇNULL */
+		const wchar_t* GetGraphPassName(U32 i_passNum)const;
+		/** OtœKpX̗L/ݒ肷.
+			@param	i_passName	pX̖O.
+			@param	i_onEnable	truȅꍇL. */
+		ErrorCode SetGraphPassEnableFlag(const wchar_t i_passName[], bool i_onEnable);
+		/** ỎZOŃpXύXC[̐擾 */
+		U32 GetGraphPassChangeLayerCount(U32 i_passNum)const;
+		/** ỎZOŃpXύXC[GUIDԍwŎ擾 */
+		ErrorCode GetGraphPassChangeLayerGUID(U32 i_passNum, U32 i_layerNum, Gravisbell::GUID& o_layerGUID)const;
+
+	private:
+		/** LȃOtœKpXo^ɓKp.
+			ỎZOł̍œKʂ͔j. */
+		ErrorCode ApplyGraphPass(void);
+
+
+		//====================================
 		// o̓obt@֘A
 		//====================================
 	public:
@@ -305,6 +432,28 @@ namespace NeuralNetwork {
 			@return ɉZsob`̃TCY */
 		U32 GetBatchSize()const override;
 
+		/** ZɎgpob`TCYύX.
+			ZOŎw肵ob`TCYȉł΁Aڑ̍Ċmobt@̍Ċmۂs킸ɕύXł.
+			Zp̎O(PreProcessCalculate)sĂꍇ̂ݗL.
+			@param batchSize	ɉZsob`̃TCY. 1`GetMaxBatchSize()̖߂l. */
+		ErrorCode SetBatchSize(U32 batchSize)override;
+		/** őob`TCY擾.
+			@return ZOŎw肵ob`̃TCY */
+		U32 GetMaxBatchSize()const override;
+
+		/** ZʂČvZŕł邩mF.
+			̑SC[ČvZ\ȏꍇ̂true. */
+		bool CheckCanRecompute()const override;
+		/** ZO(wKp)œo^ꎞobt@̃TCYAobt@mۂɓo^.
+			̑SC[̈ꎞobt@o^. */
+		ErrorCode RegisterPlannedTemporaryBuffer(Gravisbell::Common::ITemporaryMemoryManager& o_temporaryMemoryManager, U32 i_batchSize)const override;
+		/** Z̒ԒlwKɍėpꍇɁAZwK܂ŕێꎞobt@̃TCY߂.
+			ZSC[̍v. */
+		U64 GetPlannedReuseIntermediateByteCount(U32 i_batchSize)const override;
+		/** Z̒ԒlwKɍėp邩ݒ肷.
+			̑SC[ɐݒ肷. */
+		void SetReuseIntermediateFlag(bool i_onReuse)override;
+
 		/** ꎞobt@ǗNX擾 */
 		Common::ITemporaryMemoryManager& GetTemporaryMemoryManager();
 
@@ -363,6 +512,12 @@ namespace NeuralNetwork {
 		/** ڑ̊ms */
 		ErrorCode EstablishmentConnection(void);
 
+	private:
+		/** ZO̊JnɁAỎZǑʂėpł邩𔻒肷.
+			őob`TCYςꍇ̓C[Ƃ̏o̓obt@ASC[ĎsΏۂɂ.
+			ʂςꍇ͑SC[ĎsΏۂɂ. */
+		void BeginPreProcess(U32 batchSize, bool i_onLearnMode);
+
 	public:
 		/** ZOs.(wKp)
 			@param batchSize	ɉZsob`̃TCY.
@@ -385,6 +540,14 @@ namespace NeuralNetwork {
 			@return ꍇ0Ԃ */
 		ErrorCode Calculate_device(CONST_BATCH_BUFFER_POINTER i_lppInputBuffer[], BATCH_BUFFER_POINTER o_lppOutputBuffer)override;
 
+		/** w肵C[̏o͂vZ.
+			w背C[̑ĉ݂ZAeC[̏o̓obt@̃AhXԂ.
+			@param	i_lppInputBuffer	̓f[^obt@.
+			@param	i_lpLayerGUID		o͂擾郌C[GUIDz.
+			@param	i_layerCount		o͂擾郌C[.
+			@param	o_lppOutputBuffer	eC[̏o̓obt@̃AhXi[. */
+		ErrorCode CalculateLayerOutput(CONST_BATCH_BUFFER_POINTER i_lppInputBuffer[], const Gravisbell::GUID i_lpLayerGUID[], U32 i_layerCount, CONST_BATCH_BUFFER_POINTER o_lppOutputBuffer[]);
+
 
 		//================================
 		// wK
@@ -402,6 +565,14 @@ namespace NeuralNetwork {
 			@param	i_lppDOutputBuffer	o͌덷=C[̓͌덷.	[GetBatchSize()̖߂l][GetOutputBufferCount()̖߂l]̗vfKv.
 			ǑvZʂgp */
 		ErrorCode Training_device(CONST_BATCH_BUFFER_POINTER i_lppInputBuffer[], BATCH_BUFFER_POINTER o_lppDInputBuffer[], CONST_BATCH_BUFFER_POINTER i_lppOutputBuffer, CONST_BATCH_BUFFER_POINTER )override;
+
+		/** ZƊwKAĎs.
+			Z͊eC[̒Ԓl̍ėpLɂ.
+			@param	i_lppInputBuffer		̓f[^obt@.
+			@param	o_lppDInputBuffer		͌덷i[. NULL̏ꍇ͏o͂Ȃ.
+			@param	i_calculateDOutputFunc	Zʂo͌덷vZ֐.
+			@param	i_pUserData				i_calculateDOutputFuncɓnCӂ̃f[^. */
+		ErrorCode CalculateAndTraining(CONST_BATCH_BUFFER_POINTER i_lppInputBuffer[], BATCH_BUFFER_POINTER o_lppDInputBuffer[], CalculateDOutputFunc i_calculateDOutputFunc, void* i_pUserData);
 	};
 
 }	// NeuralNetwork
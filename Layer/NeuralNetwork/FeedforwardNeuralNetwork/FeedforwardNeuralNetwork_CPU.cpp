@@ -85,29 +85,61 @@ namespace NeuralNetwork {
 	/** o̓obt@̑ݒ肷 */
 	ErrorCode FeedforwardNeuralNetwork_CPU::SetOutputBufferCount(U32 i_outputBufferCount)
 	{
+		this->lpTemporaryOutputBuffer.resize(i_outputBufferCount);
+
 		return ErrorCode::ERROR_CODE_NONE;
 	}
 
 	/** o̓obt@̃TCYݒ肷 */
 	ErrorCode FeedforwardNeuralNetwork_CPU::ResizeOutputBuffer(U32 i_outputBufferNo, U32 i_bufferSize)
 	{
+		if(i_outputBufferNo >= this->lpTemporaryOutputBuffer.size())
+			return ErrorCode::ERROR_CODE_COMMON_OUT_OF_ARRAYRANGE;
+
+		// ČvZC[ȊȌo͂̓C[Ƃ̃obt@ɕێ邽߁ALobt@͊mۂȂ
+		if(!this->IsRecomputeOutputBuffer(i_outputBufferNo))
+		{
+			std::vector<F32>().swap(this->lpTemporaryOutputBuffer[i_outputBufferNo].lpBuffer);
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+
+		this->lpTemporaryOutputBuffer[i_outputBufferNo].lpBuffer.resize(i_bufferSize);
+
 		return ErrorCode::ERROR_CODE_NONE;
+	}
+
+	/** C[ƂɊmۂo̓obt@ */
+	void FeedforwardNeuralNetwork_CPU::ReleaseLayerOutputBuffer(const Gravisbell::GUID& i_guid)
+	{
+		this->lpLayerOutputBuffer.erase(i_guid);
 	}
 
 	/** o̓obt@݂̌̎gp҂擾 */
 	GUID FeedforwardNeuralNetwork_CPU::GetReservedOutputBufferID(U32 i_outputBufferNo)
 	{
-		return GUID();
+		if(i_outputBufferNo >= this->lpTemporaryOutputBuffer.size())
+			return GUID();
+
+		return this->lpTemporaryOutputBuffer[i_outputBufferNo].reserveLayerID;
 	}
 	/** o̓obt@gpɂĎ擾(foCXˑ) */
 	BATCH_BUFFER_POINTER FeedforwardNeuralNetwork_CPU::ReserveOutputBuffer_d(U32 i_outputBufferNo, GUID i_guid)
 	{
+		// ČvZC[͋Lobt@gp
+		if(i_outputBufferNo < this->lpTemporaryOutputBuffer.size() && this->IsRecomputeOutputBuffer(i_outputBufferNo))
+		{
+			this->lpTemporaryOutputBuffer[i_outputBufferNo].reserveLayerID = i_guid;
+
+			return &this->lpTemporaryOutputBuffer[i_outputBufferNo].lpBuffer[0];
+		}
+
 		if(this->lpLayerOutputBuffer.count(i_guid) == 0)
 		{
-			// C[̏o̓obt@mۂ
+			// C[̏o̓obt@mۂ.
+			// SetBatchSizeŌォob`TCY傫Ă悤ɍőob`TCYmۂ
 			IODataStruct outputDataStruct = this->GetOutputDataStruct(i_guid);
 
-			this->lpLayerOutputBuffer[i_guid].resize(outputDataStruct.GetDataCount() * this->GetBatchSize());
+			this->lpLayerOutputBuffer[i_guid].resize(outputDataStruct.GetDataCount() * this->GetMaxBatchSize());
 		}
 
 		return &this->lpLayerOutputBuffer[i_guid][0];
@@ -171,12 +203,14 @@ namespace NeuralNetwork {
 		// ̓obt@Rs[
 		for(U32 i=0; i<this->lppInputBuffer.size(); i++)
 		{
-			if(this->lppInputTmpBuffer[i].empty())
+			// őob`TCYmۂÃ݂ob`TCŶݕʂ
+			U32 bufferSize = this->GetInputBufferCount(i) * this->GetMaxBatchSize();
+			if(this->lppInputTmpBuffer[i].size() != bufferSize)
 			{
-				this->lppInputTmpBuffer[i].resize(this->GetInputBufferCount(i) * this->GetBatchSize());
+				this->lppInputTmpBuffer[i].resize(bufferSize);
 				this->lppInputBuffer[i] = &this->lppInputTmpBuffer[i][0];
 			}
-			memcpy(&this->lppInputTmpBuffer[i][0], i_lppInputBuffer[i], sizeof(F32)*this->lppInputTmpBuffer[i].size());
+			memcpy(&this->lppInputTmpBuffer[i][0], i_lppInputBuffer[i], sizeof(F32)*this->GetInputBufferCount(i)*this->GetBatchSize());
 		}
 
 		return this->Calculate_device(i_lppInputBuffer, o_lppOutputBuffer);
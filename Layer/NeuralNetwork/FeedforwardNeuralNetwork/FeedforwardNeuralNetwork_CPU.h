@@ -27,6 +27,7 @@ namespace NeuralNetwork {
 		// ͌덷vZp̈ꎞobt@
 		std::vector<std::vector<F32>> lpDInputBuffer;
 		std::map<GUID, std::vector<F32>> lpLayerOutputBuffer;	/**< eC[̏o̓obt@ */
+		std::vector<BufferInfo> lpTemporaryOutputBuffer;		/**< L̏o̓obt@. ČvZC[p̃obt@̂݊mۂ */
 
 		//====================================
 		// RXgN^/fXgN^
@@ -72,6 +73,9 @@ namespace NeuralNetwork {
 		/** o̓obt@̃TCYݒ肷 */
 		ErrorCode ResizeOutputBuffer(U32 i_outputBufferNo, U32 i_bufferSize);
 
+		/** C[ƂɊmۂo̓obt@ */
+		void ReleaseLayerOutputBuffer(const Gravisbell::GUID& i_guid);
+
 	public:
 		/** o̓obt@݂̌̎gp҂擾 */
 		GUID GetReservedOutputBufferID(U32 i_outputBufferNo);
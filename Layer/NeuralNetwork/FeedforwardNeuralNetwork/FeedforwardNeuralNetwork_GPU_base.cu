@@ -44,11 +44,13 @@ namespace NeuralNetwork {
 	/** RXgN^ */
 	FeedforwardNeuralNetwork_GPU_base::FeedforwardNeuralNetwork_GPU_base(const Gravisbell::GUID& i_guid, class FeedforwardNeuralNetwork_LayerData_Base& i_layerData, const IODataStruct i_lpInputDataStruct[], U32 i_inputLayerCount)
 		:	FeedforwardNeuralNetwork_Base	(i_guid, i_layerData, i_lpInputDataStruct, i_inputLayerCount, i_layerData.GetOutputDataStruct(i_lpInputDataStruct, i_inputLayerCount), Common::CreateTemporaryMemoryManagerGPU())
+		,	dOutputBufferHandle				(Gravisbell::Common::INVALID_TEMPORARY_BUFFER_HANDLE)
 	{
 	}
 	/** RXgN^ */
 	FeedforwardNeuralNetwork_GPU_base::FeedforwardNeuralNetwork_GPU_base(const Gravisbell::GUID& i_guid, class FeedforwardNeuralNetwork_LayerData_Base& i_layerData, const IODataStruct i_lpInputDataStruct[], U32 i_inputLayerCount, Gravisbell::Common::ITemporaryMemoryManager& i_temporaryMemoryManager)
 		:	FeedforwardNeuralNetwork_Base	(i_guid, i_layerData, i_lpInputDataStruct, i_inputLayerCount, i_layerData.GetOutputDataStruct(i_lpInputDataStruct, i_inputLayerCount), i_temporaryMemoryManager)
+		,	dOutputBufferHandle				(Gravisbell::Common::INVALID_TEMPORARY_BUFFER_HANDLE)
 	{
 	}
 	/** fXgN^ */
@@ -135,12 +137,15 @@ namespace NeuralNetwork {
 	{
 		ErrorCode err = FeedforwardNeuralNetwork_Base::PreProcessLearn(batchSize);
 
+		// ꎞobt@o^AZ/wKɎgpnh擾
+		this->lpInputBufferHandle.resize(this->GetInputCount());
+		this->lpDInputBufferHandle.resize(this->GetInputCount());
 		for(U32 i=0; i<this->GetInputCount(); i++)
 		{
-			this->temporaryMemoryManager.SetBufferSize(this->GetGUID(), GetInputTemporaryBufferID(i).c_str(), sizeof(F32)*this->GetInputBufferCount(i)*this->GetBatchSize());
-			this->temporaryMemoryManager.SetBufferSize(this->GetGUID(), GetDInputTemporaryBufferID(i).c_str(), sizeof(F32)*this->GetInputBufferCount(i)*this->GetBatchSize());
+			this->lpInputBufferHandle[i]  = this->temporaryMemoryManager.RegisterBuffer(this->GetGUID(), GetInputTemporaryBufferID(i).c_str(), sizeof(F32)*this->GetInputBufferCount(i)*this->GetBatchSize());
+			this->lpDInputBufferHandle[i] = this->temporaryMemoryManager.RegisterBuffer(this->GetGUID(), GetDInputTemporaryBufferID(i).c_str(), sizeof(F32)*this->GetInputBufferCount(i)*this->GetBatchSize());
 		}
-		this->temporaryMemoryManager.SetBufferSize(this->GetGUID(), L"doutput[0]", sizeof(F32)*this->GetOutputBufferCount()*this->GetBatchSize());
+		this->dOutputBufferHandle = this->temporaryMemoryManager.RegisterBuffer(this->GetGUID(), L"doutput[0]", sizeof(F32)*this->GetOutputBufferCount()*this->GetBatchSize());
 
 		// o̓obt@̊m
 		this->lpOutputBuffer_h.resize(this->GetOutputBufferCount() * this->GetBatchSize());
@@ -155,16 +160,36 @@ namespace NeuralNetwork {
 	{
 		ErrorCode err = FeedforwardNeuralNetwork_Base::PreProcessCalculate(batchSize);
 		
+		// ꎞobt@o^AZ/wKɎgpnh擾
+		this->lpInputBufferHandle.resize(this->GetInputCount());
+		this->lpDInputBufferHandle.assign(this->GetInputCount(), Gravisbell::Common::INVALID_TEMPORARY_BUFFER_HANDLE);
 		for(U32 i=0; i<this->GetInputCount(); i++)
 		{
-			this->temporaryMemoryManager.SetBufferSize(this->GetGUID(), GetInputTemporaryBufferID(i).c_str(),  sizeof(F32)*this->GetInputBufferCount(i)*this->GetBatchSize());
+			this->lpInputBufferHandle[i] = this->temporaryMemoryManager.RegisterBuffer(this->GetGUID(), GetInputTemporaryBufferID(i).c_str(),  sizeof(F32)*this->GetInputBufferCount(i)*this->GetBatchSize());
 		}
-		this->temporaryMemoryManager.SetBufferSize(this->GetGUID(), L"doutput[0]", sizeof(F32)*this->GetOutputBufferCount()*this->GetBatchSize());
+		this->dOutputBufferHandle = this->temporaryMemoryManager.RegisterBuffer(this->GetGUID(), L"doutput[0]", sizeof(F32)*this->GetOutputBufferCount()*this->GetBatchSize());
 
 		// o̓obt@̊m
 		this->lpOutputBuffer_h.resize(this->GetOutputBufferCount() * this->GetBatchSize());
 
 		return err;
+	}
+	/** ZO(wKp)œo^ꎞobt@̃TCYAobt@mۂɓo^.
+		̑SC[̈ꎞobt@ƁAo͂̎󂯓np̈ꎞobt@o^. */
+	ErrorCode FeedforwardNeuralNetwork_GPU_base::RegisterPlannedTemporaryBuffer(Gravisbell::Common::ITemporaryMemoryManager& o_temporaryMemoryManager, U32 i_batchSize)const
+	{
+		ErrorCode err = FeedforwardNeuralNetwork_Base::RegisterPlannedTemporaryBuffer(o_temporaryMemoryManager, i_batchSize);
+		if(err != ErrorCode::ERROR_CODE_NONE)
+			return err;
+
+		for(U32 i=0; i<this->lppInputLayer.size(); i++)
+		{
+			o_temporaryMemoryManager.RegisterBuffer(this->GetGUID(), GetInputTemporaryBufferID(i).c_str(),  sizeof(F32)*this->GetInputBufferCount(i)*i_batchSize);
+			o_temporaryMemoryManager.RegisterBuffer(this->GetGUID(), GetDInputTemporaryBufferID(i).c_str(), sizeof(F32)*this->GetInputBufferCount(i)*i_batchSize);
+		}
+		o_temporaryMemoryManager.RegisterBuffer(this->GetGUID(), L"doutput[0]", sizeof(F32)*this->GetOutputBufferCount()*i_batchSize);
+
+		return ErrorCode::ERROR_CODE_NONE;
 	}
 
 
@@ -198,15 +223,17 @@ namespace NeuralNetwork {
 		std::vector<const F32*> lppInputBuffer(this->GetInputCount());
 		for(U32 i=0; i<this->GetInputCount(); i++)
 		{
-			if(this->lppInputTmpBuffer[i].empty())
+			// őob`TCYmۂÃ݂ob`TCŶݕʂ
+			U32 bufferSize = this->GetInputBufferCount(i) * this->GetMaxBatchSize();
+			if(this->lppInputTmpBuffer[i].size() != bufferSize)
 			{
-				this->lppInputTmpBuffer[i].resize(this->GetInputBufferCount(i) * this->GetBatchSize());
+				this->lppInputTmpBuffer[i].resize(bufferSize);
 				this->lppInputBuffer[i] = &this->lppInputTmpBuffer[i][0];
 			}
-			memcpy(&this->lppInputTmpBuffer[i][0], i_lppInputBuffer[i], sizeof(F32)*this->lppInputTmpBuffer[i].size());
+			memcpy(&this->lppInputTmpBuffer[i][0], i_lppInputBuffer[i], sizeof(F32)*this->GetInputBufferCount(i)*this->GetBatchSize());
 
 			// ̓obt@foCXɃRs[
-			F32* lpInputBuffer = (F32*)this->temporaryMemoryManager.ReserveBuffer(this->GetGUID(), GetInputTemporaryBufferID(i).c_str());
+			F32* lpInputBuffer = (F32*)this->temporaryMemoryManager.ReserveBuffer(this->lpInputBufferHandle[i]);
 			cudaMemcpy(lpInputBuffer, &this->lppInputTmpBuffer[i][0], sizeof(F32)*this->GetInputBufferCount(i)*this->GetBatchSize(), cudaMemcpyHostToDevice);
 
 			lppInputBuffer[i] = lpInputBuffer;
@@ -220,7 +247,7 @@ namespace NeuralNetwork {
 
 		// obt@J
 		for(U32 i=0; i<this->GetInputCount(); i++)
-			this->temporaryMemoryManager.RestoreBuffer(this->GetGUID(), GetInputTemporaryBufferID(i).c_str());
+			this->temporaryMemoryManager.RestoreBuffer(this->lpInputBufferHandle[i]);
 
 		return err;
 	}
@@ -246,14 +273,14 @@ namespace NeuralNetwork {
 		std::vector<const F32*> lppInputBuffer(this->GetInputCount());
 		for(U32 i=0; i<this->GetInputCount(); i++)
 		{
-			F32* lpInputBuffer = (F32*)this->temporaryMemoryManager.ReserveBuffer(this->GetGUID(), GetInputTemporaryBufferID(i).c_str());
+			F32* lpInputBuffer = (F32*)this->temporaryMemoryManager.ReserveBuffer(this->lpInputBufferHandle[i]);
 			cudaMemcpy(lpInputBuffer, &this->lppInputTmpBuffer[i][0], sizeof(F32)*this->GetInputBufferCount(i)*this->GetBatchSize(), cudaMemcpyHostToDevice);
 
 			lppInputBuffer[i] = lpInputBuffer;
 		}
 
 		// o͌덷obt@foCXɃRs[
-		F32* lppDOutputBuffer = (F32*)this->temporaryMemoryManager.ReserveBuffer(this->GetGUID(), L"doutput[0]");
+		F32* lppDOutputBuffer = (F32*)this->temporaryMemoryManager.ReserveBuffer(this->dOutputBufferHandle);
 		cudaMemcpy(lppDOutputBuffer, i_lppDOutputBuffer, sizeof(F32)*this->GetOutputBufferCount()*this->GetBatchSize(), cudaMemcpyHostToDevice);
 
 		Gravisbell::ErrorCode err;
@@ -263,7 +290,7 @@ namespace NeuralNetwork {
 			std::vector<F32*> lppDInputBuffer(this->GetInputCount(), NULL);
 			for(U32 i=0; i<this->GetInputCount(); i++)
 			{
-				lppDInputBuffer[i] = (F32*)this->temporaryMemoryManager.ReserveBuffer(this->GetGUID(), GetDInputTemporaryBufferID(i).c_str());
+				lppDInputBuffer[i] = (F32*)this->temporaryMemoryManager.ReserveBuffer(this->lpDInputBufferHandle[i]);
 			}
 
 			// Z
@@ -273,7 +300,7 @@ namespace NeuralNetwork {
 			for(U32 i=0; i<this->GetInputCount(); i++)
 			{
 				cudaMemcpy(o_lppDInputBuffer, lppDInputBuffer[i], sizeof(F32)*this->GetInputBufferCount(i)*this->GetBatchSize(), cudaMemcpyDeviceToHost);
-				this->temporaryMemoryManager.RestoreBuffer(this->GetGUID(), GetDInputTemporaryBufferID(i).c_str());
+				this->temporaryMemoryManager.RestoreBuffer(this->lpDInputBufferHandle[i]);
 			}
 		}
 		else
@@ -284,8 +311,8 @@ namespace NeuralNetwork {
 
 		// obt@J
 		for(U32 i=0; i<this->GetInputCount(); i++)
-			this->temporaryMemoryManager.RestoreBuffer(this->GetGUID(), GetInputTemporaryBufferID(i).c_str());
-		this->temporaryMemoryManager.RestoreBuffer(this->GetGUID(), L"doutput[0]");
+			this->temporaryMemoryManager.RestoreBuffer(this->lpInputBufferHandle[i]);
+		this->temporaryMemoryManager.RestoreBuffer(this->dOutputBufferHandle);
 
 		return err;
 	}
@@ -311,14 +338,14 @@ namespace NeuralNetwork {
 		std::vector<const F32*> lppInputBuffer(this->GetInputCount());
 		for(U32 i=0; i<this->GetInputCount(); i++)
 		{
-			F32* lpInputBuffer = (F32*)this->temporaryMemoryManager.ReserveBuffer(this->GetGUID(), GetInputTemporaryBufferID(i).c_str());
+			F32* lpInputBuffer = (F32*)this->temporaryMemoryManager.ReserveBuffer(this->lpInputBufferHandle[i]);
 			cudaMemcpy(lpInputBuffer, &this->lppInputTmpBuffer[i][0], sizeof(F32)*this->GetInputBufferCount(i)*this->GetBatchSize(), cudaMemcpyHostToDevice);
 
 			lppInputBuffer[i] = lpInputBuffer;
 		}
 
 		// o͌덷obt@foCXɃRs[
-		F32* lppDOutputBuffer = (F32*)this->temporaryMemoryManager.ReserveBuffer(this->GetGUID(), L"doutput[0]");
+		F32* lppDOutputBuffer = (F32*)this->temporaryMemoryManager.ReserveBuffer(this->dOutputBufferHandle);
 		cudaMemcpy(lppDOutputBuffer, i_lppDOutputBuffer, sizeof(F32)*this->GetOutputBufferCount()*this->GetBatchSize(), cudaMemcpyHostToDevice);
 
 
@@ -329,7 +356,7 @@ namespace NeuralNetwork {
 			std::vector<F32*> lppDInputBuffer(this->GetInputCount(), NULL);
 			for(U32 i=0; i<this->GetInputCount(); i++)
 			{
-				lppDInputBuffer[i] = (F32*)this->temporaryMemoryManager.ReserveBuffer(this->GetGUID(), GetDInputTemporaryBufferID(i).c_str());
+				lppDInputBuffer[i] = (F32*)this->temporaryMemoryManager.ReserveBuffer(this->lpDInputBufferHandle[i]);
 			}
 
 			// Z
@@ -339,7 +366,7 @@ namespace NeuralNetwork {
 			for(U32 i=0; i<this->GetInputCount(); i++)
 			{
 				cudaMemcpy(o_lppDInputBuffer[i], lppDInputBuffer[i], sizeof(F32)*this->GetInputBufferCount(i)*this->GetBatchSize(), cudaMemcpyDeviceToHost);
-				this->temporaryMemoryManager.RestoreBuffer(this->GetGUID(), GetDInputTemporaryBufferID(i).c_str());
+				this->temporaryMemoryManager.RestoreBuffer(this->lpDInputBufferHandle[i]);
 			}
 		}
 		else
@@ -350,8 +377,8 @@ namespace NeuralNetwork {
 
 		// obt@J
 		for(U32 i=0; i<this->GetInputCount(); i++)
-			this->temporaryMemoryManager.RestoreBuffer(this->GetGUID(), GetInputTemporaryBufferID(i).c_str());
-		this->temporaryMemoryManager.RestoreBuffer(this->GetGUID(), L"doutput[0]");
+			this->temporaryMemoryManager.RestoreBuffer(this->lpInputBufferHandle[i]);
+		this->temporaryMemoryManager.RestoreBuffer(this->dOutputBufferHandle);
 
 		return err;
 	}
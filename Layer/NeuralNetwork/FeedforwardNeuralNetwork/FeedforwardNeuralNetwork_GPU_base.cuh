@@ -24,6 +24,10 @@ namespace NeuralNetwork {
 		std::vector<F32> lpOutputBuffer_h;	/**< o̓obt@(zXg) */
 		std::vector<thrust::device_vector<F32>> lpDInputBuffer;
 
+		std::vector<Gravisbell::Common::TemporaryBufferHandle> lpInputBufferHandle;		/**< ̓obt@(foCX)̈ꎞobt@̃nh <͐> */
+		std::vector<Gravisbell::Common::TemporaryBufferHandle> lpDInputBufferHandle;	/**< ͌덷obt@(foCX)̈ꎞobt@̃nh <͐>. Zp̎Oł͓o^Ȃ */
+		Gravisbell::Common::TemporaryBufferHandle dOutputBufferHandle;					/**< o͌덷obt@(foCX)̈ꎞobt@̃nh */
+
 		//====================================
 		// RXgN^/fXgN^
 		//====================================
@@ -97,6 +101,9 @@ namespace NeuralNetwork {
 			NN쐬AZsOɈxKs邱ƁBf[^ƂɎsKv͂Ȃ.
 			sꍇCalculateȍ~͎̏ss. */
 		ErrorCode PreProcessCalculate(unsigned int batchSize)override;
+		/** ZO(wKp)œo^ꎞobt@̃TCYAobt@mۂɓo^.
+			̑SC[̈ꎞobt@ƁAo͂̎󂯓np̈ꎞobt@o^. */
+		ErrorCode RegisterPlannedTemporaryBuffer(Gravisbell::Common::ITemporaryMemoryManager& o_temporaryMemoryManager, U32 i_batchSize)const override;
 
 
 		/** Zs.
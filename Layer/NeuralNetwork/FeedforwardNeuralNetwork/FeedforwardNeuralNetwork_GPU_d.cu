@@ -54,29 +54,61 @@ namespace NeuralNetwork {
 	/** o̓obt@̑ݒ肷 */
 	ErrorCode FeedforwardNeuralNetwork_GPU_d::SetOutputBufferCount(U32 i_outputBufferCount)
 	{
+		this->lpTemporaryOutputBuffer.resize(i_outputBufferCount);
+
 		return ErrorCode::ERROR_CODE_NONE;
 	}
 
 	/** o̓obt@̃TCYݒ肷 */
 	ErrorCode FeedforwardNeuralNetwork_GPU_d::ResizeOutputBuffer(U32 i_outputBufferNo, U32 i_bufferSize)
 	{
+		if(i_outputBufferNo >= this->lpTemporaryOutputBuffer.size())
+			return ErrorCode::ERROR_CODE_COMMON_OUT_OF_ARRAYRANGE;
+
+		// ČvZC[ȊȌo͂̓C[Ƃ̃obt@ɕێ邽߁ALobt@͊mۂȂ
+		if(!this->IsRecomputeOutputBuffer(i_outputBufferNo))
+		{
+			thrust::device_vector<F32>().swap(this->lpTemporaryOutputBuffer[i_outputBufferNo].lpBuffer);
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+
+		this->lpTemporaryOutputBuffer[i_outputBufferNo].lpBuffer.resize(i_bufferSize);
+
 		return ErrorCode::ERROR_CODE_NONE;
 	}
 
+	/** C[ƂɊmۂo̓obt@ */
+	void FeedforwardNeuralNetwork_GPU_d::ReleaseLayerOutputBuffer(const Gravisbell::GUID& i_guid)
+	{
+		this->lpLayerOutputBuffer_d.erase(i_guid);
+	}
+
 	/** o̓obt@݂̌̎gp҂擾 */
 	GUID FeedforwardNeuralNetwork_GPU_d::GetReservedOutputBufferID(U32 i_outputBufferNo)
 	{
-		return GUID();
+		if(i_outputBufferNo >= this->lpTemporaryOutputBuffer.size())
+			return GUID();
+
+		return this->lpTemporaryOutputBuffer[i_outputBufferNo].reserveLayerID;
 	}
 	/** o̓obt@gpɂĎ擾(foCXˑ) */
 	BATCH_BUFFER_POINTER FeedforwardNeuralNetwork_GPU_d::ReserveOutputBuffer_d(U32 i_outputBufferNo, GUID i_guid)
 	{
+		// ČvZC[͋Lobt@gp
+		if(i_outputBufferNo < this->lpTemporaryOutputBuffer.size() && this->IsRecomputeOutputBuffer(i_outputBufferNo))
+		{
+			this->lpTemporaryOutputBuffer[i_outputBufferNo].reserveLayerID = i_guid;
+
+			return thrust::raw_pointer_cast(&this->lpTemporaryOutputBuffer[i_outputBufferNo].lpBuffer[0]);
+		}
+
 		if(this->lpLayerOutputBuffer_d.count(i_guid) == 0)
 		{
-			// C[̏o̓obt@mۂ
+			// C[̏o̓obt@mۂ.
+			// SetBatchSizeŌォob`TCY傫Ă悤ɍőob`TCYmۂ
 			IODataStruct outputDataStruct = this->GetOutputDataStruct(i_guid);
 
-			this->lpLayerOutputBuffer_d[i_guid].resize(outputDataStruct.GetDataCount() * this->GetBatchSize());
+			this->lpLayerOutputBuffer_d[i_guid].resize(outputDataStruct.GetDataCount() * this->GetMaxBatchSize());
 		}
 
 		return thrust::raw_pointer_cast(&this->lpLayerOutputBuffer_d[i_guid][0]);
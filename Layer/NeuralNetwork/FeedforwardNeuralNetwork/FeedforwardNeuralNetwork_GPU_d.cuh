@@ -21,7 +21,14 @@ namespace NeuralNetwork {
 	class FeedforwardNeuralNetwork_GPU_d : public FeedforwardNeuralNetwork_GPU_base
 	{
 	private:
+		struct BufferInfo
+		{
+			GUID reserveLayerID;
+			thrust::device_vector<F32> lpBuffer;
+		};
+
 		std::map<GUID, thrust::device_vector<F32>>	lpLayerOutputBuffer_d;	/**< eC[Ƃ̏o̓obt@(foCX) */
+		std::vector<BufferInfo> lpTemporaryOutputBuffer;	/**< L̏o̓obt@. ČvZC[p̃obt@̂݊mۂ */
 
 		//====================================
 		// RXgN^/fXgN^
@@ -51,6 +58,9 @@ namespace NeuralNetwork {
 		/** o̓obt@̃TCYݒ肷 */
 		ErrorCode ResizeOutputBuffer(U32 i_outputBufferNo, U32 i_bufferSize);
 
+		/** C[ƂɊmۂo̓obt@ */
+		void ReleaseLayerOutputBuffer(const Gravisbell::GUID& i_guid);
+
 	public:
 		/** o̓obt@݂̌̎gp҂擾 */
 		GUID GetReservedOutputBufferID(U32 i_outputBufferNo);
@@ -68,6 +68,19 @@ namespace NeuralNetwork {
 		this->lpTemporaryOutputBuffer[i_outputBufferNo].lpBuffer.resize(i_bufferSize);
 
 		return ErrorCode::ERROR_CODE_NONE;
+	}
+
+	/** C[ƂɊmۂo̓obt@.
+		foCX̃obt@\񒆂̏ꍇ͗\AzXg֑ޔȂ悤ɂ. */
+	void FeedforwardNeuralNetwork_GPU_h::ReleaseLayerOutputBuffer(const Gravisbell::GUID& i_guid)
+	{
+		this->lpLayerOutputBuffer_h.erase(i_guid);
+
+		for(auto& buffer : this->lpTemporaryOutputBuffer)
+		{
+			if(buffer.reserveLayerID == i_guid)
+				buffer.reserveLayerID = GUID();
+		}
 	}
 
 	/** o̓obt@݂̌̎gp҂擾 */
@@ -84,12 +97,21 @@ namespace NeuralNetwork {
 		if(i_outputBufferNo >= this->lpTemporaryOutputBuffer.size())
 			return NULL;
 
+		// ČvZC[͌덷`ɏo͂𕜌邽߁AzXgɑޔȂ
+		if(this->IsRecomputeOutputBuffer(i_outputBufferNo))
+		{
+			this->lpTemporaryOutputBuffer[i_outputBufferNo].reserveLayerID = i_guid;
+
+			return thrust::raw_pointer_cast(&this->lpTemporaryOutputBuffer[i_outputBufferNo].lpBuffer[0]);
+		}
+
 		if(this->lpLayerOutputBuffer_h.count(i_guid) == 0)
 		{
-			// C[̏o̓obt@mۂ
+			// C[̏o̓obt@mۂ.
+			// SetBatchSizeŌォob`TCY傫Ă悤ɍőob`TCYmۂ
 			IODataStruct outputDataStruct = this->GetOutputDataStruct(i_guid);
 
-			this->lpLayerOutputBuffer_h[i_guid].resize(outputDataStruct.GetDataCount() * this->GetBatchSize());
+			this->lpLayerOutputBuffer_h[i_guid].resize(outputDataStruct.GetDataCount() * this->GetMaxBatchSize());
 		}
 
 		// Ώۂ̃obt@\񒆂łȂꍇÃ݂obt@zXgɑޔ.Vobt@̓efoCXɃRs[
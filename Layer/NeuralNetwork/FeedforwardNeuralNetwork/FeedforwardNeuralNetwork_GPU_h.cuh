@@ -58,6 +58,9 @@ namespace NeuralNetwork {
 		/** o̓obt@̃TCYݒ肷 */
 		ErrorCode ResizeOutputBuffer(U32 i_outputBufferNo, U32 i_bufferSize);
 
+		/** C[ƂɊmۂo̓obt@ */
+		void ReleaseLayerOutputBuffer(const Gravisbell::GUID& i_guid);
+
 	public:
 		/** o̓obt@݂̌̎gp҂擾 */
 		GUID GetReservedOutputBufferID(U32 i_outputBufferNo);
@@ -0,0 +1,152 @@
+//======================================
+// C[̏Xgɑ΂œKpX
+// ڑ̊mAobt@̊蓖đOɓKp
+//======================================
+#include"stdafx.h"
+
+#include<set>
+
+#include"FeedforwardNeuralNetwork_GraphPass.h"
+#include"FeedforwardNeuralNetwork_Base.h"
+
+namespace Gravisbell {
+namespace Layer {
+namespace NeuralNetwork {
+
+	/** o̓C[瓞BłȂC[OpX.
+		Xg͏o̓C[͕ɒHč쐬Ă邽߁Ał͏OꂽC[񍐂. */
+	class GraphPass_DeadLayerElimination : public IGraphPass
+	{
+	public:
+		/** pX̖O擾 */
+		const wchar_t* GetName()const
+		{
+			return L"DeadLayerElimination";
+		}
+
+		/** pXKp */
+		ErrorCode Apply(FeedforwardNeuralNetwork_Base& i_neuralNetwork, std::list<ILayerConnect*>& io_lpCalculateLayerList, bool i_onLearnMode, std::vector<Gravisbell::GUID>& o_lpChangeLayerGUID)
+		{
+			std::set<Gravisbell::GUID> lpCalculateLayerGUID;
+			for(auto pLayer : io_lpCalculateLayerList)
+				lpCalculateLayerGUID.insert(pLayer->GetGUID());
+
+			for(U32 layerNum=0; layerNum<i_neuralNetwork.GetLayerCount(); layerNum++)
+			{
+				Gravisbell::GUID layerGUID;
+				ErrorCode err = i_neuralNetwork.GetLayerGUIDbyNum(layerNum, layerGUID);
+				if(err != ErrorCode::ERROR_CODE_NONE)
+					return err;
+
+				if(lpCalculateLayerGUID.count(layerGUID) == 0)
+					o_lpChangeLayerGUID.push_back(layerGUID);
+			}
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+	};
+
+	/** Zʂ͂ƈv郌C[̉ZȗpX.
+		ZȗC[͓͌C[̏o̓obt@g̏o͂ƂAo̓obt@Ȃ.
+		wK͊eC[̏o͂덷`ɕKvȂ߁AZp̎Oł̂ݓKp. */
+	class GraphPass_IdentityElimination : public IGraphPass
+	{
+	public:
+		/** pX̖O擾 */
+		const wchar_t* GetName()const
+		{
+			return L"IdentityElimination";
+		}
+
+		/** pXKp */
+		ErrorCode Apply(FeedforwardNeuralNetwork_Base& i_neuralNetwork, std::list<ILayerConnect*>& io_lpCalculateLayerList, bool i_onLearnMode, std::vector<Gravisbell::GUID>& o_lpChangeLayerGUID)
+		{
+			if(i_onLearnMode)
+				return ErrorCode::ERROR_CODE_NONE;
+
+			for(auto pLayer : io_lpCalculateLayerList)
+			{
+				if(!pLayer->CheckIsIdentity())
+					continue;
+				if(pLayer->SetPassThroughFlag(true) != ErrorCode::ERROR_CODE_NONE)
+					continue;
+
+				o_lpChangeLayerGUID.push_back(pLayer->GetGUID());
+			}
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+	};
+
+	/** vfPʂ̌㏈(֐)͌C[̉ZɓpX.
+		C[͉ZȗA͌C[o̓obt@߂OɌ㏈Kp.
+		͌C[̏o͂̃C[QƂꍇAČvZΏۂ̏ꍇ͓Ȃ. */
+	class GraphPass_EpilogueFusion : public IGraphPass
+	{
+	public:
+		/** pX̖O擾 */
+		const wchar_t* GetName()const
+		{
+			return L"EpilogueFusion";
+		}
+
+		/** pXKp */
+		ErrorCode Apply(FeedforwardNeuralNetwork_Base& i_neuralNetwork, std::list<ILayerConnect*>& io_lpCalculateLayerList, bool i_onLearnMode, std::vector<Gravisbell::GUID>& o_lpChangeLayerGUID)
+		{
+			for(auto pLayer : io_lpCalculateLayerList)
+			{
+				if(pLayer->GetPassThroughFlag())
+					continue;
+				if(!pLayer->CheckCanEpilogue())
+					continue;
+				if(pLayer->GetInputLayerCount() != 1 || pLayer->GetOutputToLayerCount() != 1)
+					continue;
+
+				ILayerConnect* pInputLayer = pLayer->GetInputLayerByNum(0);
+				if(pInputLayer == NULL)
+					continue;
+				if(pInputLayer->GetPassThroughFlag() || pInputLayer->GetOutputToLayerCount() != 1)
+					continue;
+				if(i_neuralNetwork.GetLayerRecomputeFlag(pInputLayer->GetGUID()) || i_neuralNetwork.GetLayerRecomputeFlag(pLayer->GetGUID()))
+					continue;
+
+				if(pInputLayer->SetEpilogueLayer(pLayer) != ErrorCode::ERROR_CODE_NONE)
+					continue;
+				if(pLayer->SetPassThroughFlag(true) != ErrorCode::ERROR_CODE_NONE)
+				{
+					pInputLayer->SetEpilogueLayer(NULL);
+					continue;
+				}
+
+				o_lpChangeLayerGUID.push_back(pLayer->GetGUID());
+			}
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+	};
+
+
+	/** W̍œKpXKpɍ쐬.
+		@param	o_lpGraphPass	쐬pX̒ǉ. pX̍폜͌Ăяoōs. */
+	void CreateDefaultGraphPass(std::vector<GraphPassInfo>& o_lpGraphPass)
+	{
+		IGraphPass* lpPass[] =
+		{
+			new GraphPass_DeadLayerElimination(),
+			new GraphPass_IdentityElimination(),
+			new GraphPass_EpilogueFusion(),
+		};
+
+		for(auto pPass : lpPass)
+		{
+			GraphPassInfo info;
+			info.pPass = pPass;
+			info.onEnable = true;
+
+			o_lpGraphPass.push_back(info);
+		}
+	}
+
+}	// NeuralNetwork
+}	// Layer
+}	// Gravisbell
@@ -0,0 +1,55 @@
+//======================================
+// C[̏Xgɑ΂œKpX
+// ڑ̊mAobt@̊蓖đOɓKp
+//======================================
+#ifndef __GRAVISBELL_FEEDFORWARD_NEURALNETWORK_GRAPHPASS_H__
+#define __GRAVISBELL_FEEDFORWARD_NEURALNETWORK_GRAPHPASS_H__
+
+#include"LayerConnect.h"
+
+#include<list>
+#include<vector>
+
+namespace Gravisbell {
+namespace Layer {
+namespace NeuralNetwork {
+
+	/** C[̏Xgɑ΂œKpX */
+	class IGraphPass
+	{
+	public:
+		/** RXgN^ */
+		IGraphPass(){}
+		/** fXgN^ */
+		virtual ~IGraphPass(){}
+
+	public:
+		/** pX̖O擾 */
+		virtual const wchar_t* GetName()const = 0;
+
+		/** pXKp.
+			@param	i_neuralNetwork			KpΏۂ̃j[lbg[N.
+			@param	io_lpCalculateLayerList	C[ɕׂXg.
+			@param	i_onLearnMode			wKp̎Ȍꍇtrue.
+			@param	o_lpChangeLayerGUID		ύXC[GUID̒ǉ. */
+		virtual ErrorCode Apply(class FeedforwardNeuralNetwork_Base& i_neuralNetwork, std::list<ILayerConnect*>& io_lpCalculateLayerList, bool i_onLearnMode, std::vector<Gravisbell::GUID>& o_lpChangeLayerGUID) = 0;
+	};
+
+	/** œKpX̓o^ */
+	struct GraphPassInfo
+	{
+		IGraphPass* pPass;	/**< pX{ */
+		bool onEnable;		/**< LtO */
+		std::vector<Gravisbell::GUID> lpChangeLayerGUID;	/**< ỎZOŕύXC[GUID */
+	};
+
+	/** W̍œKpXKpɍ쐬.
+		@param	o_lpGraphPass	쐬pX̒ǉ. pX̍폜͌Ăяoōs. */
+	void CreateDefaultGraphPass(std::vector<GraphPassInfo>& o_lpGraphPass);
+
+}	// NeuralNetwork
+}	// Layer
+}	// Gravisbell
+
+
+#endif	// __GRAVISBELL_FEEDFORWARD_NEURALNETWORK_GRAPHPASS_H__
@@ -23,6 +23,13 @@ namespace NeuralNetwork {
 		:	layerDLLManager	(i_layerDLLManager)
 		,	guid			(guid)
 		,	pLayerStructure	(NULL)
+		,	onFlatParameter		(false)
+		,	pBindParameter		(NULL)
+		,	pBindDParameter		(NULL)
+		,	bindParameterCount	(0)
+		,	lpFlatParameter		(NULL)
+		,	lpFlatDParameter	(NULL)
+		,	onDeferredUpdate	(false)
 	{
 	}
 	/** fXgN^ */
@@ -50,7 +57,9 @@ namespace NeuralNetwork {
 			connectInfo.second.pLayerData->Initialize();
 		}
 
-		return ErrorCode::ERROR_CODE_NONE;
+		// ō蒼ꂽC[zu
+		this->ApplyDeferredUpdateFlag();
+		return this->UpdateParameterBuffer();
 	}
 	/** . ej[̒l_ɏ
 		@param	i_config			ݒ
@@ -209,6 +218,7 @@ namespace NeuralNetwork {
 				// C[ڑ
 				this->lpConnectInfo[layerConnect.guid] = layerConnect;
 			}
+			this->lpConnectInfoByNum.clear();
 		}
 
 		// o̓C[GUID
@@ -217,7 +227,9 @@ namespace NeuralNetwork {
 
 		o_useBufferSize = readBufferByte;
 
-		return ErrorCode::ERROR_CODE_NONE;
+		// p[^̈
+		this->ApplyDeferredUpdateFlag();
+		return this->UpdateParameterBuffer();
 	}
 
 
@@ -521,6 +533,8 @@ namespace NeuralNetwork {
 		// ̓C[قȂꍇ͏I
 		if(i_inputLayerCount != this->layerStructure.inputLayerCount)
 			return IODataStruct(0,0,0,0);
+
+		std::lock_guard<std::mutex> lock(this->tmp_mutex);
 
 		this->tmp_lpInputDataStruct = i_lpInputDataStruct;
 		this->tmp_inputLayerCount = i_inputLayerCount;
@@ -791,20 +805,18 @@ namespace NeuralNetwork {
 
 		// ǉ
 		this->lpConnectInfo[i_guid] = LayerConnect(i_guid, i_pLayerData, i_onFixFlag);
+		this->lpConnectInfoByNum.clear();
 
-		return ErrorCode::ERROR_CODE_NONE;
+		// p[^̈zu
+		this->ApplyDeferredUpdateFlag();
+		return this->UpdateParameterBuffer();
 	}
 	/** C[f[^폜.
 		@param i_guid	폜郌C[GUID */
 	ErrorCode FeedforwardNeuralNetwork_LayerData_Base::EraseLayer(const Gravisbell::GUID& i_guid)
 	{
 		// 폜C[
-		auto it = this->lpConnectInfo.begin();
-		while(it != this->lpConnectInfo.end())
-		{
-			if(it->second.guid == i_guid)
-				break;
-		}
+		auto it = this->lpConnectInfo.find(i_guid);
 		if(it == this->lpConnectInfo.end())
 			return ErrorCode::ERROR_CODE_ERASELAYER_NOTFOUND;
 
@@ -813,6 +825,24 @@ namespace NeuralNetwork {
 		{
 			this->EraseInputLayerFromLayer(it_search.second.guid, i_guid);
 			this->EraseBypassLayerFromLayer(it_search.second.guid, i_guid);
+		}
+
+		// ̃C[̃C[f[^gpĂȂꍇ͗̈悩O
+		{
+			bool onUseOther = false;
+			for(auto& it_search : this->lpConnectInfo)
+			{
+				if(it_search.second.guid != i_guid && it_search.second.pLayerData == it->second.pLayerData)
+				{
+					onUseOther = true;
+					break;
+				}
+			}
+			if(!onUseOther && it->second.pLayerData)
+			{
+				this->UnbindParameterBuffer(it->second.pLayerData);
+				it->second.pLayerData->SetDeferredUpdateFlag(false);
+			}
 		}
 
 		// C[f[^{̂ꍇ͍폜
@@ -845,18 +875,31 @@ namespace NeuralNetwork {
 
 		// ڑ폜
 		this->lpConnectInfo.erase(it);
+		this->lpConnectInfoByNum.clear();
 
 		// o͑ΏۃC[̏ꍇ
 		if(this->outputLayerGUID == i_guid)
 			this->outputLayerGUID = Gravisbell::GUID();
 
-		return ErrorCode::ERROR_CODE_NONE;
+		// p[^̈zu
+		return this->UpdateParameterBuffer();
 	}
 	/** C[f[^S폜 */
 	ErrorCode FeedforwardNeuralNetwork_LayerData_Base::EraseAllLayer()
 	{
+		// ̈悩O
+		for(auto& it : this->lpConnectInfo)
+		{
+			if(it.second.pLayerData == NULL)
+				continue;
+
+			this->UnbindParameterBuffer(it.second.pLayerData);
+			it.second.pLayerData->SetDeferredUpdateFlag(false);
+		}
+
 		// ڑS폜
 		this->lpConnectInfo.clear();
+		this->lpConnectInfoByNum.clear();
 
 		// C[f[^{̂폜
 		for(auto it : this->lpLayerData)
@@ -868,7 +911,8 @@ namespace NeuralNetwork {
 		// o͑ΏۃC[̏ꍇ
 		this->outputLayerGUID = Gravisbell::GUID();
 
-		return ErrorCode::ERROR_CODE_NONE;
+		// p[^̈zu
+		return this->UpdateParameterBuffer();
 	}
 
 	/** o^Ă郌C[擾 */
@@ -879,14 +923,11 @@ namespace NeuralNetwork {
 	/** C[GUIDԍwŎ擾 */
 	ErrorCode FeedforwardNeuralNetwork_LayerData_Base::GetLayerGUIDbyNum(U32 i_layerNum, Gravisbell::GUID& o_guid)
 	{
-		if(i_layerNum >= this->lpConnectInfo.size())
+		LayerConnect* pLayerConnect = this->GetLayerByNum(i_layerNum);
+		if(pLayerConnect == NULL)
 			return ErrorCode::ERROR_CODE_COMMON_OUT_OF_ARRAYRANGE;
 
-		auto it = this->lpConnectInfo.begin();
-		for(U32 i=0; i<i_layerNum; i++)
-			it++;
-
-		o_guid = it->second.guid;
+		o_guid = pLayerConnect->guid;
 
 		return ErrorCode::ERROR_CODE_NONE;
 	}
@@ -897,11 +938,16 @@ namespace NeuralNetwork {
 		if(i_layerNum >= this->lpConnectInfo.size())
 			return NULL;
 
-		auto it = this->lpConnectInfo.begin();
-		for(U32 i=0; i<i_layerNum; i++)
-			it++;
+		// C[̒ǉ/폜Aŏ̎擾ɔԍwp̈ꗗ쐬
+		if(this->lpConnectInfoByNum.size() != this->lpConnectInfo.size())
+		{
+			this->lpConnectInfoByNum.clear();
+			this->lpConnectInfoByNum.reserve(this->lpConnectInfo.size());
+			for(auto& it : this->lpConnectInfo)
+				this->lpConnectInfoByNum.push_back(&it.second);
+		}
 
-		return &it->second;
+		return this->lpConnectInfoByNum[i_layerNum];
 	}
 	/** o^Ă郌C[GUIDwŎ擾 */
 	FeedforwardNeuralNetwork_LayerData_Base::LayerConnect* FeedforwardNeuralNetwork_LayerData_Base::GetLayerByGUID(const Gravisbell::GUID& i_guid)
@@ -1285,7 +1331,342 @@ namespace NeuralNetwork {
 
 		return ErrorCode::ERROR_CODE_NONE;
 	}
+	/** C[ێĂSẴIveB}CU[wIDł邩mF */
+	bool FeedforwardNeuralNetwork_LayerData_Base::CheckOptimizerID(const wchar_t i_optimizerID[])const
+	{
+		for(auto& it : this->lpConnectInfo)
+		{
+			if(it.second.pLayerData && !it.second.pLayerData->CheckOptimizerID(i_optimizerID))
+				return false;
+		}
+
+		return true;
+	}
 
+
+	//====================================
+	// p[^̈
+	//====================================
+	/** Õp[^̈ɔzuꍇɕKvȗvf擾 */
+	U64 FeedforwardNeuralNetwork_LayerData_Base::GetParameterCount()const
+	{
+		std::vector<ILayerData*> lpParameterLayerData;
+		this->GetParameterLayerDataList(lpParameterLayerData);
+
+		U64 parameterCount = 0;
+		for(auto pLayerData : lpParameterLayerData)
+			parameterCount += pLayerData->GetParameterCount();
+
+		return parameterCount;
+	}
+	/** p[^ƌ덷̊i[ʂ̃lbg[N̗̈ɕύX.
+		NULLw肵ꍇ͎g̐ݒɏ]Ĕzu. */
+	ErrorCode FeedforwardNeuralNetwork_LayerData_Base::BindParameterBuffer(F32* io_lpParameter, F32* io_lpDParameter)
+	{
+		if((io_lpParameter == NULL) != (io_lpDParameter == NULL))
+			return ErrorCode::ERROR_CODE_COMMON_NULL_REFERENCE;
+
+		this->pBindParameter  = io_lpParameter;
+		this->pBindDParameter = io_lpDParameter;
+		this->bindParameterCount = io_lpParameter ? this->GetParameterCount() : 0;
+
+		return this->UpdateParameterBuffer();
+	}
+
+	/** C[̃p[^ƌ덷AꂼA1̗̈ɔzu邩ݒ肷 */
+	ErrorCode FeedforwardNeuralNetwork_LayerData_Base::SetFlatParameterFlag(bool i_onFlatParameter)
+	{
+		if(this->onFlatParameter == i_onFlatParameter)
+			return ErrorCode::ERROR_CODE_NONE;
+
+		this->onFlatParameter = i_onFlatParameter;
+
+		return this->UpdateParameterBuffer();
+	}
+	/** Äɔzu邩擾 */
+	bool FeedforwardNeuralNetwork_LayerData_Base::GetFlatParameterFlag()const
+	{
+		return this->onFlatParameter;
+	}
+
+	/** p[^̗̈擾 */
+	F32* FeedforwardNeuralNetwork_LayerData_Base::GetFlatParameterBuffer()
+	{
+		if(this->pBindParameter && this->bindParameterCount == this->GetParameterCount())
+			return this->pBindParameter;
+		return this->lpFlatParameter;
+	}
+	/** 덷̗̈擾 */
+	F32* FeedforwardNeuralNetwork_LayerData_Base::GetFlatDParameterBuffer()
+	{
+		if(this->pBindDParameter && this->bindParameterCount == this->GetParameterCount())
+			return this->pBindDParameter;
+		return this->lpFlatDParameter;
+	}
+
+	/** C[̈ɔzu.
+		C[̒ǉ/폜AɌĂяo. */
+	ErrorCode FeedforwardNeuralNetwork_LayerData_Base::UpdateParameterBuffer()
+	{
+		// zu郌C[f[^̈ꗗ쐬
+		std::vector<ILayerData*> lpParameterLayerData;
+		this->GetParameterLayerDataList(lpParameterLayerData);
+
+		std::vector<std::pair<ILayerData*, U64>> lpLayout;
+		U64 parameterCount = 0;
+		for(auto pLayerData : lpParameterLayerData)
+		{
+			U64 layerParameterCount = pLayerData->GetParameterCount();
+			if(layerParameterCount == 0)
+				continue;
+
+			lpLayout.push_back(std::pair<ILayerData*, U64>(pLayerData, layerParameterCount));
+			parameterCount += layerParameterCount;
+		}
+
+		// zu
+		F32* pParameter  = NULL;
+		F32* pDParameter = NULL;
+		F32* lpOldParameter  = NULL;
+		F32* lpOldDParameter = NULL;
+		if(this->pBindParameter && this->bindParameterCount == parameterCount)
+		{
+			// ʂ̃lbg[N̗̈gp
+			pParameter  = this->pBindParameter;
+			pDParameter = this->pBindDParameter;
+
+			lpOldParameter  = this->lpFlatParameter;
+			lpOldDParameter = this->lpFlatDParameter;
+			this->lpFlatParameter  = NULL;
+			this->lpFlatDParameter = NULL;
+		}
+		else if(this->onFlatParameter && parameterCount > 0)
+		{
+			// zuςꍇ̂݊mۂ
+			if(this->lpFlatParameter == NULL || this->lpFlatParameterLayout != lpLayout)
+			{
+				F32* lpNewParameter  = this->AllocateParameterBuffer(parameterCount);
+				F32* lpNewDParameter = this->AllocateParameterBuffer(parameterCount);
+				if(lpNewParameter == NULL || lpNewDParameter == NULL)
+				{
+					if(lpNewParameter)
+						this->ReleaseParameterBuffer(lpNewParameter);
+					if(lpNewDParameter)
+						this->ReleaseParameterBuffer(lpNewDParameter);
+					return ErrorCode::ERROR_CODE_COMMON_ALLOCATION_MEMORY;
+				}
+
+				lpOldParameter  = this->lpFlatParameter;
+				lpOldDParameter = this->lpFlatDParameter;
+				this->lpFlatParameter  = lpNewParameter;
+				this->lpFlatDParameter = lpNewDParameter;
+			}
+
+			pParameter  = this->lpFlatParameter;
+			pDParameter = this->lpFlatDParameter;
+		}
+		else
+		{
+			// eC[̗̓̈ɖ߂
+			lpOldParameter  = this->lpFlatParameter;
+			lpOldDParameter = this->lpFlatDParameter;
+			this->lpFlatParameter  = NULL;
+			this->lpFlatDParameter = NULL;
+		}
+
+		// eC[zu.
+		// ō蒼ꂽC[邽߁AzuςȂꍇ蓖Ē
+		ErrorCode err = ErrorCode::ERROR_CODE_NONE;
+		U64 offset = 0;
+		for(auto& layout : lpLayout)
+		{
+			if(pParameter)
+				err = layout.first->BindParameterBuffer(&pParameter[offset], &pDParameter[offset]);
+			else
+				err = layout.first->BindParameterBuffer(NULL, NULL);
+			if(err != ErrorCode::ERROR_CODE_NONE)
+				break;
+
+			offset += layout.second;
+		}
+		this->lpFlatParameterLayout = lpLayout;
+
+		// ȑÖ̗J
+		if(lpOldParameter)
+			this->ReleaseParameterBuffer(lpOldParameter);
+		if(lpOldDParameter)
+			this->ReleaseParameterBuffer(lpOldDParameter);
+
+		return err;
+	}
+	/** C[̈悩O */
+	void FeedforwardNeuralNetwork_LayerData_Base::UnbindParameterBuffer(ILayerData* i_pLayerData)
+	{
+		if(i_pLayerData == NULL)
+			return;
+
+		for(auto it=this->lpFlatParameterLayout.begin(); it!=this->lpFlatParameterLayout.end(); it++)
+		{
+			if(it->first == i_pLayerData)
+			{
+				i_pLayerData->BindParameterBuffer(NULL, NULL);
+				this->lpFlatParameterLayout.erase(it);
+				break;
+			}
+		}
+	}
+	/** ̈ɔzuC[f[^̈ꗗ擾. d͏ */
+	void FeedforwardNeuralNetwork_LayerData_Base::GetParameterLayerDataList(std::vector<ILayerData*>& o_lpLayerData)const
+	{
+		std::set<ILayerData*> lpUsedLayerData;
+		for(auto& it : this->lpConnectInfo)
+		{
+			if(it.second.pLayerData == NULL)
+				continue;
+			if(lpUsedLayerData.count(it.second.pLayerData))
+				continue;
+
+			lpUsedLayerData.insert(it.second.pLayerData);
+			o_lpLayerData.push_back(it.second.pLayerData);
+		}
+	}
+
+	/** gŊmۂ̈SĊJ. hNX̃fXgN^Ăяo.
+		J̈C[QƂȂ悤AzuC[ɗ̈悩O */
+	void FeedforwardNeuralNetwork_LayerData_Base::ReleaseFlatParameterBuffer()
+	{
+		for(auto& layout : this->lpFlatParameterLayout)
+		{
+			if(layout.first)
+				layout.first->BindParameterBuffer(NULL, NULL);
+		}
+
+		if(this->lpFlatParameter)
+			this->ReleaseParameterBuffer(this->lpFlatParameter);
+		if(this->lpFlatDParameter)
+			this->ReleaseParameterBuffer(this->lpFlatDParameter);
+		this->lpFlatParameter  = NULL;
+		this->lpFlatDParameter = NULL;
+		this->lpFlatParameterLayout.clear();
+	}
+
+
+	//====================================
+	// ꊇXV
+	//====================================
+	/** C[̍XVx邩ݒ肷 */
+	ErrorCode FeedforwardNeuralNetwork_LayerData_Base::SetDeferredUpdateFlag(bool i_onDeferredUpdate)
+	{
+		this->onDeferredUpdate = i_onDeferredUpdate;
+
+		this->ApplyDeferredUpdateFlag();
+
+		return ErrorCode::ERROR_CODE_NONE;
+	}
+	/** C[̍XVxĂ邩擾 */
+	bool FeedforwardNeuralNetwork_LayerData_Base::GetDeferredUpdateFlag()const
+	{
+		return this->onDeferredUpdate;
+	}
+	/** ꊇXV̑Ώې擾 */
+	U32 FeedforwardNeuralNetwork_LayerData_Base::GetUpdateTargetCount()const
+	{
+		std::vector<ILayerData*> lpParameterLayerData;
+		this->GetParameterLayerDataList(lpParameterLayerData);
+
+		U32 targetCount = 0;
+		for(auto pLayerData : lpParameterLayerData)
+			targetCount += pLayerData->GetUpdateTargetCount();
+
+		return targetCount;
+	}
+	/** ꊇXV̑Ώۂ擾 */
+	ErrorCode FeedforwardNeuralNetwork_LayerData_Base::GetUpdateTarget(U32 i_targetNum, OptimizerUpdateTarget& o_target)
+	{
+		std::vector<ILayerData*> lpParameterLayerData;
+		this->GetParameterLayerDataList(lpParameterLayerData);
+
+		for(auto pLayerData : lpParameterLayerData)
+		{
+			U32 targetCount = pLayerData->GetUpdateTargetCount();
+			if(i_targetNum < targetCount)
+				return pLayerData->GetUpdateTarget(i_targetNum, o_target);
+
+			i_targetNum -= targetCount;
+		}
+
+		return ErrorCode::ERROR_CODE_COMMON_OUT_OF_ARRAYRANGE;
+	}
+	/** ꊇXV̊ʒm */
+	ErrorCode FeedforwardNeuralNetwork_LayerData_Base::CompleteUpdate()
+	{
+		std::vector<ILayerData*> lpParameterLayerData;
+		this->GetParameterLayerDataList(lpParameterLayerData);
+
+		ErrorCode result = ErrorCode::ERROR_CODE_NONE;
+		for(auto pLayerData : lpParameterLayerData)
+		{
+			ErrorCode err = pLayerData->CompleteUpdate();
+			if(err != ErrorCode::ERROR_CODE_NONE && result == ErrorCode::ERROR_CODE_NONE)
+				result = err;
+		}
+
+		return result;
+	}
+
+	/** xĂC[̍XVꊇŔf */
+	ErrorCode FeedforwardNeuralNetwork_LayerData_Base::UpdatePendingParameter()
+	{
+		if(!this->onDeferredUpdate)
+			return ErrorCode::ERROR_CODE_NONE;
+
+		// 덷i[ĂΏۂW.
+		// ̃lbg[N̑ΏۂWJ
+		std::vector<OptimizerUpdateTarget> lpTarget;
+		{
+			std::vector<ILayerData*> lpParameterLayerData;
+			this->GetParameterLayerDataList(lpParameterLayerData);
+
+			for(auto pLayerData : lpParameterLayerData)
+			{
+				U32 targetCount = pLayerData->GetUpdateTargetCount();
+				for(U32 targetNum=0; targetNum<targetCount; targetNum++)
+				{
+					OptimizerUpdateTarget target;
+					if(pLayerData->GetUpdateTarget(targetNum, target) != ErrorCode::ERROR_CODE_NONE)
+						continue;
+					if(target.pOptimizer == NULL)
+						continue;
+
+					lpTarget.push_back(target);
+				}
+			}
+		}
+
+		// ꊇōXV
+		ErrorCode err = ErrorCode::ERROR_CODE_NONE;
+		if(!lpTarget.empty())
+			err = this->UpdateParameterMulti(&lpTarget[0], (U32)lpTarget.size());
+
+		// XV̒l𔽉f
+		ErrorCode errComplete = this->CompleteUpdate();
+		if(err == ErrorCode::ERROR_CODE_NONE)
+			err = errComplete;
+
+		return err;
+	}
+
+	/** C[ɍXV̒x̐ݒ𔽉f */
+	void FeedforwardNeuralNetwork_LayerData_Base::ApplyDeferredUpdateFlag()
+	{
+		std::vector<ILayerData*> lpParameterLayerData;
+		this->GetParameterLayerDataList(lpParameterLayerData);
+
+		// xłȂC[͏]ʂ葦ɍXV邽߁A߂l͊mFȂ
+		for(auto pLayerData : lpParameterLayerData)
+			pLayerData->SetDeferredUpdateFlag(this->onDeferredUpdate);
+	}
+
 }	// NeuralNetwork
 }	// Layer
 }	// Gravisbell
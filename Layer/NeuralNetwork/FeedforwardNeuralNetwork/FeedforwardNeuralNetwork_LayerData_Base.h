@@ -8,6 +8,7 @@
 #include<set>
 #include<map>
 #include<vector>
+#include<mutex>
 
 #include<Layer/Connect/ILayerConnectData.h>
 #include<Layer/ILayerData.h>
@@ -70,9 +71,20 @@ namespace NeuralNetwork {
 
 		std::map<Gravisbell::GUID, ILayerData*> lpLayerData;	/**< C[f[^GUID, C[f[^ */
 		std::map<Gravisbell::GUID, LayerConnect> lpConnectInfo;	/**< C[GUID, C[ڑ */
+		std::vector<LayerConnect*> lpConnectInfoByNum;			/**< ԍwŎ擾邽߂̃C[ڑ. C[̒ǉ/폜ɔjA̎擾ɍ쐬 */
 
 		SettingData::Standard::IData* pLayerStructure;	/**< C[\`RtBONX */
 		FeedforwardNeuralNetwork::LayerStructure layerStructure;	/**< C[\ */
+
+		bool onFlatParameter;				/**< C[̃p[^ÄɔzutO */
+		F32* pBindParameter;				/**< ʂ̃lbg[N犄蓖Ăꂽp[^̈ */
+		F32* pBindDParameter;				/**< ʂ̃lbg[N犄蓖Ăꂽ덷̈ */
+		U64 bindParameterCount;				/**< ʂ̃lbg[N犄蓖Ăꂽ̗̈vf */
+		F32* lpFlatParameter;				/**< gŊmۂp[^̈ */
+		F32* lpFlatDParameter;				/**< gŊmۂ덷̈ */
+		std::vector<std::pair<ILayerData*, U64>> lpFlatParameterLayout;	/**< ̈ɔzuC[f[^Ɨvf. zu */
+
+		bool onDeferredUpdate;				/**< C[̍XVxAꊇōXVtO */
 
 
 		//====================================
@@ -169,6 +181,7 @@ namespace NeuralNetwork {
 		const IODataStruct* tmp_lpInputDataStruct;
 		U32 tmp_inputLayerCount;
 		std::map<Gravisbell::GUID, IODataStruct> tmp_lpOutputDataStruct;
+		std::mutex tmp_mutex;	/**< o̓f[^\vZp̈ꎞϐ̔r. Xbh瓯CreateLayerĂяo悤ɂ */
 
 		/** o̓f[^\擾.
 			@param	i_lpInputDataStruct	̓f[^\̔z. GetInputFromLayerCount()̖߂lȏ̗vfKv
@@ -302,6 +315,77 @@ namespace NeuralNetwork {
 		ErrorCode SetOptimizerHyperParameter(const wchar_t i_parameterID[], F32 i_value);
 		ErrorCode SetOptimizerHyperParameter(const wchar_t i_parameterID[], S32 i_value);
 		ErrorCode SetOptimizerHyperParameter(const wchar_t i_parameterID[], const wchar_t i_value[]);
+		/** C[ێĂSẴIveB}CU[wIDł邩mF */
+		bool CheckOptimizerID(const wchar_t i_optimizerID[])const;
+
+
+		//====================================
+		// p[^̈
+		//====================================
+	public:
+		/** Õp[^̈ɔzuꍇɕKvȗvf擾 */
+		U64 GetParameterCount()const;
+		/** p[^ƌ덷̊i[ʂ̃lbg[N̗̈ɕύX.
+			NULLw肵ꍇ͎g̐ݒɏ]Ĕzu. */
+		ErrorCode BindParameterBuffer(F32* io_lpParameter, F32* io_lpDParameter);
+
+		/** C[̃p[^ƌ덷AꂼA1̗̈ɔzu邩ݒ肷 */
+		ErrorCode SetFlatParameterFlag(bool i_onFlatParameter);
+		/** Äɔzu邩擾 */
+		bool GetFlatParameterFlag()const;
+
+		/** p[^̗̈擾 */
+		F32* GetFlatParameterBuffer();
+		/** 덷̗̈擾 */
+		F32* GetFlatDParameterBuffer();
+
+	protected:
+		/** C[̈ɔzu.
+			C[̒ǉ/폜AɌĂяo. */
+		ErrorCode UpdateParameterBuffer();
+		/** C[̈悩O */
+		void UnbindParameterBuffer(ILayerData* i_pLayerData);
+		/** ̈ɔzuC[f[^̈ꗗ擾. d͏ */
+		void GetParameterLayerDataList(std::vector<ILayerData*>& o_lpLayerData)const;
+
+		/** foCX0ŏ̈mۂ */
+		virtual F32* AllocateParameterBuffer(U64 i_count) = 0;
+		/** foCẌ̗J */
+		virtual void ReleaseParameterBuffer(F32* i_lpBuffer) = 0;
+		/** gŊmۂ̈SĊJ. hNX̃fXgN^Ăяo.
+			zuC[͗̈悩OĂJ */
+		void ReleaseFlatParameterBuffer();
+
+
+		//====================================
+		// ꊇXV
+		//====================================
+	public:
+		/** C[̍XVx邩ݒ肷.
+			LȏꍇAwK̓C[̍XVUpdatePendingParameterňꊇčs. */
+		ErrorCode SetDeferredUpdateFlag(bool i_onDeferredUpdate);
+		/** C[̍XVxĂ邩擾 */
+		bool GetDeferredUpdateFlag()const;
+		/** ꊇXV̑Ώې擾. C[̑Ώې̍v */
+		U32 GetUpdateTargetCount()const;
+		/** ꊇXV̑Ώۂ擾 */
+		ErrorCode GetUpdateTarget(U32 i_targetNum, OptimizerUpdateTarget& o_target);
+		/** ꊇXV̊ʒm */
+		ErrorCode CompleteUpdate();
+
+		/** xĂC[̍XVꊇŔf.
+			lbg[NwK̍ŌɌĂяo. */
+		ErrorCode UpdatePendingParameter();
+
+	protected:
+		/** C[ɍXV̒x̐ݒ𔽉f.
+			C[̒ǉAɌĂяo. */
+		void ApplyDeferredUpdateFlag();
+
+		/** ̑ΏۂꊇōXV.
+			@param	i_lpTarget		XVΏۂ̔z.
+			@param	i_targetCount	XVΏۂ̐. */
+		virtual ErrorCode UpdateParameterMulti(const OptimizerUpdateTarget i_lpTarget[], U32 i_targetCount) = 0;
 	};
 
 }	// NeuralNetwork
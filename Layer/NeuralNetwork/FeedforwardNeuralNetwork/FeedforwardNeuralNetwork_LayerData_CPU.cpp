@@ -7,6 +7,8 @@
 #include"FeedforwardNeuralNetwork_FUNC.hpp"
 #include"FeedforwardNeuralNetwork_LayerData_Base.h"
 #include"FeedforwardNeuralNetwork_CPU.h"
+
+#include<Library/NeuralNetwork/Optimizer.h>
 
 using namespace Gravisbell;
 
@@ -28,7 +30,39 @@ namespace NeuralNetwork {
 		/** fXgN^ */
 		virtual ~FeedforwardNeuralNetwork_LayerData_CPU()
 		{
+			this->ReleaseFlatParameterBuffer();
 		}
+
+	protected:
+		//===========================
+		// p[^̈
+		//===========================
+		/** foCX0ŏ̈mۂ */
+		F32* AllocateParameterBuffer(U64 i_count)
+		{
+			F32* lpBuffer = (F32*)_aligned_malloc(sizeof(F32) * i_count, 64);
+			if(lpBuffer == NULL)
+				return NULL;
+			memset(lpBuffer, 0, sizeof(F32) * i_count);
+
+			return lpBuffer;
+		}
+		/** foCẌ̗J */
+		void ReleaseParameterBuffer(F32* i_lpBuffer)
+		{
+			_aligned_free(i_lpBuffer);
+		}
+
+		//===========================
+		// ꊇXV
+		//===========================
+		/** ̑ΏۂꊇōXV */
+		ErrorCode UpdateParameterMulti(const OptimizerUpdateTarget i_lpTarget[], U32 i_targetCount)
+		{
+			return UpdateParameterMulti_CPU(i_lpTarget, i_targetCount);
+		}
+
+	public:
 
 		//===========================
 		// C[쐬
@@ -8,6 +8,8 @@
 #include"FeedforwardNeuralNetwork_LayerData_Base.h"
 #include"FeedforwardNeuralNetwork_GPU_d.cuh"
 #include"FeedforwardNeuralNetwork_GPU_h.cuh"
+
+#include<Library/NeuralNetwork/Optimizer.h>
 
 using namespace Gravisbell;
 
@@ -29,7 +31,39 @@ namespace NeuralNetwork {
 		/** fXgN^ */
 		virtual ~FeedforwardNeuralNetwork_LayerData_GPU()
 		{
+			this->ReleaseFlatParameterBuffer();
 		}
+
+	protected:
+		//===========================
+		// p[^̈
+		//===========================
+		/** foCX0ŏ̈mۂ */
+		F32* AllocateParameterBuffer(U64 i_count)
+		{
+			F32* lpBuffer = NULL;
+			if(cudaMalloc((void**)&lpBuffer, sizeof(F32) * i_count) != cudaSuccess)
+				return NULL;
+			cudaMemset(lpBuffer, 0, sizeof(F32) * i_count);
+
+			return lpBuffer;
+		}
+		/** foCẌ̗J */
+		void ReleaseParameterBuffer(F32* i_lpBuffer)
+		{
+			cudaFree(i_lpBuffer);
+		}
+
+		//===========================
+		// ꊇXV
+		//===========================
+		/** ̑ΏۂꊇōXV */
+		ErrorCode UpdateParameterMulti(const OptimizerUpdateTarget i_lpTarget[], U32 i_targetCount)
+		{
+			return UpdateParameterMulti_GPU(i_lpTarget, i_targetCount);
+		}
+
+	public:
 
 		//===========================
 		// C[쐬
@@ -103,15 +103,6 @@ namespace NeuralNetwork {
 		/** ͌덷obt@ʒuwŎ擾 */
 		virtual CONST_BATCH_BUFFER_POINTER GetDInputBufferByNum_d(S32 num)const = 0;
 
-		/** C[Xg쐬.
-			@param	i_lpLayerGUID	ڑĂGUID̃Xg.͕ɊmF. */
-		virtual ErrorCode CreateLayerList(std::set<Gravisbell::GUID>& io_lpLayerGUID)const = 0;
-		/** vZXg쐬.
-			@param	i_lpLayerGUID		SC[GUID.
-			@param	io_lpCalculateList	ZɕׂꂽڑXg.
-			@param	io_lpAddedList		ڑXgɓo^ς݂̃C[GUIDꗗ.
-			@param	io_lpAddWaitList	ǉҋ@Ԃ̐ڑNX̃Xg. */
-		virtual ErrorCode CreateCalculateList(const std::set<Gravisbell::GUID>& i_lpLayerGUID, std::list<ILayerConnect*>& io_lpCalculateList, std::set<Gravisbell::GUID>& io_lpAddedList, std::set<ILayerConnect*>& io_lpAddWaitList) = 0;
 
 	public:
 		/** C[ɓ̓C[ǉ. */
@@ -210,7 +201,42 @@ namespace NeuralNetwork {
 			NN쐬AZsOɈxKs邱ƁBf[^ƂɎsKv͂Ȃ.
 			sꍇCalculateȍ~͎̏ss. */
 		virtual ErrorCode PreProcessCalculate(unsigned int batchSize) = 0;
-
+		/** ZɎgpob`TCYύX.
+			ZOŎw肵ob`TCYȉł΁Aobt@̍Ċmۂs킸ɕύXł. */
+		virtual ErrorCode SetBatchSize(unsigned int batchSize) = 0;
+		/** ZʂČvZŕł邩mF.
+			o̓C[͍ČvZ̑ΏۊO. */
+		virtual bool CheckCanRecompute(void)const = 0;
+		/** ZO(wKp)œo^ꎞobt@̃TCYAobt@mۂɓo^.
+			o̓C[͈ꎞobt@gpȂ߉Ȃ. */
+		virtual ErrorCode RegisterPlannedTemporaryBuffer(Gravisbell::Common::ITemporaryMemoryManager& o_temporaryMemoryManager, U32 i_batchSize)const = 0;
+		/** Z̒ԒlwKɍėpꍇɁAZwK܂ŕێꎞobt@̃TCY߂.
+			o̓C[͒ԒlȂ0. */
+		virtual U64 GetPlannedReuseIntermediateByteCount(U32 i_batchSize)const = 0;
+		/** Z̒ԒlwKɍėp邩ݒ肷.
+			o̓C[͒ԒlȂ߉Ȃ. */
+		virtual void SetReuseIntermediateFlag(bool i_onReuse) = 0;
+
+		/** Zʂ͂ƈv邩mF.
+			P,Po͂̃C[ȊO͑ΏۊO. */
+		virtual bool CheckIsIdentity(void) = 0;
+		/** ZȗA͌C[̏o̓obt@g̏o̓obt@ƂĈݒ肷.
+			OtœKŉZp̎OA͌㏈Ƃē͌C[ɓꍇɂ̂ݐݒ肷.
+			ΏۊÕC[trueݒ肵ꍇERROR_CODE_COMMON_NOT_COMPATIBLE. */
+		virtual ErrorCode SetPassThroughFlag(bool i_onPassThrough) = 0;
+		/** ZȗĂ邩擾 */
+		virtual bool GetPassThroughFlag(void)const = 0;
+
+		/** ͌C[̏o͂̌㏈Ƃē\mF.
+			P,Po͂̃C[ȊO͑ΏۊO. */
+		virtual bool CheckCanEpilogue(void) = 0;
+		/** o͂ɓKp㏈ƂāAĩC[𓝍.
+			C[͉ZȗÃC[̉Z,덷`ŏ.
+			OtœKł̂ݐݒ肷. NULLŉ. ΏۊÕC[w肵ꍇERROR_CODE_COMMON_NOT_COMPATIBLE. */
+		virtual ErrorCode SetEpilogueLayer(ILayerConnect* i_pEpilogueLayer) = 0;
+		/** ㏈̃C[擾. ĂȂꍇNULL */
+		virtual ILayerConnect* GetEpilogueLayer(void)const = 0;
+
 
 		/** [v̏.
 			sꍇCalculateȍ~͎̏ss. */
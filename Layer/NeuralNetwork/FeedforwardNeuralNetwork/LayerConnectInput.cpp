@@ -111,35 +111,6 @@ namespace NeuralNetwork {
 		return this->neuralNetwork.GetDInputBuffer_d(this->inputNum);
 	}
 
-	/** C[Xg쐬.
-		@param	i_lpLayerGUID	ڑĂGUID̃Xg.͕ɊmF. */
-	ErrorCode LayerConnectInput::CreateLayerList(std::set<Gravisbell::GUID>& io_lpLayerGUID)const
-	{
-		io_lpLayerGUID.insert(this->GetGUID());
-
-		return ErrorCode::ERROR_CODE_NONE;
-	}
-	/** vZXg쐬.
-		@param	i_lpLayerGUID		SC[GUID.
-		@param	io_lpCalculateList	ZɕׂꂽڑXg.
-		@param	io_lpAddedList		ڑXgɓo^ς݂̃C[GUIDꗗ.
-		@param	io_lpAddWaitList	ǉҋ@Ԃ̐ڑNX̃Xg. */
-	ErrorCode LayerConnectInput::CreateCalculateList(const std::set<Gravisbell::GUID>& i_lpLayerGUID, std::list<ILayerConnect*>& io_lpCalculateList, std::set<Gravisbell::GUID>& io_lpAddedList, std::set<ILayerConnect*>& io_lpAddWaitList)
-	{
-		// 擪ɒǉ
-		io_lpCalculateList.insert(io_lpCalculateList.begin(), this);
-
-		// ǉςɐݒ
-		io_lpAddedList.insert(this->GetGUID());
-
-		// ǉҋ@Ԃ̏ꍇ ǉҋ@ς݂ɂȂ邱Ƃ͂蓾Ȃ̂ifʂ邱Ƃ͂Ȃ
-		if(io_lpAddWaitList.count(this) > 0)
-			io_lpAddWaitList.erase(this);
-
-		return ErrorCode::ERROR_CODE_NONE;
-	}
-
-
 	/** C[ɓ̓C[ǉ. */
 	ErrorCode LayerConnectInput::AddInputLayerToLayer(ILayerConnect* pInputFromLayer)
 	{
@@ -362,6 +333,67 @@ namespace NeuralNetwork {
 	{
 		return ErrorCode::ERROR_CODE_NONE;
 	}
+	/** ZɎgpob`TCYύX.
+		ZOŎw肵ob`TCYȉł΁Aobt@̍Ċmۂs킸ɕύXł. */
+	ErrorCode LayerConnectInput::SetBatchSize(unsigned int batchSize)
+	{
+		return ErrorCode::ERROR_CODE_NONE;
+	}
+	/** ZʂČvZŕł邩mF. */
+	bool LayerConnectInput::CheckCanRecompute(void)const
+	{
+		return false;
+	}
+	/** ZO(wKp)œo^ꎞobt@̃TCYAobt@mۂɓo^. */
+	ErrorCode LayerConnectInput::RegisterPlannedTemporaryBuffer(Gravisbell::Common::ITemporaryMemoryManager& o_temporaryMemoryManager, U32 i_batchSize)const
+	{
+		return ErrorCode::ERROR_CODE_NONE;
+	}
+	/** Z̒ԒlwKɍėpꍇɁAZwK܂ŕێꎞobt@̃TCY߂. */
+	U64 LayerConnectInput::GetPlannedReuseIntermediateByteCount(U32 i_batchSize)const
+	{
+		return 0;
+	}
+	/** Z̒ԒlwKɍėp邩ݒ肷. */
+	void LayerConnectInput::SetReuseIntermediateFlag(bool i_onReuse)
+	{
+	}
+	/** Zʂ͂ƈv邩mF. */
+	bool LayerConnectInput::CheckIsIdentity(void)
+	{
+		return false;
+	}
+	/** ZȗA͌C[̏o̓obt@g̏o̓obt@ƂĈݒ肷. */
+	ErrorCode LayerConnectInput::SetPassThroughFlag(bool i_onPassThrough)
+	{
+		if(i_onPassThrough)
+			return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+
+		return ErrorCode::ERROR_CODE_NONE;
+	}
+	/** ZȗĂ邩擾 */
+	bool LayerConnectInput::GetPassThroughFlag(void)const
+	{
+		return false;
+	}
+	/** ͌C[̏o͂̌㏈Ƃē\mF. */
+	bool LayerConnectInput::CheckCanEpilogue(void)
+	{
+		return false;
+	}
+	/** o͂ɓKp㏈ƂāAĩC[𓝍. */
+	ErrorCode LayerConnectInput::SetEpilogueLayer(ILayerConnect* i_pEpilogueLayer)
+	{
+		if(i_pEpilogueLayer)
+			return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+
+		return ErrorCode::ERROR_CODE_NONE;
+	}
+	/** ㏈̃C[擾. ĂȂꍇNULL */
+	ILayerConnect* LayerConnectInput::GetEpilogueLayer(void)const
+	{
+		return NULL;
+	}
 	
 	/** [v̏.
 		sꍇCalculateȍ~͎̏ss. */
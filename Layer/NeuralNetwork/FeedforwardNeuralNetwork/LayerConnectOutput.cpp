@@ -113,57 +113,6 @@ namespace NeuralNetwork {
 		return this->neuralNetwork.GetDOutputBuffer_d();
 	}
 
-	/** C[Xg쐬.
-		@param	i_lpLayerGUID	ڑĂGUID̃Xg.͕ɊmF. */
-	ErrorCode LayerConnectOutput::CreateLayerList(std::set<Gravisbell::GUID>& io_lpLayerGUID)const
-	{
-		io_lpLayerGUID.insert(this->GetGUID());
-		for(auto pInputFromLayer : this->lppInputFromLayer)
-			pInputFromLayer->CreateLayerList(io_lpLayerGUID);
-
-		return ErrorCode::ERROR_CODE_NONE;
-	}
-	/** vZXg쐬.
-		@param	i_lpLayerGUID		SC[GUID.
-		@param	io_lpCalculateList	ZɕׂꂽڑXg.
-		@param	io_lpAddedList		ڑXgɓo^ς݂̃C[GUIDꗗ.
-		@param	io_lpAddWaitList	ǉҋ@Ԃ̐ڑNX̃Xg. */
-	ErrorCode LayerConnectOutput::CreateCalculateList(const std::set<Gravisbell::GUID>& i_lpLayerGUID, std::list<ILayerConnect*>& io_lpCalculateList, std::set<Gravisbell::GUID>& io_lpAddedList, std::set<ILayerConnect*>& io_lpAddWaitList)
-	{
-		// ǉ
-		{
-			// 擪ɒǉ
-			io_lpCalculateList.insert(io_lpCalculateList.begin(), this);
-
-			// ǉςɐݒ
-			io_lpAddedList.insert(this->GetGUID());
-
-			// ǉҋ@Ԃ̏ꍇ ǉҋ@ς݂ɂȂ邱Ƃ͂蓾Ȃ̂ifʂ邱Ƃ͂ȂÔ
-			if(io_lpAddWaitList.count(this) > 0)
-				io_lpAddWaitList.erase(this);
-		}
-
-		// ͌C[ǉ
-		for(auto pInputFromLayer : this->lppInputFromLayer)
-		{
-			if(pInputFromLayer->GetLayerKind() & Gravisbell::Layer::LAYER_KIND_MULT_OUTPUT)
-			{
-				// o̓C[̏ꍇ͈Uۗ
-				io_lpAddWaitList.insert(pInputFromLayer);
-			}
-			else
-			{
-				// PƏo̓C[̏ꍇ͏s
-				ErrorCode errCode = pInputFromLayer->CreateCalculateList(i_lpLayerGUID, io_lpCalculateList, io_lpAddedList, io_lpAddWaitList);
-				if(errCode != ErrorCode::ERROR_CODE_NONE)
-					return errCode;
-			}
-		}
-
-		return ErrorCode::ERROR_CODE_NONE;
-	}
-
-
 	/** C[ɓ̓C[ǉ. */
 	ErrorCode LayerConnectOutput::AddInputLayerToLayer(ILayerConnect* pInputFromLayer)
 	{
@@ -399,6 +348,67 @@ namespace NeuralNetwork {
 	{
 		return ErrorCode::ERROR_CODE_NONE;
 	}
+	/** ZɎgpob`TCYύX.
+		ZOŎw肵ob`TCYȉł΁Aobt@̍Ċmۂs킸ɕύXł. */
+	ErrorCode LayerConnectOutput::SetBatchSize(unsigned int batchSize)
+	{
+		return ErrorCode::ERROR_CODE_NONE;
+	}
+	/** ZʂČvZŕł邩mF. */
+	bool LayerConnectOutput::CheckCanRecompute(void)const
+	{
+		return false;
+	}
+	/** ZO(wKp)œo^ꎞobt@̃TCYAobt@mۂɓo^. */
+	ErrorCode LayerConnectOutput::RegisterPlannedTemporaryBuffer(Gravisbell::Common::ITemporaryMemoryManager& o_temporaryMemoryManager, U32 i_batchSize)const
+	{
+		return ErrorCode::ERROR_CODE_NONE;
+	}
+	/** Z̒ԒlwKɍėpꍇɁAZwK܂ŕێꎞobt@̃TCY߂. */
+	U64 LayerConnectOutput::GetPlannedReuseIntermediateByteCount(U32 i_batchSize)const
+	{
+		return 0;
+	}
+	/** Z̒ԒlwKɍėp邩ݒ肷. */
+	void LayerConnectOutput::SetReuseIntermediateFlag(bool i_onReuse)
+	{
+	}
+	/** Zʂ͂ƈv邩mF. */
+	bool LayerConnectOutput::CheckIsIdentity(void)
+	{
+		return false;
+	}
+	/** ZȗA͌C[̏o̓obt@g̏o̓obt@ƂĈݒ肷. */
+	ErrorCode LayerConnectOutput::SetPassThroughFlag(bool i_onPassThrough)
+	{
+		if(i_onPassThrough)
+			return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+
+		return ErrorCode::ERROR_CODE_NONE;
+	}
+	/** ZȗĂ邩擾 */
+	bool LayerConnectOutput::GetPassThroughFlag(void)const
+	{
+		return false;
+	}
+	/** ͌C[̏o͂̌㏈Ƃē\mF. */
+	bool LayerConnectOutput::CheckCanEpilogue(void)
+	{
+		return false;
+	}
+	/** o͂ɓKp㏈ƂāAĩC[𓝍. */
+	ErrorCode LayerConnectOutput::SetEpilogueLayer(ILayerConnect* i_pEpilogueLayer)
+	{
+		if(i_pEpilogueLayer)
+			return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+
+		return ErrorCode::ERROR_CODE_NONE;
+	}
+	/** ㏈̃C[擾. ĂȂꍇNULL */
+	ILayerConnect* LayerConnectOutput::GetEpilogueLayer(void)const
+	{
+		return NULL;
+	}
 	
 	/** [v̏.
 		sꍇCalculateȍ~͎̏ss. */
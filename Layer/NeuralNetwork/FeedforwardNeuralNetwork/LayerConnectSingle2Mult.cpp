@@ -120,60 +120,6 @@ namespace NeuralNetwork {
 		return neuralNetwork.GetTmpDInputBuffer_d(this->GetDInputBufferID(0));
 	}
 
-	/** C[Xg쐬.
-		@param	i_lpLayerGUID	ڑĂGUID̃Xg.͕ɊmF. */
-	ErrorCode LayerConnectSingle2Mult::CreateLayerList(std::set<Gravisbell::GUID>& io_lpLayerGUID)const
-	{
-		if(io_lpLayerGUID.count(this->GetGUID()))
-			return ErrorCode::ERROR_CODE_NONE;
-
-		io_lpLayerGUID.insert(this->GetGUID());
-		for(auto pInputFromLayer : this->lppInputFromLayer)
-			pInputFromLayer->CreateLayerList(io_lpLayerGUID);
-
-		return ErrorCode::ERROR_CODE_NONE;
-	}
-	/** vZXg쐬.
-		@param	i_lpLayerGUID		SC[GUID.
-		@param	io_lpCalculateList	ZɕׂꂽڑXg.
-		@param	io_lpAddedList		ڑXgɓo^ς݂̃C[GUIDꗗ.
-		@param	io_lpAddWaitList	ǉҋ@Ԃ̐ڑNX̃Xg. */
-	ErrorCode LayerConnectSingle2Mult::CreateCalculateList(const std::set<Gravisbell::GUID>& i_lpLayerGUID, std::list<ILayerConnect*>& io_lpCalculateList, std::set<Gravisbell::GUID>& io_lpAddedList, std::set<ILayerConnect*>& io_lpAddWaitList)
-	{
-		// ǉ
-		{
-			// 擪ɒǉ
-			io_lpCalculateList.insert(io_lpCalculateList.begin(), this);
-
-			// ǉςɐݒ
-			io_lpAddedList.insert(this->GetGUID());
-
-			// ǉҋ@Ԃ̏ꍇ ǉҋ@ς݂ɂȂ邱Ƃ͂蓾Ȃ̂ifʂ邱Ƃ͂ȂÔ
-			if(io_lpAddWaitList.count(this) > 0)
-				io_lpAddWaitList.erase(this);
-		}
-
-		// ͌C[ǉ
-		for(auto pInputFromLayer : this->lppInputFromLayer)
-		{
-			if(pInputFromLayer->GetLayerKind() & Gravisbell::Layer::LAYER_KIND_MULT_OUTPUT)
-			{
-				// o̓C[̏ꍇ͈Uۗ
-				io_lpAddWaitList.insert(pInputFromLayer);
-			}
-			else
-			{
-				// PƏo̓C[̏ꍇ͏s
-				ErrorCode errCode = pInputFromLayer->CreateCalculateList(i_lpLayerGUID, io_lpCalculateList, io_lpAddedList, io_lpAddWaitList);
-				if(errCode != ErrorCode::ERROR_CODE_NONE)
-					return errCode;
-			}
-		}
-
-		return ErrorCode::ERROR_CODE_NONE;
-	}
-
-
 	/** C[ɓ̓C[ǉ. */
 	ErrorCode LayerConnectSingle2Mult::AddInputLayerToLayer(ILayerConnect* pInputFromLayer)
 	{
@@ -466,6 +412,68 @@ namespace NeuralNetwork {
 	{
 		return this->pLayer->PreProcessCalculate(batchSize);
 	}
+	/** ZɎgpob`TCYύX.
+		ZOŎw肵ob`TCYȉł΁Aobt@̍Ċmۂs킸ɕύXł. */
+	ErrorCode LayerConnectSingle2Mult::SetBatchSize(unsigned int batchSize)
+	{
+		return this->pLayer->SetBatchSize(batchSize);
+	}
+	/** ZʂČvZŕł邩mF. */
+	bool LayerConnectSingle2Mult::CheckCanRecompute(void)const
+	{
+		return this->pLayer->CheckCanRecompute();
+	}
+	/** ZO(wKp)œo^ꎞobt@̃TCYAobt@mۂɓo^. */
+	ErrorCode LayerConnectSingle2Mult::RegisterPlannedTemporaryBuffer(Gravisbell::Common::ITemporaryMemoryManager& o_temporaryMemoryManager, U32 i_batchSize)const
+	{
+		return this->pLayer->RegisterPlannedTemporaryBuffer(o_temporaryMemoryManager, i_batchSize);
+	}
+	/** Z̒ԒlwKɍėpꍇɁAZwK܂ŕێꎞobt@̃TCY߂. */
+	U64 LayerConnectSingle2Mult::GetPlannedReuseIntermediateByteCount(U32 i_batchSize)const
+	{
+		return this->pLayer->GetPlannedReuseIntermediateByteCount(i_batchSize);
+	}
+	/** Z̒ԒlwKɍėp邩ݒ肷. */
+	void LayerConnectSingle2Mult::SetReuseIntermediateFlag(bool i_onReuse)
+	{
+		this->pLayer->SetReuseIntermediateFlag(i_onReuse);
+	}
+	/** Zʂ͂ƈv邩mF. */
+	bool LayerConnectSingle2Mult::CheckIsIdentity(void)
+	{
+		return false;
+	}
+	/** ZȗA͌C[̏o̓obt@g̏o̓obt@ƂĈݒ肷. */
+	ErrorCode LayerConnectSingle2Mult::SetPassThroughFlag(bool i_onPassThrough)
+	{
+		if(i_onPassThrough)
+			return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+
+		return ErrorCode::ERROR_CODE_NONE;
+	}
+	/** ZȗĂ邩擾 */
+	bool LayerConnectSingle2Mult::GetPassThroughFlag(void)const
+	{
+		return false;
+	}
+	/** ͌C[̏o͂̌㏈Ƃē\mF. */
+	bool LayerConnectSingle2Mult::CheckCanEpilogue(void)
+	{
+		return false;
+	}
+	/** o͂ɓKp㏈ƂāAĩC[𓝍. */
+	ErrorCode LayerConnectSingle2Mult::SetEpilogueLayer(ILayerConnect* i_pEpilogueLayer)
+	{
+		if(i_pEpilogueLayer)
+			return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+
+		return ErrorCode::ERROR_CODE_NONE;
+	}
+	/** ㏈̃C[擾. ĂȂꍇNULL */
+	ILayerConnect* LayerConnectSingle2Mult::GetEpilogueLayer(void)const
+	{
+		return NULL;
+	}
 
 	/** [v̏.
 		sꍇCalculateȍ~͎̏ss. */
@@ -99,15 +99,6 @@ namespace NeuralNetwork {
 		/** ͌덷obt@ʒuwŎ擾 */
 		CONST_BATCH_BUFFER_POINTER GetDInputBufferByNum_d(S32 num)const;
 
-		/** C[Xg쐬.
-			@param	i_lpLayerGUID	ڑĂGUID̃Xg.͕ɊmF. */
-		ErrorCode CreateLayerList(std::set<Gravisbell::GUID>& io_lpLayerGUID)const;
-		/** vZXg쐬.
-			@param	i_lpLayerGUID		SC[GUID.
-			@param	io_lpCalculateList	ZɕׂꂽڑXg.
-			@param	io_lpAddedList		ڑXgɓo^ς݂̃C[GUIDꗗ.
-			@param	io_lpAddWaitList	ǉҋ@Ԃ̐ڑNX̃Xg. */
-		ErrorCode CreateCalculateList(const std::set<Gravisbell::GUID>& i_lpLayerGUID, std::list<ILayerConnect*>& io_lpCalculateList, std::set<Gravisbell::GUID>& io_lpAddedList, std::set<ILayerConnect*>& io_lpAddWaitList);
 
 	public:
 		/** C[ɓ̓C[ǉ. */
@@ -207,6 +198,31 @@ namespace NeuralNetwork {
 			NN쐬AZsOɈxKs邱ƁBf[^ƂɎsKv͂Ȃ.
 			sꍇCalculateȍ~͎̏ss. */
 		ErrorCode PreProcessCalculate(unsigned int batchSize);
+		/** ZɎgpob`TCYύX.
+			ZOŎw肵ob`TCYȉł΁Aobt@̍Ċmۂs킸ɕύXł. */
+		ErrorCode SetBatchSize(unsigned int batchSize);
+		/** ZʂČvZŕł邩mF. */
+		bool CheckCanRecompute(void)const;
+		/** ZO(wKp)œo^ꎞobt@̃TCYAobt@mۂɓo^. */
+		ErrorCode RegisterPlannedTemporaryBuffer(Gravisbell::Common::ITemporaryMemoryManager& o_temporaryMemoryManager, U32 i_batchSize)const;
+		/** Z̒ԒlwKɍėpꍇɁAZwK܂ŕێꎞobt@̃TCY߂. */
+		U64 GetPlannedReuseIntermediateByteCount(U32 i_batchSize)const;
+		/** Z̒ԒlwKɍėp邩ݒ肷. */
+		void SetReuseIntermediateFlag(bool i_onReuse);
+
+		/** Zʂ͂ƈv邩mF. */
+		bool CheckIsIdentity(void);
+		/** ZȗA͌C[̏o̓obt@g̏o̓obt@ƂĈݒ肷. */
+		ErrorCode SetPassThroughFlag(bool i_onPassThrough);
+		/** ZȗĂ邩擾 */
+		bool GetPassThroughFlag(void)const;
+
+		/** ͌C[̏o͂̌㏈Ƃē\mF. */
+		bool CheckCanEpilogue(void);
+		/** o͂ɓKp㏈ƂāAĩC[𓝍. */
+		ErrorCode SetEpilogueLayer(ILayerConnect* i_pEpilogueLayer);
+		/** ㏈̃C[擾. ĂȂꍇNULL */
+		ILayerConnect* GetEpilogueLayer(void)const;
 
 
 		/** [v̏.
@@ -21,6 +21,8 @@ namespace NeuralNetwork {
 		,	dInputBufferID		(INVALID_DINPUTBUFFER_ID)
 		,	onLayerFix			(onFixFlag)		/**< C[Œ艻tO */
 		,	isNecessaryBackPropagation	(true)	/**< 덷`KvȃtO. falsȅꍇAj[lbg[N̂͌덷obt@Ȃꍇ͌덷`Ȃ */
+		,	onPassThrough		(false)	/**< ZȗtO */
+		,	pEpilogueLayer		(NULL)	/**< ㏈ƂēC[ */
 	{
 	}
 	/** fXgN^ */
@@ -100,6 +102,10 @@ namespace NeuralNetwork {
 		@return o̓f[^z̐擪|C^ */
 	CONST_BATCH_BUFFER_POINTER LayerConnectSingle2Single::GetOutputBuffer_d()const
 	{
+		// ZȗĂꍇ͓͂̂܂܏o͂Ƃ
+		if(this->onPassThrough)
+			return this->lppInputFromLayer[0]->GetOutputBuffer_d();
+
 		return this->neuralNetwork.ReserveOutputBuffer_d(this->outputBufferID, this->GetGUID());
 	}
 
@@ -117,63 +123,13 @@ namespace NeuralNetwork {
 	/** ͌덷obt@ʒuwŎ擾 */
 	CONST_BATCH_BUFFER_POINTER LayerConnectSingle2Single::GetDInputBufferByNum_d(S32 num)const
 	{
+		// ZȗĂꍇ͏o͌덷̂܂ܓ͌덷Ƃ
+		if(this->onPassThrough)
+			return this->lppOutputToLayer[0].pLayer->GetDInputBufferByNum_d(this->lppOutputToLayer[0].position);
+
 		return neuralNetwork.GetTmpDInputBuffer_d(this->GetDInputBufferID(0));
 	}
 
-	/** C[Xg쐬.
-		@param	i_lpLayerGUID	ڑĂGUID̃Xg.͕ɊmF. */
-	ErrorCode LayerConnectSingle2Single::CreateLayerList(std::set<Gravisbell::GUID>& io_lpLayerGUID)const
-	{
-		if(io_lpLayerGUID.count(this->GetGUID()))
-			return ErrorCode::ERROR_CODE_NONE;
-
-		io_lpLayerGUID.insert(this->GetGUID());
-		for(auto pInputFromLayer : this->lppInputFromLayer)
-			pInputFromLayer->CreateLayerList(io_lpLayerGUID);
-
-		return ErrorCode::ERROR_CODE_NONE;
-	}
-	/** vZXg쐬.
-		@param	i_lpLayerGUID		SC[GUID.
-		@param	io_lpCalculateList	ZɕׂꂽڑXg.
-		@param	io_lpAddedList		ڑXgɓo^ς݂̃C[GUIDꗗ.
-		@param	io_lpAddWaitList	ǉҋ@Ԃ̐ڑNX̃Xg. */
-	ErrorCode LayerConnectSingle2Single::CreateCalculateList(const std::set<Gravisbell::GUID>& i_lpLayerGUID, std::list<ILayerConnect*>& io_lpCalculateList, std::set<Gravisbell::GUID>& io_lpAddedList, std::set<ILayerConnect*>& io_lpAddWaitList)
-	{
-		// ǉ
-		{
-			// 擪ɒǉ
-			io_lpCalculateList.insert(io_lpCalculateList.begin(), this);
-
-			// ǉςɐݒ
-			io_lpAddedList.insert(this->GetGUID());
-
-			// ǉҋ@Ԃ̏ꍇ ǉҋ@ς݂ɂȂ邱Ƃ͂蓾Ȃ̂ifʂ邱Ƃ͂ȂÔ
-			if(io_lpAddWaitList.count(this) > 0)
-				io_lpAddWaitList.erase(this);
-		}
-
-		// ͌C[ǉ
-		for(auto pInputFromLayer : this->lppInputFromLayer)
-		{
-			if(pInputFromLayer->GetLayerKind() & Gravisbell::Layer::LAYER_KIND_MULT_OUTPUT)
-			{
-				// o̓C[̏ꍇ͈Uۗ
-				io_lpAddWaitList.insert(pInputFromLayer);
-			}
-			else
-			{
-				// PƏo̓C[̏ꍇ͏s
-				ErrorCode errCode = pInputFromLayer->CreateCalculateList(i_lpLayerGUID, io_lpCalculateList, io_lpAddedList, io_lpAddWaitList);
-				if(errCode != ErrorCode::ERROR_CODE_NONE)
-					return errCode;
-			}
-		}
-
-		return ErrorCode::ERROR_CODE_NONE;
-	}
-
-
 	/** C[ɓ̓C[ǉ. */
 	ErrorCode LayerConnectSingle2Single::AddInputLayerToLayer(ILayerConnect* pInputFromLayer)
 	{
@@ -464,6 +420,79 @@ namespace NeuralNetwork {
 	{
 		return this->pLayer->PreProcessCalculate(batchSize);
 	}
+	/** ZɎgpob`TCYύX.
+		ZOŎw肵ob`TCYȉł΁Aobt@̍Ċmۂs킸ɕύXł. */
+	ErrorCode LayerConnectSingle2Single::SetBatchSize(unsigned int batchSize)
+	{
+		return this->pLayer->SetBatchSize(batchSize);
+	}
+	/** ZʂČvZŕł邩mF. */
+	bool LayerConnectSingle2Single::CheckCanRecompute(void)const
+	{
+		return this->pLayer->CheckCanRecompute();
+	}
+	/** ZO(wKp)œo^ꎞobt@̃TCYAobt@mۂɓo^. */
+	ErrorCode LayerConnectSingle2Single::RegisterPlannedTemporaryBuffer(Gravisbell::Common::ITemporaryMemoryManager& o_temporaryMemoryManager, U32 i_batchSize)const
+	{
+		return this->pLayer->RegisterPlannedTemporaryBuffer(o_temporaryMemoryManager, i_batchSize);
+	}
+	/** Z̒ԒlwKɍėpꍇɁAZwK܂ŕێꎞobt@̃TCY߂. */
+	U64 LayerConnectSingle2Single::GetPlannedReuseIntermediateByteCount(U32 i_batchSize)const
+	{
+		return this->pLayer->GetPlannedReuseIntermediateByteCount(i_batchSize);
+	}
+	/** Z̒ԒlwKɍėp邩ݒ肷. */
+	void LayerConnectSingle2Single::SetReuseIntermediateFlag(bool i_onReuse)
+	{
+		this->pLayer->SetReuseIntermediateFlag(i_onReuse);
+	}
+	/** Zʂ͂ƈv邩mF. */
+	bool LayerConnectSingle2Single::CheckIsIdentity(void)
+	{
+		return this->pLayer->CheckIsIdentity();
+	}
+	/** ZȗA͌C[̏o̓obt@g̏o̓obt@ƂĈݒ肷. */
+	ErrorCode LayerConnectSingle2Single::SetPassThroughFlag(bool i_onPassThrough)
+	{
+		this->onPassThrough = i_onPassThrough;
+
+		return ErrorCode::ERROR_CODE_NONE;
+	}
+	/** ZȗĂ邩擾 */
+	bool LayerConnectSingle2Single::GetPassThroughFlag(void)const
+	{
+		return this->onPassThrough;
+	}
+	/** ͌C[̏o͂̌㏈Ƃē\mF. */
+	bool LayerConnectSingle2Single::CheckCanEpilogue(void)
+	{
+		return this->pLayer_io->CheckCanEpilogue();
+	}
+	/** o͂ɓKp㏈ƂāAĩC[𓝍. */
+	ErrorCode LayerConnectSingle2Single::SetEpilogueLayer(ILayerConnect* i_pEpilogueLayer)
+	{
+		if(i_pEpilogueLayer == NULL)
+		{
+			this->pEpilogueLayer = NULL;
+			return this->pLayer_io->SetEpilogueLayer(NULL);
+		}
+
+		LayerConnectSingle2Single* pEpilogueConnect = dynamic_cast<LayerConnectSingle2Single*>(i_pEpilogueLayer);
+		if(pEpilogueConnect == NULL)
+			return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+
+		ErrorCode err = this->pLayer_io->SetEpilogueLayer(pEpilogueConnect->pLayer_io);
+		if(err != ErrorCode::ERROR_CODE_NONE)
+			return err;
+		this->pEpilogueLayer = i_pEpilogueLayer;
+
+		return ErrorCode::ERROR_CODE_NONE;
+	}
+	/** ㏈̃C[擾. ĂȂꍇNULL */
+	ILayerConnect* LayerConnectSingle2Single::GetEpilogueLayer(void)const
+	{
+		return this->pEpilogueLayer;
+	}
 	
 
 	/** [v̏.
@@ -476,6 +505,9 @@ namespace NeuralNetwork {
 	/** Zs. */
 	ErrorCode LayerConnectSingle2Single::Calculate(void)
 	{
+		if(this->onPassThrough)
+			return ErrorCode::ERROR_CODE_NONE;
+
 		return this->pLayer_io->Calculate_device(
 			lppInputFromLayer[0]->GetOutputBuffer_d(),
 			neuralNetwork.ReserveOutputBuffer_d(this->outputBufferID, this->GetGUID())
@@ -484,6 +516,8 @@ namespace NeuralNetwork {
 	/** wK덷vZ. */
 	ErrorCode LayerConnectSingle2Single::CalculateDInput(void)
 	{
+		if(this->onPassThrough)
+			return ErrorCode::ERROR_CODE_NONE;
 		if(!this->IsNecessaryCalculateDInput())
 			return ErrorCode::ERROR_CODE_NONE;
 		
@@ -507,6 +541,8 @@ namespace NeuralNetwork {
 	/** wK덷vZ. */
 	ErrorCode LayerConnectSingle2Single::Training(void)
 	{
+		if(this->onPassThrough)
+			return ErrorCode::ERROR_CODE_NONE;
 		if(this->onLayerFix)
 			return this->CalculateDInput();
 
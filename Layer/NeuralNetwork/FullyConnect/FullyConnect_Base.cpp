@@ -15,6 +15,7 @@ using namespace Gravisbell::Layer::NeuralNetwork;
 /** RXgN^ */
 FullyConnect_Base::FullyConnect_Base(Gravisbell::GUID guid, const IODataStruct& i_inputDataStruct, const IODataStruct& i_outputDataStruct)
 	:	CNNSingle2SingleLayerBase(guid, ::CreateRuntimeParameter(), i_inputDataStruct, i_outputDataStruct)
+	,	pEpilogueLayer	(NULL)	/**< o͂ɓēKp㏈C[ */
 {
 }
 
@@ -36,3 +37,31 @@ U32 FullyConnect_Base::GetNeuronCount()const
 
 	return pLayerData->GetNeuronCount();
 }
+
+
+//===========================
+// ㏈̓
+//===========================
+/** o͂ɓēKp㏈C[ݒ肷.
+	@param	i_pEpilogueLayer	㏈C[. NULL̏ꍇ͉. */
+ErrorCode FullyConnect_Base::SetEpilogueLayer(INNSingle2SingleLayer* i_pEpilogueLayer)
+{
+	if(i_pEpilogueLayer)
+	{
+		// vfƂɓƗẐݓł
+		if(!i_pEpilogueLayer->CheckCanEpilogue())
+			return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+
+		// g̏o͂̂܂ܓ͂Ƃ郌C[̂ݓł
+		if(i_pEpilogueLayer->GetInputBufferCount() != this->GetOutputBufferCount())
+			return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+
+		// foCXقȂꍇ̓obt@𒼐ڎ󂯓nȂ
+		if((i_pEpilogueLayer->GetLayerKind() & Layer::ELayerKind::LAYER_KIND_CALCTYPE) != (this->GetLayerKind() & Layer::ELayerKind::LAYER_KIND_CALCTYPE))
+			return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+	}
+
+	this->pEpilogueLayer = i_pEpilogueLayer;
+
+	return ErrorCode::ERROR_CODE_NONE;
+}
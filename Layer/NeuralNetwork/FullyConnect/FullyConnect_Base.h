@@ -36,6 +36,17 @@ namespace NeuralNetwork {
 		/** j[擾 */
 		U32 GetNeuronCount()const;
 
+	protected:
+		INNSingle2SingleLayer* pEpilogueLayer;	/**< o͂ɓēKp㏈C[. ĂȂꍇNULL */
+
+		//==========================================
+		// ㏈̓
+		//==========================================
+	public:
+		/** o͂ɓēKp㏈C[ݒ肷.
+			@param	i_pEpilogueLayer	㏈C[. NULL̏ꍇ͉. */
+		ErrorCode SetEpilogueLayer(INNSingle2SingleLayer* i_pEpilogueLayer);
+
 	};
 
 }	// NeuralNetwork
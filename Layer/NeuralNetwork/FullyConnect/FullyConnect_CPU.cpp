@@ -4,6 +4,9 @@
 // CPUp
 //======================================
 #include"stdafx.h"
+
+#include<algorithm>
+#include<xmmintrin.h>
 
 #include"FullyConnect_DATA.hpp"
 #include"FullyConnect_FUNC.hpp"
@@ -29,6 +32,7 @@ namespace NeuralNetwork {
 		,	inputBufferCount				(0)		/**< ̓obt@ */
 		,	neuronCount						(0)		/**< j[ */
 		,	outputBufferCount				(0)		/**< o̓obt@ */
+		,	onDNeuronDirty					(true)
 	{
 	}
 	/** fXgN^ */
@@ -89,6 +93,11 @@ namespace NeuralNetwork {
 		// p[^̕ωʃobt@
 		this->lpDBias.resize(this->neuronCount);
 		this->lpDNeuron.resize(this->neuronCount * this->inputBufferCount);
+		this->onDNeuronDirty = true;
+		this->lpActiveInputNum.reserve(this->inputBufferCount);
+		this->lpInputActiveFlag.assign(this->inputBufferCount, 0);
+		this->lpNonZeroInputNum.reserve(this->inputBufferCount);
+		this->lpNonZeroInputOffset.resize(this->GetBatchSize() + 1);
 
 
 		return ErrorCode::ERROR_CODE_NONE;
@@ -119,6 +128,15 @@ namespace NeuralNetwork {
 		// /o̓obt@ۑp̃AhXz쐬
 		this->m_lppInputBuffer.resize(this->GetBatchSize(), NULL);
 		this->m_lppOutputBuffer.resize(this->GetBatchSize(), NULL);
+
+		// Zp̏ꍇ͊wKp̃obt@
+		if(this->GetProcessType() == ProcessType::PROCESSTYPE_CALCULATE)
+		{
+			std::vector<F32>().swap(this->lpDBias);
+			std::vector<F32>().swap(this->lpDNeuron);
+			std::vector<BATCH_BUFFER_POINTER>().swap(this->m_lppDInputBuffer);
+			std::vector<CONST_BATCH_BUFFER_POINTER>().swap(this->m_lppDOutputBuffer);
+		}
 
 		return ErrorCode::ERROR_CODE_NONE;
 	}
@@ -162,7 +180,7 @@ namespace NeuralNetwork {
 			do
 			{
 				// Zs
-				ErrorCode err = this->CalculateBase(&lpTmpWeight[0], &lpTmpBias[0]);
+				ErrorCode err = this->CalculateBase(&lpTmpWeight[0], &lpTmpBias[0], false);
 				if(err != ErrorCode::ERROR_CODE_NONE)
 					return err;
 
@@ -212,10 +230,27 @@ namespace NeuralNetwork {
 
 			// d݂XV
 			this->layerData.pWeightData->SetData(&lpTmpWeight[0], &lpTmpBias[0]);
+
+			// U͌㏈̓KpȌo͂ŋ߂邽߁A㏈͍Ōɂ܂Ƃ߂ēKp
+			if(this->pEpilogueLayer)
+			{
+				ErrorCode err = this->pEpilogueLayer->CalculateEpilogue_device(o_lppOutputBuffer, this->outputBufferCount * this->GetBatchSize());
+				if(err != ErrorCode::ERROR_CODE_NONE)
+					return err;
+			}
 		}
 		else
 		{
-			ErrorCode err = this->CalculateBase(this->layerData.pWeightData->GetWeight(), this->layerData.pWeightData->GetBias());
+			// _ɕϊς݂Weightgpłꍇ̓j[4𓯎ɌvZ.
+			// wK͍XV̂тɕϊƂɂȂ邽ߌ̕тgp
+			const F32* lpPackedWeight = NULL;
+			if(this->GetProcessType() == ProcessType::PROCESSTYPE_CALCULATE)
+				lpPackedWeight = this->layerData.pWeightData->GetPackedWeight(WEIGHT_LAYOUT_PANEL4);
+			ErrorCode err;
+			if(lpPackedWeight)
+				err = this->CalculatePanel4(lpPackedWeight, this->layerData.pWeightData->GetBias());
+			else
+				err = this->CalculateBase(this->layerData.pWeightData->GetWeight(), this->layerData.pWeightData->GetBias(), true);
 			if(err != ErrorCode::ERROR_CODE_NONE)
 				return err;
 		}
@@ -224,8 +259,9 @@ namespace NeuralNetwork {
 	}
 
 
-	/** Zs. */
-	ErrorCode FullyConnect_CPU::CalculateBase(const F32* lpWeight, const F32* lpBias)
+	/** Zs.
+		@param	i_onEpilogue	㏈𓝍ĂꍇɁAob`Ƃ̏o͂̊m蒼Ɍ㏈Kp. */
+	ErrorCode FullyConnect_CPU::CalculateBase(const F32* lpWeight, const F32* lpBias, bool i_onEpilogue)
 	{
 		for(unsigned int batchNum=0; batchNum<this->GetBatchSize(); batchNum++)
 		{
@@ -248,6 +284,63 @@ namespace NeuralNetwork {
 					return ErrorCode::ERROR_CODE_COMMON_CALCULATE_NAN;
 #endif
 			}
+
+			// ㏈Ao͂LbVɎcĂ邤ɓKp
+			if(i_onEpilogue && this->pEpilogueLayer)
+			{
+				ErrorCode err = this->pEpilogueLayer->CalculateEpilogue_device(this->m_lppOutputBuffer[batchNum], this->outputBufferCount);
+				if(err != ErrorCode::ERROR_CODE_NONE)
+					return err;
+			}
+		}
+
+		return ErrorCode::ERROR_CODE_NONE;
+	}
+
+	/** 4j[Pʂɕϊς݂WeightŉZs.
+		ej[̉ZCalculateBaseƓ.
+		@param	lpPackedWeight	WEIGHT_LAYOUT_PANEL4̕тWeight. */
+	ErrorCode FullyConnect_CPU::CalculatePanel4(const F32* lpPackedWeight, const F32* lpBias)
+	{
+		static const U32 PANEL_SIZE = 4;
+
+		for(unsigned int batchNum=0; batchNum<this->GetBatchSize(); batchNum++)
+		{
+			const F32* lpInput = this->m_lppInputBuffer[batchNum];
+
+			for(U32 neuronBegin=0; neuronBegin<this->neuronCount; neuronBegin+=PANEL_SIZE)
+			{
+				const F32* lpPanel = &lpPackedWeight[(U64)neuronBegin * this->inputBufferCount];
+
+				// j[̒lZ. 1pl4j[֓Ɋ|
+				__m128 vSum = _mm_setzero_ps();
+				for(U32 inputNum=0; inputNum<this->inputBufferCount; inputNum++)
+				{
+					vSum = _mm_add_ps(vSum, _mm_mul_ps(_mm_set1_ps(lpInput[inputNum]), _mm_loadu_ps(&lpPanel[inputNum * PANEL_SIZE])));
+				}
+				F32 lpSum[PANEL_SIZE];
+				_mm_storeu_ps(lpSum, vSum);
+
+				// i[. [̃pl݂͑j[̂
+				U32 neuronEnd = std::min<U32>(neuronBegin + PANEL_SIZE, this->neuronCount);
+				for(U32 neuronNum=neuronBegin; neuronNum<neuronEnd; neuronNum++)
+				{
+					this->m_lppOutputBuffer[batchNum][neuronNum] = lpSum[neuronNum - neuronBegin] + lpBias[neuronNum];
+
+#ifdef _DEBUG
+					if(isnan(this->m_lppOutputBuffer[batchNum][neuronNum]))
+						return ErrorCode::ERROR_CODE_COMMON_CALCULATE_NAN;
+#endif
+				}
+			}
+
+			// ㏈Ao͂LbVɎcĂ邤ɓKp
+			if(this->pEpilogueLayer)
+			{
+				ErrorCode err = this->pEpilogueLayer->CalculateEpilogue_device(this->m_lppOutputBuffer[batchNum], this->outputBufferCount);
+				if(err != ErrorCode::ERROR_CODE_NONE)
+					return err;
+			}
 		}
 
 		return ErrorCode::ERROR_CODE_NONE;
@@ -263,6 +356,11 @@ namespace NeuralNetwork {
 		ǑvZʂgp */
 	ErrorCode FullyConnect_CPU::CalculateDInput_device(CONST_BATCH_BUFFER_POINTER i_lppInputBuffer, BATCH_BUFFER_POINTER o_lppDInputBuffer, CONST_BATCH_BUFFER_POINTER i_lppOutputBuffer, CONST_BATCH_BUFFER_POINTER i_lppDOutputBuffer)
 	{
+		// ㏈̔lo͌덷ɏZ
+		ErrorCode err = this->CalculateDEpilogue(i_lppOutputBuffer, i_lppDOutputBuffer);
+		if(err != ErrorCode::ERROR_CODE_NONE)
+			return err;
+
 		// /o̓obt@̃AhXzɊi[
 		for(U32 batchNum=0; batchNum<this->GetBatchSize(); batchNum++)
 		{
@@ -309,43 +407,132 @@ namespace NeuralNetwork {
 		if(errCode != ErrorCode::ERROR_CODE_NONE)
 			return errCode;
 
-		// p[^ωʂ̃obt@NA
-		memset(&this->lpDBias[0],   0, sizeof(F32)*this->lpDBias.size());
-		memset(&this->lpDNeuron[0], 0, sizeof(F32)*this->lpDNeuron.size());
-
-		// wK덷vZ
-		for(U32 neuronNum=0; neuronNum<this->neuronCount; neuronNum++)
+		// oCAX̕ωʂvZ
+		for(U32 neuronNum=0; neuronNum<this->neuronCount; neuronNum++)
+		{
+			F32 sumDOutput = 0.0f;
+			for(U32 batchNum=0; batchNum<this->GetBatchSize(); batchNum++)
+			{
+				 sumDOutput += this->m_lppDOutputBuffer[batchNum][neuronNum];
+			}
+
+			this->lpDBias[neuronNum] = sumDOutput;
+		}
+
+		// 0ȊO̒l͂ob`Ƃɗ񋓂. Sob`0̓͂ɑΉd݂̕ωʂ0ƂȂ.
+		// ͖͂ȃobt@̂߁A񋓎͓̂͐~ob`̑ƂȂ
+		this->lpActiveInputNum.clear();
+		this->lpNonZeroInputNum.clear();
+		for(U32 batchNum=0; batchNum<this->GetBatchSize(); batchNum++)
+		{
+			this->lpNonZeroInputOffset[batchNum] = (U32)this->lpNonZeroInputNum.size();
+			for(U32 inputNum=0; inputNum<this->inputBufferCount; inputNum++)
+			{
+				if(this->m_lppInputBuffer[batchNum][inputNum] == 0.0f)
+					continue;
+
+				this->lpNonZeroInputNum.push_back(inputNum);
+				if(!this->lpInputActiveFlag[inputNum])
+				{
+					this->lpInputActiveFlag[inputNum] = 1;
+					this->lpActiveInputNum.push_back(inputNum);
+				}
+			}
+		}
+		this->lpNonZeroInputOffset[this->GetBatchSize()] = (U32)this->lpNonZeroInputNum.size();
+		std::sort(this->lpActiveInputNum.begin(), this->lpActiveInputNum.end());
+
+		if(this->lpActiveInputNum.size() < this->inputBufferCount)
 		{
-			// oCAXXV
+			// ꕔ݂̓͂̂0ȊȌꍇ(one-hot͓)́A0ȊO̒lωʂ݂̂vZčXV.
+			// ob`ɉZ邽߁AŜvZꍇƓlƂȂ
+			if(this->onDNeuronDirty)
 			{
-				F32 sumDOutput = 0.0f;
-				for(U32 batchNum=0; batchNum<this->GetBatchSize(); batchNum++)
-				{
-					 sumDOutput += this->m_lppDOutputBuffer[batchNum][neuronNum];
-				}
-
-				this->lpDBias[neuronNum] = sumDOutput;
+				memset(&this->lpDNeuron[0], 0, sizeof(F32)*this->lpDNeuron.size());
+				this->onDNeuronDirty = false;
 			}
 
-			// ͑Ήj[XV
-			for(U32 inputNum=0; inputNum<this->inputBufferCount; inputNum++)
+			for(U32 batchNum=0; batchNum<this->GetBatchSize(); batchNum++)
+			{
+				for(U32 pos=this->lpNonZeroInputOffset[batchNum]; pos<this->lpNonZeroInputOffset[batchNum+1]; pos++)
+				{
+					U32 inputNum = this->lpNonZeroInputNum[pos];
+					F32 input = this->m_lppInputBuffer[batchNum][inputNum];
+
+					for(U32 neuronNum=0; neuronNum<this->neuronCount; neuronNum++)
+					{
+						this->lpDNeuron[neuronNum*this->inputBufferCount + inputNum] += input * this->m_lppDOutputBuffer[batchNum][neuronNum];
+					}
+				}
+			}
+
+			// 덷𔽉f
+			this->layerData.pWeightData->UpdateDataSparse(
+				&this->lpDNeuron[0], &this->lpDBias[0],
+				this->inputBufferCount, 1,
+				this->lpActiveInputNum.empty() ? NULL : &this->lpActiveInputNum[0], (U32)this->lpActiveInputNum.size());
+
+			// gp݂̂0ɖ߂
+			for(U32 activeNum=0; activeNum<this->lpActiveInputNum.size(); activeNum++)
 			{
-				F32 sumDOutput = 0.0f;
-				for(U32 batchNum=0; batchNum<this->GetBatchSize(); batchNum++)
-				{
-					sumDOutput += this->m_lppInputBuffer[batchNum][inputNum] * this->m_lppDOutputBuffer[batchNum][neuronNum];
-				}
-
-				this->lpDNeuron[neuronNum*this->inputBufferCount + inputNum] += sumDOutput;
+				U32 inputNum = this->lpActiveInputNum[activeNum];
+
+				for(U32 neuronNum=0; neuronNum<this->neuronCount; neuronNum++)
+					this->lpDNeuron[neuronNum*this->inputBufferCount + inputNum] = 0.0f;
 			}
-		}
-
-		// 덷𔽉f
-		this->layerData.pWeightData->UpdateData(&this->lpDNeuron[0], &this->lpDBias[0]);
+		}
+		else
+		{
+			// ͑Ήj[̕ωʂvZ
+			for(U32 neuronNum=0; neuronNum<this->neuronCount; neuronNum++)
+			{
+				for(U32 inputNum=0; inputNum<this->inputBufferCount; inputNum++)
+				{
+					F32 sumDOutput = 0.0f;
+					for(U32 batchNum=0; batchNum<this->GetBatchSize(); batchNum++)
+					{
+						sumDOutput += this->m_lppInputBuffer[batchNum][inputNum] * this->m_lppDOutputBuffer[batchNum][neuronNum];
+					}
+
+					this->lpDNeuron[neuronNum*this->inputBufferCount + inputNum] = sumDOutput;
+				}
+			}
+			this->onDNeuronDirty = true;
+
+			// 덷𔽉f
+			this->layerData.pWeightData->UpdateData(&this->lpDNeuron[0], &this->lpDBias[0]);
+		}
+
+		// ͂̃tO߂
+		for(U32 activeNum=0; activeNum<this->lpActiveInputNum.size(); activeNum++)
+			this->lpInputActiveFlag[this->lpActiveInputNum[activeNum]] = 0;
 
 		return ErrorCode::ERROR_CODE_NONE;
 	}
 
+	/** ㏈̔lo͌덷ɏZ.
+		㏈𓝍ĂȂꍇAZς݂̏ꍇ͏o͌덷̂܂܎gp.
+		@param	io_lppDOutputBuffer	o͌덷. Zʂ̃AhXɒu. */
+	ErrorCode FullyConnect_CPU::CalculateDEpilogue(CONST_BATCH_BUFFER_POINTER i_lppOutputBuffer, CONST_BATCH_BUFFER_POINTER& io_lppDOutputBuffer)
+	{
+		if(this->pEpilogueLayer == NULL)
+			return ErrorCode::ERROR_CODE_NONE;
+
+		const U32 bufferCount = this->outputBufferCount * this->GetBatchSize();
+		if(this->lpDOutputEpilogue.size() < bufferCount)
+			this->lpDOutputEpilogue.resize(bufferCount);
+		if(io_lppDOutputBuffer == &this->lpDOutputEpilogue[0])
+			return ErrorCode::ERROR_CODE_NONE;
+
+		ErrorCode err = this->pEpilogueLayer->CalculateDEpilogue_device(i_lppOutputBuffer, io_lppDOutputBuffer, &this->lpDOutputEpilogue[0], bufferCount);
+		if(err != ErrorCode::ERROR_CODE_NONE)
+			return err;
+
+		io_lppDOutputBuffer = &this->lpDOutputEpilogue[0];
+
+		return ErrorCode::ERROR_CODE_NONE;
+	}
+
 
 } // Gravisbell;
 } // Layer;
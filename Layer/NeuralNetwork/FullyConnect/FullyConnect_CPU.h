@@ -40,7 +40,13 @@ private:
 
 	// Zp̃obt@
 	std::vector<F32> lpDBias;	/**< oCAX̕ω */
-	std::vector<F32> lpDNeuron;	/**< j[̕ω */
+	std::vector<F32> lpDNeuron;	/**< j[̕ω. aȍXV̌͑S0̏Ԃۂ */
+	bool onDNeuronDirty;		/**< lpDNeuron0ȊO̒lcĂ\tO */
+	std::vector<U32> lpActiveInputNum;	/**< ob`̂ꂩ0ȊO̒l͔ԍ. ωʂd݂̗ɑΉ */
+	std::vector<U08> lpInputActiveFlag;	/**< ͔ԍƂ0ȊO̒ltO. [inputBufferCount] */
+	std::vector<U32> lpNonZeroInputNum;		/**< ob`Ƃ0ȊO̒l͔ԍ */
+	std::vector<U32> lpNonZeroInputOffset;	/**< ob`ƂlpNonZeroInputNum̊Jnʒu. [GetBatchSize()+1] */
+	std::vector<F32> lpDOutputEpilogue;	/**< ㏈̔lZo͌덷 */
 
 public:
 	/** RXgN^ */
@@ -94,7 +100,13 @@ public:
 		@param lpInputBuffer	̓f[^obt@. GetInputBufferCountŎ擾l̗vfKv
 		@return ꍇ0Ԃ */
 	ErrorCode Calculate_device(CONST_BATCH_BUFFER_POINTER i_lppInputBuffer, BATCH_BUFFER_POINTER o_lppOutputBuffer);
-	ErrorCode CalculateBase(const F32* lpWeight, const F32* lpBias);
+	/** Zs.
+		@param	i_onEpilogue	㏈𓝍ĂꍇɁAob`Ƃ̏o͂̊m蒼Ɍ㏈Kp. */
+	ErrorCode CalculateBase(const F32* lpWeight, const F32* lpBias, bool i_onEpilogue);
+	/** 4j[Pʂɕϊς݂WeightŉZs.
+		ej[̉ZCalculateBaseƓ.
+		@param	lpPackedWeight	WEIGHT_LAYOUT_PANEL4̕тWeight. */
+	ErrorCode CalculatePanel4(const F32* lpPackedWeight, const F32* lpBias);
 
 public:
 	//================================
@@ -113,6 +125,12 @@ public:
 		ǑvZʂgp */
 	ErrorCode Training_device(CONST_BATCH_BUFFER_POINTER i_lppInputBuffer, BATCH_BUFFER_POINTER o_lppDInputBuffer, CONST_BATCH_BUFFER_POINTER i_lppOutputBuffer, CONST_BATCH_BUFFER_POINTER i_lppDOutputBuffer);
 
+private:
+	/** ㏈̔lo͌덷ɏZ.
+		㏈𓝍ĂȂꍇAZς݂̏ꍇ͏o͌덷̂܂܎gp.
+		@param	io_lppDOutputBuffer	o͌덷. Zʂ̃AhXɒu. */
+	ErrorCode CalculateDEpilogue(CONST_BATCH_BUFFER_POINTER i_lppOutputBuffer, CONST_BATCH_BUFFER_POINTER& io_lppDOutputBuffer);
+
 };
 
 
@@ -245,6 +245,13 @@ namespace NeuralNetwork {
 				return err;
 		}
 
+		// ㏈Ao̓obt@߂ɂ̂܂ܓKp
+		if(this->pEpilogueLayer)
+		{
+			ErrorCode err = this->pEpilogueLayer->CalculateEpilogue_device(o_lppOutputBuffer, this->outputBufferCount * this->GetBatchSize());
+			if(err != ErrorCode::ERROR_CODE_NONE)
+				return err;
+		}
 
 		return ErrorCode::ERROR_CODE_NONE;
 	}
@@ -310,6 +317,11 @@ namespace NeuralNetwork {
 		ǑvZʂgp */
 	ErrorCode FullyConnect_GPU::CalculateDInput_device(CONST_BATCH_BUFFER_POINTER i_lppInputBuffer, BATCH_BUFFER_POINTER o_lppDInputBuffer, CONST_BATCH_BUFFER_POINTER i_lppOutputBuffer, CONST_BATCH_BUFFER_POINTER i_lppDOutputBuffer)
 	{
+		// ㏈̔lo͌덷ɏZ
+		ErrorCode err = this->CalculateDEpilogue(i_lppOutputBuffer, i_lppDOutputBuffer);
+		if(err != ErrorCode::ERROR_CODE_NONE)
+			return err;
+
 		// ͌덷vZ
 		if(o_lppDInputBuffer)
 		{
@@ -349,8 +361,13 @@ namespace NeuralNetwork {
 		cudaMemcpy(&lpInputBuffer_h[0], i_lppInputBuffer, sizeof(F32)*lpInputBuffer_h.size(), cudaMemcpyDeviceToHost);
 
 
+		// ㏈̔lo͌덷ɏZ. Z̏o͌덷͌덷ƃp[^ωʂ̗Ŏgp
+		Gravisbell::ErrorCode errCode = this->CalculateDEpilogue(i_lppOutputBuffer, i_lppDOutputBuffer);
+		if(errCode != ErrorCode::ERROR_CODE_NONE)
+			return errCode;
+
 		// ͌덷vZ
-		Gravisbell::ErrorCode errCode = this->CalculateDInput_device(i_lppInputBuffer, o_lppDInputBuffer, i_lppOutputBuffer, i_lppDOutputBuffer);
+		errCode = this->CalculateDInput_device(i_lppInputBuffer, o_lppDInputBuffer, i_lppOutputBuffer, i_lppDOutputBuffer);
 		if(errCode != ErrorCode::ERROR_CODE_NONE)
 			return errCode;
 
@@ -409,6 +426,29 @@ namespace NeuralNetwork {
 		return ErrorCode::ERROR_CODE_NONE;
 	}
 
+	/** ㏈̔lo͌덷ɏZ.
+		㏈𓝍ĂȂꍇAZς݂̏ꍇ͏o͌덷̂܂܎gp.
+		@param	io_lppDOutputBuffer	o͌덷. Zʂ̃AhXɒu. */
+	ErrorCode FullyConnect_GPU::CalculateDEpilogue(CONST_BATCH_BUFFER_POINTER i_lppOutputBuffer, CONST_BATCH_BUFFER_POINTER& io_lppDOutputBuffer)
+	{
+		if(this->pEpilogueLayer == NULL)
+			return ErrorCode::ERROR_CODE_NONE;
+
+		const U32 bufferCount = this->outputBufferCount * this->GetBatchSize();
+		if(this->lpDOutputEpilogue.size() < bufferCount)
+			this->lpDOutputEpilogue.resize(bufferCount);
+		if(io_lppDOutputBuffer == thrust::raw_pointer_cast(&this->lpDOutputEpilogue[0]))
+			return ErrorCode::ERROR_CODE_NONE;
+
+		ErrorCode err = this->pEpilogueLayer->CalculateDEpilogue_device(i_lppOutputBuffer, io_lppDOutputBuffer, thrust::raw_pointer_cast(&this->lpDOutputEpilogue[0]), bufferCount);
+		if(err != ErrorCode::ERROR_CODE_NONE)
+			return err;
+
+		io_lppDOutputBuffer = thrust::raw_pointer_cast(&this->lpDOutputEpilogue[0]);
+
+		return ErrorCode::ERROR_CODE_NONE;
+	}
+
 
 } // Gravisbell;
 } // Layer;
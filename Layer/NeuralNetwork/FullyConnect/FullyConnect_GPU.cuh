@@ -44,6 +44,7 @@ private:
 
 	thrust::device_vector<F32> lpDBias;		/**< oCAX̕ω */
 	thrust::device_vector<F32> lpDNeuron;	/**< j[̕ω */
+	thrust::device_vector<F32> lpDOutputEpilogue;	/**< ㏈̔lZo͌덷 */
 
 	cublasHandle_t cublasHandle;
 
@@ -118,6 +119,12 @@ public:
 		@param	i_lppDOutputBuffer	o͌덷=C[̓͌덷.	[GetBatchSize()̖߂l][GetOutputBufferCount()̖߂l]̗vfKv.
 		ǑvZʂgp */
 	ErrorCode Training_device(CONST_BATCH_BUFFER_POINTER i_lppInputBuffer, BATCH_BUFFER_POINTER o_lppDInputBuffer, CONST_BATCH_BUFFER_POINTER i_lppOutputBuffer, CONST_BATCH_BUFFER_POINTER i_lppDOutputBuffer);
+
+private:
+	/** ㏈̔lo͌덷ɏZ.
+		㏈𓝍ĂȂꍇAZς݂̏ꍇ͏o͌덷̂܂܎gp.
+		@param	io_lppDOutputBuffer	o͌덷. Zʂ̃AhXɒu. */
+	ErrorCode CalculateDEpilogue(CONST_BATCH_BUFFER_POINTER i_lppOutputBuffer, CONST_BATCH_BUFFER_POINTER& io_lppDOutputBuffer);
 };
 
 
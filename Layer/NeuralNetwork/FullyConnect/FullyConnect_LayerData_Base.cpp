@@ -269,7 +269,70 @@ namespace NeuralNetwork {
 	{
 		return this->pWeightData->SetOptimizerHyperParameter(i_parameterID, i_value);
 	}
+	/** ێĂSẴIveB}CU[wIDł邩mF */
+	bool FullyConnect_LayerData_Base::CheckOptimizerID(const wchar_t i_optimizerID[])const
+	{
+		return this->pWeightData->CheckOptimizerID(i_optimizerID);
+	}
 
+
+	//===========================
+	// p[^̈
+	//===========================
+	/** Õp[^̈ɔzuꍇɕKvȗvf擾 */
+	U64 FullyConnect_LayerData_Base::GetParameterCount()const
+	{
+		if(this->pWeightData == NULL)
+			return 0;
+
+		return this->pWeightData->GetParameterCount();
+	}
+	/** p[^ƌ덷̊i[Ö̗ɕύX */
+	ErrorCode FullyConnect_LayerData_Base::BindParameterBuffer(F32* io_lpParameter, F32* io_lpDParameter)
+	{
+		if(this->pWeightData == NULL)
+			return ErrorCode::ERROR_CODE_COMMON_NULL_REFERENCE;
+
+		return this->pWeightData->BindParameterBuffer(io_lpParameter, io_lpDParameter);
+	}
+
+
+	//===========================
+	// ꊇXV
+	//===========================
+	/** XVx邩ݒ肷 */
+	ErrorCode FullyConnect_LayerData_Base::SetDeferredUpdateFlag(bool i_onDeferredUpdate)
+	{
+		if(this->pWeightData == NULL)
+			return ErrorCode::ERROR_CODE_COMMON_NULL_REFERENCE;
+
+		return this->pWeightData->SetDeferredUpdateFlag(i_onDeferredUpdate);
+	}
+	/** ꊇXV̑Ώې擾 */
+	U32 FullyConnect_LayerData_Base::GetUpdateTargetCount()const
+	{
+		if(this->pWeightData == NULL)
+			return 0;
+
+		return this->pWeightData->GetUpdateTargetCount();
+	}
+	/** ꊇXV̑Ώۂ擾 */
+	ErrorCode FullyConnect_LayerData_Base::GetUpdateTarget(U32 i_targetNum, OptimizerUpdateTarget& o_target)
+	{
+		if(this->pWeightData == NULL)
+			return ErrorCode::ERROR_CODE_COMMON_NULL_REFERENCE;
+
+		return this->pWeightData->GetUpdateTarget(i_targetNum, o_target);
+	}
+	/** ꊇXV̊ʒm */
+	ErrorCode FullyConnect_LayerData_Base::CompleteUpdate()
+	{
+		if(this->pWeightData == NULL)
+			return ErrorCode::ERROR_CODE_NONE;
+
+		return this->pWeightData->CompleteUpdate();
+	}
+
 } // Gravisbell;
 } // Layer;
 } // NeuralNetwork;
@@ -133,6 +133,32 @@ namespace NeuralNetwork {
 		ErrorCode SetOptimizerHyperParameter(const wchar_t i_parameterID[], F32 i_value);
 		ErrorCode SetOptimizerHyperParameter(const wchar_t i_parameterID[], S32 i_value);
 		ErrorCode SetOptimizerHyperParameter(const wchar_t i_parameterID[], const wchar_t i_value[]);
+		/** ێĂSẴIveB}CU[wIDł邩mF */
+		bool CheckOptimizerID(const wchar_t i_optimizerID[])const;
+
+
+		//===========================
+		// p[^̈
+		//===========================
+	public:
+		/** Õp[^̈ɔzuꍇɕKvȗvf擾 */
+		U64 GetParameterCount()const;
+		/** p[^ƌ덷̊i[Ö̗ɕύX */
+		ErrorCode BindParameterBuffer(F32* io_lpParameter, F32* io_lpDParameter);
+
+
+		//===========================
+		// ꊇXV
+		//===========================
+	public:
+		/** XVx邩ݒ肷 */
+		ErrorCode SetDeferredUpdateFlag(bool i_onDeferredUpdate);
+		/** ꊇXV̑Ώې擾 */
+		U32 GetUpdateTargetCount()const;
+		/** ꊇXV̑Ώۂ擾 */
+		ErrorCode GetUpdateTarget(U32 i_targetNum, OptimizerUpdateTarget& o_target);
+		/** ꊇXV̊ʒm */
+		ErrorCode CompleteUpdate();
 	};
 
 } // Gravisbell;
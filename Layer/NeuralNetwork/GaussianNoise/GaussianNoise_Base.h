@@ -27,6 +27,17 @@ namespace NeuralNetwork {
 
 		/** fXgN^ */
 		virtual ~GaussianNoise_Base();
+
+		//===========================
+		// C[
+		//===========================
+	public:
+		/** ZʂČvZŕł邩mF.
+			ZƂɗgp邽ߍČvZs. */
+		bool CheckCanRecompute()const
+		{
+			return false;
+		}
 	};
 
 }	// NeuralNetwork
@@ -119,6 +119,16 @@ namespace NeuralNetwork {
 	}
 
 
+	/** Zʂ͂ƈv邩mF.
+		mCY̕ςƕU0̏ꍇ̂true. */
+	bool GaussianNoise_CPU::CheckIsIdentity()
+	{
+		F32 average  = this->layerData.layerStructure.Average  + this->GetRuntimeParameterByStructure().GaussianNoise_Bias;
+		F32 variance = this->layerData.layerStructure.Variance * this->GetRuntimeParameterByStructure().GaussianNoise_Power;
+
+		return average == 0.0f && variance == 0.0f;
+	}
+
 	/** Zs.
 		@param lpInputBuffer	̓f[^obt@. GetInputBufferCountŎ擾l̗vfKv
 		@return ꍇ0Ԃ */
@@ -86,6 +86,10 @@ public:
 	//================================
 	// Z
 	//================================
+	/** Zʂ͂ƈv邩mF.
+		mCY̕ςƕU0̏ꍇ̂true. */
+	bool CheckIsIdentity();
+
 	/** Zs.
 		@param lpInputBuffer	̓f[^obt@. GetInputBufferCountŎ擾l̗vfKv
 		@return ꍇ0Ԃ */
@@ -2,6 +2,8 @@
 // ֐C[̃f[^
 //======================================
 #include"stdafx.h"
+
+#include<string>
 
 #include"Normalization_Scale_LayerData_Base.h"
 #include"Normalization_Scale_FUNC.hpp"
@@ -205,6 +207,17 @@ namespace NeuralNetwork {
 
 		return ErrorCode::ERROR_CODE_NONE;
 	}
+	/** ێĂSẴIveB}CU[wIDł邩mF */
+	bool Normalization_Scale_LayerData_Base::CheckOptimizerID(const wchar_t i_optimizerID[])const
+	{
+		std::wstring optimizerID = i_optimizerID;
+		if(this->m_pOptimizer_bias && optimizerID != this->m_pOptimizer_bias->GetOptimizerID())
+			return false;
+		if(this->m_pOptimizer_scale && optimizerID != this->m_pOptimizer_scale->GetOptimizerID())
+			return false;
+
+		return true;
+	}
 
 
 } // Gravisbell;
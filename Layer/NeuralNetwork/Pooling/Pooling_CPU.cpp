@@ -11,6 +11,8 @@
 
 #include"Pooling_CPU.h"
 #include"Pooling_LayerData_CPU.h"
+
+#define MAX_INPUT_OFFSET_CODE	L"MaxInputOffset"
 
 using namespace Gravisbell;
 using namespace Gravisbell::Layer::NeuralNetwork;
@@ -26,6 +28,9 @@ namespace NeuralNetwork {
 		,	layerData						(i_layerData)	/**< C[f[^ */
 		,	inputBufferCount				(0)		/**< ̓obt@ */
 		,	outputBufferCount				(0)		/**< o̓obt@ */
+		,	lpMaxInputOffset				(NULL)	/**< Zɋ߂ől͈̓ʒu */
+		,	temporaryMemoryManager			(i_temporaryMemoryManager)	/**< ꎞobt@Ǘ */
+		,	maxInputOffsetBufferHandle	(Gravisbell::Common::INVALID_TEMPORARY_BUFFER_HANDLE)
 	{
 	}
 	/** fXgN^ */
@@ -83,8 +88,18 @@ namespace NeuralNetwork {
 		// ͌덷obt@󂯎p̃AhXz쐬
 		this->lppBatchDInputBuffer.resize(this->GetBatchSize());
 
-
-		return ErrorCode::ERROR_CODE_NONE;
+		// ől͈̓ʒu̕ێpobt@̃TCYo^
+		this->maxInputOffsetBufferHandle = this->temporaryMemoryManager.RegisterBuffer(this->GetGUID(), MAX_INPUT_OFFSET_CODE, sizeof(U32) * this->outputBufferCount * this->GetBatchSize());
+
+		return ErrorCode::ERROR_CODE_NONE;
+	}
+
+
+	/** Z̒ԒlwKɍėpꍇɁAZwK܂ŕێꎞobt@̃TCY߂.
+		ZO(wKp)œo^obt@͒Ԓlėpꍇ̂ݗ\񂳂邽߁A̒lƂČς. */
+	U64 Pooling_CPU::GetPlannedReuseIntermediateByteCount(U32 i_batchSize)const
+	{
+		return (U64)sizeof(U32) * this->GetOutputBufferCount() * i_batchSize;
 	}
 
 
@@ -109,6 +124,9 @@ namespace NeuralNetwork {
 		this->lppBatchInputBuffer.resize(this->GetBatchSize(), NULL);
 		this->lppBatchOutputBuffer.resize(this->GetBatchSize());
 
+		// ێĂől͈̓ʒu̓obt@TCYς邽ߔj
+		this->RestoreMaxInputOffsetBuffer();
+
 
 		return ErrorCode::ERROR_CODE_NONE;
 	}
@@ -134,6 +152,12 @@ namespace NeuralNetwork {
 			this->lppBatchOutputBuffer[batchNum] = &o_lppOutputBuffer[batchNum * this->outputBufferCount];
 		}
 
+		// ̊wKōėpꍇ͍ől͈̓ʒuێ
+		if(this->GetReuseIntermediateFlag())
+			this->lpMaxInputOffset = (U32*)this->temporaryMemoryManager.ReserveBuffer(this->maxInputOffsetBufferHandle);
+		else
+			this->RestoreMaxInputOffsetBuffer();
+
 		for(U32 batchNum=0; batchNum<this->GetBatchSize(); batchNum++)
 		{
 			for(U32 ch=0; ch<this->GetOutputDataStruct().ch; ch++)
@@ -146,6 +170,7 @@ namespace NeuralNetwork {
 						{
 							// ől𒲂ׂ
 							F32 maxValue = -FLT_MAX;
+							U32 maxInputOffset = this->inputBufferCount;
 							for(S32 filterZ=0; filterZ<this->layerData.layerStructure.FilterSize.z; filterZ++)
 							{
 								U32 inputZ = outputZ * this->layerData.layerStructure.Stride.z + filterZ;
@@ -166,13 +191,19 @@ namespace NeuralNetwork {
 
 										U32 inputOffset = this->GetInputDataStruct().POSITION_TO_OFFSET(inputX, inputY, inputZ, ch);
 
-										maxValue = max(maxValue, this->lppBatchInputBuffer[batchNum][inputOffset]);
+										if(this->lppBatchInputBuffer[batchNum][inputOffset] > maxValue)
+										{
+											maxValue = this->lppBatchInputBuffer[batchNum][inputOffset];
+											maxInputOffset = inputOffset;
+										}
 									}
 								}
 							}
 							
 							U32 outputOffset = this->GetOutputDataStruct().POSITION_TO_OFFSET(outputX,outputY,outputZ,ch);
 							this->lppBatchOutputBuffer[batchNum][outputOffset] = maxValue;
+							if(this->lpMaxInputOffset)
+								this->lpMaxInputOffset[batchNum*this->outputBufferCount + outputOffset] = maxInputOffset;
 						}
 					}
 				}
@@ -207,6 +238,22 @@ namespace NeuralNetwork {
 
 			// ͌덷obt@
 			memset(o_lppDInputBuffer, 0, sizeof(F32) * this->inputBufferCount * this->GetBatchSize());
+
+			// Z̍ől͈̓ʒuێĂꍇ́AtB^𑖍Ɍ덷蓖Ă
+			if(this->lpMaxInputOffset)
+			{
+				for(U32 batchNum=0; batchNum<this->GetBatchSize(); batchNum++)
+				{
+					for(U32 outputOffset=0; outputOffset<this->outputBufferCount; outputOffset++)
+					{
+						U32 inputOffset = this->lpMaxInputOffset[batchNum*this->outputBufferCount + outputOffset];
+						if(inputOffset < this->inputBufferCount)
+							this->lppBatchDInputBuffer[batchNum][inputOffset] = this->lppBatchDOutputBufferPrev[batchNum][outputOffset];
+					}
+				}
+
+				return ErrorCode::ERROR_CODE_NONE;
+			}
 
 			for(U32 batchNum=0; batchNum<this->GetBatchSize(); batchNum++)
 			{
@@ -266,7 +313,22 @@ namespace NeuralNetwork {
 		ǑvZʂgp */
 	ErrorCode Pooling_CPU::Training_device(CONST_BATCH_BUFFER_POINTER i_lppInputBuffer, BATCH_BUFFER_POINTER o_lppDInputBuffer, CONST_BATCH_BUFFER_POINTER i_lppOutputBuffer, CONST_BATCH_BUFFER_POINTER i_lppDOutputBuffer)
 	{
-		return this->CalculateDInput_device(i_lppInputBuffer, o_lppDInputBuffer, i_lppOutputBuffer, i_lppDOutputBuffer);
+		ErrorCode err = this->CalculateDInput_device(i_lppInputBuffer, o_lppDInputBuffer, i_lppOutputBuffer, i_lppDOutputBuffer);
+
+		// ől͈̓ʒu͊wKŎgI邽ߊJ
+		this->RestoreMaxInputOffsetBuffer();
+
+		return err;
+	}
+
+	/** ől͈̓ʒu̕ێpobt@J */
+	void Pooling_CPU::RestoreMaxInputOffsetBuffer()
+	{
+		if(this->lpMaxInputOffset == NULL)
+			return;
+
+		this->temporaryMemoryManager.RestoreBuffer(this->maxInputOffsetBufferHandle);
+		this->lpMaxInputOffset = NULL;
 	}
 
 
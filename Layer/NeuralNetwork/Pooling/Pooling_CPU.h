@@ -33,6 +33,12 @@ private:
 	// Get֐gƏׂނ̂ňꎞۑp. PreCalculateŒli[.
 	U32 inputBufferCount;				/**< ̓obt@ */
 	U32 outputBufferCount;				/**< o̓obt@ */
+
+	// wKp̃f[^
+	U32* lpMaxInputOffset;		/**< Zɋ߂ől͈̓ʒu <ob`><o̓obt@>. wKɍėp. ێĂȂꍇNULL */
+
+	Gravisbell::Common::ITemporaryMemoryManager& temporaryMemoryManager;	/**< ꎞobt@Ǘ */
+	Gravisbell::Common::TemporaryBufferHandle maxInputOffsetBufferHandle;	/**< ől͈̓ʒüꎞobt@̃nh */
 
 public:
 	/** RXgN^ */
@@ -75,6 +81,8 @@ public:
 		NN쐬AZsOɈxKs邱ƁBf[^ƂɎsKv͂Ȃ.
 		sꍇCalculateȍ~͎̏ss. */
 	ErrorCode PreProcessCalculate();
+	/** Z̒ԒlwKɍėpꍇɁAZwK܂ŕێꎞobt@̃TCY߂. */
+	U64 GetPlannedReuseIntermediateByteCount(U32 i_batchSize)const;
 
 
 	/** [v̏.f[^Zbg̎sJnOɎs
@@ -104,6 +112,10 @@ public:
 		@param	i_lppDOutputBuffer	o͌덷=C[̓͌덷.	[GetBatchSize()̖߂l][GetOutputBufferCount()̖߂l]̗vfKv.
 		ǑvZʂgp */
 	ErrorCode Training_device(CONST_BATCH_BUFFER_POINTER i_lppInputBuffer, BATCH_BUFFER_POINTER o_lppDInputBuffer, CONST_BATCH_BUFFER_POINTER i_lppOutputBuffer, CONST_BATCH_BUFFER_POINTER i_lppDOutputBuffer);
+
+private:
+	/** ől͈̓ʒu̕ێpobt@J */
+	void RestoreMaxInputOffsetBuffer();
 };
 
 
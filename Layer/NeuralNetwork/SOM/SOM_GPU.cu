@@ -35,6 +35,7 @@ namespace NeuralNetwork {
 		,	unitCount						(0)		/**< jbg */
 		,	outputBufferCount				(0)		/**< o̓obt@ */
 		,	temporaryMemoryManager			(i_temporaryMemoryManager)
+		,	matchRateBufferHandle	(Gravisbell::Common::INVALID_TEMPORARY_BUFFER_HANDLE)
 	{
 		cublasCreate(&cublasHandle);
 	}
@@ -91,6 +92,15 @@ namespace NeuralNetwork {
 
 		// p[^̕ωʃobt@
 		this->lpDUnit.resize(this->unitCount * this->inputBufferCount);
+
+		return ErrorCode::ERROR_CODE_NONE;
+	}
+
+
+	/** ZO(wKp)œo^ꎞobt@̃TCYAobt@mۂɓo^. */
+	ErrorCode SOM_GPU::RegisterPlannedTemporaryBuffer(Gravisbell::Common::ITemporaryMemoryManager& o_temporaryMemoryManager, U32 i_batchSize)const
+	{
+		o_temporaryMemoryManager.RegisterBuffer(this->GetGUID(), CODE_MATCH_RATE, sizeof(F32)*this->GetUnitCount()*this->layerData.layerStructure.DimensionCount);
 
 		return ErrorCode::ERROR_CODE_NONE;
 	}
@@ -141,7 +151,7 @@ namespace NeuralNetwork {
 
 
 		// ꎞobt@̃TCYݒ
-		this->temporaryMemoryManager.SetBufferSize(this->GetGUID(), CODE_MATCH_RATE, sizeof(F32)*this->unitCount*this->layerData.layerStructure.DimensionCount);
+		this->matchRateBufferHandle = this->temporaryMemoryManager.RegisterBuffer(this->GetGUID(), CODE_MATCH_RATE, sizeof(F32)*this->unitCount*this->layerData.layerStructure.DimensionCount);
 
 
 		return ErrorCode::ERROR_CODE_NONE;
@@ -165,7 +175,7 @@ namespace NeuralNetwork {
 		// BMU(Best Matching Unit)𒲂ׂ
 		{
 			// obt@m
-			F32* lpTmpMatchRate = (F32*)this->temporaryMemoryManager.ReserveBuffer(this->GetGUID(), CODE_MATCH_RATE);
+			F32* lpTmpMatchRate = (F32*)this->temporaryMemoryManager.ReserveBuffer(this->matchRateBufferHandle);
 
 			// vvZ
 			{
@@ -208,7 +218,7 @@ namespace NeuralNetwork {
 			// jbgW߂
 
 			// obt@
-			this->temporaryMemoryManager.RestoreBuffer(this->GetGUID(), CODE_MATCH_RATE);
+			this->temporaryMemoryManager.RestoreBuffer(this->matchRateBufferHandle);
 		}
 
 		return ErrorCode::ERROR_CODE_NONE;
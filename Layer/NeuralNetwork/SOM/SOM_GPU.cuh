@@ -48,6 +48,7 @@ private:
 	cublasHandle_t cublasHandle;
 
 	Gravisbell::Common::ITemporaryMemoryManager& temporaryMemoryManager;
+	Gravisbell::Common::TemporaryBufferHandle matchRateBufferHandle;	/**< v̈ꎞobt@̃nh */
 
 public:
 	/** RXgN^ */
@@ -90,6 +91,8 @@ public:
 		NN쐬AZsOɈxKs邱ƁBf[^ƂɎsKv͂Ȃ.
 		sꍇCalculateȍ~͎̏ss. */
 	ErrorCode PreProcessCalculate();
+	/** ZO(wKp)œo^ꎞobt@̃TCYAobt@mۂɓo^. */
+	ErrorCode RegisterPlannedTemporaryBuffer(Gravisbell::Common::ITemporaryMemoryManager& o_temporaryMemoryManager, U32 i_batchSize)const;
 
 
 	/** [v̏.f[^Zbg̎sJnOɎs
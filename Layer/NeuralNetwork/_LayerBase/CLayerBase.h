@@ -38,11 +38,16 @@ namespace NeuralNetwork {
 	private:
 		ProcessType processType;
 		U32 batchSize;	/**< ob`TCY */
+		U32 maxBatchSize;	/**< őob`TCY. ZOŎw肵ob`TCY */
+		bool onReuseIntermediate;	/**< Z̒ԒlwKɍėptO */
 
 	public:
 		/** RXgN^ */
 		CLayerBase()
 			:	processType					(PROCESSTYPE_CALCULATE)
+			,	batchSize					(0)
+			,	maxBatchSize				(0)
+			,	onReuseIntermediate			(false)
 		{
 		}
 		/** fXgN^ */
@@ -82,7 +87,9 @@ namespace NeuralNetwork {
 		virtual ErrorCode PreProcessLearn(U32 batchSize)
 		{
 			this->batchSize = batchSize;
+			this->maxBatchSize = batchSize;
 			this->processType = PROCESSTYPE_LEARN;
+			this->onReuseIntermediate = false;
 
 			return PreProcessLearn();
 		}
@@ -95,7 +102,9 @@ namespace NeuralNetwork {
 		virtual ErrorCode PreProcessCalculate(U32 batchSize)
 		{
 			this->batchSize = batchSize;
+			this->maxBatchSize = batchSize;
 			this->processType = PROCESSTYPE_CALCULATE;
+			this->onReuseIntermediate = false;
 
 			return PreProcessCalculate();
 		}
@@ -109,6 +118,59 @@ namespace NeuralNetwork {
 			return this->batchSize;
 		}
 
+		/** ZɎgpob`TCYύX.
+			ZOŎw肵ob`TCYȉł΁Aobt@̍Ċmۂs킸ɕύXł.
+			@param batchSize	ɉZsob`̃TCY. 1`GetMaxBatchSize()̖߂l. */
+		ErrorCode SetBatchSize(U32 batchSize)
+		{
+			// wK̓ob`Ŝœv鏈邽ߕύXłȂ
+			if(this->processType != PROCESSTYPE_CALCULATE)
+				return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+			if(batchSize == 0 || batchSize > this->maxBatchSize)
+				return ErrorCode::ERROR_CODE_COMMON_OUT_OF_VALUERANGE;
+			if(batchSize == this->batchSize)
+				return ErrorCode::ERROR_CODE_NONE;
+
+			U32 prevBatchSize = this->batchSize;
+			this->batchSize = batchSize;
+
+			ErrorCode err = this->ChangeBatchSize(prevBatchSize);
+			if(err != ErrorCode::ERROR_CODE_NONE)
+				this->batchSize = prevBatchSize;
+
+			return err;
+		}
+		/** őob`TCY擾.
+			@return ZOŎw肵ob`̃TCY */
+		U32 GetMaxBatchSize()const
+		{
+			return this->maxBatchSize;
+		}
+
+		/** Z̒ԒlwKɍėp邩ݒ肷.
+			ZO(wKp)sĂꍇ̂ݗL.
+			@param	i_onReuse	truȅꍇAԒlėp. */
+		void SetReuseIntermediateFlag(bool i_onReuse)
+		{
+			this->onReuseIntermediate = i_onReuse && (this->processType == PROCESSTYPE_LEARN);
+		}
+		/** Z̒ԒlwKɍėp邩mF */
+		bool GetReuseIntermediateFlag()const
+		{
+			return this->onReuseIntermediate;
+		}
+
+	protected:
+		/** ob`TCYύX̏.
+			ob`TCYɍ쐬\(cuDNÑf[^\)C[̓I[o[ChčXV.
+			obt@͍őob`TCYŊmۍς݂̂ߍĊmۂĂ͂ȂȂ.
+			@param i_prevBatchSize	ύXÕob`TCY */
+		virtual ErrorCode ChangeBatchSize(U32 i_prevBatchSize)
+		{
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+
+	public:
 		/** Zʂ擾 */
 		ProcessType GetProcessType()const
 		{
@@ -27,6 +27,27 @@ namespace Gravisbell {
 namespace Layer {
 namespace NeuralNetwork {
 
+	/** cuDNÑf[^\̃ob`ύX.
+		擪̗vf̓ob`TCYɔႷ̂ƂčĐݒ肷. XgCh͕ύXȂ.
+		@param	io_tensorDesc		ύXf[^\.
+		@param	i_prevBatchSize		ύXÕob`TCY.
+		@param	i_batchSize			ύX̃ob`TCY. */
+	inline cudnnStatus_t ChangeTensorDescriptorBatchSize(cudnnTensorDescriptor_t io_tensorDesc, U32 i_prevBatchSize, U32 i_batchSize)
+	{
+		cudnnDataType_t dataType;
+		int dimCount = 0;
+		int dimA[CUDNN_DIM_MAX];
+		int strideA[CUDNN_DIM_MAX];
+
+		cudnnStatus_t err = cudnnGetTensorNdDescriptor(io_tensorDesc, CUDNN_DIM_MAX, &dataType, &dimCount, dimA, strideA);
+		if(err != CUDNN_STATUS_SUCCESS)
+			return err;
+
+		dimA[0] = dimA[0] / i_prevBatchSize * i_batchSize;
+
+		return cudnnSetTensorNdDescriptor(io_tensorDesc, dataType, dimCount, dimA, strideA);
+	}
+
 	//=================================
 	// P / Po
 	//=================================
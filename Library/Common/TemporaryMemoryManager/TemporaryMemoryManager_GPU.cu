@@ -6,7 +6,10 @@
 #include"Library/Common/TemporaryMemoryManager.h"
 
 #include<map>
-#include<list>
+#include<deque>
+#include<vector>
+#include<string>
+#include<algorithm>
 
 #include<thrust/device_vector.h>
 
@@ -14,45 +17,166 @@
 namespace Gravisbell {
 namespace Common {
 
-	template<class BufferType>
+	/** L̈(foCX).
+		cudaMallocŊmۂ̈̓hCo傫ȃy[WŊǗ邽߁Aʏ̊mۂs */
+	class ArenaBuffer_device
+	{
+	private:
+		thrust::device_vector<BYTE> lpBuffer;
+
+	public:
+		/** ̈mۂ. mۍς݂̗̈͊J */
+		void Allocate(U64 i_byteCount)
+		{
+			this->Release();
+			this->lpBuffer.resize((size_t)i_byteCount);
+		}
+		/** ̈J */
+		void Release()
+		{
+			thrust::device_vector<BYTE>().swap(this->lpBuffer);
+		}
+		/** ̈̐擪擾. mۂĂȂꍇNULL */
+		BYTE* GetBuffer()
+		{
+			if(this->lpBuffer.empty())
+				return NULL;
+			return thrust::raw_pointer_cast(&this->lpBuffer[0]);
+		}
+	};
+
+	/** L̈(zXg).
+		[Wy[Wgp\ȏꍇ̓[Wy[WŊmۂAgpłȂꍇ͒ʏ̃y[WŊmۂ */
+	class ArenaBuffer_host
+	{
+	private:
+		BYTE* lpBuffer;
+
+	public:
+		/** RXgN^ */
+		ArenaBuffer_host()
+			:	lpBuffer	(NULL)
+		{
+		}
+		/** fXgN^ */
+		~ArenaBuffer_host()
+		{
+			this->Release();
+		}
+
+	public:
+		/** ̈mۂ. mۍς݂̗̈͊J */
+		void Allocate(U64 i_byteCount)
+		{
+			this->Release();
+			if(i_byteCount == 0)
+				return;
+
+			// [Wy[WŊm. bNy[Wꍇ͎s
+			SIZE_T largePageSize = GetLargePageMinimum();
+			if(largePageSize > 0)
+			{
+				SIZE_T byteCount = (SIZE_T)((i_byteCount + largePageSize - 1) / largePageSize * largePageSize);
+				this->lpBuffer = (BYTE*)VirtualAlloc(NULL, byteCount, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+			}
+
+			// ʏ̃y[WŊm
+			if(this->lpBuffer == NULL)
+				this->lpBuffer = (BYTE*)VirtualAlloc(NULL, (SIZE_T)i_byteCount, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+		}
+		/** ̈J */
+		void Release()
+		{
+			if(this->lpBuffer)
+				VirtualFree(this->lpBuffer, 0, MEM_RELEASE);
+			this->lpBuffer = NULL;
+		}
+		/** ̈̐擪擾. mۂĂȂꍇNULL */
+		BYTE* GetBuffer()
+		{
+			return this->lpBuffer;
+		}
+	};
+
+
+	template<class BufferType, class ArenaType>
 	class TemporaryMemoryManager : public ITemporaryMemoryManager
 	{
 	private:
-		struct BufferInfo
+		/** JĂȂgpԂ̏I */
+		static const U32 LIFETIME_OPEN = 0xFFFFFFFF;
+
+		/** mۍς݂̃obt@ */
+		struct SlabInfo
 		{
-			bool onReserved;						/**< gp\񂪂Ă邩 */
-			GUID guid;								/**< \񂵂Ă郌C[GUID */
+			bool onReserved;	/**< gp\񂪂Ă邩 */
+			U32 byteCount;		/**< gp\ȃTCY. oCgP */
+			U32 alignOffset;	/**< mۂobt@̐擪狫E܂ł̃ItZbg */
 			BufferType lpBuffer;	/**< obt@{ */
 
-			BufferInfo()
+			SlabInfo()
 				:	onReserved	(false)
-				,	guid		()
-				,	lpBuffer()
-			{
-			}
-			BufferInfo(BufferInfo& info)
-				:	onReserved	(info.onReserved)
-				,	guid		(info.guid)
-				,	lpBuffer	(info.lpBuffer)
-			{
-			}
-			BufferInfo(bool i_onReserved, GUID i_guid, U32 i_bufferSize)
-				:	onReserved	(i_onReserved)
-				,	guid		(i_guid)
-				,	lpBuffer	(i_bufferSize)
+				,	byteCount	(0)
+				,	alignOffset	(0)
+				,	lpBuffer	()
 			{
 			}
 		};
+		/** gp@Ƃ̃obt@.
+			R[h̃obt@̓C[ԂŋL */
+		struct CodeInfo
+		{
+			std::deque<SlabInfo> lpSlab;	/**< mۍς݂̃obt@. ǉɊ̃obt@ړȂdequegp */
+			std::vector<U32> lpFreeSlabNo;	/**< \񂳂ĂȂobt@̔ԍ */
+		};
+		/** nh̓o^ */
+		struct HandleInfo
+		{
+			GUID guid;			/**< o^C[GUID */
+			U32 codeNo;			/**< gp@̔ԍ */
+			U32 bufferSize;		/**< vꂽTCY. oCgP */
+			S32 reserveSlabNo;	/**< \񒆂̃obt@̔ԍ. \񂵂ĂȂꍇ-1 */
+
+			S64 arenaOffset;		/**< L̈̈ʒu. zuĂȂꍇ-1 */
+			U32 arenaByteCount;		/**< L̈ɔzuTCY. oCgP */
+			bool onArenaReserved;	/**< L̈ŗ\񒆂 */
+
+			bool onRecordExclude;	/**< ̋L^Jn\񒆂. JɋL^Jn̎gpԂL^ */
+			std::vector<std::pair<U32,U32>> lpLifetime;	/**< L^̎gp. <\񎞍, J> */
+		};
+
+		std::map<GUID, std::map<std::wstring, TemporaryBufferHandle>>	lpHandleByName;	/**< ẘ֐p. <C[GUID, <R[h, nh>> */
+		std::map<std::wstring, U32>	lpCodeNo;		/**< R[hƂ̔ԍ */
+
+		std::vector<HandleInfo>	lpHandleInfo;		/**< nh̓o^. Y̓nh */
+		std::deque<CodeInfo>	lpCodeInfo;			/**< gp@Ƃ̃obt@. Y̓R[hԍ */
+
+		U64 reservedByteCount;		/**< \񒆂̃obt@̍vTCY */
+		U64 peakReservedByteCount;	/**< \񒆂̃obt@̍vTCY̍ől */
+
+		ArenaType arena;			/**< L̈ */
+		U64 arenaByteCount;			/**< L̈̃TCY */
+		std::vector<TemporaryBufferHandle> lpArenaReservedHandle;	/**< L̈ŗ\񒆂̃nh */
 
-		std::map<GUID, std::map<std::wstring, U32>>	lpBufferSize;				/**< obt@̃TCYꗗ */
-		std::map<std::wstring, BufferType>	lpShareBuffer;		/**< Lobt@{ */
-		std::map<std::wstring, std::list<BufferInfo>>		lpReserveBuffer;	/**< \obt@{ */
+		bool onArenaPlanRequired;	/**< L̈̔zu肵Kv邩 */
+		bool onLifetimeRecord;		/**< ̋L^ */
+		bool onLifetimeRecordEnd;	/**< ̋L^̏IvĂ邩 */
+		U32 lifetimeClock;			/**< L^̎. \/JƂɐi߂ */
+		U32 openLifetimeCount;		/**< L^ɗ\񂳂AJĂȂobt@̐ */
 
 
 	public:
 		/** RXgN^ */
 		TemporaryMemoryManager()
 			:	ITemporaryMemoryManager()
+			,	reservedByteCount		(0)
+			,	peakReservedByteCount	(0)
+			,	arenaByteCount			(0)
+			,	onArenaPlanRequired		(true)
+			,	onLifetimeRecord		(false)
+			,	onLifetimeRecordEnd		(false)
+			,	lifetimeClock			(0)
+			,	openLifetimeCount		(0)
 		{
 		}
 
@@ -61,6 +185,153 @@ namespace Common {
 		{
 		}
 
+	private:
+		/** vꂽTCYEPʂɐ؂グ */
+		static U32 GetSlabByteCount(U32 i_bufferSize)
+		{
+			U32 byteCount = (i_bufferSize + (TEMPORARY_BUFFER_ALIGNMENT-1)) / TEMPORARY_BUFFER_ALIGNMENT * TEMPORARY_BUFFER_ALIGNMENT;
+			if(byteCount == 0)
+				byteCount = TEMPORARY_BUFFER_ALIGNMENT;
+
+			return byteCount;
+		}
+
+		/** w̃nh擾.
+			@return	o^̏ꍇINVALID_TEMPORARY_BUFFER_HANDLE */
+		TemporaryBufferHandle FindHandle(GUID i_layerGUID, const wchar_t i_szCode[])const
+		{
+			auto it_guid = this->lpHandleByName.find(i_layerGUID);
+			if(it_guid == this->lpHandleByName.end())
+				return INVALID_TEMPORARY_BUFFER_HANDLE;
+
+			auto it_code = it_guid->second.find(i_szCode);
+			if(it_code == it_guid->second.end())
+				return INVALID_TEMPORARY_BUFFER_HANDLE;
+
+			return it_code->second;
+		}
+
+		/** 2̃obt@̋L^̎gpԂdȂ邩 */
+		static bool CheckLifetimeOverlap(const HandleInfo& i_handleInfo1, const HandleInfo& i_handleInfo2)
+		{
+			for(auto& lifetime1 : i_handleInfo1.lpLifetime)
+			{
+				for(auto& lifetime2 : i_handleInfo2.lpLifetime)
+				{
+					if(lifetime1.first < lifetime2.second && lifetime2.first < lifetime1.second)
+						return true;
+				}
+			}
+			return false;
+		}
+
+		/** L̈ŗ\ł邩.
+			zuς݂ŁAL̈ŗ\񒆂̑̃obt@ƃAhXdȂȂꍇɗ\ł.
+			L^͔zu肵߁AL̈gpȂ */
+		bool CheckArenaReservable(TemporaryBufferHandle i_handle)const
+		{
+			if(this->onLifetimeRecord)
+				return false;
+			if(this->arenaByteCount == 0)
+				return false;
+
+			const HandleInfo& handleInfo = this->lpHandleInfo[i_handle];
+			if(handleInfo.arenaOffset < 0)
+				return false;
+			if(GetSlabByteCount(handleInfo.bufferSize) > handleInfo.arenaByteCount)
+				return false;
+
+			for(auto reservedHandle : this->lpArenaReservedHandle)
+			{
+				const HandleInfo& reservedInfo = this->lpHandleInfo[reservedHandle];
+				if(handleInfo.arenaOffset < reservedInfo.arenaOffset + reservedInfo.arenaByteCount && reservedInfo.arenaOffset < handleInfo.arenaOffset + handleInfo.arenaByteCount)
+					return false;
+			}
+
+			return true;
+		}
+
+		/** L^gpԂ狤L̈̔zu肵Amۂ.
+			TCY̑傫obt@珇ɁAgpԂ̏dȂobt@ƏdȂȂłÖʒuɔzu */
+		void BuildArena()
+		{
+			this->onLifetimeRecord = false;
+			this->onLifetimeRecordEnd = false;
+
+			// L̈gp̏ꍇ͊mۂȂ߁A̋L^Ŕzu
+			if(!this->lpArenaReservedHandle.empty())
+				return;
+
+			// L^Ɏgpꂽobt@傫ɕׂ
+			std::vector<TemporaryBufferHandle> lpPlanHandle;
+			for(TemporaryBufferHandle handle=0; handle<this->lpHandleInfo.size(); handle++)
+			{
+				HandleInfo& handleInfo = this->lpHandleInfo[handle];
+				handleInfo.arenaOffset = -1;
+				handleInfo.arenaByteCount = 0;
+
+				if(!handleInfo.lpLifetime.empty())
+					lpPlanHandle.push_back(handle);
+			}
+			std::stable_sort(lpPlanHandle.begin(), lpPlanHandle.end(), [this](TemporaryBufferHandle i_handle1, TemporaryBufferHandle i_handle2)
+			{
+				return this->lpHandleInfo[i_handle1].bufferSize > this->lpHandleInfo[i_handle2].bufferSize;
+			});
+
+			// zu
+			U64 arenaByteCount = 0;
+			std::vector<std::pair<S64,S64>> lpUsedRange;
+			for(U32 planNum=0; planNum<lpPlanHandle.size(); planNum++)
+			{
+				HandleInfo& handleInfo = this->lpHandleInfo[lpPlanHandle[planNum]];
+				U32 byteCount = GetSlabByteCount(handleInfo.bufferSize);
+
+				// gpԂ̏dȂzuς݃obt@͈̔͂擾
+				lpUsedRange.clear();
+				for(U32 placedNum=0; placedNum<planNum; placedNum++)
+				{
+					const HandleInfo& placedInfo = this->lpHandleInfo[lpPlanHandle[placedNum]];
+					if(CheckLifetimeOverlap(handleInfo, placedInfo))
+						lpUsedRange.push_back(std::make_pair(placedInfo.arenaOffset, placedInfo.arenaOffset + placedInfo.arenaByteCount));
+				}
+				std::sort(lpUsedRange.begin(), lpUsedRange.end());
+
+				// ܂錄ԂOT
+				S64 offset = 0;
+				for(auto& usedRange : lpUsedRange)
+				{
+					if(usedRange.first >= offset + byteCount)
+						break;
+					if(usedRange.second > offset)
+						offset = usedRange.second;
+				}
+
+				handleInfo.arenaOffset = offset;
+				handleInfo.arenaByteCount = byteCount;
+				if(arenaByteCount < (U64)(offset + byteCount))
+					arenaByteCount = (U64)(offset + byteCount);
+			}
+
+			// L̈m
+			this->arena.Allocate(arenaByteCount);
+			this->arenaByteCount = this->arena.GetBuffer() ? arenaByteCount : 0;
+			this->onArenaPlanRequired = false;
+			if(this->arenaByteCount == 0)
+				return;
+
+			// \񂳂ĂȂobt@͋L̈Œu邽ߊJ
+			for(auto& codeInfo : this->lpCodeInfo)
+			{
+				for(auto slabNo : codeInfo.lpFreeSlabNo)
+				{
+					SlabInfo& slab = codeInfo.lpSlab[slabNo];
+					BufferType().swap(slab.lpBuffer);
+					slab.byteCount = 0;
+					slab.alignOffset = 0;
+				}
+			}
+		}
+
 	public:
 		/** obt@TCYo^.
 			@param	i_layerGUID		C[GUID.
@@ -68,7 +339,7 @@ namespace Common {
 			@param	i_bufferSize	obt@̃TCY. oCgP. */
 		ErrorCode SetBufferSize(GUID i_layerGUID, const wchar_t i_szCode[], U32 i_bufferSize)
 		{
-			this->lpBufferSize[i_layerGUID][(std::wstring)i_szCode] = i_bufferSize;
+			this->RegisterBuffer(i_layerGUID, i_szCode, i_bufferSize);
 
 			return ErrorCode::ERROR_CODE_NONE;
 		}
@@ -78,92 +349,283 @@ namespace Common {
 			@param	i_szCode		gp@`ID. */
 		U32 GetBufferSize(GUID i_layerGUID, const wchar_t i_szCode[])const
 		{
-			auto it_guid = this->lpBufferSize.find(i_layerGUID);
-			if(it_guid == this->lpBufferSize.end())
-				return 0;
-
-			auto it_code = it_guid->second.find(i_szCode);
-			if(it_code == it_guid->second.end())
-				return 0;
-
-			return it_code->second;
+			return this->GetBufferSize(this->FindHandle(i_layerGUID, i_szCode));
 		}
 
-		/** obt@擾 */
-		BYTE* GetBuffer(GUID i_layerGUID, const wchar_t i_szCode[])
+		/** o^ς݂̃obt@TCYgpʂς.
+			R[h̃obt@̓C[ԂŋL邽߁AR[hƂ̍őTCY̍vƂȂ.
+			L̈̔zuς݂̏ꍇ͋L̈̃TCYƂȂ.
+			@return	oCgP */
+		U64 GetEstimatedByteCount()const
 		{
-			U32 bufferSize = lpBufferSize[i_layerGUID][i_szCode];
-			thrust::device_vector<BYTE>& buffer = this->lpShareBuffer[i_szCode];
+			if(!this->onArenaPlanRequired && this->arenaByteCount > 0)
+				return this->arenaByteCount;
 
-			if(buffer.size() < bufferSize)
-				buffer.resize(bufferSize);
+			std::vector<U32> lpMaxBufferSize(this->lpCodeInfo.size(), 0);
+			for(auto& handleInfo : this->lpHandleInfo)
+			{
+				U32 byteCount = GetSlabByteCount(handleInfo.bufferSize);
+				if(lpMaxBufferSize[handleInfo.codeNo] < byteCount)
+					lpMaxBufferSize[handleInfo.codeNo] = byteCount;
+			}
+
+			U64 byteCount = 0;
+			for(auto maxBufferSize : lpMaxBufferSize)
+				byteCount += maxBufferSize;
 
-			return thrust::raw_pointer_cast(&buffer[0]);
+			return byteCount;
 		}
 
 		/** obt@\񂵂Ď擾 */
 		BYTE* ReserveBuffer(GUID i_layerGUID, const wchar_t i_szCode[])
 		{
-			// obt@TCY擾
-			U32 bufferSize = lpBufferSize[i_layerGUID][i_szCode];
+			TemporaryBufferHandle handle = this->FindHandle(i_layerGUID, i_szCode);
+			if(handle == INVALID_TEMPORARY_BUFFER_HANDLE)
+				handle = this->RegisterBuffer(i_layerGUID, i_szCode, 0);
 
-			// R[h̋󂫃obt@
-			auto& bufferList = this->lpReserveBuffer[i_szCode];
-			auto it = bufferList.begin();
-			while(it != bufferList.end())
-			{
-				if(!it->onReserved)
-					break;
-				if(it->guid == i_layerGUID)
-					return thrust::raw_pointer_cast(&it->lpBuffer[0]);	// \ς݂œGUID̏ꍇI
+			return this->ReserveBuffer(handle);
+		}
+		/** \ς݃obt@J */
+		void RestoreBuffer(GUID i_layerGUID, const wchar_t i_szCode[])
+		{
+			this->RestoreBuffer(this->FindHandle(i_layerGUID, i_szCode));
+		}
 
-				it++;
-			}
 
-			if(it == bufferList.end())
+		//====================================
+		// nhw
+		//====================================
+		/** obt@TCYo^A\/JɎgpnh擾.
+			ZOŌĂяo. o^ς݂̃C[,R[h̏ꍇ̓TCYXVAnhԂ. */
+		TemporaryBufferHandle RegisterBuffer(GUID i_layerGUID, const wchar_t i_szCode[], U32 i_bufferSize)
+		{
+			TemporaryBufferHandle& handle = this->lpHandleByName[i_layerGUID].insert(std::make_pair(std::wstring(i_szCode), INVALID_TEMPORARY_BUFFER_HANDLE)).first->second;
+			if(handle == INVALID_TEMPORARY_BUFFER_HANDLE)
 			{
-				// 󂫂Ȃꍇ͋Iɒǉ
-				it = bufferList.insert(bufferList.end(), BufferInfo(true, i_layerGUID, bufferSize));
+				// R[hԍ擾
+				auto it_code = this->lpCodeNo.find(i_szCode);
+				if(it_code == this->lpCodeNo.end())
+				{
+					it_code = this->lpCodeNo.insert(std::make_pair(std::wstring(i_szCode), (U32)this->lpCodeInfo.size())).first;
+					this->lpCodeInfo.push_back(CodeInfo());
+				}
+
+				HandleInfo handleInfo;
+				handleInfo.guid = i_layerGUID;
+				handleInfo.codeNo = it_code->second;
+				handleInfo.bufferSize = 0;
+				handleInfo.reserveSlabNo = -1;
+				handleInfo.arenaOffset = -1;
+				handleInfo.arenaByteCount = 0;
+				handleInfo.onArenaReserved = false;
+				handleInfo.onRecordExclude = false;
+
+				handle = (TemporaryBufferHandle)this->lpHandleInfo.size();
+				this->lpHandleInfo.push_back(handleInfo);
 			}
-			else
+
+			this->lpHandleInfo[handle].bufferSize = i_bufferSize;
+
+			// L̈Ɏ܂Ȃꍇ͔zu肵
+			if(GetSlabByteCount(i_bufferSize) > this->lpHandleInfo[handle].arenaByteCount)
+				this->onArenaPlanRequired = true;
+
+			return handle;
+		}
+
+		/** obt@TCY擾. */
+		U32 GetBufferSize(TemporaryBufferHandle i_handle)const
+		{
+			if(i_handle >= this->lpHandleInfo.size())
+				return 0;
+
+			return this->lpHandleInfo[i_handle].bufferSize;
+		}
+
+		/** obt@\񂵂Ď擾.
+			R[h̋󂫃obt@ėp. nhŗ\ς݂̏ꍇ͗\񒆂̃obt@Ԃ. */
+		BYTE* ReserveBuffer(TemporaryBufferHandle i_handle)
+		{
+			if(i_handle >= this->lpHandleInfo.size())
+				return NULL;
+			HandleInfo& handleInfo = this->lpHandleInfo[i_handle];
+			CodeInfo& codeInfo = this->lpCodeInfo[handleInfo.codeNo];
+
+			U32 byteCount = GetSlabByteCount(handleInfo.bufferSize);
+
+			if(handleInfo.onArenaReserved)
+				return this->arena.GetBuffer() + handleInfo.arenaOffset;
+
+			if(handleInfo.reserveSlabNo < 0)
 			{
-				// obt@̃TCYmFāAKvȂg
-				if(it->lpBuffer.size() < bufferSize)
-					it->lpBuffer.resize(bufferSize);
+				// L^
+				if(this->onLifetimeRecord && !handleInfo.onRecordExclude)
+				{
+					handleInfo.lpLifetime.push_back(std::make_pair(this->lifetimeClock++, (U32)LIFETIME_OPEN));
+					this->openLifetimeCount++;
+				}
+
+				// L̈ŗ\
+				if(this->CheckArenaReservable(i_handle))
+				{
+					handleInfo.onArenaReserved = true;
+					this->lpArenaReservedHandle.push_back(i_handle);
+
+					// \ʂXV
+					this->reservedByteCount += handleInfo.arenaByteCount;
+					if(this->peakReservedByteCount < this->reservedByteCount)
+						this->peakReservedByteCount = this->reservedByteCount;
+
+					return this->arena.GetBuffer() + handleInfo.arenaOffset;
+				}
+
+				// 󂫃obt@擾. 󂫂Ȃꍇ͒ǉ
+				if(codeInfo.lpFreeSlabNo.empty())
+				{
+					handleInfo.reserveSlabNo = (S32)codeInfo.lpSlab.size();
+					codeInfo.lpSlab.push_back(SlabInfo());
+				}
+				else
+				{
+					handleInfo.reserveSlabNo = (S32)codeInfo.lpFreeSlabNo.back();
+					codeInfo.lpFreeSlabNo.pop_back();
+				}
+
+				SlabInfo& slab = codeInfo.lpSlab[handleInfo.reserveSlabNo];
+				slab.onReserved = true;
+
+				// obt@̃TCYmFāAKvȂg. Eɑ邽߂̗]܂߂Ċmۂ
+				if(slab.byteCount < byteCount)
+				{
+					slab.lpBuffer.resize(byteCount + TEMPORARY_BUFFER_ALIGNMENT - 1);
+					size_t address = (size_t)thrust::raw_pointer_cast(&slab.lpBuffer[0]);
+					slab.alignOffset = (U32)((TEMPORARY_BUFFER_ALIGNMENT - address % TEMPORARY_BUFFER_ALIGNMENT) % TEMPORARY_BUFFER_ALIGNMENT);
+					slab.byteCount = byteCount;
+				}
+
+				// \ʂXV
+				this->reservedByteCount += slab.byteCount;
+				if(this->peakReservedByteCount < this->reservedByteCount)
+					this->peakReservedByteCount = this->reservedByteCount;
 			}
 
-			it->onReserved = true;
-			it->guid = i_layerGUID;
+			SlabInfo& slab = codeInfo.lpSlab[handleInfo.reserveSlabNo];
 
-			return thrust::raw_pointer_cast(&it->lpBuffer[0]);
+			return thrust::raw_pointer_cast(&slab.lpBuffer[0]) + slab.alignOffset;
 		}
-		/** \ς݃obt@J */
-		void RestoreBuffer(GUID i_layerGUID, const wchar_t i_szCode[])
+		/** \ς݃obt@J. */
+		void RestoreBuffer(TemporaryBufferHandle i_handle)
 		{
-			// R[h̗\ς݃obt@
-			auto& bufferList = this->lpReserveBuffer[i_szCode];
-			auto it = bufferList.begin();
-			while(it != bufferList.end())
+			if(i_handle >= this->lpHandleInfo.size())
+				return;
+			HandleInfo& handleInfo = this->lpHandleInfo[i_handle];
+			if(handleInfo.onArenaReserved)
+			{
+				auto it = std::find(this->lpArenaReservedHandle.begin(), this->lpArenaReservedHandle.end(), i_handle);
+				*it = this->lpArenaReservedHandle.back();
+				this->lpArenaReservedHandle.pop_back();
+
+				handleInfo.onArenaReserved = false;
+				this->reservedByteCount -= handleInfo.arenaByteCount;
+			}
+			else if(handleInfo.reserveSlabNo >= 0)
+			{
+				CodeInfo& codeInfo = this->lpCodeInfo[handleInfo.codeNo];
+
+				SlabInfo& slab = codeInfo.lpSlab[handleInfo.reserveSlabNo];
+				slab.onReserved = false;
+				this->reservedByteCount -= slab.byteCount;
+
+				codeInfo.lpFreeSlabNo.push_back((U32)handleInfo.reserveSlabNo);
+				handleInfo.reserveSlabNo = -1;
+			}
+			else
+			{
+				return;
+			}
+
+			// L^
+			if(this->onLifetimeRecord)
 			{
-				if(it->guid == i_layerGUID)
+				if(handleInfo.onRecordExclude)
 				{
-					it->onReserved = false;
-					return;
+					// L^JnO\񂵂Ăꍇ́AL^Jn̎gpԂƂ
+					handleInfo.lpLifetime.push_back(std::make_pair((U32)0, this->lifetimeClock++));
+					handleInfo.onRecordExclude = false;
 				}
+				else if(!handleInfo.lpLifetime.empty() && handleInfo.lpLifetime.back().second == LIFETIME_OPEN)
+				{
+					handleInfo.lpLifetime.back().second = this->lifetimeClock++;
+					this->openLifetimeCount--;
 
-				it++;
+					// L^̏IvĂꍇ́ASĊJꂽ_ŋL̈mۂ
+					if(this->onLifetimeRecordEnd && this->openLifetimeCount == 0)
+						this->BuildArena();
+				}
 			}
 		}
+
+		/** ɗ\񂳂ꂽobt@̍vTCY̍ől擾. */
+		U64 GetPeakReservedByteCount()const
+		{
+			return this->peakReservedByteCount;
+		}
+		/** ɗ\񂳂ꂽobt@̍vTCY̍őlA݂̗\ʂŏ */
+		void ResetPeakReservedByteCount()
+		{
+			this->peakReservedByteCount = this->reservedByteCount;
+		}
+
+
+		//====================================
+		// ɊÂL̈
+		//====================================
+		/** obt@̎̋L^Jn.
+			zǔɓo^eύXĂȂꍇ͉Ȃ. */
+		void BeginLifetimeRecord()
+		{
+			if(!this->onArenaPlanRequired)
+				return;
+
+			this->onLifetimeRecord = true;
+			this->onLifetimeRecordEnd = false;
+			this->lifetimeClock = 0;
+			this->openLifetimeCount = 0;
+
+			// L^Jnɗ\񒆂̃obt@́AJ܂Ō݂̊mېg
+			for(auto& handleInfo : this->lpHandleInfo)
+			{
+				handleInfo.lpLifetime.clear();
+				handleInfo.onRecordExclude = handleInfo.onArenaReserved || handleInfo.reserveSlabNo >= 0;
+			}
+		}
+		/** obt@̎̋L^IAL̈mۂ.
+			L^ɗ\񂳂ꂽobt@JĂȂꍇ́ASĊJꂽ_Ŋmۂ. */
+		void EndLifetimeRecord()
+		{
+			if(!this->onLifetimeRecord)
+				return;
+
+			this->onLifetimeRecordEnd = true;
+			if(this->openLifetimeCount == 0)
+				this->BuildArena();
+		}
+
+		/** L̈̃TCY擾. */
+		U64 GetArenaByteCount()const
+		{
+			return this->arenaByteCount;
+		}
 	};
 
 
 	TemporaryMemoryManager_API ITemporaryMemoryManager* CreateTemporaryMemoryManagerGPU()
 	{
-		return new TemporaryMemoryManager<thrust::device_vector<BYTE>>();
+		return new TemporaryMemoryManager<thrust::device_vector<BYTE>, ArenaBuffer_device>();
 	}
 	TemporaryMemoryManager_API ITemporaryMemoryManager* CreateTemporaryMemoryManagerCPU()
 	{
-		return new TemporaryMemoryManager<thrust::host_vector<BYTE>>();
+		return new TemporaryMemoryManager<thrust::host_vector<BYTE>, ArenaBuffer_host>();
 	}
 
 }	// Common
@@ -8,7 +8,13 @@
 
 
 #include"Optimizer_SGD_base.h"
+#include"Optimizer_Momentum_base.h"
+#include"Optimizer_AdaDelta_base.h"
 #include"Optimizer_Adam_base.h"
+#include"Optimizer_LARS_base.h"
+#include"Optimizer_LAMB_base.h"
+#include"Optimizer_Frozen.h"
+#include"Optimizer_GradientReducer.h"
 
 
 namespace Gravisbell {
@@ -25,10 +31,30 @@ namespace NeuralNetwork {
 		{
 			ChangeOptimizer_SGD_CPU(io_ppOptimizer, i_parameterCount);
 		}
+		else if(i_optimizerID == Optimizer_Momentum_base::OPTIMIZER_ID)
+		{
+			ChangeOptimizer_Momentum_CPU(io_ppOptimizer, i_parameterCount);
+		}
+		else if(i_optimizerID == Optimizer_AdaDelta_base::OPTIMIZER_ID)
+		{
+			ChangeOptimizer_AdaDelta_CPU(io_ppOptimizer, i_parameterCount);
+		}
 		else if(i_optimizerID == Optimizer_Adam_base::OPTIMIZER_ID)
 		{
 			ChangeOptimizer_Adam_CPU(io_ppOptimizer, i_parameterCount);
 		}
+		else if(i_optimizerID == Optimizer_LARS_base::OPTIMIZER_ID)
+		{
+			ChangeOptimizer_LARS_CPU(io_ppOptimizer, i_parameterCount);
+		}
+		else if(i_optimizerID == Optimizer_LAMB_base::OPTIMIZER_ID)
+		{
+			ChangeOptimizer_LAMB_CPU(io_ppOptimizer, i_parameterCount);
+		}
+		else if(i_optimizerID == Optimizer_Frozen::OPTIMIZER_ID)
+		{
+			ChangeOptimizer_Frozen(io_ppOptimizer, i_parameterCount);
+		}
 		else
 		{
 			return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
@@ -45,10 +71,22 @@ namespace NeuralNetwork {
 		{
 			ChangeOptimizer_SGD_GPU(io_ppOptimizer, i_parameterCount);
 		}
+		else if(i_optimizerID == Optimizer_Momentum_base::OPTIMIZER_ID)
+		{
+			ChangeOptimizer_Momentum_GPU(io_ppOptimizer, i_parameterCount);
+		}
+		else if(i_optimizerID == Optimizer_AdaDelta_base::OPTIMIZER_ID)
+		{
+			ChangeOptimizer_AdaDelta_GPU(io_ppOptimizer, i_parameterCount);
+		}
 		else if(i_optimizerID == Optimizer_Adam_base::OPTIMIZER_ID)
 		{
 			ChangeOptimizer_Adam_GPU(io_ppOptimizer, i_parameterCount);
 		}
+		else if(i_optimizerID == Optimizer_Frozen::OPTIMIZER_ID)
+		{
+			ChangeOptimizer_Frozen(io_ppOptimizer, i_parameterCount);
+		}
 		else
 		{
 			return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
@@ -106,11 +144,36 @@ namespace NeuralNetwork {
 			S64 useBufferCount = 0;
 			return CreateOptimizerFromBuffer_SGD_CPU(&i_lpBuffer[readBufferPos], remainingBufferCount, useBufferCount);
 		}
+		else if(optimizerID == Optimizer_Momentum_base::OPTIMIZER_ID)
+		{
+			S64 useBufferCount = 0;
+			return CreateOptimizerFromBuffer_Momentum_CPU(&i_lpBuffer[readBufferPos], remainingBufferCount, useBufferCount);
+		}
+		else if(optimizerID == Optimizer_AdaDelta_base::OPTIMIZER_ID)
+		{
+			S64 useBufferCount = 0;
+			return CreateOptimizerFromBuffer_AdaDelta_CPU(&i_lpBuffer[readBufferPos], remainingBufferCount, useBufferCount);
+		}
 		else if(optimizerID == Optimizer_Adam_base::OPTIMIZER_ID)
 		{
 			S64 useBufferCount = 0;
 			return CreateOptimizerFromBuffer_Adam_CPU(&i_lpBuffer[readBufferPos], remainingBufferCount, useBufferCount);
 		}
+		else if(optimizerID == Optimizer_LARS_base::OPTIMIZER_ID)
+		{
+			S64 useBufferCount = 0;
+			return CreateOptimizerFromBuffer_LARS_CPU(&i_lpBuffer[readBufferPos], remainingBufferCount, useBufferCount);
+		}
+		else if(optimizerID == Optimizer_LAMB_base::OPTIMIZER_ID)
+		{
+			S64 useBufferCount = 0;
+			return CreateOptimizerFromBuffer_LAMB_CPU(&i_lpBuffer[readBufferPos], remainingBufferCount, useBufferCount);
+		}
+		else if(optimizerID == Optimizer_Frozen::OPTIMIZER_ID)
+		{
+			S64 useBufferCount = 0;
+			return CreateOptimizerFromBuffer_Frozen(&i_lpBuffer[readBufferPos], remainingBufferCount, useBufferCount);
+		}
 
 		return NULL;
 	}
@@ -133,15 +196,70 @@ namespace NeuralNetwork {
 			S64 useBufferCount = 0;
 			return CreateOptimizerFromBuffer_SGD_GPU(&i_lpBuffer[readBufferPos], remainingBufferCount, useBufferCount);
 		}
+		else if(optimizerID == Optimizer_Momentum_base::OPTIMIZER_ID)
+		{
+			S64 useBufferCount = 0;
+			return CreateOptimizerFromBuffer_Momentum_GPU(&i_lpBuffer[readBufferPos], remainingBufferCount, useBufferCount);
+		}
+		else if(optimizerID == Optimizer_AdaDelta_base::OPTIMIZER_ID)
+		{
+			S64 useBufferCount = 0;
+			return CreateOptimizerFromBuffer_AdaDelta_GPU(&i_lpBuffer[readBufferPos], remainingBufferCount, useBufferCount);
+		}
 		else if(optimizerID == Optimizer_Adam_base::OPTIMIZER_ID)
 		{
 			S64 useBufferCount = 0;
 			return CreateOptimizerFromBuffer_Adam_GPU(&i_lpBuffer[readBufferPos], remainingBufferCount, useBufferCount);
 		}
+		else if(optimizerID == Optimizer_Frozen::OPTIMIZER_ID)
+		{
+			S64 useBufferCount = 0;
+			return CreateOptimizerFromBuffer_Frozen(&i_lpBuffer[readBufferPos], remainingBufferCount, useBufferCount);
+		}
 
 		return NULL;
 	}
 
+
+	/** ωʏW񃋁[`(CPU) */
+	static IGradientReducer* g_pGradientReducer_CPU = NULL;
+
+	/** ωʏW񃋁[`ݒ肷 */
+	Optimizer_API void SetGradientReducer_CPU(IGradientReducer* i_pGradientReducer)
+	{
+		g_pGradientReducer_CPU = i_pGradientReducer;
+	}
+	/** ωʏW񃋁[`擾 */
+	Optimizer_API IGradientReducer* GetGradientReducer_CPU(void)
+	{
+		return g_pGradientReducer_CPU;
+	}
+
+	/** ωʂW񂷂.(CPU)
+		W񃋁[`ݒ肳ĂȂꍇ͓͂̂܂ܕԂ.
+		@param	i_lpDParameter		W񂷂ω.
+		@param	i_parameterCount	ωʂ̗vf.
+		@param	io_lpReduceBuffer	Wp̍ƃobt@.
+		@param	o_lpDParameter		W̕ωʂ̊i[. */
+	ErrorCode ReduceGradient_CPU(const F32 i_lpDParameter[], U64 i_parameterCount, std::vector<F32>& io_lpReduceBuffer, const F32*& o_lpDParameter)
+	{
+		o_lpDParameter = i_lpDParameter;
+		if(g_pGradientReducer_CPU == NULL)
+			return ErrorCode::ERROR_CODE_NONE;
+
+		// Ăяo̕ωʂ͏Ȃߍƃobt@ɃRs[ĂW񂷂
+		io_lpReduceBuffer.resize(i_parameterCount);
+		memcpy(&io_lpReduceBuffer[0], i_lpDParameter, sizeof(F32)*i_parameterCount);
+
+		ErrorCode err = g_pGradientReducer_CPU->ReduceGradient(&io_lpReduceBuffer[0], i_parameterCount);
+		if(err != ErrorCode::ERROR_CODE_NONE)
+			return err;
+
+		o_lpDParameter = &io_lpReduceBuffer[0];
+
+		return ErrorCode::ERROR_CODE_NONE;
+	}
+
 }	// NeuralNetwork
 }	// Layer
 }	// Gravisbell
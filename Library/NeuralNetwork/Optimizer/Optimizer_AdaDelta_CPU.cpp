@@ -4,35 +4,41 @@
 #include"stdafx.h"
 
 #include<vector>
+#include<algorithm>
 
-#include"Layer/NeuralNetwork/IOptimizer.h"
+#include"Optimizer_AdaDelta_base.h"
+#include"Optimizer_GradientReducer.h"
+#include"Optimizer_Kernel_CPU.h"
+#include"Optimizer_SparseRow.h"
+#include"Library/NeuralNetwork/Optimizer.h"
 
 namespace Gravisbell {
 namespace Layer {
 namespace NeuralNetwork {
 
-	class Optimizer_AdaDelta_CPU : public iOptimizer_AdaDelta
+	class Optimizer_AdaDelta_CPU : public Optimizer_AdaDelta_base
 	{
-	private:
-		U32 m_parameterCount;	/**< p[^ */
-
-		F32 m_rho;				/**< . */
-		F32 m_epsilon;			/**< ⏕W. */
-
+	public:
 		std::vector<F32> lpParameterH;
 		std::vector<F32> lpParameterS;
-		std::vector<F32> lpParameterV;
+		std::vector<U16> lpReducedParameterH;	/**< kxŊi[ꍇH */
+		std::vector<U16> lpReducedParameterS;	/**< kxŊi[ꍇS */
+
+		U32 m_stateSeed;	/**< mIۂ߂̗̎. XVƂɐi߂ */
+
+	private:
+		std::vector<F32> lpReduceBuffer;	/**< ωʏWp̍ƃobt@ */
+
+		OptimizerSparseRow m_sparseRow;	/**< aȍXVŒxĂs̊Ǘ */
 
 	public:
 		/** RXgN^ */
-		Optimizer_AdaDelta_CPU(U32 i_parameterCount)
-			:	m_parameterCount	(i_parameterCount)
-			,	m_rho				(0.0f)
-			,	m_epsilon			(0.0f)
+		Optimizer_AdaDelta_CPU(U64 i_parameterCount)
+			:	Optimizer_AdaDelta_base	(i_parameterCount)
+			,	m_stateSeed				(0)
 		{
-			this->lpParameterH.resize(m_parameterCount, 0.0f);
-			this->lpParameterS.resize(m_parameterCount, 0.0f);
-			this->lpParameterV.resize(m_parameterCount, 0.0f);
+			this->lpParameterH.resize(this->m_parameterCount, 0.0f);
+			this->lpParameterS.resize(this->m_parameterCount, 0.0f);
 		}
 		/** fXgN^ */
 		virtual ~Optimizer_AdaDelta_CPU()
@@ -41,76 +47,262 @@ namespace NeuralNetwork {
 
 	public:
 		//===========================
-		// {
+		// 
 		//===========================
-		/** IveB}CU̎ʂ擾 */
-		OptimizerType GetTypeCode()const
+		/** p[^XV.
+			@param io_lpParamter	XVp[^.
+			@param io_lpDParameter	p[^̕ω. */
+		ErrorCode UpdateParameter(F32 io_lpParameter[], const F32 i_lpDParameter[])
 		{
-			return OptimizerType::OPTIMIZER_TYPE_ADADELTA;
+			// vfꍇ͔͈͂𕪊ĕXbhōXV
+			OptimizerUpdateTarget target = {this, io_lpParameter, i_lpDParameter};
+			return UpdateParameterMulti_CPU(&target, 1);
 		}
-		
-		/** nCp[p[^XV
-			@param	i_rho			.
-			@param	i_epsilon		⏕W. */
-		virtual ErrorCode SetHyperParameter(F32 i_rho, F32 i_epsilon)
+
+		/** p[^̕XVJn.
+			@param	i_lpDParameter	p[^̕ω.
+			@param	o_lpDParameter	UpdateParameterRangeɓnωʂ̊i[. */
+		ErrorCode BeginUpdateParameter(const F32 i_lpDParameter[], const F32*& o_lpDParameter)
 		{
-			this->m_rho    = i_rho;
-			this->m_epsilon = i_epsilon;
+			// ωʂW
+			ErrorCode err = ReduceGradient_CPU(i_lpDParameter, this->m_parameterCount, this->lpReduceBuffer, o_lpDParameter);
+			if(err != ErrorCode::ERROR_CODE_NONE)
+				return err;
+
+			this->m_stateSeed++;
+
+			// aȍXVŒxĂs͊e͈͂̍XVɒǂ
+			this->m_sparseRow.BeginDense();
 
 			return ErrorCode::ERROR_CODE_NONE;
 		}
+		/** p[^̈ꕔXV.
+			@param	io_lpParamter	XVp[^̐擪.
+			@param	i_lpDParameter	BeginUpdateParameterŎ擾ωʂ̐擪.
+			@param	i_offset		XV͈͂̊Jnʒu.
+			@param	i_count			XV͈̗͂vf. */
+		ErrorCode UpdateParameterRange(F32 io_lpParameter[], const F32 i_lpDParameter[], U64 i_offset, U64 i_count)
+		{
+			if(this->m_stateType == OPTIMIZER_STATE_TYPE_F32)
+			{
+				if(this->m_sparseRow.IsFlushing())
+				{
+					this->m_sparseRow.DecayLaggingState(&this->lpParameterH[i_offset], i_offset, i_count, this->m_rho);
+					this->m_sparseRow.DecayLaggingState(&this->lpParameterS[i_offset], i_offset, i_count, this->m_rho);
+				}
 
-
-		//===========================
-		// 
-		//===========================
-		/** p[^XV.
-			@param io_lpParamter	XVp[^.
-			@param io_lpDParameter	p[^̕ω. */
-		ErrorCode UpdateParameter(F32 io_lpParameter[], const F32 i_lpDParameter[])
+				this->UpdateParameterBlock(&io_lpParameter[i_offset], &i_lpDParameter[i_offset], &this->lpParameterH[i_offset], &this->lpParameterS[i_offset], i_count);
+
+				return ErrorCode::ERROR_CODE_NONE;
+			}
+
+			// kx̏ꍇ͋ԂƂɒPxɓWJčXVAmIۂ߂Ŋi[
+			F32 lpBlockH[OPTIMIZER_STATE_BLOCK_SIZE];
+			F32 lpBlockS[OPTIMIZER_STATE_BLOCK_SIZE];
+			for(U64 blockOffset=i_offset; blockOffset<i_offset+i_count; blockOffset+=OPTIMIZER_STATE_BLOCK_SIZE)
+			{
+				U64 blockCount = std::min<U64>(OPTIMIZER_STATE_BLOCK_SIZE, i_offset + i_count - blockOffset);
+
+				DecodeOptimizerState_CPU(&this->lpReducedParameterH[blockOffset], lpBlockH, blockCount, this->m_stateType);
+				DecodeOptimizerState_CPU(&this->lpReducedParameterS[blockOffset], lpBlockS, blockCount, this->m_stateType);
+
+				this->UpdateParameterBlock(&io_lpParameter[blockOffset], &i_lpDParameter[blockOffset], lpBlockH, lpBlockS, blockCount);
+
+				EncodeOptimizerState_CPU(lpBlockH, &this->lpReducedParameterH[blockOffset], blockCount, this->m_stateType, blockOffset, this->m_stateSeed * 2 + 0);
+				EncodeOptimizerState_CPU(lpBlockS, &this->lpReducedParameterS[blockOffset], blockCount, this->m_stateType, blockOffset, this->m_stateSeed * 2 + 1);
+			}
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+
+		/** ωʂŝ݂w肵ăp[^XV.
+			ω0̍XVł̓p[^͈ړH,Ŝ݂̂߁A
+			XVȂs͎ɍXVۂɏȗ񐔕̌܂Ƃ߂Ĕf.
+			@param	io_lpParamter	XVp[^.
+			@param	i_lpDParameter	p[^̕ω. p[^̗vf.
+			@param	i_rowCount		1ubN̍s.
+			@param	i_rowSize		1s̗vf.
+			@param	i_lpRowNum		ωʂsԍ̔z. dȂ.
+			@param	i_rowNumCount	sԍ̐. */
+		ErrorCode UpdateParameterSparse(F32 io_lpParameter[], const F32 i_lpDParameter[], U32 i_rowCount, U32 i_rowSize, const U32 i_lpRowNum[], U32 i_rowNumCount)
 		{
-			for(U32 paramNum=0; paramNum<this->m_parameterCount; paramNum++)
+			// W񃋁[`͑SvfΏۂƂAkx̓Ԃ͋ԒPʂŊۂ߂邽߁ȀꍇŜXV
+			if(GetGradientReducer_CPU() != NULL || this->m_stateType != OPTIMIZER_STATE_TYPE_F32)
+				return this->UpdateParameter(io_lpParameter, i_lpDParameter);
+			if(!this->m_sparseRow.BeginSparse(this->m_parameterCount, i_rowCount, i_rowSize))
+				return this->UpdateParameter(io_lpParameter, i_lpDParameter);
+
+			this->m_stateSeed++;
+
+			U64 blockCount = this->m_parameterCount / ((U64)i_rowCount * i_rowSize);
+			for(U32 rowIndex=0; rowIndex<i_rowNumCount; rowIndex++)
+			{
+				U32 rowNum = i_lpRowNum[rowIndex];
+				U32 skippedStepCount = 0;
+				if(!this->m_sparseRow.TouchRow(rowNum, skippedStepCount))
+					continue;
+
+				F32 decay = powf(this->m_rho, (F32)skippedStepCount);
+
+				for(U64 blockNum=0; blockNum<blockCount; blockNum++)
+				{
+					U64 offset = (blockNum * i_rowCount + rowNum) * i_rowSize;
+
+					if(skippedStepCount > 0)
+					{
+						for(U64 paramNum=offset; paramNum<offset+i_rowSize; paramNum++)
+						{
+							this->lpParameterH[paramNum] *= decay;
+							this->lpParameterS[paramNum] *= decay;
+						}
+					}
+
+					this->UpdateParameterBlock(&io_lpParameter[offset], &i_lpDParameter[offset], &this->lpParameterH[offset], &this->lpParameterS[offset], i_rowSize);
+				}
+			}
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+		/** aȍXVŒxĂsSčŐV̏Ԃɂ.
+			ω0̍XVł̓p[^͈ړȂ߁AH,Š݂̂𔽉f. */
+		ErrorCode ApplyLaggingUpdate(F32 io_lpParameter[])
+		{
+			if(this->m_sparseRow.IsLagging())
+			{
+				this->m_sparseRow.DecayLaggingState(&this->lpParameterH[0], 0, this->m_parameterCount, this->m_rho);
+				this->m_sparseRow.DecayLaggingState(&this->lpParameterS[0], 0, this->m_parameterCount, this->m_rho);
+			}
+			this->m_sparseRow.Reset();
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+
+		/** Ԃ̊i[xύX.
+			ێĂԂ͐Vxɕϊ. */
+		ErrorCode ChangeStateType(OptimizerStateType i_stateType)
+		{
+			if(i_stateType >= OPTIMIZER_STATE_TYPE_COUNT)
+				return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+
+			// aȍXVŒxĂš𔽉fĂϊ
+			if(this->m_sparseRow.IsLagging())
+			{
+				this->m_sparseRow.DecayLaggingState(&this->lpParameterH[0], 0, this->m_parameterCount, this->m_rho);
+				this->m_sparseRow.DecayLaggingState(&this->lpParameterS[0], 0, this->m_parameterCount, this->m_rho);
+			}
+			this->m_sparseRow.Reset();
+
+			ChangeOptimizerStateType_CPU(this->lpParameterH, this->lpReducedParameterH, this->m_parameterCount, this->m_stateType, i_stateType, this->m_stateSeed * 2 + 0);
+			ChangeOptimizerStateType_CPU(this->lpParameterS, this->lpReducedParameterS, this->m_parameterCount, this->m_stateType, i_stateType, this->m_stateSeed * 2 + 1);
+			this->m_stateType = i_stateType;
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+
+	private:
+		/** Px̓Ԃgpăp[^XV.
+			V͍XV̈ꎞl̂ߊi[Ȃ.
+			@param	io_lpParamter	XVp[^̐擪.
+			@param	i_lpDParameter	ωʂ̐擪.
+			@param	io_lpParameterH	H̐擪.
+			@param	io_lpParameterS	S̐擪.
+			@param	i_count			XVvf. */
+		void UpdateParameterBlock(F32 io_lpParameter[], const F32 i_lpDParameter[], F32 io_lpParameterH[], F32 io_lpParameterS[], U64 i_count)
+		{
+			if(!GetReferenceMode_CPU())
+			{
+				UpdateParameterKernel_AdaDelta_CPU(
+					io_lpParameter, i_lpDParameter, io_lpParameterH, io_lpParameterS, i_count,
+					this->m_rho, this->m_epsilon);
+
+				return;
+			}
+
+			for(U64 paramNum=0; paramNum<i_count; paramNum++)
 			{
 				// HXV
-				this->lpParameterH[paramNum] = this->m_rho * this->lpParameterH[paramNum] + (1.0f - this->m_rho) * (i_lpDParameter[paramNum] * i_lpDParameter[paramNum]);
+				io_lpParameterH[paramNum] = this->m_rho * io_lpParameterH[paramNum] + (1.0f - this->m_rho) * (i_lpDParameter[paramNum] * i_lpDParameter[paramNum]);
 
-				// VXV
-				this->lpParameterV[paramNum] = (sqrt(this->lpParameterS[paramNum] + this->m_epsilon)) *i_lpDParameter[paramNum] / (sqrt(this->lpParameterH[paramNum] + this->m_epsilon));
+				// VZo
+				F32 parameterV = (sqrt(io_lpParameterS[paramNum] + this->m_epsilon)) * i_lpDParameter[paramNum] / (sqrt(io_lpParameterH[paramNum] + this->m_epsilon));
 
 				// SXV
-				this->lpParameterS[paramNum] = this->m_rho * this->lpParameterS[paramNum] + (1.0f - this->m_rho) * (this->lpParameterV[paramNum] * this->lpParameterV[paramNum]);
+				io_lpParameterS[paramNum] = this->m_rho * io_lpParameterS[paramNum] + (1.0f - this->m_rho) * (parameterV * parameterV);
 
 				// dݍXV
-				io_lpParameter[paramNum] = io_lpParameter[paramNum] + this->lpParameterV[paramNum];
+				io_lpParameter[paramNum] = io_lpParameter[paramNum] + parameterV;
 			}
+		}
 
+	public:
+		//===========================
+		// ۑ
+		//===========================
+		/** C[obt@ɏ.
+			@param o_lpBuffer	ݐobt@̐擪AhX. GetUseBufferByteCount̖߂l̃oCgKv
+			@return ꍇ񂾃obt@TCY.sꍇ͕̒l */
+		S64 WriteToBuffer(BYTE* o_lpBuffer)const
+		{
+			U64 writePos = WriteToBufferBase(o_lpBuffer);
 
-			return ErrorCode::ERROR_CODE_NONE;
+			// H
+			U64 writePosH = writePos;
+			writePos += WriteOptimizerStateToBuffer_CPU(&o_lpBuffer[writePos], this->lpParameterH, this->lpReducedParameterH, this->m_parameterCount, this->m_stateType);
+			// S
+			U64 writePosS = writePos;
+			writePos += WriteOptimizerStateToBuffer_CPU(&o_lpBuffer[writePos], this->lpParameterS, this->lpReducedParameterS, this->m_parameterCount, this->m_stateType);
+
+			// aȍXVŒxĂs͌𔽉flۑ. aȍXV͒PxŊi[Ă
+			if(this->m_sparseRow.IsLagging())
+			{
+				this->m_sparseRow.DecayLaggingState((F32*)&o_lpBuffer[writePosH], 0, this->m_parameterCount, this->m_rho);
+				this->m_sparseRow.DecayLaggingState((F32*)&o_lpBuffer[writePosS], 0, this->m_parameterCount, this->m_rho);
+			}
+
+			return writePos;
 		}
 	};
 
 	/** IveB}CU쐬 */
-	iOptimizer_AdaDelta* CreateOptimizer_AdaDelta_CPU(U32 i_parameterCount)
+	Optimizer_AdaDelta_base* CreateOptimizer_AdaDelta_CPU(U64 i_parameterCount)
 	{
 		return new Optimizer_AdaDelta_CPU(i_parameterCount);
 	}
+	/** IveB}CUobt@쐬 */
+	IOptimizer* CreateOptimizerFromBuffer_AdaDelta_CPU(const BYTE* i_lpBuffer, Gravisbell::S64 i_bufferSize, Gravisbell::S64& o_useBufferSize)
+	{
+		Optimizer_AdaDelta_base* pOptimizer = CreateOptimizerFromBuffer_AdaDelta(i_lpBuffer, i_bufferSize, o_useBufferSize, CreateOptimizer_AdaDelta_CPU);
+		if(pOptimizer == NULL)
+			return NULL;
+		Optimizer_AdaDelta_CPU* pOptimizerCPU = dynamic_cast<Optimizer_AdaDelta_CPU*>(pOptimizer);
+		if(pOptimizerCPU == NULL)
+		{
+			delete pOptimizer;
+			return NULL;
+		}
+
+		// H
+		o_useBufferSize += ReadOptimizerStateFromBuffer_CPU(&i_lpBuffer[o_useBufferSize], pOptimizerCPU->lpParameterH, pOptimizerCPU->lpReducedParameterH, pOptimizerCPU->GetParameterCount(), pOptimizerCPU->GetStateType());
+		// S
+		o_useBufferSize += ReadOptimizerStateFromBuffer_CPU(&i_lpBuffer[o_useBufferSize], pOptimizerCPU->lpParameterS, pOptimizerCPU->lpReducedParameterS, pOptimizerCPU->GetParameterCount(), pOptimizerCPU->GetStateType());
+
+		return pOptimizer;
+	}
 	/** IveB}CU[XV.قȂ^ꍇ͋IɎw̌^ɕϊ. */
-	ErrorCode UpdateOptimizer_AdaDelta_CPU(IOptimizer** io_ppOptimizer, U32 i_parameterCount, F32 i_rho, F32 i_epsilon)
+	ErrorCode ChangeOptimizer_AdaDelta_CPU(IOptimizer** io_ppOptimizer, U64 i_parameterCount)
 	{
-		iOptimizer_AdaDelta* pOptimizer = dynamic_cast<iOptimizer_AdaDelta*>(*io_ppOptimizer);
+		Optimizer_AdaDelta_CPU* pOptimizer = dynamic_cast<Optimizer_AdaDelta_CPU*>(*io_ppOptimizer);
 		if(pOptimizer == NULL)
 		{
 			if(*io_ppOptimizer)
 				delete *io_ppOptimizer;
 
-			*io_ppOptimizer = pOptimizer = CreateOptimizer_AdaDelta_CPU(i_parameterCount);
+			*io_ppOptimizer = CreateOptimizer_AdaDelta_CPU(i_parameterCount);
 		}
 
-		pOptimizer->SetHyperParameter(i_rho, i_epsilon);
-
 		return ErrorCode::ERROR_CODE_NONE;
 	}
 
 }	// NeuralNetwork
 }	// Layer
-}	// Gravisbell
\ No newline at end of file
+}	// Gravisbell
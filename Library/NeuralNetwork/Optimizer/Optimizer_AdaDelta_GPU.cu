@@ -5,7 +5,7 @@
 
 #include<vector>
 
-#include"Layer/NeuralNetwork/IOptimizer.h"
+#include"Optimizer_AdaDelta_base.h"
 
 // CUDAp
 #pragma warning(push)
@@ -17,18 +17,17 @@
 #include "device_launch_parameters.h"
 #pragma warning(pop)
 
-
 #define BLOCK_SIZE	(32)
 
-
 namespace Gravisbell {
 namespace Layer {
 namespace NeuralNetwork {
 
 	namespace
 	{
-		/** xNg̗vfm̊|Z. */
-		__global__ void cuda_func_updateParameter(F32* io_lpParameter, const F32* i_lpDParameter, const U32 i_bufferSize, F32* io_lpParameterH, F32* io_lpParameterS, F32* io_lpParameterV, F32 i_rho, F32 i_epsilon)
+		/** xNg̗vfm̊|Z.
+			V͍XV̈ꎞl̂ߊi[Ȃ. */
+		__global__ void cuda_func_updateParameter(F32* io_lpParameter, const F32* i_lpDParameter, const U64 i_bufferSize, F32* io_lpParameterH, F32* io_lpParameterS, F32 i_rho, F32 i_epsilon)
 		{
 			const U32 paramNum = blockIdx.x * BLOCK_SIZE + threadIdx.x;
 			if(paramNum >= i_bufferSize)	// 򂷂邪warpȂ̂ŁAxɉe͂Ȃ͂...
@@ -37,40 +36,61 @@ namespace NeuralNetwork {
 			// HXV
 			io_lpParameterH[paramNum] = i_rho * io_lpParameterH[paramNum] + (1.0f - i_rho) * (i_lpDParameter[paramNum] * i_lpDParameter[paramNum]);
 
-			// VXV
-			io_lpParameterV[paramNum] = (sqrtf(io_lpParameterS[paramNum] + i_epsilon)) *i_lpDParameter[paramNum] / (sqrtf(io_lpParameterH[paramNum] + i_epsilon));
+			// VZo
+			F32 parameterV = (sqrtf(io_lpParameterS[paramNum] + i_epsilon)) *i_lpDParameter[paramNum] / (sqrtf(io_lpParameterH[paramNum] + i_epsilon));
 
 			// SXV
-			io_lpParameterS[paramNum] = i_rho * io_lpParameterS[paramNum] + (1.0f - i_rho) * (io_lpParameterV[paramNum] * io_lpParameterV[paramNum]);
+			io_lpParameterS[paramNum] = i_rho * io_lpParameterS[paramNum] + (1.0f - i_rho) * (parameterV * parameterV);
 
 			// dݍXV
-			io_lpParameter[paramNum] = io_lpParameter[paramNum] + io_lpParameterV[paramNum];
+			io_lpParameter[paramNum] = io_lpParameter[paramNum] + parameterV;
 		}
-	}
+		/** kx̓Ԃgpăp[^XV.
+			Ԃ͒PxɓWJČvZAmIۂ߂Ŋi[. */
+		__global__ void cuda_func_updateParameter_reduced(F32* io_lpParameter, const F32* i_lpDParameter, const U64 i_bufferSize, U16* io_lpParameterH, U16* io_lpParameterS, F32 i_rho, F32 i_epsilon, OptimizerStateType i_stateType, U64 i_offset, U32 i_seed)
+		{
+			const U32 paramNum = blockIdx.x * BLOCK_SIZE + threadIdx.x;
+			if(paramNum >= i_bufferSize)	// 򂷂邪warpȂ̂ŁAxɉe͂Ȃ͂...
+				return;
 
+			F32 parameterH = ConvertOptimizerStateToF32(io_lpParameterH[paramNum], i_stateType);
+			F32 parameterS = ConvertOptimizerStateToF32(io_lpParameterS[paramNum], i_stateType);
 
-	class Optimizer_AdaDelta_GPU : public iOptimizer_AdaDelta
-	{
-	private:
-		U32 m_parameterCount;	/**< p[^ */
-
-		F32 m_rho;				/**< . */
-		F32 m_epsilon;			/**< ⏕W. */
+			// HXV
+			parameterH = i_rho * parameterH + (1.0f - i_rho) * (i_lpDParameter[paramNum] * i_lpDParameter[paramNum]);
+
+			// VZo
+			F32 parameterV = (sqrtf(parameterS + i_epsilon)) *i_lpDParameter[paramNum] / (sqrtf(parameterH + i_epsilon));
 
+			// SXV
+			parameterS = i_rho * parameterS + (1.0f - i_rho) * (parameterV * parameterV);
+
+			// dݍXV
+			io_lpParameter[paramNum] = io_lpParameter[paramNum] + parameterV;
+
+			io_lpParameterH[paramNum] = ConvertF32ToOptimizerState(parameterH, i_stateType, GetOptimizerStateNoise(i_offset + paramNum, i_seed * 2 + 0));
+			io_lpParameterS[paramNum] = ConvertF32ToOptimizerState(parameterS, i_stateType, GetOptimizerStateNoise(i_offset + paramNum, i_seed * 2 + 1));
+		}
+	}
+
+	class Optimizer_AdaDelta_GPU : public Optimizer_AdaDelta_base
+	{
+	public:
 		thrust::device_vector<F32> lpParameterH;
 		thrust::device_vector<F32> lpParameterS;
-		thrust::device_vector<F32> lpParameterV;
+		thrust::device_vector<U16> lpReducedParameterH;	/**< kxŊi[ꍇH */
+		thrust::device_vector<U16> lpReducedParameterS;	/**< kxŊi[ꍇS */
+
+		U32 m_stateSeed;	/**< mIۂ߂̗̎. XVƂɐi߂ */
 
 	public:
 		/** RXgN^ */
-		Optimizer_AdaDelta_GPU(U32 i_parameterCount)
-			:	m_parameterCount	(i_parameterCount)
-			,	m_rho				(0.0f)
-			,	m_epsilon			(0.0f)
+		Optimizer_AdaDelta_GPU(U64 i_parameterCount)
+			:	Optimizer_AdaDelta_base	(i_parameterCount)
+			,	m_stateSeed				(0)
 		{
-			this->lpParameterH.resize(m_parameterCount, 0.0f);
-			this->lpParameterS.resize(m_parameterCount, 0.0f);
-			this->lpParameterV.resize(m_parameterCount, 0.0f);
+			this->lpParameterH.resize(this->m_parameterCount, 0.0f);
+			this->lpParameterS.resize(this->m_parameterCount, 0.0f);
 		}
 		/** fXgN^ */
 		virtual ~Optimizer_AdaDelta_GPU()
@@ -78,27 +98,6 @@ namespace NeuralNetwork {
 		}
 
 	public:
-		//===========================
-		// {
-		//===========================
-		/** IveB}CU̎ʂ擾 */
-		OptimizerType GetTypeCode()const
-		{
-			return OptimizerType::OPTIMIZER_TYPE_ADADELTA;
-		}
-		
-		/** nCp[p[^XV
-			@param	i_rho			.
-			@param	i_epsilon		⏕W. */
-		virtual ErrorCode SetHyperParameter(F32 i_rho, F32 i_epsilon)
-		{
-			this->m_rho    = i_rho;
-			this->m_epsilon = i_epsilon;
-
-			return ErrorCode::ERROR_CODE_NONE;
-		}
-
-
 		//===========================
 		// 
 		//===========================
@@ -107,46 +106,142 @@ namespace NeuralNetwork {
 			@param io_lpDParameter	p[^̕ω. */
 		ErrorCode UpdateParameter(F32 io_lpParameter[], const F32 i_lpDParameter[])
 		{
-			dim3 grid((this->m_parameterCount +(BLOCK_SIZE - 1))/BLOCK_SIZE , 1, 1);
+			return this->UpdateParameterRange(io_lpParameter, i_lpDParameter, 0, this->m_parameterCount);
+		}
+
+		/** p[^̕XVJn.
+			@param	i_lpDParameter	p[^̕ω.
+			@param	o_lpDParameter	UpdateParameterRangeɓnωʂ̊i[. */
+		ErrorCode BeginUpdateParameter(const F32 i_lpDParameter[], const F32*& o_lpDParameter)
+		{
+			this->m_stateSeed++;
+
+			o_lpDParameter = i_lpDParameter;
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+		/** p[^̈ꕔXV.
+			@param	io_lpParamter	XVp[^̐擪.
+			@param	i_lpDParameter	BeginUpdateParameterŎ擾ωʂ̐擪.
+			@param	i_offset		XV͈͂̊Jnʒu.
+			@param	i_count			XV͈̗͂vf. */
+		ErrorCode UpdateParameterRange(F32 io_lpParameter[], const F32 i_lpDParameter[], U64 i_offset, U64 i_count)
+		{
+			dim3 grid((U32)((i_count +(BLOCK_SIZE - 1))/BLOCK_SIZE), 1, 1);
 			dim3 block(BLOCK_SIZE, 1, 1);
 
-			cuda_func_updateParameter<<<grid, block>>>(
-				io_lpParameter,
-				i_lpDParameter,
-				this->m_parameterCount,
-				thrust::raw_pointer_cast(&this->lpParameterH[0]),
-				thrust::raw_pointer_cast(&this->lpParameterS[0]),
-				thrust::raw_pointer_cast(&this->lpParameterV[0]),
-				this->m_rho,
-				this->m_epsilon);
+			if(this->m_stateType == OPTIMIZER_STATE_TYPE_F32)
+			{
+				cuda_func_updateParameter<<<grid, block>>>(
+					&io_lpParameter[i_offset],
+					&i_lpDParameter[i_offset],
+					i_count,
+					thrust::raw_pointer_cast(&this->lpParameterH[i_offset]),
+					thrust::raw_pointer_cast(&this->lpParameterS[i_offset]),
+					this->m_rho, this->m_epsilon);
+			}
+			else
+			{
+				cuda_func_updateParameter_reduced<<<grid, block>>>(
+					&io_lpParameter[i_offset],
+					&i_lpDParameter[i_offset],
+					i_count,
+					thrust::raw_pointer_cast(&this->lpReducedParameterH[i_offset]),
+					thrust::raw_pointer_cast(&this->lpReducedParameterS[i_offset]),
+					this->m_rho, this->m_epsilon,
+					this->m_stateType, i_offset, this->m_stateSeed);
+			}
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+
+		/** ωʂŝ݂w肵ăp[^XV.
+			GPUł͑ŜXV. w肳ĂȂs̕ωʂ0̂ߌʂ͕ςȂ. */
+		ErrorCode UpdateParameterSparse(F32 io_lpParameter[], const F32 i_lpDParameter[], U32 i_rowCount, U32 i_rowSize, const U32 i_lpRowNum[], U32 i_rowNumCount)
+		{
+			return this->UpdateParameter(io_lpParameter, i_lpDParameter);
+		}
+		/** aȍXVŒxĂsSčŐV̏Ԃɂ.
+			GPUł͏ɑŜXV邽߁AxĂs݂͑Ȃ. */
+		ErrorCode ApplyLaggingUpdate(F32 io_lpParameter[])
+		{
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+
+		/** Ԃ̊i[xύX.
+			ێĂԂ͐Vxɕϊ. */
+		ErrorCode ChangeStateType(OptimizerStateType i_stateType)
+		{
+			if(i_stateType >= OPTIMIZER_STATE_TYPE_COUNT)
+				return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
 
+			ChangeOptimizerStateType_GPU(this->lpParameterH, this->lpReducedParameterH, this->m_parameterCount, this->m_stateType, i_stateType, this->m_stateSeed * 2 + 0);
+			ChangeOptimizerStateType_GPU(this->lpParameterS, this->lpReducedParameterS, this->m_parameterCount, this->m_stateType, i_stateType, this->m_stateSeed * 2 + 1);
+			this->m_stateType = i_stateType;
 
 			return ErrorCode::ERROR_CODE_NONE;
 		}
+
+	public:
+		//===========================
+		// ۑ
+		//===========================
+		/** C[obt@ɏ.
+			@param o_lpBuffer	ݐobt@̐擪AhX. GetUseBufferByteCount̖߂l̃oCgKv
+			@return ꍇ񂾃obt@TCY.sꍇ͕̒l */
+		S64 WriteToBuffer(BYTE* o_lpBuffer)const
+		{
+			S64 writePos = WriteToBufferBase(o_lpBuffer);
+
+			// H
+			writePos += WriteOptimizerStateToBuffer_GPU(&o_lpBuffer[writePos], this->lpParameterH, this->lpReducedParameterH, this->m_parameterCount, this->m_stateType);
+			// S
+			writePos += WriteOptimizerStateToBuffer_GPU(&o_lpBuffer[writePos], this->lpParameterS, this->lpReducedParameterS, this->m_parameterCount, this->m_stateType);
+
+			return writePos;
+		}
 	};
 
 	/** IveB}CU쐬 */
-	iOptimizer_AdaDelta* CreateOptimizer_AdaDelta_GPU(U32 i_parameterCount)
+	Optimizer_AdaDelta_base* CreateOptimizer_AdaDelta_GPU(U64 i_parameterCount)
 	{
 		return new Optimizer_AdaDelta_GPU(i_parameterCount);
 	}
+	/** IveB}CUobt@쐬 */
+	IOptimizer* CreateOptimizerFromBuffer_AdaDelta_GPU(const BYTE* i_lpBuffer, Gravisbell::S64 i_bufferSize, Gravisbell::S64& o_useBufferSize)
+	{
+		Optimizer_AdaDelta_base* pOptimizer = CreateOptimizerFromBuffer_AdaDelta(i_lpBuffer, i_bufferSize, o_useBufferSize, CreateOptimizer_AdaDelta_GPU);
+		if(pOptimizer == NULL)
+			return NULL;
+		Optimizer_AdaDelta_GPU* pOptimizerGPU = dynamic_cast<Optimizer_AdaDelta_GPU*>(pOptimizer);
+		if(pOptimizerGPU == NULL)
+		{
+			delete pOptimizer;
+			return NULL;
+		}
+
+		// H
+		o_useBufferSize += ReadOptimizerStateFromBuffer_GPU(&i_lpBuffer[o_useBufferSize], pOptimizerGPU->lpParameterH, pOptimizerGPU->lpReducedParameterH, pOptimizerGPU->GetParameterCount(), pOptimizerGPU->GetStateType());
+		// S
+		o_useBufferSize += ReadOptimizerStateFromBuffer_GPU(&i_lpBuffer[o_useBufferSize], pOptimizerGPU->lpParameterS, pOptimizerGPU->lpReducedParameterS, pOptimizerGPU->GetParameterCount(), pOptimizerGPU->GetStateType());
+
+		return pOptimizer;
+	}
 	/** IveB}CU[XV.قȂ^ꍇ͋IɎw̌^ɕϊ. */
-	ErrorCode UpdateOptimizer_AdaDelta_GPU(IOptimizer** io_ppOptimizer, U32 i_parameterCount, F32 i_rho, F32 i_epsilon)
+	ErrorCode ChangeOptimizer_AdaDelta_GPU(IOptimizer** io_ppOptimizer, U64 i_parameterCount)
 	{
-		iOptimizer_AdaDelta* pOptimizer = dynamic_cast<iOptimizer_AdaDelta*>(*io_ppOptimizer);
+		Optimizer_AdaDelta_GPU* pOptimizer = dynamic_cast<Optimizer_AdaDelta_GPU*>(*io_ppOptimizer);
 		if(pOptimizer == NULL)
 		{
 			if(*io_ppOptimizer)
 				delete *io_ppOptimizer;
 
-			*io_ppOptimizer = pOptimizer = CreateOptimizer_AdaDelta_GPU(i_parameterCount);
+			*io_ppOptimizer = CreateOptimizer_AdaDelta_GPU(i_parameterCount);
 		}
 
-		pOptimizer->SetHyperParameter(i_rho, i_epsilon);
-
 		return ErrorCode::ERROR_CODE_NONE;
 	}
 
 }	// NeuralNetwork
 }	// Layer
-}	// Gravisbell
\ No newline at end of file
+}	// Gravisbell
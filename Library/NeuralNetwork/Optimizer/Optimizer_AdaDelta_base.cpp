@@ -0,0 +1,239 @@
+//===============================================
+// œK[`(AdaDelta)
+//===============================================
+#include"stdafx.h"
+
+#include"Optimizer_AdaDelta_base.h"
+
+namespace Gravisbell {
+namespace Layer {
+namespace NeuralNetwork {
+
+	const std::wstring Optimizer_AdaDelta_base::OPTIMIZER_ID = L"AdaDelta";
+
+	/** RXgN^ */
+	Optimizer_AdaDelta_base::Optimizer_AdaDelta_base(U64 i_parameterCount)
+		:	m_parameterCount	(i_parameterCount)
+
+		,	m_rho			(0.95f)		/**< . */
+		,	m_epsilon		(1e-6f)		/**< ⏕W. */
+
+		,	m_stateType		(OPTIMIZER_STATE_TYPE_F32)	/**< Ԃ̊i[x */
+	{
+	}
+	/** fXgN^ */
+	Optimizer_AdaDelta_base::~Optimizer_AdaDelta_base()
+	{
+	}
+
+
+	//===========================
+	// {
+	//===========================
+	/** ID̎擾 */
+	const wchar_t* Optimizer_AdaDelta_base::GetOptimizerID()const
+	{
+		return OPTIMIZER_ID.c_str();
+	}
+
+	/** p[^擾 */
+	U64 Optimizer_AdaDelta_base::GetParameterCount()const
+	{
+		return this->m_parameterCount;
+	}
+
+	/** nCp[p[^ݒ肷
+		@param	i_parameterID	p[^ʗpID
+		@param	i_value			p[^. */
+	ErrorCode Optimizer_AdaDelta_base::SetHyperParameter(const wchar_t i_parameterID[], F32 i_value)
+	{
+		std::wstring parameter = i_parameterID;
+		if(parameter == L"rho")
+		{
+			this->m_rho = i_value;
+		}
+		else if(parameter == L"epsilon")
+		{
+			this->m_epsilon = i_value;
+		}
+		else
+		{
+			return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+		}
+
+		return ErrorCode::ERROR_CODE_NONE;
+	}
+	/** nCp[p[^ݒ肷
+		@param	i_parameterID	p[^ʗpID
+		@param	i_value			p[^. */
+	ErrorCode Optimizer_AdaDelta_base::SetHyperParameter(const wchar_t i_parameterID[], S32 i_value)
+	{
+		return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+	}
+	/** nCp[p[^ݒ肷
+		@param	i_parameterID	p[^ʗpID
+		@param	i_value			p[^. */
+	ErrorCode Optimizer_AdaDelta_base::SetHyperParameter(const wchar_t i_parameterID[], const wchar_t i_value[])
+	{
+		std::wstring parameter = i_parameterID;
+		if(parameter == L"StateType")
+		{
+			OptimizerStateType stateType = OPTIMIZER_STATE_TYPE_F32;
+			if(!GetOptimizerStateTypeFromString(i_value, stateType))
+				return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+
+			return this->ChangeStateType(stateType);
+		}
+
+		return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+	}
+
+	/** Ԃ̊i[x擾 */
+	OptimizerStateType Optimizer_AdaDelta_base::GetStateType()const
+	{
+		return this->m_stateType;
+	}
+
+
+	//===========================
+	// ۑ
+	//===========================
+	/** C[̕ۑɕKvȃobt@BYTEPʂŎ擾 */
+	U64 Optimizer_AdaDelta_base::GetUseBufferByteCount()const
+	{
+		U64 useBufferByte = 0;
+
+		// gpoCgi[
+		useBufferByte += sizeof(U64);
+
+		// IDobt@TCY
+		useBufferByte += sizeof(U32);
+
+		// IDobt@
+		useBufferByte += sizeof(wchar_t) * OPTIMIZER_ID.size();
+
+		// p[^
+		useBufferByte += sizeof(this->m_parameterCount);
+
+		// 
+		useBufferByte += sizeof(this->m_rho);
+		// 
+		useBufferByte += sizeof(this->m_epsilon);
+
+		// Ԃ̊i[x
+		useBufferByte += sizeof(U32);
+
+		// H
+		useBufferByte += GetOptimizerStateByteCount(this->m_stateType, this->m_parameterCount);
+		// S
+		useBufferByte += GetOptimizerStateByteCount(this->m_stateType, this->m_parameterCount);
+
+		return useBufferByte;
+	}
+
+	/** C[obt@ɏ.
+		@param o_lpBuffer	ݐobt@̐擪AhX. GetUseBufferByteCount̖߂l̃oCgKv
+		@return ꍇ񂾃obt@TCY.sꍇ͕̒l */
+	S64 Optimizer_AdaDelta_base::WriteToBufferBase(BYTE* o_lpBuffer)const
+	{
+		U32 writePos = 0;
+
+		// gpoCg
+		U64 userBufferByte = this->GetUseBufferByteCount();
+		memcpy(&o_lpBuffer[writePos], &userBufferByte, sizeof(userBufferByte));
+		writePos += sizeof(userBufferByte);
+
+		// IDobt@TCY
+		U32 idBufferSize = sizeof(wchar_t) * OPTIMIZER_ID.size();
+		memcpy(&o_lpBuffer[writePos], &idBufferSize, sizeof(idBufferSize));
+		writePos += sizeof(idBufferSize);
+
+		// IDobt@
+		memcpy(&o_lpBuffer[writePos], (const BYTE*)OPTIMIZER_ID.c_str(), idBufferSize);
+		writePos += idBufferSize;
+
+		// p[^
+		memcpy(&o_lpBuffer[writePos], &this->m_parameterCount, sizeof(this->m_parameterCount));
+		writePos+= sizeof(this->m_parameterCount);
+
+
+		// 
+		memcpy(&o_lpBuffer[writePos], &this->m_rho, sizeof(this->m_rho));
+		writePos+= sizeof(this->m_rho);
+		// 
+		memcpy(&o_lpBuffer[writePos], &this->m_epsilon, sizeof(this->m_epsilon));
+		writePos+= sizeof(this->m_epsilon);
+
+		// Ԃ̊i[x
+		U32 stateType = this->m_stateType;
+		memcpy(&o_lpBuffer[writePos], &stateType, sizeof(stateType));
+		writePos+= sizeof(stateType);
+
+
+		return writePos;
+	}
+
+	/** obt@쐬 */
+	Optimizer_AdaDelta_base* CreateOptimizerFromBuffer_AdaDelta(const BYTE* i_lpBuffer, Gravisbell::S64 i_bufferSize, Gravisbell::S64& o_useBufferSize, Optimizer_AdaDelta_base* (*CreateOptimizer_AdaDelta)(U64) )
+	{
+		o_useBufferSize = -1;
+		U64 readBufferPos = 0;
+
+		// gpobt@, ID͓ǂݎς
+
+		// p[^
+		U64 parameterCount = 0;
+		memcpy(&parameterCount, &i_lpBuffer[readBufferPos], sizeof(parameterCount));
+		readBufferPos += sizeof(parameterCount);
+
+		// 쐬
+		Optimizer_AdaDelta_base* pOptimizer = CreateOptimizer_AdaDelta(parameterCount);
+		if(pOptimizer == NULL)
+			return NULL;
+
+
+		// 
+		F32 rho = 0.0f;
+		memcpy(&rho, &i_lpBuffer[readBufferPos], sizeof(rho));
+		readBufferPos += sizeof(rho);
+		pOptimizer->SetHyperParameter(L"rho", rho);
+		// 
+		F32 epsilon = 0.0f;
+		memcpy(&epsilon, &i_lpBuffer[readBufferPos], sizeof(epsilon));
+		readBufferPos += sizeof(epsilon);
+		pOptimizer->SetHyperParameter(L"epsilon", epsilon);
+
+		// Ԃ̊i[x.
+		// i[xȂ`͒Px̏Ԕz񂪑. V`͏kxł4oCgEɑ邽ߋ`ƃTCYv邱Ƃ͂Ȃ
+		U64 legacyBufferByte = 0;
+		legacyBufferByte += sizeof(parameterCount);
+		legacyBufferByte += sizeof(F32) * 2;
+		legacyBufferByte += sizeof(F32) * parameterCount * 2;
+		if((U64)i_bufferSize != legacyBufferByte)
+		{
+			U32 stateType = OPTIMIZER_STATE_TYPE_F32;
+			memcpy(&stateType, &i_lpBuffer[readBufferPos], sizeof(stateType));
+			readBufferPos += sizeof(stateType);
+			if(stateType >= OPTIMIZER_STATE_TYPE_COUNT)
+			{
+				delete pOptimizer;
+				return NULL;
+			}
+
+			if(pOptimizer->ChangeStateType((OptimizerStateType)stateType) != ErrorCode::ERROR_CODE_NONE)
+			{
+				delete pOptimizer;
+				return NULL;
+			}
+		}
+
+
+		// gpobt@ۑ
+		o_useBufferSize = readBufferPos;
+
+		return pOptimizer;
+	}
+
+}	// NeuralNetwork
+}	// Layer
+}	// Gravisbell
@@ -0,0 +1,94 @@
+//===============================================
+// œK[`(AdaDelta)
+//===============================================
+
+#include"Layer/NeuralNetwork/IOptimizer.h"
+#include"Optimizer_StateType.h"
+
+#include<string>
+
+namespace Gravisbell {
+namespace Layer {
+namespace NeuralNetwork {
+
+	class Optimizer_AdaDelta_base : public IOptimizer
+	{
+	public:
+		static const std::wstring OPTIMIZER_ID;
+
+	protected:
+		U64 m_parameterCount;	/**< p[^ */
+
+		F32 m_rho;			/**< . */
+		F32 m_epsilon;		/**< ⏕W. */
+
+		OptimizerStateType m_stateType;	/**< Ԃ̊i[x */
+
+	public:
+		/** RXgN^ */
+		Optimizer_AdaDelta_base(U64 i_parameterCount);
+		/** fXgN^ */
+		virtual ~Optimizer_AdaDelta_base();
+
+	public:
+		//===========================
+		// {
+		//===========================
+		/** ID̎擾 */
+		const wchar_t* GetOptimizerID()const;
+
+		/** p[^擾 */
+		U64 GetParameterCount()const;
+
+		/** nCp[p[^ݒ肷
+			@param	i_parameterID	p[^ʗpID
+			@param	i_value			p[^. */
+		ErrorCode SetHyperParameter(const wchar_t i_parameterID[], F32 i_value);
+		/** nCp[p[^ݒ肷
+			@param	i_parameterID	p[^ʗpID
+			@param	i_value			p[^. */
+		ErrorCode SetHyperParameter(const wchar_t i_parameterID[], S32 i_value);
+		/** nCp[p[^ݒ肷
+			@param	i_parameterID	p[^ʗpID
+			@param	i_value			p[^. */
+		ErrorCode SetHyperParameter(const wchar_t i_parameterID[], const wchar_t i_value[]);
+
+		/** Ԃ̊i[x擾 */
+		OptimizerStateType GetStateType()const;
+		/** Ԃ̊i[xύX.
+			ێĂԂ͐Vxɕϊ. */
+		virtual ErrorCode ChangeStateType(OptimizerStateType i_stateType) = 0;
+
+
+	public:
+		//===========================
+		// ۑ
+		//===========================
+		/** C[̕ۑɕKvȃobt@BYTEPʂŎ擾 */
+		U64 GetUseBufferByteCount()const;
+
+		/** C[obt@ɏ.
+			@param o_lpBuffer	ݐobt@̐擪AhX. GetUseBufferByteCount̖߂l̃oCgKv
+			@return ꍇ񂾃obt@TCY.sꍇ͕̒l */
+		virtual S64 WriteToBuffer(BYTE* o_lpBuffer)const = 0;
+
+	protected:
+		/** C[obt@ɏ.
+			@param o_lpBuffer	ݐobt@̐擪AhX. GetUseBufferByteCount̖߂l̃oCgKv
+			@return ꍇ񂾃obt@TCY.sꍇ͕̒l */
+		S64 WriteToBufferBase(BYTE* o_lpBuffer)const;
+	};
+
+
+	/** IveB}CU[XV.قȂ^ꍇ͋IɎw̌^ɕϊ. */
+	ErrorCode ChangeOptimizer_AdaDelta_CPU(IOptimizer** io_ppOptimizer, U64 i_parameterCount);
+	ErrorCode ChangeOptimizer_AdaDelta_GPU(IOptimizer** io_ppOptimizer, U64 i_parameterCount);
+
+	/** IveB}CUobt@쐬 */
+	Optimizer_AdaDelta_base* CreateOptimizerFromBuffer_AdaDelta(const BYTE* i_lpBuffer, Gravisbell::S64 i_bufferSize, Gravisbell::S64& o_useBufferSize, Optimizer_AdaDelta_base* (*CreateOptimizer_AdaDelta)(U64) );
+	IOptimizer* CreateOptimizerFromBuffer_AdaDelta_CPU(const BYTE* i_lpBuffer, Gravisbell::S64 i_bufferSize, Gravisbell::S64& o_useBufferSize);
+	IOptimizer* CreateOptimizerFromBuffer_AdaDelta_GPU(const BYTE* i_lpBuffer, Gravisbell::S64 i_bufferSize, Gravisbell::S64& o_useBufferSize);
+
+}	// NeuralNetwork
+}	// Layer
+}	// Gravisbell
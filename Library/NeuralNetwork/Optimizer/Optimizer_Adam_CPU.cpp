@@ -4,8 +4,13 @@
 #include"stdafx.h"
 
 #include<vector>
+#include<algorithm>
 
 #include"Optimizer_Adam_base.h"
+#include"Optimizer_GradientReducer.h"
+#include"Optimizer_Kernel_CPU.h"
+#include"Optimizer_SparseRow.h"
+#include"Library/NeuralNetwork/Optimizer.h"
 
 namespace Gravisbell {
 namespace Layer {
@@ -16,16 +21,26 @@ namespace NeuralNetwork {
 	public:
 		std::vector<F32> lpParameterM;
 		std::vector<F32> lpParameterV;
+		std::vector<U16> lpReducedParameterM;	/**< kxŊi[ꍇM */
+		std::vector<U16> lpReducedParameterV;	/**< kxŊi[ꍇV */
 
 		F32 m_beta1Pows;	/**< 1̊Kl */
 		F32 m_beta2Pows;	/**< 2̊Kl */
 
+		U32 m_stateSeed;	/**< mIۂ߂̗̎. XVƂɐi߂ */
+
+	private:
+		std::vector<F32> lpReduceBuffer;	/**< ωʏWp̍ƃobt@ */
+
+		OptimizerSparseRow m_sparseRow;	/**< xXVŒxĂs̊Ǘ */
+
 	public:
 		/** RXgN^ */
 		Optimizer_Adam_CPU(U64 i_parameterCount)
 			:	Optimizer_Adam_base	(i_parameterCount)
 			,	m_beta2Pows	(1.0f)	/**< 2̊Kl */
 			,	m_beta1Pows	(1.0f)	/**< 1̊Kl */
+			,	m_stateSeed	(0)
 		{
 			this->lpParameterM.resize(this->m_parameterCount);
 			this->lpParameterV.resize(this->m_parameterCount);
@@ -44,21 +59,188 @@ namespace NeuralNetwork {
 			@param io_lpDParameter	p[^̕ω. */
 		ErrorCode UpdateParameter(F32 io_lpParameter[], const F32 i_lpDParameter[])
 		{
+			// vfꍇ͔͈͂𕪊ĕXbhōXV
+			OptimizerUpdateTarget target = {this, io_lpParameter, i_lpDParameter};
+			return UpdateParameterMulti_CPU(&target, 1);
+		}
+
+		/** p[^̕XVJn.
+			@param	i_lpDParameter	p[^̕ω.
+			@param	o_lpDParameter	UpdateParameterRangeɓnωʂ̊i[. */
+		ErrorCode BeginUpdateParameter(const F32 i_lpDParameter[], const F32*& o_lpDParameter)
+		{
+			// ωʂW
+			ErrorCode err = ReduceGradient_CPU(i_lpDParameter, this->m_parameterCount, this->lpReduceBuffer, o_lpDParameter);
+			if(err != ErrorCode::ERROR_CODE_NONE)
+				return err;
+
 			this->m_beta1Pows *= this->m_beta1;
 			this->m_beta2Pows *= this->m_beta2;
 
-			for(U64 paramNum=0; paramNum<this->m_parameterCount; paramNum++)
+			this->m_stateSeed++;
+
+			// xXVŒxĂs͊e͈͂̍XVɒǂ
+			this->m_sparseRow.BeginDense();
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+		/** p[^̈ꕔXV.
+			@param	io_lpParamter	XVp[^̐擪.
+			@param	i_lpDParameter	BeginUpdateParameterŎ擾ωʂ̐擪.
+			@param	i_offset		XV͈͂̊Jnʒu.
+			@param	i_count			XV͈̗͂vf. */
+		ErrorCode UpdateParameterRange(F32 io_lpParameter[], const F32 i_lpDParameter[], U64 i_offset, U64 i_count)
+		{
+			if(this->m_stateType == OPTIMIZER_STATE_TYPE_F32)
 			{
-				this->lpParameterM[paramNum] = this->m_beta1 * this->lpParameterM[paramNum] + (1.0f - this->m_beta1) * i_lpDParameter[paramNum];
-				this->lpParameterV[paramNum] = this->m_beta2 * this->lpParameterV[paramNum] + (1.0f - this->m_beta2) * i_lpDParameter[paramNum] * i_lpDParameter[paramNum];
+				if(this->m_sparseRow.IsFlushing())
+				{
+					this->m_sparseRow.DecayLaggingState(&this->lpParameterM[i_offset], i_offset, i_count, this->m_beta1);
+					this->m_sparseRow.DecayLaggingState(&this->lpParameterV[i_offset], i_offset, i_count, this->m_beta2);
+				}
 
-				F32 tmpM = this->lpParameterM[paramNum] / (1.0f - this->m_beta1Pows);
-				F32 tmpV = this->lpParameterV[paramNum] / (1.0f - this->m_beta2Pows);
+				this->UpdateParameterBlock(&io_lpParameter[i_offset], &i_lpDParameter[i_offset], &this->lpParameterM[i_offset], &this->lpParameterV[i_offset], i_count);
 
-				io_lpParameter[paramNum] += this->m_alpha * (tmpM / (sqrt(tmpV) + this->m_epsilon));
+				return ErrorCode::ERROR_CODE_NONE;
+			}
+
+			// kx̏ꍇ͋ԂƂɒPxɓWJčXVAmIۂ߂Ŋi[
+			F32 lpBlockM[OPTIMIZER_STATE_BLOCK_SIZE];
+			F32 lpBlockV[OPTIMIZER_STATE_BLOCK_SIZE];
+			for(U64 blockOffset=i_offset; blockOffset<i_offset+i_count; blockOffset+=OPTIMIZER_STATE_BLOCK_SIZE)
+			{
+				U64 blockCount = std::min<U64>(OPTIMIZER_STATE_BLOCK_SIZE, i_offset + i_count - blockOffset);
+
+				DecodeOptimizerState_CPU(&this->lpReducedParameterM[blockOffset], lpBlockM, blockCount, this->m_stateType);
+				DecodeOptimizerState_CPU(&this->lpReducedParameterV[blockOffset], lpBlockV, blockCount, this->m_stateType);
+
+				this->UpdateParameterBlock(&io_lpParameter[blockOffset], &i_lpDParameter[blockOffset], lpBlockM, lpBlockV, blockCount);
+
+				EncodeOptimizerState_CPU(lpBlockM, &this->lpReducedParameterM[blockOffset], blockCount, this->m_stateType, blockOffset, this->m_stateSeed * 2 + 0);
+				EncodeOptimizerState_CPU(lpBlockV, &this->lpReducedParameterV[blockOffset], blockCount, this->m_stateType, blockOffset, this->m_stateSeed * 2 + 1);
 			}
 
 			return ErrorCode::ERROR_CODE_NONE;
+		}
+
+		/** ωʂŝ݂w肵ăp[^XV.
+			xXVLȏꍇ̂ݎw肳ꂽsXVAȊO͑ŜXV.
+			XVȂs͎ɍXVۂɁAȗ񐔕M,V̌܂Ƃ߂Ĕf.
+			ȗ񐔕̃p[^̈ړ͔fȂ߁AŜXVꍇƂ͌ʂقȂ.
+			@param	io_lpParamter	XVp[^.
+			@param	i_lpDParameter	p[^̕ω. p[^̗vf.
+			@param	i_rowCount		1ubN̍s.
+			@param	i_rowSize		1s̗vf.
+			@param	i_lpRowNum		ωʂsԍ̔z. dȂ.
+			@param	i_rowNumCount	sԍ̐. */
+		ErrorCode UpdateParameterSparse(F32 io_lpParameter[], const F32 i_lpDParameter[], U32 i_rowCount, U32 i_rowSize, const U32 i_lpRowNum[], U32 i_rowNumCount)
+		{
+			// W񃋁[`͑SvfΏۂƂAkx̓Ԃ͋ԒPʂŊۂ߂邽߁ȀꍇŜXV
+			if(!this->m_lazyUpdate || GetGradientReducer_CPU() != NULL || this->m_stateType != OPTIMIZER_STATE_TYPE_F32)
+				return this->UpdateParameter(io_lpParameter, i_lpDParameter);
+			if(!this->m_sparseRow.BeginSparse(this->m_parameterCount, i_rowCount, i_rowSize))
+				return this->UpdateParameter(io_lpParameter, i_lpDParameter);
+
+			// oCAX␳͑Ŝ̍XV񐔂ōs
+			this->m_beta1Pows *= this->m_beta1;
+			this->m_beta2Pows *= this->m_beta2;
+
+			this->m_stateSeed++;
+
+			U64 blockCount = this->m_parameterCount / ((U64)i_rowCount * i_rowSize);
+			for(U32 rowIndex=0; rowIndex<i_rowNumCount; rowIndex++)
+			{
+				U32 rowNum = i_lpRowNum[rowIndex];
+				U32 skippedStepCount = 0;
+				if(!this->m_sparseRow.TouchRow(rowNum, skippedStepCount))
+					continue;
+
+				F32 decayM = powf(this->m_beta1, (F32)skippedStepCount);
+				F32 decayV = powf(this->m_beta2, (F32)skippedStepCount);
+
+				for(U64 blockNum=0; blockNum<blockCount; blockNum++)
+				{
+					U64 offset = (blockNum * i_rowCount + rowNum) * i_rowSize;
+
+					if(skippedStepCount > 0)
+					{
+						for(U64 paramNum=offset; paramNum<offset+i_rowSize; paramNum++)
+						{
+							this->lpParameterM[paramNum] *= decayM;
+							this->lpParameterV[paramNum] *= decayV;
+						}
+					}
+
+					this->UpdateParameterBlock(&io_lpParameter[offset], &i_lpDParameter[offset], &this->lpParameterM[offset], &this->lpParameterV[offset], i_rowSize);
+				}
+			}
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+		/** aȍXVŒxĂsSčŐV̏Ԃɂ.
+			xXVł̓p[^̈ړ𔽉fȂ߁AM,V݂̌̂𔽉f. */
+		ErrorCode ApplyLaggingUpdate(F32 io_lpParameter[])
+		{
+			if(this->m_sparseRow.IsLagging())
+			{
+				this->m_sparseRow.DecayLaggingState(&this->lpParameterM[0], 0, this->m_parameterCount, this->m_beta1);
+				this->m_sparseRow.DecayLaggingState(&this->lpParameterV[0], 0, this->m_parameterCount, this->m_beta2);
+			}
+			this->m_sparseRow.Reset();
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+
+		/** Ԃ̊i[xύX.
+			ێĂԂ͐Vxɕϊ. */
+		ErrorCode ChangeStateType(OptimizerStateType i_stateType)
+		{
+			if(i_stateType >= OPTIMIZER_STATE_TYPE_COUNT)
+				return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+
+			// xXVŒxĂš𔽉fĂϊ
+			if(this->m_sparseRow.IsLagging())
+			{
+				this->m_sparseRow.DecayLaggingState(&this->lpParameterM[0], 0, this->m_parameterCount, this->m_beta1);
+				this->m_sparseRow.DecayLaggingState(&this->lpParameterV[0], 0, this->m_parameterCount, this->m_beta2);
+			}
+			this->m_sparseRow.Reset();
+
+			ChangeOptimizerStateType_CPU(this->lpParameterM, this->lpReducedParameterM, this->m_parameterCount, this->m_stateType, i_stateType, this->m_stateSeed * 2 + 0);
+			ChangeOptimizerStateType_CPU(this->lpParameterV, this->lpReducedParameterV, this->m_parameterCount, this->m_stateType, i_stateType, this->m_stateSeed * 2 + 1);
+			this->m_stateType = i_stateType;
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+
+	private:
+		/** Px̓Ԃgpăp[^XV.
+			@param	io_lpParamter	XVp[^̐擪.
+			@param	i_lpDParameter	ωʂ̐擪.
+			@param	io_lpParameterM	M̐擪.
+			@param	io_lpParameterV	V̐擪.
+			@param	i_count			XVvf. */
+		void UpdateParameterBlock(F32 io_lpParameter[], const F32 i_lpDParameter[], F32 io_lpParameterM[], F32 io_lpParameterV[], U64 i_count)
+		{
+			if(!GetReferenceMode_CPU())
+			{
+				UpdateParameterKernel_Adam_CPU(
+					io_lpParameter, i_lpDParameter, io_lpParameterM, io_lpParameterV, i_count,
+					this->m_alpha, this->m_beta1, this->m_beta2, this->m_epsilon, this->m_beta1Pows, this->m_beta2Pows);
+
+				return;
+			}
+
+			for(U64 paramNum=0; paramNum<i_count; paramNum++)
+			{
+				io_lpParameterM[paramNum] = this->m_beta1 * io_lpParameterM[paramNum] + (1.0f - this->m_beta1) * i_lpDParameter[paramNum];
+				io_lpParameterV[paramNum] = this->m_beta2 * io_lpParameterV[paramNum] + (1.0f - this->m_beta2) * i_lpDParameter[paramNum] * i_lpDParameter[paramNum];
+
+				F32 tmpM = io_lpParameterM[paramNum] / (1.0f - this->m_beta1Pows);
+				F32 tmpV = io_lpParameterV[paramNum] / (1.0f - this->m_beta2Pows);
+
+				io_lpParameter[paramNum] += this->m_alpha * (tmpM / (sqrt(tmpV) + this->m_epsilon));
+			}
 		}
 
 	public:
@@ -73,11 +255,18 @@ namespace NeuralNetwork {
 			U64 writePos = WriteToBufferBase(o_lpBuffer);
 
 			// M
-			memcpy(&o_lpBuffer[writePos], &this->lpParameterM[0], sizeof(F32)*this->m_parameterCount);
-			writePos += sizeof(F32)*this->m_parameterCount;
+			U64 writePosM = writePos;
+			writePos += WriteOptimizerStateToBuffer_CPU(&o_lpBuffer[writePos], this->lpParameterM, this->lpReducedParameterM, this->m_parameterCount, this->m_stateType);
 			// V
-			memcpy(&o_lpBuffer[writePos], &this->lpParameterV[0], sizeof(F32)*this->m_parameterCount);
-			writePos += sizeof(F32)*this->m_parameterCount;
+			U64 writePosV = writePos;
+			writePos += WriteOptimizerStateToBuffer_CPU(&o_lpBuffer[writePos], this->lpParameterV, this->lpReducedParameterV, this->m_parameterCount, this->m_stateType);
+
+			// xXVŒxĂs͌𔽉flۑ. xXV͒PxŊi[Ă
+			if(this->m_sparseRow.IsLagging())
+			{
+				this->m_sparseRow.DecayLaggingState((F32*)&o_lpBuffer[writePosM], 0, this->m_parameterCount, this->m_beta1);
+				this->m_sparseRow.DecayLaggingState((F32*)&o_lpBuffer[writePosV], 0, this->m_parameterCount, this->m_beta2);
+			}
 
 			// beta1^n
 			memcpy(&o_lpBuffer[writePos], &this->m_beta1Pows, sizeof(F32));
@@ -109,11 +298,9 @@ namespace NeuralNetwork {
 		}
 
 		// M
-		memcpy(&pOptimizerCPU->lpParameterM[0], &i_lpBuffer[o_useBufferSize], sizeof(F32)*pOptimizerCPU->lpParameterM.size());
-		o_useBufferSize += sizeof(F32)*pOptimizerCPU->lpParameterM.size();
+		o_useBufferSize += ReadOptimizerStateFromBuffer_CPU(&i_lpBuffer[o_useBufferSize], pOptimizerCPU->lpParameterM, pOptimizerCPU->lpReducedParameterM, pOptimizerCPU->GetParameterCount(), pOptimizerCPU->GetStateType());
 		// V
-		memcpy(&pOptimizerCPU->lpParameterV[0], &i_lpBuffer[o_useBufferSize], sizeof(F32)*pOptimizerCPU->lpParameterV.size());
-		o_useBufferSize += sizeof(F32)*pOptimizerCPU->lpParameterV.size();
+		o_useBufferSize += ReadOptimizerStateFromBuffer_CPU(&i_lpBuffer[o_useBufferSize], pOptimizerCPU->lpParameterV, pOptimizerCPU->lpReducedParameterV, pOptimizerCPU->GetParameterCount(), pOptimizerCPU->GetStateType());
 
 		// beta1^n
 		memcpy(&pOptimizerCPU->m_beta1Pows, &i_lpBuffer[o_useBufferSize], sizeof(F32));
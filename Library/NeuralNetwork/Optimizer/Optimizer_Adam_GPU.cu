@@ -26,7 +26,7 @@ namespace NeuralNetwork {
 	namespace
 	{
 		/** xNg̗vfm̊|Z. */
-		__global__ void cuda_func_updateParameter(F32* io_lpParameter, const F32* i_lpDParameter, const U32 i_bufferSize, F32* io_lpParameterM, F32* io_lpParameterV, F32 i_alpha, F32 i_beta1, F32 i_beta2, F32 i_epsilon, F32 i_beta1Pows, F32 i_beta2Pows)
+		__global__ void cuda_func_updateParameter(F32* io_lpParameter, const F32* i_lpDParameter, const U64 i_bufferSize, F32* io_lpParameterM, F32* io_lpParameterV, F32 i_alpha, F32 i_beta1, F32 i_beta2, F32 i_epsilon, F32 i_beta1Pows, F32 i_beta2Pows)
 		{
 			const U32 paramNum = blockIdx.x * BLOCK_SIZE + threadIdx.x;
 			if(paramNum >= i_bufferSize)	// 򂷂邪warpȂ̂ŁAxɉe͂Ȃ͂...
@@ -40,6 +40,28 @@ namespace NeuralNetwork {
 
 			io_lpParameter[paramNum] += i_alpha * (tmpM / (sqrt(tmpV) + i_epsilon));
 		}
+		/** kx̓Ԃgpăp[^XV.
+			Ԃ͒PxɓWJČvZAmIۂ߂Ŋi[. */
+		__global__ void cuda_func_updateParameter_reduced(F32* io_lpParameter, const F32* i_lpDParameter, const U64 i_bufferSize, U16* io_lpParameterM, U16* io_lpParameterV, F32 i_alpha, F32 i_beta1, F32 i_beta2, F32 i_epsilon, F32 i_beta1Pows, F32 i_beta2Pows, OptimizerStateType i_stateType, U64 i_offset, U32 i_seed)
+		{
+			const U32 paramNum = blockIdx.x * BLOCK_SIZE + threadIdx.x;
+			if(paramNum >= i_bufferSize)	// 򂷂邪warpȂ̂ŁAxɉe͂Ȃ͂...
+				return;
+
+			F32 parameterM = ConvertOptimizerStateToF32(io_lpParameterM[paramNum], i_stateType);
+			F32 parameterV = ConvertOptimizerStateToF32(io_lpParameterV[paramNum], i_stateType);
+
+			parameterM = i_beta1 * parameterM + (1.0f - i_beta1) * i_lpDParameter[paramNum];
+			parameterV = i_beta2 * parameterV + (1.0f - i_beta2) * i_lpDParameter[paramNum] * i_lpDParameter[paramNum];
+
+			F32 tmpM = parameterM / (1.0f - i_beta1Pows);
+			F32 tmpV = parameterV / (1.0f - i_beta2Pows);
+
+			io_lpParameter[paramNum] += i_alpha * (tmpM / (sqrt(tmpV) + i_epsilon));
+
+			io_lpParameterM[paramNum] = ConvertF32ToOptimizerState(parameterM, i_stateType, GetOptimizerStateNoise(i_offset + paramNum, i_seed * 2 + 0));
+			io_lpParameterV[paramNum] = ConvertF32ToOptimizerState(parameterV, i_stateType, GetOptimizerStateNoise(i_offset + paramNum, i_seed * 2 + 1));
+		}
 	}
 
 	class Optimizer_Adam_GPU : public Optimizer_Adam_base
@@ -47,16 +69,21 @@ namespace NeuralNetwork {
 	public:
 		thrust::device_vector<F32> lpParameterM;
 		thrust::device_vector<F32> lpParameterV;
+		thrust::device_vector<U16> lpReducedParameterM;	/**< kxŊi[ꍇM */
+		thrust::device_vector<U16> lpReducedParameterV;	/**< kxŊi[ꍇV */
 
 		F32 m_beta1Pows;	/**< 1̊Kl */
 		F32 m_beta2Pows;	/**< 2̊Kl */
 
+		U32 m_stateSeed;	/**< mIۂ߂̗̎. XVƂɐi߂ */
+
 	public:
 		/** RXgN^ */
 		Optimizer_Adam_GPU(U64 i_parameterCount)
 			:	Optimizer_Adam_base	(i_parameterCount)
 			,	m_beta2Pows	(1.0f)	/**< 2̊Kl */
 			,	m_beta1Pows	(1.0f)	/**< 1̊Kl */
+			,	m_stateSeed	(0)
 		{
 			this->lpParameterM.resize(this->m_parameterCount);
 			this->lpParameterV.resize(this->m_parameterCount);
@@ -74,22 +101,90 @@ namespace NeuralNetwork {
 			@param io_lpParamter	XVp[^.
 			@param io_lpDParameter	p[^̕ω. */
 		ErrorCode UpdateParameter(F32 io_lpParameter[], const F32 i_lpDParameter[])
+		{
+			const F32* lpDParameter = NULL;
+			ErrorCode err = this->BeginUpdateParameter(i_lpDParameter, lpDParameter);
+			if(err != ErrorCode::ERROR_CODE_NONE)
+				return err;
+
+			return this->UpdateParameterRange(io_lpParameter, lpDParameter, 0, this->m_parameterCount);
+		}
+
+		/** p[^̕XVJn.
+			@param	i_lpDParameter	p[^̕ω.
+			@param	o_lpDParameter	UpdateParameterRangeɓnωʂ̊i[. */
+		ErrorCode BeginUpdateParameter(const F32 i_lpDParameter[], const F32*& o_lpDParameter)
 		{
 			this->m_beta1Pows *= this->m_beta1;
 			this->m_beta2Pows *= this->m_beta2;
 
-			dim3 grid((this->m_parameterCount +(BLOCK_SIZE - 1))/BLOCK_SIZE , 1, 1);
+			this->m_stateSeed++;
+
+			o_lpDParameter = i_lpDParameter;
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+		/** p[^̈ꕔXV.
+			@param	io_lpParamter	XVp[^̐擪.
+			@param	i_lpDParameter	BeginUpdateParameterŎ擾ωʂ̐擪.
+			@param	i_offset		XV͈͂̊Jnʒu.
+			@param	i_count			XV͈̗͂vf. */
+		ErrorCode UpdateParameterRange(F32 io_lpParameter[], const F32 i_lpDParameter[], U64 i_offset, U64 i_count)
+		{
+			dim3 grid((U32)((i_count +(BLOCK_SIZE - 1))/BLOCK_SIZE), 1, 1);
 			dim3 block(BLOCK_SIZE, 1, 1);
 
-			cuda_func_updateParameter<<<grid, block>>>(
-				io_lpParameter,
-				i_lpDParameter,
-				this->m_parameterCount,
-				thrust::raw_pointer_cast(&this->lpParameterM[0]),
-				thrust::raw_pointer_cast(&this->lpParameterV[0]),
-				this->m_alpha, this->m_beta1, this->m_beta2, this->m_epsilon,
-				this->m_beta1Pows, this->m_beta2Pows);
+			if(this->m_stateType == OPTIMIZER_STATE_TYPE_F32)
+			{
+				cuda_func_updateParameter<<<grid, block>>>(
+					&io_lpParameter[i_offset],
+					&i_lpDParameter[i_offset],
+					i_count,
+					thrust::raw_pointer_cast(&this->lpParameterM[i_offset]),
+					thrust::raw_pointer_cast(&this->lpParameterV[i_offset]),
+					this->m_alpha, this->m_beta1, this->m_beta2, this->m_epsilon,
+					this->m_beta1Pows, this->m_beta2Pows);
+			}
+			else
+			{
+				cuda_func_updateParameter_reduced<<<grid, block>>>(
+					&io_lpParameter[i_offset],
+					&i_lpDParameter[i_offset],
+					i_count,
+					thrust::raw_pointer_cast(&this->lpReducedParameterM[i_offset]),
+					thrust::raw_pointer_cast(&this->lpReducedParameterV[i_offset]),
+					this->m_alpha, this->m_beta1, this->m_beta2, this->m_epsilon,
+					this->m_beta1Pows, this->m_beta2Pows,
+					this->m_stateType, i_offset, this->m_stateSeed);
+			}
+
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+
+		/** ωʂŝ݂w肵ăp[^XV.
+			GPUł͑ŜXV. w肳ĂȂs̕ωʂ0̂ߌʂ͕ςȂ. */
+		ErrorCode UpdateParameterSparse(F32 io_lpParameter[], const F32 i_lpDParameter[], U32 i_rowCount, U32 i_rowSize, const U32 i_lpRowNum[], U32 i_rowNumCount)
+		{
+			return this->UpdateParameter(io_lpParameter, i_lpDParameter);
+		}
+		/** aȍXVŒxĂsSčŐV̏Ԃɂ.
+			GPUł͏ɑŜXV邽߁AxĂs݂͑Ȃ. */
+		ErrorCode ApplyLaggingUpdate(F32 io_lpParameter[])
+		{
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+
+		/** Ԃ̊i[xύX.
+			ێĂԂ͐Vxɕϊ. */
+		ErrorCode ChangeStateType(OptimizerStateType i_stateType)
+		{
+			if(i_stateType >= OPTIMIZER_STATE_TYPE_COUNT)
+				return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
 
+			ChangeOptimizerStateType_GPU(this->lpParameterM, this->lpReducedParameterM, this->m_parameterCount, this->m_stateType, i_stateType, this->m_stateSeed * 2 + 0);
+			ChangeOptimizerStateType_GPU(this->lpParameterV, this->lpReducedParameterV, this->m_parameterCount, this->m_stateType, i_stateType, this->m_stateSeed * 2 + 1);
+			this->m_stateType = i_stateType;
 
 			return ErrorCode::ERROR_CODE_NONE;
 		}
@@ -106,11 +201,9 @@ namespace NeuralNetwork {
 			S64 writePos = WriteToBufferBase(o_lpBuffer);
 
 			// M
-			cudaMemcpy(&o_lpBuffer[writePos], thrust::raw_pointer_cast(&this->lpParameterM[0]), sizeof(F32)*this->m_parameterCount, cudaMemcpyDeviceToHost);
-			writePos += sizeof(F32)*this->m_parameterCount;
+			writePos += WriteOptimizerStateToBuffer_GPU(&o_lpBuffer[writePos], this->lpParameterM, this->lpReducedParameterM, this->m_parameterCount, this->m_stateType);
 			// V
-			cudaMemcpy(&o_lpBuffer[writePos], thrust::raw_pointer_cast(&this->lpParameterV[0]), sizeof(F32)*this->m_parameterCount, cudaMemcpyDeviceToHost);
-			writePos += sizeof(F32)*this->m_parameterCount;
+			writePos += WriteOptimizerStateToBuffer_GPU(&o_lpBuffer[writePos], this->lpParameterV, this->lpReducedParameterV, this->m_parameterCount, this->m_stateType);
 
 			// beta1^n
 			memcpy(&o_lpBuffer[writePos], &this->m_beta1Pows, sizeof(F32));
@@ -142,11 +235,9 @@ namespace NeuralNetwork {
 		}
 
 		// M
-		cudaMemcpy(thrust::raw_pointer_cast(&pOptimizerGPU->lpParameterM[0]), &i_lpBuffer[o_useBufferSize], sizeof(F32)*pOptimizerGPU->lpParameterM.size(), cudaMemcpyHostToDevice);
-		o_useBufferSize += sizeof(F32)*pOptimizerGPU->lpParameterM.size();
+		o_useBufferSize += ReadOptimizerStateFromBuffer_GPU(&i_lpBuffer[o_useBufferSize], pOptimizerGPU->lpParameterM, pOptimizerGPU->lpReducedParameterM, pOptimizerGPU->GetParameterCount(), pOptimizerGPU->GetStateType());
 		// V
-		cudaMemcpy(thrust::raw_pointer_cast(&pOptimizerGPU->lpParameterV[0]), &i_lpBuffer[o_useBufferSize], sizeof(F32)*pOptimizerGPU->lpParameterV.size(), cudaMemcpyHostToDevice);
-		o_useBufferSize += sizeof(F32)*pOptimizerGPU->lpParameterV.size();
+		o_useBufferSize += ReadOptimizerStateFromBuffer_GPU(&i_lpBuffer[o_useBufferSize], pOptimizerGPU->lpParameterV, pOptimizerGPU->lpReducedParameterV, pOptimizerGPU->GetParameterCount(), pOptimizerGPU->GetStateType());
 
 		// beta1^n
 		memcpy(&pOptimizerGPU->m_beta1Pows, &i_lpBuffer[o_useBufferSize], sizeof(F32));
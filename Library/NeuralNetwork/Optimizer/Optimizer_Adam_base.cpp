@@ -19,6 +19,10 @@ namespace NeuralNetwork {
 		,	m_beta1			(0.9f)			/**< . */
 		,	m_beta2			(0.999f)		/**< . */
 		,	m_epsilon		(1e-8f)			/**< ⏕W. */
+
+		,	m_stateType		(OPTIMIZER_STATE_TYPE_F32)	/**< Ԃ̊i[x */
+
+		,	m_lazyUpdate	(false)
 	{
 	}
 	/** fXgN^ */
@@ -34,6 +38,12 @@ namespace NeuralNetwork {
 	const wchar_t* Optimizer_Adam_base::GetOptimizerID()const
 	{
 		return OPTIMIZER_ID.c_str();
+	}
+
+	/** p[^擾 */
+	U64 Optimizer_Adam_base::GetParameterCount()const
+	{
+		return this->m_parameterCount;
 	}
 
 	/** nCp[p[^ݒ肷
@@ -70,15 +80,41 @@ namespace NeuralNetwork {
 		@param	i_value			p[^. */
 	ErrorCode Optimizer_Adam_base::SetHyperParameter(const wchar_t i_parameterID[], S32 i_value)
 	{
-		return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+		std::wstring parameter = i_parameterID;
+		if(parameter == L"LazyUpdate")
+		{
+			this->m_lazyUpdate = (i_value != 0);
+		}
+		else
+		{
+			return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+		}
+
+		return ErrorCode::ERROR_CODE_NONE;
 	}
 	/** nCp[p[^ݒ肷
 		@param	i_parameterID	p[^ʗpID
 		@param	i_value			p[^. */
 	ErrorCode Optimizer_Adam_base::SetHyperParameter(const wchar_t i_parameterID[], const wchar_t i_value[])
 	{
+		std::wstring parameter = i_parameterID;
+		if(parameter == L"StateType")
+		{
+			OptimizerStateType stateType = OPTIMIZER_STATE_TYPE_F32;
+			if(!GetOptimizerStateTypeFromString(i_value, stateType))
+				return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+
+			return this->ChangeStateType(stateType);
+		}
+
 		return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
 	}
+
+	/** Ԃ̊i[x擾 */
+	OptimizerStateType Optimizer_Adam_base::GetStateType()const
+	{
+		return this->m_stateType;
+	}
 
 
 	//===========================
@@ -110,10 +146,15 @@ namespace NeuralNetwork {
 		// 
 		useBufferByte += sizeof(this->m_epsilon);
 
+		// Ԃ̊i[x
+		useBufferByte += sizeof(U32);
+		// LazyUpdate
+		useBufferByte += sizeof(U32);
+
 		// M
-		useBufferByte += sizeof(F32) * this->m_parameterCount;
+		useBufferByte += GetOptimizerStateByteCount(this->m_stateType, this->m_parameterCount);
 		// V
-		useBufferByte += sizeof(F32) * this->m_parameterCount;
+		useBufferByte += GetOptimizerStateByteCount(this->m_stateType, this->m_parameterCount);
 
 		// 1^n
 		useBufferByte += sizeof(F32);
@@ -163,6 +204,15 @@ namespace NeuralNetwork {
 		memcpy(&o_lpBuffer[writePos], &this->m_epsilon, sizeof(this->m_epsilon));
 		writePos+= sizeof(this->m_epsilon);
 
+		// Ԃ̊i[x
+		U32 stateType = this->m_stateType;
+		memcpy(&o_lpBuffer[writePos], &stateType, sizeof(stateType));
+		writePos+= sizeof(stateType);
+		// LazyUpdate
+		U32 lazyUpdate = this->m_lazyUpdate ? 1 : 0;
+		memcpy(&o_lpBuffer[writePos], &lazyUpdate, sizeof(lazyUpdate));
+		writePos+= sizeof(lazyUpdate);
+
 
 		return writePos;
 	}
@@ -207,6 +257,51 @@ namespace NeuralNetwork {
 		readBufferPos += sizeof(epsilon);
 		pOptimizer->SetHyperParameter(L"epsilon", epsilon);
 
+		// Ԃ̊i[x, LazyUpdate.
+		// i[xȂ`͒Px̏Ԕz񂪑.
+		// V`͊i[x狁߂TCYƈvꍇ̂ݐV`ƂĈ.
+		// `̏Ԕz̐擪kx̒lƂēǂ߂͔̂񐳋K̏ꍇ݂̂̂߁Akxŋ`ƃTCYvĂʂł
+		U64 legacyBufferByte = 0;
+		legacyBufferByte += sizeof(parameterCount);
+		legacyBufferByte += sizeof(F32) * 4;
+		legacyBufferByte += sizeof(F32) * parameterCount * 2;
+		// 1^n, 2^n
+		legacyBufferByte += sizeof(F32) * 2;
+
+		U32 stateType = OPTIMIZER_STATE_TYPE_F32;
+		memcpy(&stateType, &i_lpBuffer[readBufferPos], sizeof(stateType));
+
+		U64 bufferByte = 0;
+		if(stateType < OPTIMIZER_STATE_TYPE_COUNT)
+		{
+			bufferByte += readBufferPos;
+			bufferByte += sizeof(U32) * 2;
+			bufferByte += GetOptimizerStateByteCount((OptimizerStateType)stateType, parameterCount) * 2;
+			// 1^n, 2^n
+			bufferByte += sizeof(F32) * 2;
+		}
+
+		if(bufferByte > 0 && (U64)i_bufferSize == bufferByte)
+		{
+			readBufferPos += sizeof(stateType);
+			if(pOptimizer->ChangeStateType((OptimizerStateType)stateType) != ErrorCode::ERROR_CODE_NONE)
+			{
+				delete pOptimizer;
+				return NULL;
+			}
+
+			// LazyUpdate
+			U32 lazyUpdate = 0;
+			memcpy(&lazyUpdate, &i_lpBuffer[readBufferPos], sizeof(lazyUpdate));
+			readBufferPos += sizeof(lazyUpdate);
+			pOptimizer->SetHyperParameter(L"LazyUpdate", (S32)lazyUpdate);
+		}
+		else if((U64)i_bufferSize != legacyBufferByte)
+		{
+			delete pOptimizer;
+			return NULL;
+		}
+
 
 		// gpobt@ۑ
 		o_useBufferSize = readBufferPos;
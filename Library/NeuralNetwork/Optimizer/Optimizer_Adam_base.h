@@ -3,6 +3,7 @@
 //===============================================
 
 #include"Layer/NeuralNetwork/IOptimizer.h"
+#include"Optimizer_StateType.h"
 
 #include<string>
 
@@ -23,6 +24,10 @@ namespace NeuralNetwork {
 		F32	m_beta2;		/**< . */
 		F32	m_epsilon;		/**< ⏕W. */
 
+		OptimizerStateType m_stateType;	/**< Ԃ̊i[x */
+
+		bool m_lazyUpdate;	/**< xXVtO. aȍXVŕωʂȂs̍XVȗAɍXVۂM,V݂̌̂𔽉f */
+
 	public:
 		/** RXgN^ */
 		Optimizer_Adam_base(U64 i_parameterCount);
@@ -35,6 +40,9 @@ namespace NeuralNetwork {
 		//===========================
 		/** ID̎擾 */
 		const wchar_t* GetOptimizerID()const;
+
+		/** p[^擾 */
+		U64 GetParameterCount()const;
 
 		/** nCp[p[^ݒ肷
 			@param	i_parameterID	p[^ʗpID
@@ -48,6 +56,12 @@ namespace NeuralNetwork {
 			@param	i_parameterID	p[^ʗpID
 			@param	i_value			p[^. */
 		ErrorCode SetHyperParameter(const wchar_t i_parameterID[], const wchar_t i_value[]);
+
+		/** Ԃ̊i[x擾 */
+		OptimizerStateType GetStateType()const;
+		/** Ԃ̊i[xύX.
+			ێĂԂ͐Vxɕϊ. */
+		virtual ErrorCode ChangeStateType(OptimizerStateType i_stateType) = 0;
 
 
 	public:
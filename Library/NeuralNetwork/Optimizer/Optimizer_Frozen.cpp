@@ -0,0 +1,189 @@
+//===============================================
+// œK[`(_p)
+// ԂAp[^̍XVۂ
+//===============================================
+#include"stdafx.h"
+
+#include"Optimizer_Frozen.h"
+
+namespace Gravisbell {
+namespace Layer {
+namespace NeuralNetwork {
+
+	const std::wstring Optimizer_Frozen::OPTIMIZER_ID = L"Frozen";
+
+	/** RXgN^ */
+	Optimizer_Frozen::Optimizer_Frozen(U64 i_parameterCount)
+		:	m_parameterCount	(i_parameterCount)
+	{
+	}
+	/** fXgN^ */
+	Optimizer_Frozen::~Optimizer_Frozen()
+	{
+	}
+
+
+	//===========================
+	// {
+	//===========================
+	/** ID̎擾 */
+	const wchar_t* Optimizer_Frozen::GetOptimizerID()const
+	{
+		return OPTIMIZER_ID.c_str();
+	}
+
+	/** p[^擾 */
+	U64 Optimizer_Frozen::GetParameterCount()const
+	{
+		return this->m_parameterCount;
+	}
+
+	/** nCp[p[^ݒ肷
+		@param	i_parameterID	p[^ʗpID
+		@param	i_value			p[^. */
+	ErrorCode Optimizer_Frozen::SetHyperParameter(const wchar_t i_parameterID[], F32 i_value)
+	{
+		return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+	}
+	/** nCp[p[^ݒ肷
+		@param	i_parameterID	p[^ʗpID
+		@param	i_value			p[^. */
+	ErrorCode Optimizer_Frozen::SetHyperParameter(const wchar_t i_parameterID[], S32 i_value)
+	{
+		return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+	}
+	/** nCp[p[^ݒ肷
+		@param	i_parameterID	p[^ʗpID
+		@param	i_value			p[^. */
+	ErrorCode Optimizer_Frozen::SetHyperParameter(const wchar_t i_parameterID[], const wchar_t i_value[])
+	{
+		return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+	}
+
+
+	//===========================
+	// 
+	//===========================
+	/** p[^XV.
+		_p̂ߏɎs. */
+	ErrorCode Optimizer_Frozen::UpdateParameter(F32 io_lpParameter[], const F32 i_lpDParameter[])
+	{
+		return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+	}
+	/** p[^̕XVJn.
+		_p̂ߏɎs. */
+	ErrorCode Optimizer_Frozen::BeginUpdateParameter(const F32 i_lpDParameter[], const F32*& o_lpDParameter)
+	{
+		o_lpDParameter = NULL;
+
+		return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+	}
+	/** p[^̈ꕔXV.
+		_p̂ߏɎs. */
+	ErrorCode Optimizer_Frozen::UpdateParameterRange(F32 io_lpParameter[], const F32 i_lpDParameter[], U64 i_offset, U64 i_count)
+	{
+		return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+	}
+	/** ωʂŝ݂w肵ăp[^XV.
+		_p̂ߏɎs. */
+	ErrorCode Optimizer_Frozen::UpdateParameterSparse(F32 io_lpParameter[], const F32 i_lpDParameter[], U32 i_rowCount, U32 i_rowSize, const U32 i_lpRowNum[], U32 i_rowNumCount)
+	{
+		return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+	}
+	/** aȍXVŒxĂsSčŐV̏Ԃɂ.
+		XVsȂ߁AxĂs݂͑Ȃ. */
+	ErrorCode Optimizer_Frozen::ApplyLaggingUpdate(F32 io_lpParameter[])
+	{
+		return ErrorCode::ERROR_CODE_NONE;
+	}
+
+
+	//===========================
+	// ۑ
+	//===========================
+	/** C[̕ۑɕKvȃobt@BYTEPʂŎ擾 */
+	U64 Optimizer_Frozen::GetUseBufferByteCount()const
+	{
+		U64 useBufferByte = 0;
+
+		// gpoCgi[
+		useBufferByte += sizeof(U64);
+
+		// IDobt@TCY
+		useBufferByte += sizeof(U32);
+
+		// IDobt@
+		useBufferByte += sizeof(wchar_t) * OPTIMIZER_ID.size();
+
+		// p[^
+		useBufferByte += sizeof(this->m_parameterCount);
+
+		return useBufferByte;
+	}
+
+	/** C[obt@ɏ.
+		@param o_lpBuffer	ݐobt@̐擪AhX. GetUseBufferByteCount̖߂l̃oCgKv
+		@return ꍇ񂾃obt@TCY.sꍇ͕̒l */
+	S64 Optimizer_Frozen::WriteToBuffer(BYTE* o_lpBuffer)const
+	{
+		U64 writePos = 0;
+
+		// gpoCg
+		U64 userBufferByte = this->GetUseBufferByteCount();
+		memcpy(&o_lpBuffer[writePos], &userBufferByte, sizeof(userBufferByte));
+		writePos += sizeof(userBufferByte);
+
+		// IDobt@TCY
+		U32 idBufferSize = sizeof(wchar_t) * OPTIMIZER_ID.size();
+		memcpy(&o_lpBuffer[writePos], &idBufferSize, sizeof(idBufferSize));
+		writePos += sizeof(idBufferSize);
+
+		// IDobt@
+		memcpy(&o_lpBuffer[writePos], (const BYTE*)OPTIMIZER_ID.c_str(), idBufferSize);
+		writePos += idBufferSize;
+
+		// p[^
+		memcpy(&o_lpBuffer[writePos], &this->m_parameterCount, sizeof(this->m_parameterCount));
+		writePos+= sizeof(this->m_parameterCount);
+
+		return writePos;
+	}
+
+
+	/** IveB}CU[XV.قȂ^ꍇ͋IɎw̌^ɕϊ. */
+	ErrorCode ChangeOptimizer_Frozen(IOptimizer** io_ppOptimizer, U64 i_parameterCount)
+	{
+		Optimizer_Frozen* pOptimizer = dynamic_cast<Optimizer_Frozen*>(*io_ppOptimizer);
+		if(pOptimizer == NULL)
+		{
+			if(*io_ppOptimizer)
+				delete *io_ppOptimizer;
+
+			*io_ppOptimizer = new Optimizer_Frozen(i_parameterCount);
+		}
+
+		return ErrorCode::ERROR_CODE_NONE;
+	}
+
+	/** obt@쐬 */
+	IOptimizer* CreateOptimizerFromBuffer_Frozen(const BYTE* i_lpBuffer, Gravisbell::S64 i_bufferSize, Gravisbell::S64& o_useBufferSize)
+	{
+		o_useBufferSize = -1;
+		U64 readBufferPos = 0;
+
+		// gpobt@, ID͓ǂݎς
+
+		// p[^
+		U64 parameterCount = 0;
+		memcpy(&parameterCount, &i_lpBuffer[readBufferPos], sizeof(parameterCount));
+		readBufferPos += sizeof(parameterCount);
+
+		// gpobt@ۑ
+		o_useBufferSize = readBufferPos;
+
+		return new Optimizer_Frozen(parameterCount);
+	}
+
+}	// NeuralNetwork
+}	// Layer
+}	// Gravisbell
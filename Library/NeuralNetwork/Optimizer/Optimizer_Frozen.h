@@ -0,0 +1,96 @@
+//===============================================
+// œK[`(_p)
+// ԂAp[^̍XVۂ
+//===============================================
+
+#include"Layer/NeuralNetwork/IOptimizer.h"
+
+#include<string>
+
+namespace Gravisbell {
+namespace Layer {
+namespace NeuralNetwork {
+
+	class Optimizer_Frozen : public IOptimizer
+	{
+	public:
+		static const std::wstring OPTIMIZER_ID;
+
+	protected:
+		U64 m_parameterCount;	/**< p[^ */
+
+	public:
+		/** RXgN^ */
+		Optimizer_Frozen(U64 i_parameterCount);
+		/** fXgN^ */
+		virtual ~Optimizer_Frozen();
+
+	public:
+		//===========================
+		// {
+		//===========================
+		/** ID̎擾 */
+		const wchar_t* GetOptimizerID()const;
+
+		/** p[^擾 */
+		U64 GetParameterCount()const;
+
+		/** nCp[p[^ݒ肷
+			@param	i_parameterID	p[^ʗpID
+			@param	i_value			p[^. */
+		ErrorCode SetHyperParameter(const wchar_t i_parameterID[], F32 i_value);
+		/** nCp[p[^ݒ肷
+			@param	i_parameterID	p[^ʗpID
+			@param	i_value			p[^. */
+		ErrorCode SetHyperParameter(const wchar_t i_parameterID[], S32 i_value);
+		/** nCp[p[^ݒ肷
+			@param	i_parameterID	p[^ʗpID
+			@param	i_value			p[^. */
+		ErrorCode SetHyperParameter(const wchar_t i_parameterID[], const wchar_t i_value[]);
+
+	public:
+		//===========================
+		// 
+		//===========================
+		/** p[^XV.
+			_p̂ߏɎs. */
+		ErrorCode UpdateParameter(F32 io_lpParameter[], const F32 i_lpDParameter[]);
+
+		/** p[^̕XVJn.
+			_p̂ߏɎs. */
+		ErrorCode BeginUpdateParameter(const F32 i_lpDParameter[], const F32*& o_lpDParameter);
+		/** p[^̈ꕔXV.
+			_p̂ߏɎs. */
+		ErrorCode UpdateParameterRange(F32 io_lpParameter[], const F32 i_lpDParameter[], U64 i_offset, U64 i_count);
+		/** ωʂŝ݂w肵ăp[^XV.
+			_p̂ߏɎs. */
+		ErrorCode UpdateParameterSparse(F32 io_lpParameter[], const F32 i_lpDParameter[], U32 i_rowCount, U32 i_rowSize, const U32 i_lpRowNum[], U32 i_rowNumCount);
+		/** aȍXVŒxĂsSčŐV̏Ԃɂ.
+			XVsȂ߁AxĂs݂͑Ȃ. */
+		ErrorCode ApplyLaggingUpdate(F32 io_lpParameter[]);
+
+	public:
+		//===========================
+		// ۑ
+		//===========================
+		/** C[̕ۑɕKvȃobt@BYTEPʂŎ擾 */
+		U64 GetUseBufferByteCount()const;
+
+		/** C[obt@ɏ.
+			@param o_lpBuffer	ݐobt@̐擪AhX. GetUseBufferByteCount̖߂l̃oCgKv
+			@return ꍇ񂾃obt@TCY.sꍇ͕̒l */
+		S64 WriteToBuffer(BYTE* o_lpBuffer)const;
+	};
+
+
+	/** IveB}CU[XV.قȂ^ꍇ͋IɎw̌^ɕϊ.
+		foCX̃gpȂCPU/GPU. */
+	ErrorCode ChangeOptimizer_Frozen(IOptimizer** io_ppOptimizer, U64 i_parameterCount);
+
+	/** IveB}CUobt@쐬.
+		foCX̃gpȂCPU/GPU. */
+	IOptimizer* CreateOptimizerFromBuffer_Frozen(const BYTE* i_lpBuffer, Gravisbell::S64 i_bufferSize, Gravisbell::S64& o_useBufferSize);
+
+}	// NeuralNetwork
+}	// Layer
+}	// Gravisbell
@@ -0,0 +1,23 @@
+//===============================================
+// ωʏW񃋁[`
+//===============================================
+
+#include"Library/NeuralNetwork/Optimizer.h"
+
+#include<vector>
+
+namespace Gravisbell {
+namespace Layer {
+namespace NeuralNetwork {
+
+	/** ωʂW񂷂.(CPU)
+		SetGradientReducer_CPUŏW񃋁[`ݒ肳ĂȂꍇ͓͂̂܂ܕԂ.
+		@param	i_lpDParameter		W񂷂ω.
+		@param	i_parameterCount	ωʂ̗vf.
+		@param	io_lpReduceBuffer	Wp̍ƃobt@.
+		@param	o_lpDParameter		W̕ωʂ̊i[. */
+	ErrorCode ReduceGradient_CPU(const F32 i_lpDParameter[], U64 i_parameterCount, std::vector<F32>& io_lpReduceBuffer, const F32*& o_lpDParameter);
+
+}	// NeuralNetwork
+}	// Layer
+}	// Gravisbell
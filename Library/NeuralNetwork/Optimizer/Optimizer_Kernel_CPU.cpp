@@ -0,0 +1,382 @@
+//===============================================
+// œK[`CPUZ
+//===============================================
+#include"stdafx.h"
+
+#include<math.h>
+#include<xmmintrin.h>
+#include<algorithm>
+
+#include"Optimizer_Kernel_CPU.h"
+#include"Library/NeuralNetwork/Optimizer.h"
+
+namespace Gravisbell {
+namespace Layer {
+namespace NeuralNetwork {
+
+	namespace
+	{
+		/** xɏvf */
+		static const U64 SIMD_WIDTH = 4;
+
+		/** gptO */
+		static bool g_referenceMode_CPU = false;
+
+		/** ̋t߂.
+			ߎlj[g@1␳. y = y * (1.5 - 0.5 * x * y^2) */
+		inline __m128 RSqrt(__m128 x)
+		{
+			__m128 y = _mm_rsqrt_ps(x);
+			__m128 halfX = _mm_mul_ps(_mm_set1_ps(0.5f), x);
+
+			return _mm_mul_ps(y, _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(halfX, _mm_mul_ps(y, y))));
+		}
+		/** ߂.
+			x * rsqrt(x)ŋ߂. 0̗vf0Ƃ */
+		inline __m128 Sqrt(__m128 x)
+		{
+			__m128 value = _mm_mul_ps(x, RSqrt(x));
+
+			return _mm_and_ps(value, _mm_cmpgt_ps(x, _mm_setzero_ps()));
+		}
+		/** 4vf̑a߂ */
+		inline F32 HorizontalSum(__m128 x)
+		{
+			F32 lpValue[SIMD_WIDTH];
+			_mm_storeu_ps(lpValue, x);
+
+			return (lpValue[0] + lpValue[1]) + (lpValue[2] + lpValue[3]);
+		}
+
+		/** Px̕a{xɉZvf.
+			Pxł̉Zɂ錅}. */
+		static const U64 PARTIAL_SUM_COUNT = 1024;
+	}
+
+	/** gp邩擾 */
+	bool GetReferenceMode_CPU()
+	{
+		return g_referenceMode_CPU;
+	}
+	/** gp邩ݒ肷 */
+	Optimizer_API void SetReferenceMode_CPU(bool i_onReferenceMode)
+	{
+		g_referenceMode_CPU = i_onReferenceMode;
+	}
+
+
+	/** SGDōXV */
+	void UpdateParameterKernel_SGD_CPU(F32 io_lpParameter[], const F32 i_lpDParameter[], U64 i_count, F32 i_learnCoeff)
+	{
+		const __m128 learnCoeff = _mm_set1_ps(i_learnCoeff);
+
+		U64 paramNum = 0;
+		for(; paramNum+SIMD_WIDTH<=i_count; paramNum+=SIMD_WIDTH)
+		{
+			__m128 dParameter = _mm_loadu_ps(&i_lpDParameter[paramNum]);
+			__m128 parameter  = _mm_loadu_ps(&io_lpParameter[paramNum]);
+
+			parameter = _mm_add_ps(parameter, _mm_mul_ps(learnCoeff, dParameter));
+
+			_mm_storeu_ps(&io_lpParameter[paramNum], parameter);
+		}
+		for(; paramNum<i_count; paramNum++)
+		{
+			io_lpParameter[paramNum] += i_learnCoeff * i_lpDParameter[paramNum];
+		}
+	}
+
+	/** MomentumōXV */
+	void UpdateParameterKernel_Momentum_CPU(F32 io_lpParameter[], const F32 i_lpDParameter[], F32 io_lpLastDParameter[], U64 i_count, F32 i_learnCoeff, F32 i_alpha)
+	{
+		const __m128 learnCoeff = _mm_set1_ps(i_learnCoeff);
+		const __m128 alpha      = _mm_set1_ps(i_alpha);
+
+		U64 paramNum = 0;
+		for(; paramNum+SIMD_WIDTH<=i_count; paramNum+=SIMD_WIDTH)
+		{
+			__m128 dParameter     = _mm_loadu_ps(&i_lpDParameter[paramNum]);
+			__m128 lastDParameter = _mm_loadu_ps(&io_lpLastDParameter[paramNum]);
+			__m128 parameter      = _mm_loadu_ps(&io_lpParameter[paramNum]);
+
+			lastDParameter = _mm_add_ps(_mm_mul_ps(alpha, lastDParameter), _mm_mul_ps(learnCoeff, dParameter));
+			parameter = _mm_add_ps(parameter, lastDParameter);
+
+			_mm_storeu_ps(&io_lpLastDParameter[paramNum], lastDParameter);
+			_mm_storeu_ps(&io_lpParameter[paramNum], parameter);
+		}
+		for(; paramNum<i_count; paramNum++)
+		{
+			io_lpLastDParameter[paramNum] = i_alpha * io_lpLastDParameter[paramNum] + i_learnCoeff * i_lpDParameter[paramNum];
+			io_lpParameter[paramNum] += io_lpLastDParameter[paramNum];
+		}
+	}
+
+	/** AdaDeltaōXV */
+	void UpdateParameterKernel_AdaDelta_CPU(F32 io_lpParameter[], const F32 i_lpDParameter[], F32 io_lpParameterH[], F32 io_lpParameterS[], U64 i_count, F32 i_rho, F32 i_epsilon)
+	{
+		const __m128 rho         = _mm_set1_ps(i_rho);
+		const __m128 oneMinusRho = _mm_set1_ps(1.0f - i_rho);
+		const __m128 epsilon     = _mm_set1_ps(i_epsilon);
+
+		U64 paramNum = 0;
+		for(; paramNum+SIMD_WIDTH<=i_count; paramNum+=SIMD_WIDTH)
+		{
+			__m128 dParameter = _mm_loadu_ps(&i_lpDParameter[paramNum]);
+			__m128 parameterH = _mm_loadu_ps(&io_lpParameterH[paramNum]);
+			__m128 parameterS = _mm_loadu_ps(&io_lpParameterS[paramNum]);
+			__m128 parameter  = _mm_loadu_ps(&io_lpParameter[paramNum]);
+
+			// HXV
+			parameterH = _mm_add_ps(_mm_mul_ps(rho, parameterH), _mm_mul_ps(oneMinusRho, _mm_mul_ps(dParameter, dParameter)));
+
+			// VZo. sqrt(S+) / sqrt(H+) = (S+) * rsqrt(S+) * rsqrt(H+). Âɂ0ɂ͂ȂȂ
+			__m128 sEpsilon = _mm_add_ps(parameterS, epsilon);
+			__m128 hEpsilon = _mm_add_ps(parameterH, epsilon);
+			__m128 parameterV = _mm_mul_ps(_mm_mul_ps(sEpsilon, RSqrt(sEpsilon)), _mm_mul_ps(RSqrt(hEpsilon), dParameter));
+
+			// SXV
+			parameterS = _mm_add_ps(_mm_mul_ps(rho, parameterS), _mm_mul_ps(oneMinusRho, _mm_mul_ps(parameterV, parameterV)));
+
+			// dݍXV
+			parameter = _mm_add_ps(parameter, parameterV);
+
+			_mm_storeu_ps(&io_lpParameterH[paramNum], parameterH);
+			_mm_storeu_ps(&io_lpParameterS[paramNum], parameterS);
+			_mm_storeu_ps(&io_lpParameter[paramNum], parameter);
+		}
+		for(; paramNum<i_count; paramNum++)
+		{
+			F32 dParameter = i_lpDParameter[paramNum];
+
+			io_lpParameterH[paramNum] = i_rho * io_lpParameterH[paramNum] + (1.0f - i_rho) * (dParameter * dParameter);
+
+			F32 parameterV = sqrtf(io_lpParameterS[paramNum] + i_epsilon) * dParameter / sqrtf(io_lpParameterH[paramNum] + i_epsilon);
+
+			io_lpParameterS[paramNum] = i_rho * io_lpParameterS[paramNum] + (1.0f - i_rho) * (parameterV * parameterV);
+
+			io_lpParameter[paramNum] += parameterV;
+		}
+	}
+
+	/** AdamōXV */
+	void UpdateParameterKernel_Adam_CPU(F32 io_lpParameter[], const F32 i_lpDParameter[], F32 io_lpParameterM[], F32 io_lpParameterV[], U64 i_count, F32 i_alpha, F32 i_beta1, F32 i_beta2, F32 i_epsilon, F32 i_beta1Pows, F32 i_beta2Pows)
+	{
+		// oCAX␳̌W
+		const F32 correctM = i_alpha / (1.0f - i_beta1Pows);	/**< wKW܂߂M̕␳W */
+		const F32 correctV = 1.0f / (1.0f - i_beta2Pows);		/**< V̕␳W */
+
+		const __m128 beta1          = _mm_set1_ps(i_beta1);
+		const __m128 oneMinusBeta1  = _mm_set1_ps(1.0f - i_beta1);
+		const __m128 beta2          = _mm_set1_ps(i_beta2);
+		const __m128 oneMinusBeta2  = _mm_set1_ps(1.0f - i_beta2);
+		const __m128 epsilon        = _mm_set1_ps(i_epsilon);
+		const __m128 vCorrectM      = _mm_set1_ps(correctM);
+		const __m128 vCorrectV      = _mm_set1_ps(correctV);
+
+		U64 paramNum = 0;
+		for(; paramNum+SIMD_WIDTH<=i_count; paramNum+=SIMD_WIDTH)
+		{
+			__m128 dParameter = _mm_loadu_ps(&i_lpDParameter[paramNum]);
+			__m128 parameterM = _mm_loadu_ps(&io_lpParameterM[paramNum]);
+			__m128 parameterV = _mm_loadu_ps(&io_lpParameterV[paramNum]);
+			__m128 parameter  = _mm_loadu_ps(&io_lpParameter[paramNum]);
+
+			parameterM = _mm_add_ps(_mm_mul_ps(beta1, parameterM), _mm_mul_ps(oneMinusBeta1, dParameter));
+			parameterV = _mm_add_ps(_mm_mul_ps(beta2, parameterV), _mm_mul_ps(oneMinusBeta2, _mm_mul_ps(dParameter, dParameter)));
+
+			__m128 denominator = _mm_add_ps(Sqrt(_mm_mul_ps(vCorrectV, parameterV)), epsilon);
+			parameter = _mm_add_ps(parameter, _mm_div_ps(_mm_mul_ps(vCorrectM, parameterM), denominator));
+
+			_mm_storeu_ps(&io_lpParameterM[paramNum], parameterM);
+			_mm_storeu_ps(&io_lpParameterV[paramNum], parameterV);
+			_mm_storeu_ps(&io_lpParameter[paramNum], parameter);
+		}
+		for(; paramNum<i_count; paramNum++)
+		{
+			F32 dParameter = i_lpDParameter[paramNum];
+
+			io_lpParameterM[paramNum] = i_beta1 * io_lpParameterM[paramNum] + (1.0f - i_beta1) * dParameter;
+			io_lpParameterV[paramNum] = i_beta2 * io_lpParameterV[paramNum] + (1.0f - i_beta2) * dParameter * dParameter;
+
+			io_lpParameter[paramNum] += correctM * io_lpParameterM[paramNum] / (sqrtf(correctV * io_lpParameterV[paramNum]) + i_epsilon);
+		}
+	}
+
+
+	/** 2̔z2a߂ */
+	void SquareSumKernel_CPU(const F32 i_lpA[], const F32 i_lpB[], U64 i_count, F64& o_sumA, F64& o_sumB)
+	{
+		o_sumA = 0.0;
+		o_sumB = 0.0;
+
+		U64 paramNum = 0;
+		while(paramNum+SIMD_WIDTH<=i_count)
+		{
+			__m128 sumA = _mm_setzero_ps();
+			__m128 sumB = _mm_setzero_ps();
+
+			U64 partialEnd = std::min<U64>(paramNum + PARTIAL_SUM_COUNT, i_count);
+			for(; paramNum+SIMD_WIDTH<=partialEnd; paramNum+=SIMD_WIDTH)
+			{
+				__m128 a = _mm_loadu_ps(&i_lpA[paramNum]);
+				__m128 b = _mm_loadu_ps(&i_lpB[paramNum]);
+
+				sumA = _mm_add_ps(sumA, _mm_mul_ps(a, a));
+				sumB = _mm_add_ps(sumB, _mm_mul_ps(b, b));
+			}
+
+			o_sumA += HorizontalSum(sumA);
+			o_sumB += HorizontalSum(sumB);
+		}
+		for(; paramNum<i_count; paramNum++)
+		{
+			o_sumA += i_lpA[paramNum] * i_lpA[paramNum];
+			o_sumB += i_lpB[paramNum] * i_lpB[paramNum];
+		}
+	}
+
+	/** LARSōXV */
+	void UpdateParameterKernel_LARS_CPU(F32 io_lpParameter[], const F32 i_lpDParameter[], F32 io_lpLastDParameter[], U64 i_count, F32 i_learnCoeff, F32 i_alpha, F32 i_weightDecay)
+	{
+		const __m128 learnCoeff  = _mm_set1_ps(i_learnCoeff);
+		const __m128 alpha       = _mm_set1_ps(i_alpha);
+		const __m128 weightDecay = _mm_set1_ps(i_weightDecay);
+
+		U64 paramNum = 0;
+		for(; paramNum+SIMD_WIDTH<=i_count; paramNum+=SIMD_WIDTH)
+		{
+			__m128 dParameter     = _mm_loadu_ps(&i_lpDParameter[paramNum]);
+			__m128 lastDParameter = _mm_loadu_ps(&io_lpLastDParameter[paramNum]);
+			__m128 parameter      = _mm_loadu_ps(&io_lpParameter[paramNum]);
+
+			dParameter = _mm_sub_ps(dParameter, _mm_mul_ps(weightDecay, parameter));
+			lastDParameter = _mm_add_ps(_mm_mul_ps(alpha, lastDParameter), _mm_mul_ps(learnCoeff, dParameter));
+			parameter = _mm_add_ps(parameter, lastDParameter);
+
+			_mm_storeu_ps(&io_lpLastDParameter[paramNum], lastDParameter);
+			_mm_storeu_ps(&io_lpParameter[paramNum], parameter);
+		}
+		for(; paramNum<i_count; paramNum++)
+		{
+			F32 dParameter = i_lpDParameter[paramNum] - i_weightDecay * io_lpParameter[paramNum];
+
+			io_lpLastDParameter[paramNum] = i_alpha * io_lpLastDParameter[paramNum] + i_learnCoeff * dParameter;
+			io_lpParameter[paramNum] += io_lpLastDParameter[paramNum];
+		}
+	}
+
+	/** LAMBM,VXVAp[^ƍXVʂ2a߂ */
+	void UpdateMomentKernel_LAMB_CPU(const F32 i_lpParameter[], const F32 i_lpDParameter[], F32 io_lpParameterM[], F32 io_lpParameterV[], U64 i_count, F32 i_beta1, F32 i_beta2, F32 i_epsilon, F32 i_weightDecay, F32 i_beta1Pows, F32 i_beta2Pows, F64& o_sumParameter, F64& o_sumUpdate)
+	{
+		// oCAX␳̌W
+		const F32 correctM = 1.0f / (1.0f - i_beta1Pows);
+		const F32 correctV = 1.0f / (1.0f - i_beta2Pows);
+
+		const __m128 beta1         = _mm_set1_ps(i_beta1);
+		const __m128 oneMinusBeta1 = _mm_set1_ps(1.0f - i_beta1);
+		const __m128 beta2         = _mm_set1_ps(i_beta2);
+		const __m128 oneMinusBeta2 = _mm_set1_ps(1.0f - i_beta2);
+		const __m128 epsilon       = _mm_set1_ps(i_epsilon);
+		const __m128 weightDecay   = _mm_set1_ps(i_weightDecay);
+		const __m128 vCorrectM     = _mm_set1_ps(correctM);
+		const __m128 vCorrectV     = _mm_set1_ps(correctV);
+
+		o_sumParameter = 0.0;
+		o_sumUpdate    = 0.0;
+
+		U64 paramNum = 0;
+		while(paramNum+SIMD_WIDTH<=i_count)
+		{
+			__m128 sumParameter = _mm_setzero_ps();
+			__m128 sumUpdate    = _mm_setzero_ps();
+
+			U64 partialEnd = std::min<U64>(paramNum + PARTIAL_SUM_COUNT, i_count);
+			for(; paramNum+SIMD_WIDTH<=partialEnd; paramNum+=SIMD_WIDTH)
+			{
+				__m128 dParameter = _mm_loadu_ps(&i_lpDParameter[paramNum]);
+				__m128 parameterM = _mm_loadu_ps(&io_lpParameterM[paramNum]);
+				__m128 parameterV = _mm_loadu_ps(&io_lpParameterV[paramNum]);
+				__m128 parameter  = _mm_loadu_ps(&i_lpParameter[paramNum]);
+
+				parameterM = _mm_add_ps(_mm_mul_ps(beta1, parameterM), _mm_mul_ps(oneMinusBeta1, dParameter));
+				parameterV = _mm_add_ps(_mm_mul_ps(beta2, parameterV), _mm_mul_ps(oneMinusBeta2, _mm_mul_ps(dParameter, dParameter)));
+
+				__m128 denominator = _mm_add_ps(Sqrt(_mm_mul_ps(vCorrectV, parameterV)), epsilon);
+				__m128 update = _mm_sub_ps(_mm_div_ps(_mm_mul_ps(vCorrectM, parameterM), denominator), _mm_mul_ps(weightDecay, parameter));
+
+				sumParameter = _mm_add_ps(sumParameter, _mm_mul_ps(parameter, parameter));
+				sumUpdate    = _mm_add_ps(sumUpdate,    _mm_mul_ps(update, update));
+
+				_mm_storeu_ps(&io_lpParameterM[paramNum], parameterM);
+				_mm_storeu_ps(&io_lpParameterV[paramNum], parameterV);
+			}
+
+			o_sumParameter += HorizontalSum(sumParameter);
+			o_sumUpdate    += HorizontalSum(sumUpdate);
+		}
+		for(; paramNum<i_count; paramNum++)
+		{
+			F32 dParameter = i_lpDParameter[paramNum];
+
+			io_lpParameterM[paramNum] = i_beta1 * io_lpParameterM[paramNum] + (1.0f - i_beta1) * dParameter;
+			io_lpParameterV[paramNum] = i_beta2 * io_lpParameterV[paramNum] + (1.0f - i_beta2) * dParameter * dParameter;
+
+			F32 update = correctM * io_lpParameterM[paramNum] / (sqrtf(correctV * io_lpParameterV[paramNum]) + i_epsilon) - i_weightDecay * i_lpParameter[paramNum];
+
+			o_sumParameter += i_lpParameter[paramNum] * i_lpParameter[paramNum];
+			o_sumUpdate    += update * update;
+		}
+	}
+	/** LAMBōXV */
+	void UpdateParameterKernel_LAMB_CPU(F32 io_lpParameter[], const F32 i_lpParameterM[], const F32 i_lpParameterV[], U64 i_count, F32 i_learnCoeff, F32 i_epsilon, F32 i_weightDecay, F32 i_beta1Pows, F32 i_beta2Pows)
+	{
+		// oCAX␳̌W
+		const F32 correctM = 1.0f / (1.0f - i_beta1Pows);
+		const F32 correctV = 1.0f / (1.0f - i_beta2Pows);
+
+		const __m128 learnCoeff  = _mm_set1_ps(i_learnCoeff);
+		const __m128 epsilon     = _mm_set1_ps(i_epsilon);
+		const __m128 weightDecay = _mm_set1_ps(i_weightDecay);
+		const __m128 vCorrectM   = _mm_set1_ps(correctM);
+		const __m128 vCorrectV   = _mm_set1_ps(correctV);
+
+		U64 paramNum = 0;
+		for(; paramNum+SIMD_WIDTH<=i_count; paramNum+=SIMD_WIDTH)
+		{
+			__m128 parameterM = _mm_loadu_ps(&i_lpParameterM[paramNum]);
+			__m128 parameterV = _mm_loadu_ps(&i_lpParameterV[paramNum]);
+			__m128 parameter  = _mm_loadu_ps(&io_lpParameter[paramNum]);
+
+			__m128 denominator = _mm_add_ps(Sqrt(_mm_mul_ps(vCorrectV, parameterV)), epsilon);
+			__m128 update = _mm_sub_ps(_mm_div_ps(_mm_mul_ps(vCorrectM, parameterM), denominator), _mm_mul_ps(weightDecay, parameter));
+
+			parameter = _mm_add_ps(parameter, _mm_mul_ps(learnCoeff, update));
+
+			_mm_storeu_ps(&io_lpParameter[paramNum], parameter);
+		}
+		for(; paramNum<i_count; paramNum++)
+		{
+			F32 update = correctM * i_lpParameterM[paramNum] / (sqrtf(correctV * i_lpParameterV[paramNum]) + i_epsilon) - i_weightDecay * io_lpParameter[paramNum];
+
+			io_lpParameter[paramNum] += i_learnCoeff * update;
+		}
+	}
+
+
+	/** kx̓ԂPxɓWJ. */
+	void DecodeOptimizerState_CPU(const U16 i_lpState[], F32 o_lpValue[], U64 i_count, OptimizerStateType i_stateType)
+	{
+		for(U64 paramNum=0; paramNum<i_count; paramNum++)
+			o_lpValue[paramNum] = ConvertOptimizerStateToF32(i_lpState[paramNum], i_stateType);
+	}
+	/** Px̒lkx̓ԂɊmIۂ߂Ŋi[. */
+	void EncodeOptimizerState_CPU(const F32 i_lpValue[], U16 o_lpState[], U64 i_count, OptimizerStateType i_stateType, U64 i_offset, U32 i_seed)
+	{
+		for(U64 paramNum=0; paramNum<i_count; paramNum++)
+			o_lpState[paramNum] = ConvertF32ToOptimizerState(i_lpValue[paramNum], i_stateType, GetOptimizerStateNoise(i_offset + paramNum, i_seed));
+	}
+
+}	// NeuralNetwork
+}	// Layer
+}	// Gravisbell
@@ -0,0 +1,87 @@
+//===============================================
+// œK[`CPUZ
+// SSE4vfA[͒
+//===============================================
+#ifndef __GRAVISBELL_NN_OPTIMIZER_KERNEL_CPU_H__
+#define __GRAVISBELL_NN_OPTIMIZER_KERNEL_CPU_H__
+
+#include"Layer/NeuralNetwork/IOptimizer.h"
+#include"Optimizer_StateType.h"
+
+namespace Gravisbell {
+namespace Layer {
+namespace NeuralNetwork {
+
+	/** gp邩擾.
+		LȏꍇAeIveB}CU͏]̒vZōXVAʂ̓rbgPʂŏ]ƈv. */
+	bool GetReferenceMode_CPU();
+
+	/** SGDōXV.
+		param += learnCoeff * d */
+	void UpdateParameterKernel_SGD_CPU(F32 io_lpParameter[], const F32 i_lpDParameter[], U64 i_count, F32 i_learnCoeff);
+
+	/** MomentumōXV.
+		lastD = alpha * lastD + learnCoeff * d
+		param += lastD */
+	void UpdateParameterKernel_Momentum_CPU(F32 io_lpParameter[], const F32 i_lpDParameter[], F32 io_lpLastDParameter[], U64 i_count, F32 i_learnCoeff, F32 i_alpha);
+
+	/** AdaDeltaōXV.
+		H = rho * H + (1-rho) * d^2
+		V = sqrt(S+epsilon) / sqrt(H+epsilon) * d
+		S = rho * S + (1-rho) * V^2
+		param += V
+		rsqrt̋ߎlj[g@1␳ċ߂. */
+	void UpdateParameterKernel_AdaDelta_CPU(F32 io_lpParameter[], const F32 i_lpDParameter[], F32 io_lpParameterH[], F32 io_lpParameterS[], U64 i_count, F32 i_rho, F32 i_epsilon);
+
+	/** AdamōXV.
+		M = beta1 * M + (1-beta1) * d
+		V = beta2 * V + (1-beta2) * d^2
+		param += alpha * (M / (1-beta1^t)) / (sqrt(V / (1-beta2^t)) + epsilon)
+		oCAX␳̌W͗vfƂɌvZAOɋ߂.
+		rsqrt̋ߎlj[g@1␳ċ߂.
+		@param	i_beta1Pows	beta1^t. XVς݂̒l.
+		@param	i_beta2Pows	beta2^t. XVς݂̒l. */
+	void UpdateParameterKernel_Adam_CPU(F32 io_lpParameter[], const F32 i_lpDParameter[], F32 io_lpParameterM[], F32 io_lpParameterV[], U64 i_count, F32 i_alpha, F32 i_beta1, F32 i_beta2, F32 i_epsilon, F32 i_beta1Pows, F32 i_beta2Pows);
+
+	/** 2̔z2a߂.
+		4vfƂ̕a͈̗vfƂɔ{xɉZ.
+		@param	o_sumA	a2a.
+		@param	o_sumB	b2a. */
+	void SquareSumKernel_CPU(const F32 i_lpA[], const F32 i_lpB[], U64 i_count, F64& o_sumA, F64& o_sumB);
+
+	/** LARSōXV.
+		lastD = alpha * lastD + learnCoeff * (d - weightDecay * param)
+		param += lastD
+		@param	i_learnCoeff	M悶wKW. */
+	void UpdateParameterKernel_LARS_CPU(F32 io_lpParameter[], const F32 i_lpDParameter[], F32 io_lpLastDParameter[], U64 i_count, F32 i_learnCoeff, F32 i_alpha, F32 i_weightDecay);
+
+	/** LAMBM,VXVAp[^ƍXVʂ2a߂.
+		M = beta1 * M + (1-beta1) * d
+		V = beta2 * V + (1-beta2) * d^2
+		u = (M / (1-beta1^t)) / (sqrt(V / (1-beta2^t)) + epsilon) - weightDecay * param
+		@param	o_sumParameter	p[^2a.
+		@param	o_sumUpdate		XVu2a. */
+	void UpdateMomentKernel_LAMB_CPU(const F32 i_lpParameter[], const F32 i_lpDParameter[], F32 io_lpParameterM[], F32 io_lpParameterV[], U64 i_count, F32 i_beta1, F32 i_beta2, F32 i_epsilon, F32 i_weightDecay, F32 i_beta1Pows, F32 i_beta2Pows, F64& o_sumParameter, F64& o_sumUpdate);
+	/** LAMBōXV.
+		XVς݂M,VXVuߒĔf.
+		param += learnCoeff * u
+		@param	i_learnCoeff	M悶wKW. */
+	void UpdateParameterKernel_LAMB_CPU(F32 io_lpParameter[], const F32 i_lpParameterM[], const F32 i_lpParameterV[], U64 i_count, F32 i_learnCoeff, F32 i_epsilon, F32 i_weightDecay, F32 i_beta1Pows, F32 i_beta2Pows);
+
+
+	/** kx̓ԂPxɓWJۂ̋Ԃ̗vf.
+		WJ̓X^bNɊmۂ邽߁AL1LbVɎ܂傫Ƃ. */
+	static const U64 OPTIMIZER_STATE_BLOCK_SIZE = 256;
+
+	/** kx̓ԂPxɓWJ. */
+	void DecodeOptimizerState_CPU(const U16 i_lpState[], F32 o_lpValue[], U64 i_count, OptimizerStateType i_stateType);
+	/** Px̒lkx̓ԂɊmIۂ߂Ŋi[.
+		@param	i_offset	擪vf̃p[^Ŝł̈ʒu. ̎ZoɎgp.
+		@param	i_seed		mIۂ߂̗̎. */
+	void EncodeOptimizerState_CPU(const F32 i_lpValue[], U16 o_lpState[], U64 i_count, OptimizerStateType i_stateType, U64 i_offset, U32 i_seed);
+
+}	// NeuralNetwork
+}	// Layer
+}	// Gravisbell
+
+#endif	// __GRAVISBELL_NN_OPTIMIZER_KERNEL_CPU_H__
@@ -0,0 +1,266 @@
+//===============================================
+// œK[`(LAMB)
+//===============================================
+#include"stdafx.h"
+
+#include<math.h>
+#include<vector>
+
+#include"Optimizer_LAMB_base.h"
+#include"Optimizer_LayerWise.h"
+#include"Optimizer_GradientReducer.h"
+#include"Optimizer_Kernel_CPU.h"
+#include"Library/NeuralNetwork/Optimizer.h"
+
+namespace Gravisbell {
+namespace Layer {
+namespace NeuralNetwork {
+
+	class Optimizer_LAMB_CPU : public Optimizer_LAMB_base, public IOptimizer_LayerWise
+	{
+	public:
+		std::vector<F32> lpParameterM;
+		std::vector<F32> lpParameterV;
+
+		F32 m_beta1Pows;	/**< 1̊Kl */
+		F32 m_beta2Pows;	/**< 2̊Kl */
+
+	private:
+		std::vector<F32> lpReduceBuffer;	/**< ωʏWp̍ƃobt@ */
+
+		OptimizerNormAccumulator m_norm;	/**< p[^ƍXVʂ2ȁWv */
+		F32 m_trustRatio;					/**< ̍XV̐M */
+
+	public:
+		/** RXgN^ */
+		Optimizer_LAMB_CPU(U64 i_parameterCount)
+			:	Optimizer_LAMB_base	(i_parameterCount)
+			,	m_beta1Pows			(1.0f)	/**< 1̊Kl */
+			,	m_beta2Pows			(1.0f)	/**< 2̊Kl */
+			,	m_trustRatio		(1.0f)
+		{
+			this->lpParameterM.resize(this->m_parameterCount, 0.0f);
+			this->lpParameterV.resize(this->m_parameterCount, 0.0f);
+		}
+		/** fXgN^ */
+		virtual ~Optimizer_LAMB_CPU()
+		{
+		}
+
+	public:
+		//===========================
+		// 
+		//===========================
+		/** p[^XV.
+			@param io_lpParamter	XVp[^.
+			@param io_lpDParameter	p[^̕ω. */
+		ErrorCode UpdateParameter(F32 io_lpParameter[], const F32 i_lpDParameter[])
+		{
+			// vfꍇ͔͈͂𕪊ĕXbhōXV
+			OptimizerUpdateTarget target = {this, io_lpParameter, i_lpDParameter};
+			return UpdateParameterMulti_CPU(&target, 1);
+		}
+
+		/** p[^̕XVJn.
+			@param	i_lpDParameter	p[^̕ω.
+			@param	o_lpDParameter	UpdateParameterRangeɓnωʂ̊i[. */
+		ErrorCode BeginUpdateParameter(const F32 i_lpDParameter[], const F32*& o_lpDParameter)
+		{
+			// ωʂW
+			ErrorCode err = ReduceGradient_CPU(i_lpDParameter, this->m_parameterCount, this->lpReduceBuffer, o_lpDParameter);
+			if(err != ErrorCode::ERROR_CODE_NONE)
+				return err;
+
+			this->m_beta1Pows *= this->m_beta1;
+			this->m_beta2Pows *= this->m_beta2;
+
+			this->m_norm.Reset();
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+		/** p[^̈ꕔɂM,VXVAm̕a߂.
+			@param	i_lpParamter	XVp[^̐擪.
+			@param	i_lpDParameter	BeginUpdateParameterŎ擾ωʂ̐擪.
+			@param	i_offset		͈͂̊Jnʒu.
+			@param	i_count			͈̗͂vf. */
+		ErrorCode PrepareParameterRange(const F32 i_lpParameter[], const F32 i_lpDParameter[], U64 i_offset, U64 i_count)
+		{
+			F64 sumParameter = 0.0;
+			F64 sumUpdate    = 0.0;
+
+			if(!GetReferenceMode_CPU())
+			{
+				UpdateMomentKernel_LAMB_CPU(
+					&i_lpParameter[i_offset], &i_lpDParameter[i_offset], &this->lpParameterM[i_offset], &this->lpParameterV[i_offset], i_count,
+					this->m_beta1, this->m_beta2, this->m_epsilon, this->m_weightDecay, this->m_beta1Pows, this->m_beta2Pows,
+					sumParameter, sumUpdate);
+			}
+			else
+			{
+				for(U64 paramNum=i_offset; paramNum<i_offset+i_count; paramNum++)
+				{
+					this->lpParameterM[paramNum] = this->m_beta1 * this->lpParameterM[paramNum] + (1.0f - this->m_beta1) * i_lpDParameter[paramNum];
+					this->lpParameterV[paramNum] = this->m_beta2 * this->lpParameterV[paramNum] + (1.0f - this->m_beta2) * i_lpDParameter[paramNum] * i_lpDParameter[paramNum];
+
+					F32 update = this->CalculateUpdate(i_lpParameter[paramNum], this->lpParameterM[paramNum], this->lpParameterV[paramNum]);
+
+					sumParameter += i_lpParameter[paramNum] * i_lpParameter[paramNum];
+					sumUpdate    += update * update;
+				}
+			}
+
+			this->m_norm.AddPartialSum(i_offset, sumParameter, sumUpdate);
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+		/** m̕aWvAMm肷.
+			M = |param| / |update|. */
+		ErrorCode EndPrepareParameter()
+		{
+			this->m_norm.Complete();
+
+			this->m_trustRatio = GetOptimizerTrustRatio(sqrt(this->m_norm.GetSum(0)), sqrt(this->m_norm.GetSum(1)));
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+		/** p[^̈ꕔXV.
+			M䂪m肵ĂȂꍇ͑S͈͂̍XV̂ݎ󂯕tȀŃmWv.
+			@param	io_lpParamter	XVp[^̐擪.
+			@param	i_lpDParameter	BeginUpdateParameterŎ擾ωʂ̐擪.
+			@param	i_offset		XV͈͂̊Jnʒu.
+			@param	i_count			XV͈̗͂vf. */
+		ErrorCode UpdateParameterRange(F32 io_lpParameter[], const F32 i_lpDParameter[], U64 i_offset, U64 i_count)
+		{
+			if(!this->m_norm.IsCompleted())
+			{
+				if(i_offset != 0 || i_count != this->m_parameterCount)
+					return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+
+				this->PrepareParameterRange(io_lpParameter, i_lpDParameter, 0, this->m_parameterCount);
+				this->EndPrepareParameter();
+			}
+
+			const F32 learnCoeff = this->m_alpha * this->m_trustRatio;
+
+			if(!GetReferenceMode_CPU())
+			{
+				UpdateParameterKernel_LAMB_CPU(
+					&io_lpParameter[i_offset], &this->lpParameterM[i_offset], &this->lpParameterV[i_offset], i_count,
+					learnCoeff, this->m_epsilon, this->m_weightDecay, this->m_beta1Pows, this->m_beta2Pows);
+
+				return ErrorCode::ERROR_CODE_NONE;
+			}
+
+			for(U64 paramNum=i_offset; paramNum<i_offset+i_count; paramNum++)
+			{
+				io_lpParameter[paramNum] += learnCoeff * this->CalculateUpdate(io_lpParameter[paramNum], this->lpParameterM[paramNum], this->lpParameterV[paramNum]);
+			}
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+
+		/** ωʂŝ݂w肵ăp[^XV.
+			M̓p[^Ŝ̃m狁߂邽ߑŜXV. */
+		ErrorCode UpdateParameterSparse(F32 io_lpParameter[], const F32 i_lpDParameter[], U32 i_rowCount, U32 i_rowSize, const U32 i_lpRowNum[], U32 i_rowNumCount)
+		{
+			return this->UpdateParameter(io_lpParameter, i_lpDParameter);
+		}
+		/** aȍXVŒxĂsSčŐV̏Ԃɂ.
+			ɑŜXV邽߁AxĂs݂͑Ȃ. */
+		ErrorCode ApplyLaggingUpdate(F32 io_lpParameter[])
+		{
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+
+	private:
+		/** M悶O̍XVʂ߂.
+			update = M' / (sqrt(V') + epsilon) - weightDecay * param */
+		F32 CalculateUpdate(F32 i_parameter, F32 i_parameterM, F32 i_parameterV)const
+		{
+			F32 tmpM = i_parameterM / (1.0f - this->m_beta1Pows);
+			F32 tmpV = i_parameterV / (1.0f - this->m_beta2Pows);
+
+			return tmpM / (sqrt(tmpV) + this->m_epsilon) - this->m_weightDecay * i_parameter;
+		}
+
+	public:
+		//===========================
+		// ۑ
+		//===========================
+		/** C[obt@ɏ.
+			@param o_lpBuffer	ݐobt@̐擪AhX. GetUseBufferByteCount̖߂l̃oCgKv
+			@return ꍇ񂾃obt@TCY.sꍇ͕̒l */
+		S64 WriteToBuffer(BYTE* o_lpBuffer)const
+		{
+			U64 writePos = WriteToBufferBase(o_lpBuffer);
+
+			// M
+			memcpy(&o_lpBuffer[writePos], &this->lpParameterM[0], sizeof(F32)*this->m_parameterCount);
+			writePos += sizeof(F32)*this->m_parameterCount;
+			// V
+			memcpy(&o_lpBuffer[writePos], &this->lpParameterV[0], sizeof(F32)*this->m_parameterCount);
+			writePos += sizeof(F32)*this->m_parameterCount;
+
+			// beta1^n
+			memcpy(&o_lpBuffer[writePos], &this->m_beta1Pows, sizeof(F32));
+			writePos += sizeof(F32);
+			// beta2^n
+			memcpy(&o_lpBuffer[writePos], &this->m_beta2Pows, sizeof(F32));
+			writePos += sizeof(F32);
+
+			return writePos;
+		}
+	};
+
+	/** IveB}CU쐬 */
+	Optimizer_LAMB_base* CreateOptimizer_LAMB_CPU(U64 i_parameterCount)
+	{
+		return new Optimizer_LAMB_CPU(i_parameterCount);
+	}
+	/** IveB}CUobt@쐬 */
+	IOptimizer* CreateOptimizerFromBuffer_LAMB_CPU(const BYTE* i_lpBuffer, Gravisbell::S64 i_bufferSize, Gravisbell::S64& o_useBufferSize)
+	{
+		Optimizer_LAMB_base* pOptimizer = CreateOptimizerFromBuffer_LAMB(i_lpBuffer, i_bufferSize, o_useBufferSize, CreateOptimizer_LAMB_CPU);
+		if(pOptimizer == NULL)
+			return NULL;
+		Optimizer_LAMB_CPU* pOptimizerCPU = dynamic_cast<Optimizer_LAMB_CPU*>(pOptimizer);
+		if(pOptimizerCPU == NULL)
+		{
+			delete pOptimizer;
+			return NULL;
+		}
+
+		// M
+		memcpy(&pOptimizerCPU->lpParameterM[0], &i_lpBuffer[o_useBufferSize], sizeof(F32)*pOptimizerCPU->lpParameterM.size());
+		o_useBufferSize += sizeof(F32)*pOptimizerCPU->lpParameterM.size();
+		// V
+		memcpy(&pOptimizerCPU->lpParameterV[0], &i_lpBuffer[o_useBufferSize], sizeof(F32)*pOptimizerCPU->lpParameterV.size());
+		o_useBufferSize += sizeof(F32)*pOptimizerCPU->lpParameterV.size();
+
+		// beta1^n
+		memcpy(&pOptimizerCPU->m_beta1Pows, &i_lpBuffer[o_useBufferSize], sizeof(F32));
+		o_useBufferSize += sizeof(F32);
+		// beta2^n
+		memcpy(&pOptimizerCPU->m_beta2Pows, &i_lpBuffer[o_useBufferSize], sizeof(F32));
+		o_useBufferSize += sizeof(F32);
+
+		return pOptimizer;
+	}
+	/** IveB}CU[XV.قȂ^ꍇ͋IɎw̌^ɕϊ. */
+	ErrorCode ChangeOptimizer_LAMB_CPU(IOptimizer** io_ppOptimizer, U64 i_parameterCount)
+	{
+		Optimizer_LAMB_CPU* pOptimizer = dynamic_cast<Optimizer_LAMB_CPU*>(*io_ppOptimizer);
+		if(pOptimizer == NULL)
+		{
+			if(*io_ppOptimizer)
+				delete *io_ppOptimizer;
+
+			*io_ppOptimizer = CreateOptimizer_LAMB_CPU(i_parameterCount);
+		}
+
+		return ErrorCode::ERROR_CODE_NONE;
+	}
+
+}	// NeuralNetwork
+}	// Layer
+}	// Gravisbell
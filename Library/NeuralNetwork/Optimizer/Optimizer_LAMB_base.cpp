@@ -0,0 +1,238 @@
+//===============================================
+// œK[`(LAMB)
+//===============================================
+#include"stdafx.h"
+
+#include"Optimizer_LAMB_base.h"
+
+namespace Gravisbell {
+namespace Layer {
+namespace NeuralNetwork {
+
+	const std::wstring Optimizer_LAMB_base::OPTIMIZER_ID = L"LAMB";
+
+	/** RXgN^ */
+	Optimizer_LAMB_base::Optimizer_LAMB_base(U64 i_parameterCount)
+		:	m_parameterCount	(i_parameterCount)
+
+		,	m_alpha			(0.001f)	/**< . */
+		,	m_beta1			(0.9f)		/**< . */
+		,	m_beta2			(0.999f)	/**< . */
+		,	m_epsilon		(1e-6f)		/**< ⏕W. */
+		,	m_weightDecay	(0.0f)		/**< d݌̌W */
+	{
+	}
+	/** fXgN^ */
+	Optimizer_LAMB_base::~Optimizer_LAMB_base()
+	{
+	}
+
+
+	//===========================
+	// {
+	//===========================
+	/** ID̎擾 */
+	const wchar_t* Optimizer_LAMB_base::GetOptimizerID()const
+	{
+		return OPTIMIZER_ID.c_str();
+	}
+
+	/** p[^擾 */
+	U64 Optimizer_LAMB_base::GetParameterCount()const
+	{
+		return this->m_parameterCount;
+	}
+
+	/** nCp[p[^ݒ肷
+		@param	i_parameterID	p[^ʗpID
+		@param	i_value			p[^. */
+	ErrorCode Optimizer_LAMB_base::SetHyperParameter(const wchar_t i_parameterID[], F32 i_value)
+	{
+		std::wstring parameter = i_parameterID;
+		if(parameter == L"alpha")
+		{
+			this->m_alpha = i_value;
+		}
+		else if(parameter == L"beta1")
+		{
+			this->m_beta1 = i_value;
+		}
+		else if(parameter == L"beta2")
+		{
+			this->m_beta2 = i_value;
+		}
+		else if(parameter == L"epsilon")
+		{
+			this->m_epsilon = i_value;
+		}
+		else if(parameter == L"WeightDecay")
+		{
+			this->m_weightDecay = i_value;
+		}
+		else
+		{
+			return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+		}
+
+		return ErrorCode::ERROR_CODE_NONE;
+	}
+	/** nCp[p[^ݒ肷
+		@param	i_parameterID	p[^ʗpID
+		@param	i_value			p[^. */
+	ErrorCode Optimizer_LAMB_base::SetHyperParameter(const wchar_t i_parameterID[], S32 i_value)
+	{
+		return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+	}
+	/** nCp[p[^ݒ肷
+		@param	i_parameterID	p[^ʗpID
+		@param	i_value			p[^. */
+	ErrorCode Optimizer_LAMB_base::SetHyperParameter(const wchar_t i_parameterID[], const wchar_t i_value[])
+	{
+		return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+	}
+
+
+	//===========================
+	// ۑ
+	//===========================
+	/** C[̕ۑɕKvȃobt@BYTEPʂŎ擾 */
+	U64 Optimizer_LAMB_base::GetUseBufferByteCount()const
+	{
+		U64 useBufferByte = 0;
+
+		// gpoCgi[
+		useBufferByte += sizeof(U64);
+
+		// IDobt@TCY
+		useBufferByte += sizeof(U32);
+
+		// IDobt@
+		useBufferByte += sizeof(wchar_t) * OPTIMIZER_ID.size();
+
+		// p[^
+		useBufferByte += sizeof(this->m_parameterCount);
+
+		// 
+		useBufferByte += sizeof(this->m_alpha);
+		// 
+		useBufferByte += sizeof(this->m_beta1);
+		// 
+		useBufferByte += sizeof(this->m_beta2);
+		// ⏕W
+		useBufferByte += sizeof(this->m_epsilon);
+		// d݌̌W
+		useBufferByte += sizeof(this->m_weightDecay);
+
+		// M
+		useBufferByte += sizeof(F32) * this->m_parameterCount;
+		// V
+		useBufferByte += sizeof(F32) * this->m_parameterCount;
+		// beta1^n
+		useBufferByte += sizeof(F32);
+		// beta2^n
+		useBufferByte += sizeof(F32);
+
+		return useBufferByte;
+	}
+
+	/** C[obt@ɏ.
+		@param o_lpBuffer	ݐobt@̐擪AhX. GetUseBufferByteCount̖߂l̃oCgKv
+		@return ꍇ񂾃obt@TCY.sꍇ͕̒l */
+	S64 Optimizer_LAMB_base::WriteToBufferBase(BYTE* o_lpBuffer)const
+	{
+		U32 writePos = 0;
+
+		// gpoCg
+		U64 userBufferByte = this->GetUseBufferByteCount();
+		memcpy(&o_lpBuffer[writePos], &userBufferByte, sizeof(userBufferByte));
+		writePos += sizeof(userBufferByte);
+
+		// IDobt@TCY
+		U32 idBufferSize = sizeof(wchar_t) * OPTIMIZER_ID.size();
+		memcpy(&o_lpBuffer[writePos], &idBufferSize, sizeof(idBufferSize));
+		writePos += sizeof(idBufferSize);
+
+		// IDobt@
+		memcpy(&o_lpBuffer[writePos], (const BYTE*)OPTIMIZER_ID.c_str(), idBufferSize);
+		writePos += idBufferSize;
+
+		// p[^
+		memcpy(&o_lpBuffer[writePos], &this->m_parameterCount, sizeof(this->m_parameterCount));
+		writePos+= sizeof(this->m_parameterCount);
+
+
+		// 
+		memcpy(&o_lpBuffer[writePos], &this->m_alpha, sizeof(this->m_alpha));
+		writePos+= sizeof(this->m_alpha);
+		// 
+		memcpy(&o_lpBuffer[writePos], &this->m_beta1, sizeof(this->m_beta1));
+		writePos+= sizeof(this->m_beta1);
+		// 
+		memcpy(&o_lpBuffer[writePos], &this->m_beta2, sizeof(this->m_beta2));
+		writePos+= sizeof(this->m_beta2);
+		// ⏕W
+		memcpy(&o_lpBuffer[writePos], &this->m_epsilon, sizeof(this->m_epsilon));
+		writePos+= sizeof(this->m_epsilon);
+		// d݌̌W
+		memcpy(&o_lpBuffer[writePos], &this->m_weightDecay, sizeof(this->m_weightDecay));
+		writePos+= sizeof(this->m_weightDecay);
+
+
+		return writePos;
+	}
+
+	/** obt@쐬 */
+	Optimizer_LAMB_base* CreateOptimizerFromBuffer_LAMB(const BYTE* i_lpBuffer, Gravisbell::S64 i_bufferSize, Gravisbell::S64& o_useBufferSize, Optimizer_LAMB_base* (*CreateOptimizer_LAMB)(U64) )
+	{
+		o_useBufferSize = -1;
+		U64 readBufferPos = 0;
+
+		// gpobt@, ID͓ǂݎς
+
+		// p[^
+		U64 parameterCount = 0;
+		memcpy(&parameterCount, &i_lpBuffer[readBufferPos], sizeof(parameterCount));
+		readBufferPos += sizeof(parameterCount);
+
+		// 쐬
+		Optimizer_LAMB_base* pOptimizer = CreateOptimizer_LAMB(parameterCount);
+		if(pOptimizer == NULL)
+			return NULL;
+
+
+		// 
+		F32 alpha = 0.0f;
+		memcpy(&alpha, &i_lpBuffer[readBufferPos], sizeof(alpha));
+		readBufferPos += sizeof(alpha);
+		pOptimizer->SetHyperParameter(L"alpha", alpha);
+		// 
+		F32 beta1 = 0.0f;
+		memcpy(&beta1, &i_lpBuffer[readBufferPos], sizeof(beta1));
+		readBufferPos += sizeof(beta1);
+		pOptimizer->SetHyperParameter(L"beta1", beta1);
+		// 
+		F32 beta2 = 0.0f;
+		memcpy(&beta2, &i_lpBuffer[readBufferPos], sizeof(beta2));
+		readBufferPos += sizeof(beta2);
+		pOptimizer->SetHyperParameter(L"beta2", beta2);
+		// ⏕W
+		F32 epsilon = 0.0f;
+		memcpy(&epsilon, &i_lpBuffer[readBufferPos], sizeof(epsilon));
+		readBufferPos += sizeof(epsilon);
+		pOptimizer->SetHyperParameter(L"epsilon", epsilon);
+		// d݌̌W
+		F32 weightDecay = 0.0f;
+		memcpy(&weightDecay, &i_lpBuffer[readBufferPos], sizeof(weightDecay));
+		readBufferPos += sizeof(weightDecay);
+		pOptimizer->SetHyperParameter(L"WeightDecay", weightDecay);
+
+
+		// gpobt@ۑ
+		o_useBufferSize = readBufferPos;
+
+		return pOptimizer;
+	}
+
+}	// NeuralNetwork
+}	// Layer
+}	// Gravisbell
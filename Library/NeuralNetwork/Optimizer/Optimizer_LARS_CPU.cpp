@@ -0,0 +1,231 @@
+//===============================================
+// œK[`(LARS)
+//===============================================
+#include"stdafx.h"
+
+#include<math.h>
+#include<vector>
+
+#include"Optimizer_LARS_base.h"
+#include"Optimizer_LayerWise.h"
+#include"Optimizer_GradientReducer.h"
+#include"Optimizer_Kernel_CPU.h"
+#include"Library/NeuralNetwork/Optimizer.h"
+
+namespace Gravisbell {
+namespace Layer {
+namespace NeuralNetwork {
+
+	class Optimizer_LARS_CPU : public Optimizer_LARS_base, public IOptimizer_LayerWise
+	{
+	public:
+		std::vector<F32> m_lpLastDParameter;	/**< O̍XV̍ۂ̃p[^ω */
+
+	private:
+		std::vector<F32> lpReduceBuffer;	/**< ωʏWp̍ƃobt@ */
+
+		OptimizerNormAccumulator m_norm;	/**< p[^ƕωʂ2ȁWv */
+		F32 m_trustRatio;					/**< ̍XV̐M */
+
+	public:
+		/** RXgN^ */
+		Optimizer_LARS_CPU(U64 i_parameterCount)
+			:	Optimizer_LARS_base	(i_parameterCount)
+			,	m_trustRatio		(1.0f)
+		{
+			this->m_lpLastDParameter.resize(this->m_parameterCount, 0.0f);
+		}
+		/** fXgN^ */
+		virtual ~Optimizer_LARS_CPU()
+		{
+		}
+
+	public:
+		//===========================
+		// 
+		//===========================
+		/** p[^XV.
+			@param io_lpParamter	XVp[^.
+			@param io_lpDParameter	p[^̕ω. */
+		ErrorCode UpdateParameter(F32 io_lpParameter[], const F32 i_lpDParameter[])
+		{
+			// vfꍇ͔͈͂𕪊ĕXbhōXV
+			OptimizerUpdateTarget target = {this, io_lpParameter, i_lpDParameter};
+			return UpdateParameterMulti_CPU(&target, 1);
+		}
+
+		/** p[^̕XVJn.
+			@param	i_lpDParameter	p[^̕ω.
+			@param	o_lpDParameter	UpdateParameterRangeɓnωʂ̊i[. */
+		ErrorCode BeginUpdateParameter(const F32 i_lpDParameter[], const F32*& o_lpDParameter)
+		{
+			// ωʂW
+			ErrorCode err = ReduceGradient_CPU(i_lpDParameter, this->m_parameterCount, this->lpReduceBuffer, o_lpDParameter);
+			if(err != ErrorCode::ERROR_CODE_NONE)
+				return err;
+
+			this->m_norm.Reset();
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+		/** p[^̈ꕔɂăm̕a߂.
+			@param	i_lpParamter	XVp[^̐擪.
+			@param	i_lpDParameter	BeginUpdateParameterŎ擾ωʂ̐擪.
+			@param	i_offset		͈͂̊Jnʒu.
+			@param	i_count			͈̗͂vf. */
+		ErrorCode PrepareParameterRange(const F32 i_lpParameter[], const F32 i_lpDParameter[], U64 i_offset, U64 i_count)
+		{
+			F64 sumParameter  = 0.0;
+			F64 sumDParameter = 0.0;
+
+			if(!GetReferenceMode_CPU())
+			{
+				SquareSumKernel_CPU(&i_lpParameter[i_offset], &i_lpDParameter[i_offset], i_count, sumParameter, sumDParameter);
+			}
+			else
+			{
+				for(U64 paramNum=i_offset; paramNum<i_offset+i_count; paramNum++)
+				{
+					sumParameter  += i_lpParameter[paramNum]  * i_lpParameter[paramNum];
+					sumDParameter += i_lpDParameter[paramNum] * i_lpDParameter[paramNum];
+				}
+			}
+
+			this->m_norm.AddPartialSum(i_offset, sumParameter, sumDParameter);
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+		/** m̕aWvAMm肷.
+			M = eta * |param| / (|d| + weightDecay * |param| + epsilon).
+			ωʂ0̏ꍇ͒Ȃ. */
+		ErrorCode EndPrepareParameter()
+		{
+			this->m_norm.Complete();
+
+			F64 normParameter  = sqrt(this->m_norm.GetSum(0));
+			F64 normDParameter = sqrt(this->m_norm.GetSum(1));
+
+			if(normDParameter <= 0.0)
+				this->m_trustRatio = 1.0f;
+			else
+				this->m_trustRatio = GetOptimizerTrustRatio(this->m_eta * normParameter, normDParameter + this->m_weightDecay * normParameter + this->m_epsilon);
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+		/** p[^̈ꕔXV.
+			M䂪m肵ĂȂꍇ͑S͈͂̍XV̂ݎ󂯕tȀŃmWv.
+			@param	io_lpParamter	XVp[^̐擪.
+			@param	i_lpDParameter	BeginUpdateParameterŎ擾ωʂ̐擪.
+			@param	i_offset		XV͈͂̊Jnʒu.
+			@param	i_count			XV͈̗͂vf. */
+		ErrorCode UpdateParameterRange(F32 io_lpParameter[], const F32 i_lpDParameter[], U64 i_offset, U64 i_count)
+		{
+			if(!this->m_norm.IsCompleted())
+			{
+				if(i_offset != 0 || i_count != this->m_parameterCount)
+					return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+
+				this->PrepareParameterRange(io_lpParameter, i_lpDParameter, 0, this->m_parameterCount);
+				this->EndPrepareParameter();
+			}
+
+			const F32 learnCoeff = this->m_learnCoeff * this->m_trustRatio;
+
+			if(!GetReferenceMode_CPU())
+			{
+				UpdateParameterKernel_LARS_CPU(
+					&io_lpParameter[i_offset], &i_lpDParameter[i_offset], &this->m_lpLastDParameter[i_offset], i_count,
+					learnCoeff, this->m_alpha, this->m_weightDecay);
+
+				return ErrorCode::ERROR_CODE_NONE;
+			}
+
+			for(U64 paramNum=i_offset; paramNum<i_offset+i_count; paramNum++)
+			{
+				// d݌ω
+				F32 dParameter = i_lpDParameter[paramNum] - this->m_weightDecay * io_lpParameter[paramNum];
+
+				// ωʂXV
+				this->m_lpLastDParameter[paramNum] = this->m_alpha * this->m_lpLastDParameter[paramNum] + learnCoeff * dParameter;
+
+				// p[^XV
+				io_lpParameter[paramNum] += this->m_lpLastDParameter[paramNum];
+			}
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+
+		/** ωʂŝ݂w肵ăp[^XV.
+			M̓p[^Ŝ̃m狁߂邽ߑŜXV. */
+		ErrorCode UpdateParameterSparse(F32 io_lpParameter[], const F32 i_lpDParameter[], U32 i_rowCount, U32 i_rowSize, const U32 i_lpRowNum[], U32 i_rowNumCount)
+		{
+			return this->UpdateParameter(io_lpParameter, i_lpDParameter);
+		}
+		/** aȍXVŒxĂsSčŐV̏Ԃɂ.
+			ɑŜXV邽߁AxĂs݂͑Ȃ. */
+		ErrorCode ApplyLaggingUpdate(F32 io_lpParameter[])
+		{
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+
+	public:
+		//===========================
+		// ۑ
+		//===========================
+		/** C[obt@ɏ.
+			@param o_lpBuffer	ݐobt@̐擪AhX. GetUseBufferByteCount̖߂l̃oCgKv
+			@return ꍇ񂾃obt@TCY.sꍇ͕̒l */
+		S64 WriteToBuffer(BYTE* o_lpBuffer)const
+		{
+			U64 writePos = WriteToBufferBase(o_lpBuffer);
+
+			// O̕ω
+			memcpy(&o_lpBuffer[writePos], &this->m_lpLastDParameter[0], sizeof(F32)*this->m_parameterCount);
+			writePos += sizeof(F32)*this->m_parameterCount;
+
+			return writePos;
+		}
+	};
+
+	/** IveB}CU쐬 */
+	Optimizer_LARS_base* CreateOptimizer_LARS_CPU(U64 i_parameterCount)
+	{
+		return new Optimizer_LARS_CPU(i_parameterCount);
+	}
+	/** IveB}CUobt@쐬 */
+	IOptimizer* CreateOptimizerFromBuffer_LARS_CPU(const BYTE* i_lpBuffer, Gravisbell::S64 i_bufferSize, Gravisbell::S64& o_useBufferSize)
+	{
+		Optimizer_LARS_base* pOptimizer = CreateOptimizerFromBuffer_LARS(i_lpBuffer, i_bufferSize, o_useBufferSize, CreateOptimizer_LARS_CPU);
+		if(pOptimizer == NULL)
+			return NULL;
+		Optimizer_LARS_CPU* pOptimizerCPU = dynamic_cast<Optimizer_LARS_CPU*>(pOptimizer);
+		if(pOptimizerCPU == NULL)
+		{
+			delete pOptimizer;
+			return NULL;
+		}
+
+		// O̕ω
+		memcpy(&pOptimizerCPU->m_lpLastDParameter[0], &i_lpBuffer[o_useBufferSize], sizeof(F32)*pOptimizerCPU->m_lpLastDParameter.size());
+		o_useBufferSize += sizeof(F32)*pOptimizerCPU->m_lpLastDParameter.size();
+
+		return pOptimizer;
+	}
+	/** IveB}CU[XV.قȂ^ꍇ͋IɎw̌^ɕϊ. */
+	ErrorCode ChangeOptimizer_LARS_CPU(IOptimizer** io_ppOptimizer, U64 i_parameterCount)
+	{
+		Optimizer_LARS_CPU* pOptimizer = dynamic_cast<Optimizer_LARS_CPU*>(*io_ppOptimizer);
+		if(pOptimizer == NULL)
+		{
+			if(*io_ppOptimizer)
+				delete *io_ppOptimizer;
+
+			*io_ppOptimizer = CreateOptimizer_LARS_CPU(i_parameterCount);
+		}
+
+		return ErrorCode::ERROR_CODE_NONE;
+	}
+
+}	// NeuralNetwork
+}	// Layer
+}	// Gravisbell
@@ -0,0 +1,232 @@
+//===============================================
+// œK[`(LARS)
+//===============================================
+#include"stdafx.h"
+
+#include"Optimizer_LARS_base.h"
+
+namespace Gravisbell {
+namespace Layer {
+namespace NeuralNetwork {
+
+	const std::wstring Optimizer_LARS_base::OPTIMIZER_ID = L"LARS";
+
+	/** RXgN^ */
+	Optimizer_LARS_base::Optimizer_LARS_base(U64 i_parameterCount)
+		:	m_parameterCount	(i_parameterCount)
+
+		,	m_learnCoeff	(1.0f)		/**< wKW */
+		,	m_alpha			(0.9f)		/**<  */
+		,	m_eta			(0.001f)	/**< MW */
+		,	m_weightDecay	(0.0f)		/**< d݌̌W */
+		,	m_epsilon		(1e-9f)		/**< ⏕W */
+	{
+	}
+	/** fXgN^ */
+	Optimizer_LARS_base::~Optimizer_LARS_base()
+	{
+	}
+
+
+	//===========================
+	// {
+	//===========================
+	/** ID̎擾 */
+	const wchar_t* Optimizer_LARS_base::GetOptimizerID()const
+	{
+		return OPTIMIZER_ID.c_str();
+	}
+
+	/** p[^擾 */
+	U64 Optimizer_LARS_base::GetParameterCount()const
+	{
+		return this->m_parameterCount;
+	}
+
+	/** nCp[p[^ݒ肷
+		@param	i_parameterID	p[^ʗpID
+		@param	i_value			p[^. */
+	ErrorCode Optimizer_LARS_base::SetHyperParameter(const wchar_t i_parameterID[], F32 i_value)
+	{
+		std::wstring parameter = i_parameterID;
+		if(parameter == L"LearnCoeff")
+		{
+			this->m_learnCoeff = i_value;
+		}
+		else if(parameter == L"alpha")
+		{
+			this->m_alpha = i_value;
+		}
+		else if(parameter == L"eta")
+		{
+			this->m_eta = i_value;
+		}
+		else if(parameter == L"WeightDecay")
+		{
+			this->m_weightDecay = i_value;
+		}
+		else if(parameter == L"epsilon")
+		{
+			this->m_epsilon = i_value;
+		}
+		else
+		{
+			return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+		}
+
+		return ErrorCode::ERROR_CODE_NONE;
+	}
+	/** nCp[p[^ݒ肷
+		@param	i_parameterID	p[^ʗpID
+		@param	i_value			p[^. */
+	ErrorCode Optimizer_LARS_base::SetHyperParameter(const wchar_t i_parameterID[], S32 i_value)
+	{
+		return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+	}
+	/** nCp[p[^ݒ肷
+		@param	i_parameterID	p[^ʗpID
+		@param	i_value			p[^. */
+	ErrorCode Optimizer_LARS_base::SetHyperParameter(const wchar_t i_parameterID[], const wchar_t i_value[])
+	{
+		return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+	}
+
+
+	//===========================
+	// ۑ
+	//===========================
+	/** C[̕ۑɕKvȃobt@BYTEPʂŎ擾 */
+	U64 Optimizer_LARS_base::GetUseBufferByteCount()const
+	{
+		U64 useBufferByte = 0;
+
+		// gpoCgi[
+		useBufferByte += sizeof(U64);
+
+		// IDobt@TCY
+		useBufferByte += sizeof(U32);
+
+		// IDobt@
+		useBufferByte += sizeof(wchar_t) * OPTIMIZER_ID.size();
+
+		// p[^
+		useBufferByte += sizeof(this->m_parameterCount);
+
+		// wKW
+		useBufferByte += sizeof(this->m_learnCoeff);
+		// 
+		useBufferByte += sizeof(this->m_alpha);
+		// MW
+		useBufferByte += sizeof(this->m_eta);
+		// d݌̌W
+		useBufferByte += sizeof(this->m_weightDecay);
+		// ⏕W
+		useBufferByte += sizeof(this->m_epsilon);
+
+		// O̕ω
+		useBufferByte += sizeof(F32) * this->m_parameterCount;
+
+		return useBufferByte;
+	}
+
+	/** C[obt@ɏ.
+		@param o_lpBuffer	ݐobt@̐擪AhX. GetUseBufferByteCount̖߂l̃oCgKv
+		@return ꍇ񂾃obt@TCY.sꍇ͕̒l */
+	S64 Optimizer_LARS_base::WriteToBufferBase(BYTE* o_lpBuffer)const
+	{
+		U32 writePos = 0;
+
+		// gpoCg
+		U64 userBufferByte = this->GetUseBufferByteCount();
+		memcpy(&o_lpBuffer[writePos], &userBufferByte, sizeof(userBufferByte));
+		writePos += sizeof(userBufferByte);
+
+		// IDobt@TCY
+		U32 idBufferSize = sizeof(wchar_t) * OPTIMIZER_ID.size();
+		memcpy(&o_lpBuffer[writePos], &idBufferSize, sizeof(idBufferSize));
+		writePos += sizeof(idBufferSize);
+
+		// IDobt@
+		memcpy(&o_lpBuffer[writePos], (const BYTE*)OPTIMIZER_ID.c_str(), idBufferSize);
+		writePos += idBufferSize;
+
+		// p[^
+		memcpy(&o_lpBuffer[writePos], &this->m_parameterCount, sizeof(this->m_parameterCount));
+		writePos+= sizeof(this->m_parameterCount);
+
+
+		// wKW
+		memcpy(&o_lpBuffer[writePos], &this->m_learnCoeff, sizeof(this->m_learnCoeff));
+		writePos+= sizeof(this->m_learnCoeff);
+		// 
+		memcpy(&o_lpBuffer[writePos], &this->m_alpha, sizeof(this->m_alpha));
+		writePos+= sizeof(this->m_alpha);
+		// MW
+		memcpy(&o_lpBuffer[writePos], &this->m_eta, sizeof(this->m_eta));
+		writePos+= sizeof(this->m_eta);
+		// d݌̌W
+		memcpy(&o_lpBuffer[writePos], &this->m_weightDecay, sizeof(this->m_weightDecay));
+		writePos+= sizeof(this->m_weightDecay);
+		// ⏕W
+		memcpy(&o_lpBuffer[writePos], &this->m_epsilon, sizeof(this->m_epsilon));
+		writePos+= sizeof(this->m_epsilon);
+
+
+		return writePos;
+	}
+
+	/** obt@쐬 */
+	Optimizer_LARS_base* CreateOptimizerFromBuffer_LARS(const BYTE* i_lpBuffer, Gravisbell::S64 i_bufferSize, Gravisbell::S64& o_useBufferSize, Optimizer_LARS_base* (*CreateOptimizer_LARS)(U64) )
+	{
+		o_useBufferSize = -1;
+		U64 readBufferPos = 0;
+
+		// gpobt@, ID͓ǂݎς
+
+		// p[^
+		U64 parameterCount = 0;
+		memcpy(&parameterCount, &i_lpBuffer[readBufferPos], sizeof(parameterCount));
+		readBufferPos += sizeof(parameterCount);
+
+		// 쐬
+		Optimizer_LARS_base* pOptimizer = CreateOptimizer_LARS(parameterCount);
+		if(pOptimizer == NULL)
+			return NULL;
+
+
+		// wKW
+		F32 learnCoeff = 0.0f;
+		memcpy(&learnCoeff, &i_lpBuffer[readBufferPos], sizeof(learnCoeff));
+		readBufferPos += sizeof(learnCoeff);
+		pOptimizer->SetHyperParameter(L"LearnCoeff", learnCoeff);
+		// 
+		F32 alpha = 0.0f;
+		memcpy(&alpha, &i_lpBuffer[readBufferPos], sizeof(alpha));
+		readBufferPos += sizeof(alpha);
+		pOptimizer->SetHyperParameter(L"alpha", alpha);
+		// MW
+		F32 eta = 0.0f;
+		memcpy(&eta, &i_lpBuffer[readBufferPos], sizeof(eta));
+		readBufferPos += sizeof(eta);
+		pOptimizer->SetHyperParameter(L"eta", eta);
+		// d݌̌W
+		F32 weightDecay = 0.0f;
+		memcpy(&weightDecay, &i_lpBuffer[readBufferPos], sizeof(weightDecay));
+		readBufferPos += sizeof(weightDecay);
+		pOptimizer->SetHyperParameter(L"WeightDecay", weightDecay);
+		// ⏕W
+		F32 epsilon = 0.0f;
+		memcpy(&epsilon, &i_lpBuffer[readBufferPos], sizeof(epsilon));
+		readBufferPos += sizeof(epsilon);
+		pOptimizer->SetHyperParameter(L"epsilon", epsilon);
+
+
+		// gpobt@ۑ
+		o_useBufferSize = readBufferPos;
+
+		return pOptimizer;
+	}
+
+}	// NeuralNetwork
+}	// Layer
+}	// Gravisbell
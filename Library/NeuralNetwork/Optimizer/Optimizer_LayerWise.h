@@ -0,0 +1,138 @@
+//===============================================
+// wPʂ̐MgpœK[`̋ʏ
+// XVʂ̑傫p[^Ŝ̃mŒ邽߁A͈͂Ƃ̍XV̑OɑS͈͂̃mWv
+//===============================================
+#ifndef __GRAVISBELL_NN_OPTIMIZER_LAYER_WISE_H__
+#define __GRAVISBELL_NN_OPTIMIZER_LAYER_WISE_H__
+
+#include"Layer/NeuralNetwork/IOptimizer.h"
+
+#include<vector>
+#include<mutex>
+#include<algorithm>
+
+namespace Gravisbell {
+namespace Layer {
+namespace NeuralNetwork {
+
+	/** wPʂ̐MgpIveB}CU.(CPU)
+		UpdateParameterMulti_CPÚABeginUpdateParameteřɑS͈͂PrepareParameterRangeAEndPrepareParameteȑɌĂяoA
+		Mm肳ĂUpdateParameterRangeĂяo. */
+	class IOptimizer_LayerWise
+	{
+	public:
+		/** fXgN^ */
+		virtual ~IOptimizer_LayerWise(){}
+
+	public:
+		/** p[^̈ꕔɂăm̕a߂.
+			BeginUpdateParameteřɌĂяo. dȂ͈͂łΕXbh瓯ɌĂяo.
+			@param	i_lpParamter	XVp[^̐擪.
+			@param	i_lpDParameter	BeginUpdateParameterŎ擾ωʂ̐擪.
+			@param	i_offset		͈͂̊Jnʒu.
+			@param	i_count			͈̗͂vf. */
+		virtual ErrorCode PrepareParameterRange(const F32 i_lpParameter[], const F32 i_lpDParameter[], U64 i_offset, U64 i_count) = 0;
+		/** m̕aWvAMm肷.
+			S͈͂PrepareParameterRangě1xĂяo. */
+		virtual ErrorCode EndPrepareParameter() = 0;
+	};
+
+	/** ͈͂Ƃɋ߂2ȁWv.
+		a͔͈͂̊JnʒȕɉZ邽߁AłΌʂ͌ĂяoXbhɂ炸v. */
+	class OptimizerNormAccumulator
+	{
+	public:
+		static const U32 SUM_COUNT = 2;	/**< Wv2a̐ */
+
+	private:
+		/** ͈͂Ƃ̕a */
+		struct PartialSum
+		{
+			U64 offset;					/**< ͈͂̊Jnʒu */
+			F64 lpSum[SUM_COUNT];		/**< 2a */
+
+			bool operator<(const PartialSum& i_value)const
+			{
+				return this->offset < i_value.offset;
+			}
+		};
+
+	private:
+		std::mutex m_mutex;						/**< a̒ǉ̔r */
+		std::vector<PartialSum> m_lpPartialSum;	/**< ͈͂Ƃ̕a */
+
+		F64 m_lpSum[SUM_COUNT];	/**< Wv */
+		bool m_onCompleted;		/**< Wvς */
+
+	public:
+		/** RXgN^ */
+		OptimizerNormAccumulator()
+			:	m_onCompleted	(false)
+		{
+			for(U32 sumNum=0; sumNum<SUM_COUNT; sumNum++)
+				this->m_lpSum[sumNum] = 0.0;
+		}
+
+	public:
+		/** WvJn. O̕a͔j */
+		void Reset()
+		{
+			this->m_lpPartialSum.clear();
+			this->m_onCompleted = false;
+		}
+		/** ͈͂̕aǉ.
+			Xbh瓯ɌĂяo. */
+		void AddPartialSum(U64 i_offset, F64 i_sum0, F64 i_sum1)
+		{
+			PartialSum partialSum;
+			partialSum.offset   = i_offset;
+			partialSum.lpSum[0] = i_sum0;
+			partialSum.lpSum[1] = i_sum1;
+
+			std::lock_guard<std::mutex> lock(this->m_mutex);
+			this->m_lpPartialSum.push_back(partialSum);
+		}
+		/** aWv */
+		void Complete()
+		{
+			std::sort(this->m_lpPartialSum.begin(), this->m_lpPartialSum.end());
+
+			for(U32 sumNum=0; sumNum<SUM_COUNT; sumNum++)
+			{
+				this->m_lpSum[sumNum] = 0.0;
+				for(U32 partialNum=0; partialNum<this->m_lpPartialSum.size(); partialNum++)
+					this->m_lpSum[sumNum] += this->m_lpPartialSum[partialNum].lpSum[sumNum];
+			}
+
+			this->m_onCompleted = true;
+		}
+
+		/** Wvς݂ */
+		bool IsCompleted()const
+		{
+			return this->m_onCompleted;
+		}
+		/** Wvʂ擾 */
+		F64 GetSum(U32 i_sumNum)const
+		{
+			return this->m_lpSum[i_sumNum];
+		}
+	};
+
+	/** M߂.
+		ꂩ̃m0̏ꍇ͒Ȃ.
+		@param	i_numerator		q. p[^̃mɌW悶l.
+		@param	i_denominator	. XVʂ̃m. */
+	inline F32 GetOptimizerTrustRatio(F64 i_numerator, F64 i_denominator)
+	{
+		if(i_numerator <= 0.0 || i_denominator <= 0.0)
+			return 1.0f;
+
+		return (F32)(i_numerator / i_denominator);
+	}
+
+}	// NeuralNetwork
+}	// Layer
+}	// Gravisbell
+
+#endif	// __GRAVISBELL_NN_OPTIMIZER_LAYER_WISE_H__
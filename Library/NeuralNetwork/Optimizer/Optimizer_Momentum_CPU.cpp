@@ -5,29 +5,32 @@
 
 #include<vector>
 
-#include"Layer/NeuralNetwork/IOptimizer.h"
+#include"Optimizer_Momentum_base.h"
+#include"Optimizer_GradientReducer.h"
+#include"Optimizer_Kernel_CPU.h"
+#include"Optimizer_SparseRow.h"
+#include"Library/NeuralNetwork/Optimizer.h"
 
 namespace Gravisbell {
 namespace Layer {
 namespace NeuralNetwork {
 
-	class Optimizer_Momentum_CPU : public iOptimizer_Momentum
+	class Optimizer_Momentum_CPU : public Optimizer_Momentum_base
 	{
+	public:
+		std::vector<F32> m_lpLastDParameter;	/**< O̍XV̍ۂ̃p[^ω */
+
 	private:
-		U32 m_parameterCount;	/**< p[^ */
-		F32 m_learnCoeff;		/**< wKW */
-		F32 m_alpha;				/**<  */
+		std::vector<F32> lpReduceBuffer;	/**< ωʏWp̍ƃobt@ */
 
-		std::vector<F32> m_lpLastDParameter;	/**< O̍XV̍ۂ̃p[^ω */
+		OptimizerSparseRow m_sparseRow;	/**< aȍXVŒxĂs̊Ǘ */
 
 	public:
 		/** RXgN^ */
-		Optimizer_Momentum_CPU(U32 i_parameterCount)
-			:	m_parameterCount	(i_parameterCount)
-			,	m_learnCoeff		(0.0f)
-			,	m_alpha				(0.0f)
+		Optimizer_Momentum_CPU(U64 i_parameterCount)
+			:	Optimizer_Momentum_base	(i_parameterCount)
 		{
-			this->m_lpLastDParameter.resize(m_parameterCount, 0.0f);
+			this->m_lpLastDParameter.resize(this->m_parameterCount, 0.0f);
 		}
 		/** fXgN^ */
 		virtual ~Optimizer_Momentum_CPU()
@@ -36,72 +39,228 @@ namespace NeuralNetwork {
 
 	public:
 		//===========================
-		// {
+		// 
 		//===========================
-		/** IveB}CU̎ʂ擾 */
-		OptimizerType GetTypeCode()const
+		/** p[^XV.
+			@param io_lpParamter	XVp[^.
+			@param io_lpDParameter	p[^̕ω. */
+		ErrorCode UpdateParameter(F32 io_lpParameter[], const F32 i_lpDParameter[])
 		{
-			return OptimizerType::OPTIMIZER_TYPE_MOMENTUM;
+			// vfꍇ͔͈͂𕪊ĕXbhōXV
+			OptimizerUpdateTarget target = {this, io_lpParameter, i_lpDParameter};
+			return UpdateParameterMulti_CPU(&target, 1);
 		}
-		
-		/** nCp[p[^XV
-			@param	i_learnCoeff	wKW
-			@param	i_alpha			. */
-		virtual ErrorCode SetHyperParameter(F32 i_learnCoeff, F32 i_alpha)
+
+		/** p[^̕XVJn.
+			@param	i_lpDParameter	p[^̕ω.
+			@param	o_lpDParameter	UpdateParameterRangeɓnωʂ̊i[. */
+		ErrorCode BeginUpdateParameter(const F32 i_lpDParameter[], const F32*& o_lpDParameter)
 		{
-			this->m_learnCoeff = i_learnCoeff;
-			this->m_alpha = i_alpha;
+			// ωʂW
+			ErrorCode err = ReduceGradient_CPU(i_lpDParameter, this->m_parameterCount, this->lpReduceBuffer, o_lpDParameter);
+			if(err != ErrorCode::ERROR_CODE_NONE)
+				return err;
+
+			// aȍXVŒxĂs͊e͈͂̍XVɒǂ
+			this->m_sparseRow.BeginDense();
 
 			return ErrorCode::ERROR_CODE_NONE;
 		}
-
-
-		//===========================
-		// 
-		//===========================
-		/** p[^XV.
-			@param io_lpParamter	XVp[^.
-			@param io_lpDParameter	p[^̕ω. */
-		ErrorCode UpdateParameter(F32 io_lpParameter[], const F32 i_lpDParameter[])
+		/** p[^̈ꕔXV.
+			@param	io_lpParamter	XVp[^̐擪.
+			@param	i_lpDParameter	BeginUpdateParameterŎ擾ωʂ̐擪.
+			@param	i_offset		XV͈͂̊Jnʒu.
+			@param	i_count			XV͈̗͂vf. */
+		ErrorCode UpdateParameterRange(F32 io_lpParameter[], const F32 i_lpDParameter[], U64 i_offset, U64 i_count)
 		{
-			// ωʂXV
-			for(U32 paramNum=0; paramNum<this->m_parameterCount; paramNum++)
+			if(this->m_sparseRow.IsFlushing())
 			{
+				for(U64 paramNum=i_offset; paramNum<i_offset+i_count; paramNum++)
+					this->CatchUpParameter(&io_lpParameter[paramNum], &this->m_lpLastDParameter[paramNum], 1, this->m_sparseRow.GetSkippedStepCount(paramNum));
+			}
+
+			if(!GetReferenceMode_CPU())
+			{
+				UpdateParameterKernel_Momentum_CPU(
+					&io_lpParameter[i_offset], &i_lpDParameter[i_offset], &this->m_lpLastDParameter[i_offset], i_count,
+					this->m_learnCoeff, this->m_alpha);
+
+				return ErrorCode::ERROR_CODE_NONE;
+			}
+
+			for(U64 paramNum=i_offset; paramNum<i_offset+i_count; paramNum++)
+			{
+				// ωʂXV
 				this->m_lpLastDParameter[paramNum] = this->m_alpha * this->m_lpLastDParameter[paramNum] + this->m_learnCoeff * i_lpDParameter[paramNum];
+
+				// p[^XV
+				io_lpParameter[paramNum] += this->m_lpLastDParameter[paramNum];
 			}
 
-			// p[^XV
-			for(U32 paramNum=0; paramNum<this->m_parameterCount; paramNum++)
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+
+		/** ωʂŝ݂w肵ăp[^XV.
+			xXV(LazyUpdate)Lȏꍇ̂ݎw肳ꂽsXVAȊO͑ŜXV.
+			XVȂs͎ɍXVۂɁAȗ񐔕̊ɂړ܂Ƃ߂Ĕf.
+			f܂ł̊Ԃ͊ɂړ܂܂Ȃl̂߁AŜXVꍇƂ͓r̒lقȂ.
+			@param	io_lpParamter	XVp[^.
+			@param	i_lpDParameter	p[^̕ω. p[^̗vf.
+			@param	i_rowCount		1ubN̍s.
+			@param	i_rowSize		1s̗vf.
+			@param	i_lpRowNum		ωʂsԍ̔z. dȂ.
+			@param	i_rowNumCount	sԍ̐. */
+		ErrorCode UpdateParameterSparse(F32 io_lpParameter[], const F32 i_lpDParameter[], U32 i_rowCount, U32 i_rowSize, const U32 i_lpRowNum[], U32 i_rowNumCount)
+		{
+			// W񃋁[`͑SvfΏۂƂ邽߁AW񂷂ꍇ͑ŜXV
+			if(!this->m_lazyUpdate || GetGradientReducer_CPU() != NULL)
+				return this->UpdateParameter(io_lpParameter, i_lpDParameter);
+			if(!this->m_sparseRow.BeginSparse(this->m_parameterCount, i_rowCount, i_rowSize))
+				return this->UpdateParameter(io_lpParameter, i_lpDParameter);
+
+			U64 blockStride = (U64)i_rowCount * i_rowSize;
+			U64 blockCount  = this->m_parameterCount / blockStride;
+			for(U32 rowIndex=0; rowIndex<i_rowNumCount; rowIndex++)
 			{
-				io_lpParameter[paramNum] += m_lpLastDParameter[paramNum];
+				U32 rowNum = i_lpRowNum[rowIndex];
+				U32 skippedStepCount = 0;
+				if(!this->m_sparseRow.TouchRow(rowNum, skippedStepCount))
+					continue;
+
+				this->CatchUpRow(io_lpParameter, (U64)rowNum * i_rowSize, blockStride, blockCount, i_rowSize, skippedStepCount);
+				this->UpdateParameterRow(io_lpParameter, i_lpDParameter, (U64)rowNum * i_rowSize, blockStride, blockCount, i_rowSize);
 			}
 
 			return ErrorCode::ERROR_CODE_NONE;
 		}
+		/** aȍXVŒxĂsSčŐV̏Ԃɂ.
+			ȗ񐔕̊ɂړp[^ɔf. */
+		ErrorCode ApplyLaggingUpdate(F32 io_lpParameter[])
+		{
+			if(this->m_sparseRow.IsLagging())
+			{
+				U32 rowCount = this->m_sparseRow.GetRowCount();
+				U32 rowSize  = this->m_sparseRow.GetRowSize();
+				U64 blockStride = (U64)rowCount * rowSize;
+				U64 blockCount  = this->m_parameterCount / blockStride;
+
+				for(U32 rowNum=0; rowNum<rowCount; rowNum++)
+					this->CatchUpRow(io_lpParameter, (U64)rowNum * rowSize, blockStride, blockCount, rowSize, this->m_sparseRow.GetRowSkippedStepCount(rowNum));
+			}
+			this->m_sparseRow.Reset();
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+
+	private:
+		/** 1sSubNɂčXV.
+			@param	i_rowOffset		擪ubNł̍s̊Jnʒu.
+			@param	i_blockStride	1ubN̗vf.
+			@param	i_blockCount	ubN.
+			@param	i_rowSize		1s̗vf. */
+		void UpdateParameterRow(F32 io_lpParameter[], const F32 i_lpDParameter[], U64 i_rowOffset, U64 i_blockStride, U64 i_blockCount, U32 i_rowSize)
+		{
+			for(U64 offset=i_rowOffset; offset<i_blockCount*i_blockStride; offset+=i_blockStride)
+			{
+				for(U64 paramNum=offset; paramNum<offset+i_rowSize; paramNum++)
+				{
+					this->m_lpLastDParameter[paramNum] = this->m_alpha * this->m_lpLastDParameter[paramNum] + this->m_learnCoeff * i_lpDParameter[paramNum];
+					io_lpParameter[paramNum] += this->m_lpLastDParameter[paramNum];
+				}
+			}
+		}
+		/** 1s̕ω0ŏȗꂽXVSubNɂĂ܂Ƃ߂Ĕf.
+			@param	i_skippedStepCount	ȗꂽXV. */
+		void CatchUpRow(F32 io_lpParameter[], U64 i_rowOffset, U64 i_blockStride, U64 i_blockCount, U32 i_rowSize, U32 i_skippedStepCount)
+		{
+			if(i_skippedStepCount == 0)
+				return;
+
+			for(U64 offset=i_rowOffset; offset<i_blockCount*i_blockStride; offset+=i_blockStride)
+				this->CatchUpParameter(&io_lpParameter[offset], &this->m_lpLastDParameter[offset], i_rowSize, i_skippedStepCount);
+		}
+		/** ω0ŏȗꂽXV܂Ƃ߂Ĕf.
+			lastD_j = alpha^j * lastD ̑a𓙔䋉ŋ߂.
+			param += lastD * alpha * (1-alpha^k) / (1-alpha)
+			lastD = alpha^k * lastD
+			@param	i_skippedStepCount	ȗꂽXV. */
+		void CatchUpParameter(F32 io_lpParameter[], F32 io_lpLastDParameter[], U64 i_count, U32 i_skippedStepCount)
+		{
+			if(i_skippedStepCount == 0)
+				return;
+
+			F32 decay = powf(this->m_alpha, (F32)i_skippedStepCount);
+			F32 moveRate = (this->m_alpha == 1.0f) ? (F32)i_skippedStepCount : this->m_alpha * (1.0f - decay) / (1.0f - this->m_alpha);
+
+			for(U64 paramNum=0; paramNum<i_count; paramNum++)
+			{
+				io_lpParameter[paramNum] += moveRate * io_lpLastDParameter[paramNum];
+				io_lpLastDParameter[paramNum] *= decay;
+			}
+		}
+
+	public:
+		//===========================
+		// ۑ
+		//===========================
+		/** C[obt@ɏ.
+			@param o_lpBuffer	ݐobt@̐擪AhX. GetUseBufferByteCount̖߂l̃oCgKv
+			@return ꍇ񂾃obt@TCY.sꍇ͕̒l */
+		S64 WriteToBuffer(BYTE* o_lpBuffer)const
+		{
+			U64 writePos = WriteToBufferBase(o_lpBuffer);
+
+			// O̕ω
+			memcpy(&o_lpBuffer[writePos], &this->m_lpLastDParameter[0], sizeof(F32)*this->m_parameterCount);
+			// aȍXVŒxĂs͌̂ݔf.
+			// p[^ɖf̊ɂړ́AۑOApplyLaggingUpdateŔfĂ
+			if(this->m_sparseRow.IsLagging())
+				this->m_sparseRow.DecayLaggingState((F32*)&o_lpBuffer[writePos], 0, this->m_parameterCount, this->m_alpha);
+			writePos += sizeof(F32)*this->m_parameterCount;
+
+			return writePos;
+		}
 	};
 
 	/** IveB}CU쐬 */
-	iOptimizer_Momentum* CreateOptimizer_Momentum_CPU(U32 i_parameterCount)
+	Optimizer_Momentum_base* CreateOptimizer_Momentum_CPU(U64 i_parameterCount)
 	{
 		return new Optimizer_Momentum_CPU(i_parameterCount);
 	}
+	/** IveB}CUobt@쐬 */
+	IOptimizer* CreateOptimizerFromBuffer_Momentum_CPU(const BYTE* i_lpBuffer, Gravisbell::S64 i_bufferSize, Gravisbell::S64& o_useBufferSize)
+	{
+		Optimizer_Momentum_base* pOptimizer = CreateOptimizerFromBuffer_Momentum(i_lpBuffer, i_bufferSize, o_useBufferSize, CreateOptimizer_Momentum_CPU);
+		if(pOptimizer == NULL)
+			return NULL;
+		Optimizer_Momentum_CPU* pOptimizerCPU = dynamic_cast<Optimizer_Momentum_CPU*>(pOptimizer);
+		if(pOptimizerCPU == NULL)
+		{
+			delete pOptimizer;
+			return NULL;
+		}
+
+		// O̕ω
+		memcpy(&pOptimizerCPU->m_lpLastDParameter[0], &i_lpBuffer[o_useBufferSize], sizeof(F32)*pOptimizerCPU->m_lpLastDParameter.size());
+		o_useBufferSize += sizeof(F32)*pOptimizerCPU->m_lpLastDParameter.size();
+
+		return pOptimizer;
+	}
 	/** IveB}CU[XV.قȂ^ꍇ͋IɎw̌^ɕϊ. */
-	ErrorCode UpdateOptimizer_Momentum_CPU(IOptimizer** io_ppOptimizer, U32 i_parameterCount, F32 i_learnCoeff, F32 i_alpha)
+	ErrorCode ChangeOptimizer_Momentum_CPU(IOptimizer** io_ppOptimizer, U64 i_parameterCount)
 	{
-		iOptimizer_Momentum* pOptimizer = dynamic_cast<iOptimizer_Momentum*>(*io_ppOptimizer);
+		Optimizer_Momentum_CPU* pOptimizer = dynamic_cast<Optimizer_Momentum_CPU*>(*io_ppOptimizer);
 		if(pOptimizer == NULL)
 		{
 			if(*io_ppOptimizer)
 				delete *io_ppOptimizer;
 
-			*io_ppOptimizer = pOptimizer = CreateOptimizer_Momentum_CPU(i_parameterCount);
+			*io_ppOptimizer = CreateOptimizer_Momentum_CPU(i_parameterCount);
 		}
 
-		pOptimizer->SetHyperParameter(i_learnCoeff, i_alpha);
-
 		return ErrorCode::ERROR_CODE_NONE;
 	}
 
 }	// NeuralNetwork
 }	// Layer
-}	// Gravisbell
\ No newline at end of file
+}	// Gravisbell
@@ -5,72 +5,59 @@
 
 #include<vector>
 
+#include"Optimizer_Momentum_base.h"
+
+// CUDAp
 #pragma warning(push)
 #pragma warning(disable : 4267)
-#include <cuda.h> // need CUDA_VERSION
-#include <cudnn.h>
+#include <cuda.h>
 #include <cublas_v2.h>
 #include <thrust/device_vector.h>
 #include <thrust/host_vector.h>
 #include "device_launch_parameters.h"
 #pragma warning(pop)
 
-#include"Layer/NeuralNetwork/IOptimizer.h"
+#define BLOCK_SIZE	(32)
 
 namespace Gravisbell {
 namespace Layer {
 namespace NeuralNetwork {
 
-	class Optimizer_Momentum_GPU : public iOptimizer_Momentum
+	namespace
 	{
-	private:
-		U32 m_parameterCount;	/**< p[^ */
-		F32 m_learnCoeff;		/**< wKW */
-		F32 m_alpha;				/**<  */
+		/** Kpăp[^XV. */
+		__global__ void cuda_func_updateParameter(F32* io_lpParameter, const F32* i_lpDParameter, const U64 i_bufferSize, F32* io_lpLastDParameter, F32 i_learnCoeff, F32 i_alpha)
+		{
+			const U32 paramNum = blockIdx.x * BLOCK_SIZE + threadIdx.x;
+			if(paramNum >= i_bufferSize)	// 򂷂邪warpȂ̂ŁAxɉe͂Ȃ͂...
+				return;
+
+			// ωʂXV
+			io_lpLastDParameter[paramNum] = i_alpha * io_lpLastDParameter[paramNum] + i_learnCoeff * i_lpDParameter[paramNum];
+
+			// p[^XV
+			io_lpParameter[paramNum] += io_lpLastDParameter[paramNum];
+		}
+	}
 
+	class Optimizer_Momentum_GPU : public Optimizer_Momentum_base
+	{
+	public:
 		thrust::device_vector<F32> m_lpLastDParameter;	/**< O̍XV̍ۂ̃p[^ω */
-
-		cublasHandle_t cublasHandle;
 
 	public:
 		/** RXgN^ */
-		Optimizer_Momentum_GPU(U32 i_parameterCount)
-			:	m_parameterCount	(i_parameterCount)
-			,	m_learnCoeff		(0.0f)
-			,	m_alpha				(0.0f)
+		Optimizer_Momentum_GPU(U64 i_parameterCount)
+			:	Optimizer_Momentum_base	(i_parameterCount)
 		{
-			cublasCreate(&cublasHandle);
-
-			this->m_lpLastDParameter.resize(this->m_parameterCount);
+			this->m_lpLastDParameter.resize(this->m_parameterCount, 0.0f);
 		}
 		/** fXgN^ */
 		virtual ~Optimizer_Momentum_GPU()
 		{
-			cublasDestroy(cublasHandle);
 		}
 
 	public:
-		//===========================
-		// {
-		//===========================
-		/** IveB}CU̎ʂ擾 */
-		OptimizerType GetTypeCode()const
-		{
-			return OptimizerType::OPTIMIZER_TYPE_MOMENTUM;
-		}
-		
-		/** nCp[p[^XV
-			@param	i_learnCoeff	wKW
-			@param	i_alpha			. */
-		virtual ErrorCode SetHyperParameter(F32 i_learnCoeff, F32 i_alpha)
-		{
-			this->m_learnCoeff = i_learnCoeff;
-			this->m_alpha = i_alpha;
-
-			return ErrorCode::ERROR_CODE_NONE;
-		}
-
-
 		//===========================
 		// 
 		//===========================
@@ -79,64 +66,109 @@ namespace NeuralNetwork {
 			@param io_lpDParameter	p[^̕ω. */
 		ErrorCode UpdateParameter(F32 io_lpParameter[], const F32 i_lpDParameter[])
 		{
-			// ωʍXV
-			// Kp
-			cublasSscal_v2(
-				this->cublasHandle,
-				this->m_parameterCount,
-				&this->m_alpha,
-				thrust::raw_pointer_cast(&this->m_lpLastDParameter[0]),
-				1);
-			// ωʂZ
-			cublasSaxpy_v2(
-				this->cublasHandle,
-				this->m_parameterCount,
-				&this->m_learnCoeff,
-				i_lpDParameter,
-				1,
-				thrust::raw_pointer_cast(&this->m_lpLastDParameter[0]),
-				1);
+			return this->UpdateParameterRange(io_lpParameter, i_lpDParameter, 0, this->m_parameterCount);
+		}
 
+		/** p[^̕XVJn.
+			@param	i_lpDParameter	p[^̕ω.
+			@param	o_lpDParameter	UpdateParameterRangeɓnωʂ̊i[. */
+		ErrorCode BeginUpdateParameter(const F32 i_lpDParameter[], const F32*& o_lpDParameter)
+		{
+			o_lpDParameter = i_lpDParameter;
 
-			// p[^XV
-			F32 alpha = 1;
-			cublasSaxpy_v2(
-				this->cublasHandle,
-				this->m_parameterCount,
-				&alpha,
-				thrust::raw_pointer_cast(&this->m_lpLastDParameter[0]),
-				1,
-				io_lpParameter,
-				1);
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+		/** p[^̈ꕔXV.
+			@param	io_lpParamter	XVp[^̐擪.
+			@param	i_lpDParameter	BeginUpdateParameterŎ擾ωʂ̐擪.
+			@param	i_offset		XV͈͂̊Jnʒu.
+			@param	i_count			XV͈̗͂vf. */
+		ErrorCode UpdateParameterRange(F32 io_lpParameter[], const F32 i_lpDParameter[], U64 i_offset, U64 i_count)
+		{
+			dim3 grid((U32)((i_count +(BLOCK_SIZE - 1))/BLOCK_SIZE), 1, 1);
+			dim3 block(BLOCK_SIZE, 1, 1);
 
+			cuda_func_updateParameter<<<grid, block>>>(
+				&io_lpParameter[i_offset],
+				&i_lpDParameter[i_offset],
+				i_count,
+				thrust::raw_pointer_cast(&this->m_lpLastDParameter[i_offset]),
+				this->m_learnCoeff, this->m_alpha);
 
 			return ErrorCode::ERROR_CODE_NONE;
 		}
+
+		/** ωʂŝ݂w肵ăp[^XV.
+			GPUł͑ŜXV. w肳ĂȂs̕ωʂ0̂ߌʂ͕ςȂ. */
+		ErrorCode UpdateParameterSparse(F32 io_lpParameter[], const F32 i_lpDParameter[], U32 i_rowCount, U32 i_rowSize, const U32 i_lpRowNum[], U32 i_rowNumCount)
+		{
+			return this->UpdateParameter(io_lpParameter, i_lpDParameter);
+		}
+		/** aȍXVŒxĂsSčŐV̏Ԃɂ.
+			GPUł͏ɑŜXV邽߁AxĂs݂͑Ȃ. */
+		ErrorCode ApplyLaggingUpdate(F32 io_lpParameter[])
+		{
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+
+	public:
+		//===========================
+		// ۑ
+		//===========================
+		/** C[obt@ɏ.
+			@param o_lpBuffer	ݐobt@̐擪AhX. GetUseBufferByteCount̖߂l̃oCgKv
+			@return ꍇ񂾃obt@TCY.sꍇ͕̒l */
+		S64 WriteToBuffer(BYTE* o_lpBuffer)const
+		{
+			S64 writePos = WriteToBufferBase(o_lpBuffer);
+
+			// O̕ω
+			cudaMemcpy(&o_lpBuffer[writePos], thrust::raw_pointer_cast(&this->m_lpLastDParameter[0]), sizeof(F32)*this->m_parameterCount, cudaMemcpyDeviceToHost);
+			writePos += sizeof(F32)*this->m_parameterCount;
+
+			return writePos;
+		}
 	};
 
 	/** IveB}CU쐬 */
-	iOptimizer_Momentum* CreateOptimizer_Momentum_GPU(U32 i_parameterCount)
+	Optimizer_Momentum_base* CreateOptimizer_Momentum_GPU(U64 i_parameterCount)
 	{
 		return new Optimizer_Momentum_GPU(i_parameterCount);
 	}
+	/** IveB}CUobt@쐬 */
+	IOptimizer* CreateOptimizerFromBuffer_Momentum_GPU(const BYTE* i_lpBuffer, Gravisbell::S64 i_bufferSize, Gravisbell::S64& o_useBufferSize)
+	{
+		Optimizer_Momentum_base* pOptimizer = CreateOptimizerFromBuffer_Momentum(i_lpBuffer, i_bufferSize, o_useBufferSize, CreateOptimizer_Momentum_GPU);
+		if(pOptimizer == NULL)
+			return NULL;
+		Optimizer_Momentum_GPU* pOptimizerGPU = dynamic_cast<Optimizer_Momentum_GPU*>(pOptimizer);
+		if(pOptimizerGPU == NULL)
+		{
+			delete pOptimizer;
+			return NULL;
+		}
+
+		// O̕ω
+		cudaMemcpy(thrust::raw_pointer_cast(&pOptimizerGPU->m_lpLastDParameter[0]), &i_lpBuffer[o_useBufferSize], sizeof(F32)*pOptimizerGPU->m_lpLastDParameter.size(), cudaMemcpyHostToDevice);
+		o_useBufferSize += sizeof(F32)*pOptimizerGPU->m_lpLastDParameter.size();
+
+		return pOptimizer;
+	}
 	/** IveB}CU[XV.قȂ^ꍇ͋IɎw̌^ɕϊ. */
-	ErrorCode UpdateOptimizer_Momentum_GPU(IOptimizer** io_ppOptimizer, U32 i_parameterCount, F32 i_learnCoeff, F32 i_alpha)
+	ErrorCode ChangeOptimizer_Momentum_GPU(IOptimizer** io_ppOptimizer, U64 i_parameterCount)
 	{
-		iOptimizer_Momentum* pOptimizer = dynamic_cast<iOptimizer_Momentum*>(*io_ppOptimizer);
+		Optimizer_Momentum_GPU* pOptimizer = dynamic_cast<Optimizer_Momentum_GPU*>(*io_ppOptimizer);
 		if(pOptimizer == NULL)
 		{
 			if(*io_ppOptimizer)
 				delete *io_ppOptimizer;
 
-			*io_ppOptimizer = pOptimizer = CreateOptimizer_Momentum_GPU(i_parameterCount);
+			*io_ppOptimizer = CreateOptimizer_Momentum_GPU(i_parameterCount);
 		}
 
-		pOptimizer->SetHyperParameter(i_learnCoeff, i_alpha);
-
 		return ErrorCode::ERROR_CODE_NONE;
 	}
 
-
 }	// NeuralNetwork
 }	// Layer
-}	// Gravisbell
\ No newline at end of file
+}	// Gravisbell
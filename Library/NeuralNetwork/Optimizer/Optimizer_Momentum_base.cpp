@@ -0,0 +1,224 @@
+//===============================================
+// œK[`(Momentum)
+//===============================================
+#include"stdafx.h"
+
+#include"Optimizer_Momentum_base.h"
+
+namespace Gravisbell {
+namespace Layer {
+namespace NeuralNetwork {
+
+	const std::wstring Optimizer_Momentum_base::OPTIMIZER_ID = L"Momentum";
+
+	/** RXgN^ */
+	Optimizer_Momentum_base::Optimizer_Momentum_base(U64 i_parameterCount)
+		:	m_parameterCount	(i_parameterCount)
+
+		,	m_learnCoeff	(1.0f)		/**< wKW */
+		,	m_alpha			(0.9f)		/**<  */
+		,	m_lazyUpdate	(false)
+	{
+	}
+	/** fXgN^ */
+	Optimizer_Momentum_base::~Optimizer_Momentum_base()
+	{
+	}
+
+
+	//===========================
+	// {
+	//===========================
+	/** ID̎擾 */
+	const wchar_t* Optimizer_Momentum_base::GetOptimizerID()const
+	{
+		return OPTIMIZER_ID.c_str();
+	}
+
+	/** p[^擾 */
+	U64 Optimizer_Momentum_base::GetParameterCount()const
+	{
+		return this->m_parameterCount;
+	}
+
+	/** nCp[p[^ݒ肷
+		@param	i_parameterID	p[^ʗpID
+		@param	i_value			p[^. */
+	ErrorCode Optimizer_Momentum_base::SetHyperParameter(const wchar_t i_parameterID[], F32 i_value)
+	{
+		std::wstring parameter = i_parameterID;
+		if(parameter == L"LearnCoeff")
+		{
+			this->m_learnCoeff = i_value;
+		}
+		else if(parameter == L"alpha")
+		{
+			this->m_alpha = i_value;
+		}
+		else
+		{
+			return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+		}
+
+		return ErrorCode::ERROR_CODE_NONE;
+	}
+	/** nCp[p[^ݒ肷
+		@param	i_parameterID	p[^ʗpID
+		@param	i_value			p[^. */
+	ErrorCode Optimizer_Momentum_base::SetHyperParameter(const wchar_t i_parameterID[], S32 i_value)
+	{
+		std::wstring parameter = i_parameterID;
+		if(parameter == L"LazyUpdate")
+		{
+			this->m_lazyUpdate = (i_value != 0);
+		}
+		else if(parameter == L"AsyncUpdate")
+		{
+			// xp[^Ƃɕێ邽߁AbNɍXVƑx̍XV. 񓯊XVɂ͑ΉȂ
+			if(i_value != 0)
+				return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+		}
+		else
+		{
+			return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+		}
+
+		return ErrorCode::ERROR_CODE_NONE;
+	}
+	/** nCp[p[^ݒ肷
+		@param	i_parameterID	p[^ʗpID
+		@param	i_value			p[^. */
+	ErrorCode Optimizer_Momentum_base::SetHyperParameter(const wchar_t i_parameterID[], const wchar_t i_value[])
+	{
+		return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+	}
+
+
+	//===========================
+	// ۑ
+	//===========================
+	/** C[̕ۑɕKvȃobt@BYTEPʂŎ擾 */
+	U64 Optimizer_Momentum_base::GetUseBufferByteCount()const
+	{
+		U64 useBufferByte = 0;
+
+		// gpoCgi[
+		useBufferByte += sizeof(U64);
+
+		// IDobt@TCY
+		useBufferByte += sizeof(U32);
+
+		// IDobt@
+		useBufferByte += sizeof(wchar_t) * OPTIMIZER_ID.size();
+
+		// p[^
+		useBufferByte += sizeof(this->m_parameterCount);
+
+		// wKW
+		useBufferByte += sizeof(this->m_learnCoeff);
+		// 
+		useBufferByte += sizeof(this->m_alpha);
+		// LazyUpdate
+		useBufferByte += sizeof(U32);
+
+		// O̕ω
+		useBufferByte += sizeof(F32) * this->m_parameterCount;
+
+		return useBufferByte;
+	}
+
+	/** C[obt@ɏ.
+		@param o_lpBuffer	ݐobt@̐擪AhX. GetUseBufferByteCount̖߂l̃oCgKv
+		@return ꍇ񂾃obt@TCY.sꍇ͕̒l */
+	S64 Optimizer_Momentum_base::WriteToBufferBase(BYTE* o_lpBuffer)const
+	{
+		U32 writePos = 0;
+
+		// gpoCg
+		U64 userBufferByte = this->GetUseBufferByteCount();
+		memcpy(&o_lpBuffer[writePos], &userBufferByte, sizeof(userBufferByte));
+		writePos += sizeof(userBufferByte);
+
+		// IDobt@TCY
+		U32 idBufferSize = sizeof(wchar_t) * OPTIMIZER_ID.size();
+		memcpy(&o_lpBuffer[writePos], &idBufferSize, sizeof(idBufferSize));
+		writePos += sizeof(idBufferSize);
+
+		// IDobt@
+		memcpy(&o_lpBuffer[writePos], (const BYTE*)OPTIMIZER_ID.c_str(), idBufferSize);
+		writePos += idBufferSize;
+
+		// p[^
+		memcpy(&o_lpBuffer[writePos], &this->m_parameterCount, sizeof(this->m_parameterCount));
+		writePos+= sizeof(this->m_parameterCount);
+
+
+		// wKW
+		memcpy(&o_lpBuffer[writePos], &this->m_learnCoeff, sizeof(this->m_learnCoeff));
+		writePos+= sizeof(this->m_learnCoeff);
+		// 
+		memcpy(&o_lpBuffer[writePos], &this->m_alpha, sizeof(this->m_alpha));
+		writePos+= sizeof(this->m_alpha);
+		// LazyUpdate
+		U32 lazyUpdate = this->m_lazyUpdate ? 1 : 0;
+		memcpy(&o_lpBuffer[writePos], &lazyUpdate, sizeof(lazyUpdate));
+		writePos+= sizeof(lazyUpdate);
+
+
+		return writePos;
+	}
+
+	/** obt@쐬 */
+	Optimizer_Momentum_base* CreateOptimizerFromBuffer_Momentum(const BYTE* i_lpBuffer, Gravisbell::S64 i_bufferSize, Gravisbell::S64& o_useBufferSize, Optimizer_Momentum_base* (*CreateOptimizer_Momentum)(U64) )
+	{
+		o_useBufferSize = -1;
+		U64 readBufferPos = 0;
+
+		// gpobt@, ID͓ǂݎς
+
+		// p[^
+		U64 parameterCount = 0;
+		memcpy(&parameterCount, &i_lpBuffer[readBufferPos], sizeof(parameterCount));
+		readBufferPos += sizeof(parameterCount);
+
+		// 쐬
+		Optimizer_Momentum_base* pOptimizer = CreateOptimizer_Momentum(parameterCount);
+		if(pOptimizer == NULL)
+			return NULL;
+
+
+		// wKW
+		F32 learnCoeff = 0.0f;
+		memcpy(&learnCoeff, &i_lpBuffer[readBufferPos], sizeof(learnCoeff));
+		readBufferPos += sizeof(learnCoeff);
+		pOptimizer->SetHyperParameter(L"LearnCoeff", learnCoeff);
+		// 
+		F32 alpha = 0.0f;
+		memcpy(&alpha, &i_lpBuffer[readBufferPos], sizeof(alpha));
+		readBufferPos += sizeof(alpha);
+		pOptimizer->SetHyperParameter(L"alpha", alpha);
+
+		// LazyUpdate. Ȃ`͒O̕ωʂ
+		U64 legacyBufferByte = readBufferPos + sizeof(F32) * parameterCount;
+		if((U64)i_bufferSize == legacyBufferByte + sizeof(U32))
+		{
+			U32 lazyUpdate = 0;
+			memcpy(&lazyUpdate, &i_lpBuffer[readBufferPos], sizeof(lazyUpdate));
+			readBufferPos += sizeof(lazyUpdate);
+			pOptimizer->SetHyperParameter(L"LazyUpdate", (S32)lazyUpdate);
+		}
+		else if((U64)i_bufferSize != legacyBufferByte)
+		{
+			delete pOptimizer;
+			return NULL;
+		}
+
+		// gpobt@ۑ
+		o_useBufferSize = readBufferPos;
+
+		return pOptimizer;
+	}
+
+}	// NeuralNetwork
+}	// Layer
+}	// Gravisbell
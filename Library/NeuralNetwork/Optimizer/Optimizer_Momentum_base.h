@@ -0,0 +1,87 @@
+//===============================================
+// œK[`(Momentum)
+//===============================================
+
+#include"Layer/NeuralNetwork/IOptimizer.h"
+
+#include<string>
+
+namespace Gravisbell {
+namespace Layer {
+namespace NeuralNetwork {
+
+	class Optimizer_Momentum_base : public IOptimizer
+	{
+	public:
+		static const std::wstring OPTIMIZER_ID;
+
+	protected:
+		U64 m_parameterCount;	/**< p[^ */
+
+		F32 m_learnCoeff;	/**< wKW */
+		F32 m_alpha;		/**<  */
+
+		bool m_lazyUpdate;	/**< aȍXVŁAωʂȂs̊ɂړɍXV܂Œx */
+
+	public:
+		/** RXgN^ */
+		Optimizer_Momentum_base(U64 i_parameterCount);
+		/** fXgN^ */
+		virtual ~Optimizer_Momentum_base();
+
+	public:
+		//===========================
+		// {
+		//===========================
+		/** ID̎擾 */
+		const wchar_t* GetOptimizerID()const;
+
+		/** p[^擾 */
+		U64 GetParameterCount()const;
+
+		/** nCp[p[^ݒ肷
+			@param	i_parameterID	p[^ʗpID
+			@param	i_value			p[^. */
+		ErrorCode SetHyperParameter(const wchar_t i_parameterID[], F32 i_value);
+		/** nCp[p[^ݒ肷
+			@param	i_parameterID	p[^ʗpID
+			@param	i_value			p[^. */
+		ErrorCode SetHyperParameter(const wchar_t i_parameterID[], S32 i_value);
+		/** nCp[p[^ݒ肷
+			@param	i_parameterID	p[^ʗpID
+			@param	i_value			p[^. */
+		ErrorCode SetHyperParameter(const wchar_t i_parameterID[], const wchar_t i_value[]);
+
+
+	public:
+		//===========================
+		// ۑ
+		//===========================
+		/** C[̕ۑɕKvȃobt@BYTEPʂŎ擾 */
+		U64 GetUseBufferByteCount()const;
+
+		/** C[obt@ɏ.
+			@param o_lpBuffer	ݐobt@̐擪AhX. GetUseBufferByteCount̖߂l̃oCgKv
+			@return ꍇ񂾃obt@TCY.sꍇ͕̒l */
+		virtual S64 WriteToBuffer(BYTE* o_lpBuffer)const = 0;
+
+	protected:
+		/** C[obt@ɏ.
+			@param o_lpBuffer	ݐobt@̐擪AhX. GetUseBufferByteCount̖߂l̃oCgKv
+			@return ꍇ񂾃obt@TCY.sꍇ͕̒l */
+		S64 WriteToBufferBase(BYTE* o_lpBuffer)const;
+	};
+
+
+	/** IveB}CU[XV.قȂ^ꍇ͋IɎw̌^ɕϊ. */
+	ErrorCode ChangeOptimizer_Momentum_CPU(IOptimizer** io_ppOptimizer, U64 i_parameterCount);
+	ErrorCode ChangeOptimizer_Momentum_GPU(IOptimizer** io_ppOptimizer, U64 i_parameterCount);
+
+	/** IveB}CUobt@쐬 */
+	Optimizer_Momentum_base* CreateOptimizerFromBuffer_Momentum(const BYTE* i_lpBuffer, Gravisbell::S64 i_bufferSize, Gravisbell::S64& o_useBufferSize, Optimizer_Momentum_base* (*CreateOptimizer_Momentum)(U64) );
+	IOptimizer* CreateOptimizerFromBuffer_Momentum_CPU(const BYTE* i_lpBuffer, Gravisbell::S64 i_bufferSize, Gravisbell::S64& o_useBufferSize);
+	IOptimizer* CreateOptimizerFromBuffer_Momentum_GPU(const BYTE* i_lpBuffer, Gravisbell::S64 i_bufferSize, Gravisbell::S64& o_useBufferSize);
+
+}	// NeuralNetwork
+}	// Layer
+}	// Gravisbell
@@ -0,0 +1,377 @@
+//===============================================
+// p[^̈ꊇXV
+//===============================================
+#include"stdafx.h"
+
+#include<vector>
+#include<thread>
+#include<atomic>
+#include<mutex>
+#include<condition_variable>
+#include<algorithm>
+
+#include"Library/NeuralNetwork/Optimizer.h"
+#include"Optimizer_LayerWise.h"
+
+namespace Gravisbell {
+namespace Layer {
+namespace NeuralNetwork {
+
+	namespace
+	{
+		/** P. vf */
+		static const U64 UPDATE_CHUNK_SIZE = 16384;
+		/** XbhōXVŏ̗vf. ꖢ̏ꍇ͌ĂяõXbĥ݂ōXV */
+		static const U64 UPDATE_MULTITHREAD_MIN_COUNT = 262144;
+
+		/** ꊇXVɎgpXbh. 0̏ꍇ͘_RA */
+		static U32 g_updateThreadCount_CPU = 0;
+
+		/** XV͈ */
+		struct UpdateChunk
+		{
+			IOptimizer* pOptimizer;		/**< XVɎgpIveB}CU */
+			IOptimizer_LayerWise* pLayerWise;	/**< wPʂ̐Mgpꍇ̃IveB}CU. gpȂꍇNULL */
+			F32* lpParameter;			/**< XVp[^̐擪 */
+			const F32* lpDParameter;	/**< ωʂ̐擪 */
+			U64 offset;					/**< XV͈͂̊Jnʒu */
+			U64 count;					/**< XV͈̗͂vf */
+		};
+
+		/** XVXbhԂ̋L */
+		struct UpdateShareInfo
+		{
+			const std::vector<UpdateChunk>* pLpChunk;	/**< XV͈͂̈ꗗ */
+			std::atomic<U64> nextChunkNum;				/**< ɏXV͈͂̔ԍ */
+			bool onPrepare;								/**< m̏Wv. wPʂ̐Mgp͈͂̂ݏ */
+
+			std::mutex errorMutex;		/**< G[L^̔r */
+			ErrorCode errorCode;		/**< ŏɔG[ */
+		};
+
+		/** XVXbh̏.
+			ĂȂXV͈͂Ɏ擾AȂȂ܂ōXV.
+			m̏Wv͍XV̑Ƀm̕a߂. */
+		void UpdateWorkerProc(UpdateShareInfo* io_pShareInfo)
+		{
+			const std::vector<UpdateChunk>& lpChunk = *io_pShareInfo->pLpChunk;
+
+			while(true)
+			{
+				U64 chunkNum = io_pShareInfo->nextChunkNum.fetch_add(1);
+				if(chunkNum >= lpChunk.size())
+					break;
+
+				const UpdateChunk& chunk = lpChunk[chunkNum];
+				ErrorCode err = ErrorCode::ERROR_CODE_NONE;
+				if(io_pShareInfo->onPrepare)
+				{
+					if(chunk.pLayerWise == NULL)
+						continue;
+					err = chunk.pLayerWise->PrepareParameterRange(chunk.lpParameter, chunk.lpDParameter, chunk.offset, chunk.count);
+				}
+				else
+				{
+					err = chunk.pOptimizer->UpdateParameterRange(chunk.lpParameter, chunk.lpDParameter, chunk.offset, chunk.count);
+				}
+				if(err != ErrorCode::ERROR_CODE_NONE)
+				{
+					std::lock_guard<std::mutex> lock(io_pShareInfo->errorMutex);
+					if(io_pShareInfo->errorCode == ErrorCode::ERROR_CODE_NONE)
+						io_pShareInfo->errorCode = err;
+				}
+			}
+		}
+
+		/** XVp̃[J[Xbhv[.
+			̎gpɍ쐬Aȍ~̍XVŎg. gpXbhύXꂽꍇ̂ݍ蒼.
+			DLL̉̓[_[bN̂߃[J[Xbh̏Iҋ@łȂ. ReleaseUpdateThreadPool_CPUŖIɒ~邱. */
+		class UpdateThreadPool
+		{
+		private:
+			std::vector<std::thread> m_lpThread;	/**< [J[Xbh */
+
+			std::mutex m_processMutex;				/**< XV̔r. ̌Ăяo瓯Ɏgpꂽꍇ͏ɏ */
+
+			std::mutex m_mutex;
+			std::condition_variable m_startCondition;	/**< ̊JnA~vʒm */
+			std::condition_variable m_doneCondition;	/**< [J[Xbh̏ʒm */
+			UpdateShareInfo* m_pShareInfo;				/**< ̋L */
+			U64 m_generation;							/**< ̊JnƂɉZԍ */
+			U32 m_useWorkerCount;						/**< ̏ɎQ郏[J[Xbh */
+			U32 m_runningCount;							/**< ĂȂ[J[Xbh */
+			bool m_onStop;								/**< ~vtO */
+
+		public:
+			/** RXgN^ */
+			UpdateThreadPool()
+				:	m_pShareInfo	(NULL)
+				,	m_generation	(0)
+				,	m_useWorkerCount(0)
+				,	m_runningCount	(0)
+				,	m_onStop		(false)
+			{
+			}
+			/** fXgN^.
+				vZXI̓[J[XbhɏIĂ邽ߑҋ@Ȃ. */
+			~UpdateThreadPool()
+			{
+				for(auto& thread : this->m_lpThread)
+					thread.detach();
+			}
+
+		public:
+			/** SXV͈͂𕡐Xbhŏ.
+				@param	i_lpChunk		XV͈͂̈ꗗ.
+				@param	i_poolSize		v[郏[J[Xbh. ĂяõXbh܂܂Ȃ.
+				@param	i_threadCount	gpXbh. ĂяõXbh܂.
+				@param	i_onPrepare		m̏Wvsꍇtrue.
+				@return	ŏɔG[. */
+			ErrorCode Process(const std::vector<UpdateChunk>& i_lpChunk, U32 i_poolSize, U32 i_threadCount, bool i_onPrepare)
+			{
+				UpdateShareInfo shareInfo;
+				shareInfo.pLpChunk = &i_lpChunk;
+				shareInfo.nextChunkNum = 0;
+				shareInfo.onPrepare = i_onPrepare;
+				shareInfo.errorCode = ErrorCode::ERROR_CODE_NONE;
+
+				// ĂяõXbĥ݂ŏ
+				if(i_threadCount <= 1 || i_poolSize == 0)
+				{
+					UpdateWorkerProc(&shareInfo);
+					return shareInfo.errorCode;
+				}
+
+				std::lock_guard<std::mutex> processLock(this->m_processMutex);
+
+				// XbhύXꂽꍇ͍蒼.
+				// Jn_̔ԍ͍쐬OɎ擾ēn. XbhŎ擾ƁȀ̊Jn肱ڂꍇ
+				if(this->m_lpThread.size() != i_poolSize)
+				{
+					this->StopWorker();
+
+					U64 generation = 0;
+					{
+						std::lock_guard<std::mutex> lock(this->m_mutex);
+						generation = this->m_generation;
+					}
+					for(U32 threadNum=0; threadNum<i_poolSize; threadNum++)
+						this->m_lpThread.push_back(std::thread(&UpdateThreadPool::WorkerThread, this, threadNum, generation));
+				}
+
+				// [J[Xbh̏Jn
+				{
+					std::lock_guard<std::mutex> lock(this->m_mutex);
+					this->m_pShareInfo = &shareInfo;
+					this->m_useWorkerCount = std::min<U32>(i_threadCount - 1, i_poolSize);
+					this->m_runningCount = this->m_useWorkerCount;
+					this->m_generation++;
+				}
+				this->m_startCondition.notify_all();
+
+				UpdateWorkerProc(&shareInfo);
+
+				// S[J[Xbh̊ҋ@. ܂shareInfojȂ
+				{
+					std::unique_lock<std::mutex> lock(this->m_mutex);
+					this->m_doneCondition.wait(lock, [this](){ return this->m_runningCount == 0; });
+					this->m_pShareInfo = NULL;
+				}
+
+				return shareInfo.errorCode;
+			}
+
+			/** S[J[Xbh~.
+				̏ꍇ͊ҋ@Ă~. */
+			void Release()
+			{
+				std::lock_guard<std::mutex> processLock(this->m_processMutex);
+
+				this->StopWorker();
+			}
+
+		private:
+			/** S[J[Xbh~. m_processMutex擾ς݂ł邱 */
+			void StopWorker()
+			{
+				{
+					std::lock_guard<std::mutex> lock(this->m_mutex);
+					this->m_onStop = true;
+				}
+				this->m_startCondition.notify_all();
+				for(auto& thread : this->m_lpThread)
+					thread.join();
+				this->m_lpThread.clear();
+
+				this->m_onStop = false;
+			}
+
+			/** [J[Xbh̏.
+				̊Jnҋ@AQΏۂ̏ꍇ͍XV͈͂.
+				@param	i_threadNum		[J[Xbh̔ԍ.
+				@param	i_generation	쐬_̏ԍ. ɊJns. */
+			void WorkerThread(U32 i_threadNum, U64 i_generation)
+			{
+				U64 generation = i_generation;
+
+				for(;;)
+				{
+					UpdateShareInfo* pShareInfo = NULL;
+					{
+						std::unique_lock<std::mutex> lock(this->m_mutex);
+						this->m_startCondition.wait(lock, [this, generation](){ return this->m_onStop || this->m_generation != generation; });
+						if(this->m_onStop)
+							break;
+
+						generation = this->m_generation;
+						if(i_threadNum >= this->m_useWorkerCount)
+							continue;
+						pShareInfo = this->m_pShareInfo;
+					}
+
+					UpdateWorkerProc(pShareInfo);
+
+					{
+						std::lock_guard<std::mutex> lock(this->m_mutex);
+						this->m_runningCount--;
+						if(this->m_runningCount == 0)
+							this->m_doneCondition.notify_all();
+					}
+				}
+			}
+		};
+
+		/** ꊇXVɎgpXbhv[ */
+		static UpdateThreadPool g_updateThreadPool;
+	}
+
+	/** ̃p[^ꊇōXV.
+		SΏۂ̗vf̑傫ɕAXbhōXV.
+		eΏۂ̃nCp[p[^͑Ώۂ̃IveB}CU̐ݒɏ].
+		wPʂ̐MgpΏۂꍇ́AɑS͈͂̃mWvĂXV.
+		XVɎsΏۂĂc̑Ώۂ͍XVAŏɔG[Ԃ.
+		@param	i_lpTarget		XVΏۂ̔z.
+		@param	i_targetCount	XVΏۂ̐. */
+	Optimizer_API ErrorCode UpdateParameterMulti_CPU(const OptimizerUpdateTarget i_lpTarget[], U32 i_targetCount)
+	{
+		ErrorCode result = ErrorCode::ERROR_CODE_NONE;
+
+		// eΏۂ̍XVJnAXV͈͂𕪊
+		std::vector<UpdateChunk> lpChunk;
+		std::vector<IOptimizer_LayerWise*> lpLayerWise;
+		U64 totalParameterCount = 0;
+		for(U32 targetNum=0; targetNum<i_targetCount; targetNum++)
+		{
+			const OptimizerUpdateTarget& target = i_lpTarget[targetNum];
+			if(target.pOptimizer == NULL || target.lpParameter == NULL || target.lpDParameter == NULL)
+				continue;
+
+			const F32* lpDParameter = NULL;
+			ErrorCode err = target.pOptimizer->BeginUpdateParameter(target.lpDParameter, lpDParameter);
+			if(err != ErrorCode::ERROR_CODE_NONE)
+			{
+				if(result == ErrorCode::ERROR_CODE_NONE)
+					result = err;
+				continue;
+			}
+
+			IOptimizer_LayerWise* pLayerWise = dynamic_cast<IOptimizer_LayerWise*>(target.pOptimizer);
+			if(pLayerWise)
+				lpLayerWise.push_back(pLayerWise);
+
+			U64 parameterCount = target.pOptimizer->GetParameterCount();
+			for(U64 offset=0; offset<parameterCount; offset+=UPDATE_CHUNK_SIZE)
+			{
+				UpdateChunk chunk;
+				chunk.pOptimizer   = target.pOptimizer;
+				chunk.pLayerWise   = pLayerWise;
+				chunk.lpParameter  = target.lpParameter;
+				chunk.lpDParameter = lpDParameter;
+				chunk.offset = offset;
+				chunk.count  = std::min<U64>(UPDATE_CHUNK_SIZE, parameterCount - offset);
+
+				lpChunk.push_back(chunk);
+			}
+			totalParameterCount += parameterCount;
+		}
+		if(lpChunk.empty())
+			return result;
+
+		// Xbh
+		U32 poolThreadCount = g_updateThreadCount_CPU;
+		if(poolThreadCount == 0)
+			poolThreadCount = std::thread::hardware_concurrency();
+		if(poolThreadCount == 0)
+			poolThreadCount = 1;
+		U32 threadCount = poolThreadCount;
+		if(totalParameterCount < UPDATE_MULTITHREAD_MIN_COUNT)
+			threadCount = 1;
+		threadCount = (U32)std::min<U64>(threadCount, lpChunk.size());
+
+		// wPʂ̐Mm
+		if(!lpLayerWise.empty())
+		{
+			ErrorCode err = g_updateThreadPool.Process(lpChunk, poolThreadCount - 1, threadCount, true);
+			if(err != ErrorCode::ERROR_CODE_NONE && result == ErrorCode::ERROR_CODE_NONE)
+				result = err;
+
+			for(U32 layerWiseNum=0; layerWiseNum<lpLayerWise.size(); layerWiseNum++)
+			{
+				err = lpLayerWise[layerWiseNum]->EndPrepareParameter();
+				if(err != ErrorCode::ERROR_CODE_NONE && result == ErrorCode::ERROR_CODE_NONE)
+					result = err;
+			}
+		}
+
+		// XV
+		ErrorCode err = g_updateThreadPool.Process(lpChunk, poolThreadCount - 1, threadCount, false);
+		if(result == ErrorCode::ERROR_CODE_NONE)
+			result = err;
+
+		return result;
+	}
+
+	/** ̃p[^ꊇōXV.
+		eΏۂ̍XVɔs.
+		XVɎsΏۂĂc̑Ώۂ͍XVAŏɔG[Ԃ.
+		@param	i_lpTarget		XVΏۂ̔z.
+		@param	i_targetCount	XVΏۂ̐. */
+	Optimizer_API ErrorCode UpdateParameterMulti_GPU(const OptimizerUpdateTarget i_lpTarget[], U32 i_targetCount)
+	{
+		ErrorCode result = ErrorCode::ERROR_CODE_NONE;
+
+		for(U32 targetNum=0; targetNum<i_targetCount; targetNum++)
+		{
+			const OptimizerUpdateTarget& target = i_lpTarget[targetNum];
+			if(target.pOptimizer == NULL || target.lpParameter == NULL || target.lpDParameter == NULL)
+				continue;
+
+			const F32* lpDParameter = NULL;
+			ErrorCode err = target.pOptimizer->BeginUpdateParameter(target.lpDParameter, lpDParameter);
+			if(err == ErrorCode::ERROR_CODE_NONE)
+				err = target.pOptimizer->UpdateParameterRange(target.lpParameter, lpDParameter, 0, target.pOptimizer->GetParameterCount());
+
+			if(err != ErrorCode::ERROR_CODE_NONE && result == ErrorCode::ERROR_CODE_NONE)
+				result = err;
+		}
+
+		return result;
+	}
+
+	/** ꊇXVɎgpXbhݒ肷.
+		@param	i_threadCount	Xbh. 0̏ꍇ͘_RAgp. */
+	Optimizer_API void SetUpdateThreadCount_CPU(U32 i_threadCount)
+	{
+		g_updateThreadCount_CPU = i_threadCount;
+	}
+
+	/** ꊇXVɎgpXbhv[~.
+		DLLOɌĂяo. ȍ~̈ꊇXVōēx쐬. */
+	Optimizer_API void ReleaseUpdateThreadPool_CPU(void)
+	{
+		g_updateThreadPool.Release();
+	}
+
+}	// NeuralNetwork
+}	// Layer
+}	// Gravisbell
@@ -4,8 +4,13 @@
 #include"stdafx.h"
 
 #include<stdio.h>
+#include<atomic>
+#include<vector>
 
 #include"Optimizer_SGD_base.h"
+#include"Optimizer_GradientReducer.h"
+#include"Optimizer_Kernel_CPU.h"
+#include"Library/NeuralNetwork/Optimizer.h"
 
 namespace Gravisbell {
 namespace Layer {
@@ -13,6 +18,9 @@ namespace NeuralNetwork {
 
 	class Optimizer_SGD_CPU : public Optimizer_SGD_base
 	{
+	private:
+		std::vector<F32> lpReduceBuffer;	/**< ωʏWp̍ƃobt@ */
+
 	public:
 		/** RXgN^ */
 		Optimizer_SGD_CPU(U64 i_parameterCount)
@@ -33,9 +41,118 @@ namespace NeuralNetwork {
 			@param io_lpDParameter	p[^̕ω. */
 		ErrorCode UpdateParameter(F32 io_lpParameter[], const F32 i_lpDParameter[])
 		{
-			for(U32 paramNum=0; paramNum<this->m_parameterCount; paramNum++)
+			// 񓯊XV͑XbhƕsČĂ΂邽߁AɍXV.
+			// Wp̍ƃobt@̓XbhԂŋL邽߁A񓯊XVɐݒ肳ꂽW񃋁[`͎gpɃG[Ƃ
+			if(this->m_asyncUpdate)
 			{
-				io_lpParameter[paramNum] += this->m_learnCoeff * i_lpDParameter[paramNum];
+				if(GetGradientReducer_CPU() != NULL)
+					return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+
+				return this->UpdateParameterRange(io_lpParameter, i_lpDParameter, 0, this->m_parameterCount);
+			}
+
+			// vfꍇ͔͈͂𕪊ĕXbhōXV
+			OptimizerUpdateTarget target = {this, io_lpParameter, i_lpDParameter};
+			return UpdateParameterMulti_CPU(&target, 1);
+		}
+
+		/** p[^̕XVJn.
+			@param	i_lpDParameter	p[^̕ω.
+			@param	o_lpDParameter	UpdateParameterRangeɓnωʂ̊i[. */
+		ErrorCode BeginUpdateParameter(const F32 i_lpDParameter[], const F32*& o_lpDParameter)
+		{
+			// ωʂW
+			return ReduceGradient_CPU(i_lpDParameter, this->m_parameterCount, this->lpReduceBuffer, o_lpDParameter);
+		}
+		/** p[^̈ꕔXV.
+			@param	io_lpParamter	XVp[^̐擪.
+			@param	i_lpDParameter	BeginUpdateParameterŎ擾ωʂ̐擪.
+			@param	i_offset		XV͈͂̊Jnʒu.
+			@param	i_count			XV͈̗͂vf. */
+		ErrorCode UpdateParameterRange(F32 io_lpParameter[], const F32 i_lpDParameter[], U64 i_offset, U64 i_count)
+		{
+			if(this->m_asyncUpdate)
+				return this->UpdateParameter_async(&io_lpParameter[i_offset], &i_lpDParameter[i_offset], i_count);
+
+			F32* lpParameter = &io_lpParameter[i_offset];
+			const F32* lpDParameter = &i_lpDParameter[i_offset];
+			const F32 learnCoeff = this->m_learnCoeff;
+
+			if(GetReferenceMode_CPU())
+			{
+				for(U64 paramNum=0; paramNum<i_count; paramNum++)
+				{
+					lpParameter[paramNum] += learnCoeff * lpDParameter[paramNum];
+				}
+			}
+			else
+			{
+				UpdateParameterKernel_SGD_CPU(lpParameter, lpDParameter, i_count, learnCoeff);
+			}
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+
+		/** ωʂŝ݂w肵ăp[^XV.
+			ԂȂ߁Aw肳ꂽs̗vf݂̂XV.
+			@param	io_lpParamter	XVp[^.
+			@param	i_lpDParameter	p[^̕ω. p[^̗vf.
+			@param	i_rowCount		1ubN̍s.
+			@param	i_rowSize		1s̗vf.
+			@param	i_lpRowNum		ωʂsԍ̔z. dȂ.
+			@param	i_rowNumCount	sԍ̐. */
+		ErrorCode UpdateParameterSparse(F32 io_lpParameter[], const F32 i_lpDParameter[], U32 i_rowCount, U32 i_rowSize, const U32 i_lpRowNum[], U32 i_rowNumCount)
+		{
+			// W񃋁[`͑SvfΏۂƂ邽߁AW񂷂ꍇ͑ŜXV
+			if(GetGradientReducer_CPU() != NULL || i_rowCount == 0 || i_rowSize == 0 || this->m_parameterCount % ((U64)i_rowCount * i_rowSize) != 0)
+				return this->UpdateParameter(io_lpParameter, i_lpDParameter);
+
+			U64 blockCount = this->m_parameterCount / ((U64)i_rowCount * i_rowSize);
+			for(U32 rowIndex=0; rowIndex<i_rowNumCount; rowIndex++)
+			{
+				U32 rowNum = i_lpRowNum[rowIndex];
+				if(rowNum >= i_rowCount)
+					continue;
+
+				for(U64 blockNum=0; blockNum<blockCount; blockNum++)
+				{
+					ErrorCode err = this->UpdateParameterRange(io_lpParameter, i_lpDParameter, (blockNum * i_rowCount + rowNum) * i_rowSize, i_rowSize);
+					if(err != ErrorCode::ERROR_CODE_NONE)
+						return err;
+				}
+			}
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+		/** aȍXVŒxĂsSčŐV̏Ԃɂ.
+			ԂAw肳Ȃs̍XVʂ0̂ߒxĂs݂͑Ȃ. */
+		ErrorCode ApplyLaggingUpdate(F32 io_lpParameter[])
+		{
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+
+	private:
+		/** p[^񓯊ɍXV.
+			XbhƋLĂp[^bNɍXV.
+			ωʂ0̗vfɂ͏܂Ȃ߁Aaȓ͂ł͋قƂǔȂ.
+			ꍇ̍XV̎肱ڂ͋e.
+			@param io_lpParamter	XVp[^.
+			@param io_lpDParameter	p[^̕ω.
+			@param i_count			XVvf. */
+		ErrorCode UpdateParameter_async(F32 io_lpParameter[], const F32 i_lpDParameter[], U64 i_count)
+		{
+			static_assert(sizeof(std::atomic<F32>) == sizeof(F32), "std::atomic<F32> must have the same size as F32");
+
+			std::atomic<F32>* lpParameter = reinterpret_cast<std::atomic<F32>*>(io_lpParameter);
+
+			for(U64 paramNum=0; paramNum<i_count; paramNum++)
+			{
+				F32 dParameter = i_lpDParameter[paramNum];
+				if(dParameter == 0.0f)
+					continue;
+
+				F32 value = lpParameter[paramNum].load(std::memory_order_relaxed);
+				lpParameter[paramNum].store(value + this->m_learnCoeff * dParameter, std::memory_order_relaxed);
 			}
 
 			return ErrorCode::ERROR_CODE_NONE;
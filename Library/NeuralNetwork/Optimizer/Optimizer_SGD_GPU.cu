@@ -46,18 +46,50 @@ namespace NeuralNetwork {
 			@param io_lpParamter	XVp[^.
 			@param io_lpDParameter	p[^̕ω. */
 		ErrorCode UpdateParameter(F32 io_lpParameter[], const F32 i_lpDParameter[])
+		{
+			return this->UpdateParameterRange(io_lpParameter, i_lpDParameter, 0, this->m_parameterCount);
+		}
+
+		/** p[^̕XVJn.
+			@param	i_lpDParameter	p[^̕ω.
+			@param	o_lpDParameter	UpdateParameterRangeɓnωʂ̊i[. */
+		ErrorCode BeginUpdateParameter(const F32 i_lpDParameter[], const F32*& o_lpDParameter)
+		{
+			o_lpDParameter = i_lpDParameter;
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+		/** p[^̈ꕔXV.
+			@param	io_lpParamter	XVp[^̐擪.
+			@param	i_lpDParameter	BeginUpdateParameterŎ擾ωʂ̐擪.
+			@param	i_offset		XV͈͂̊Jnʒu.
+			@param	i_count			XV͈̗͂vf. */
+		ErrorCode UpdateParameterRange(F32 io_lpParameter[], const F32 i_lpDParameter[], U64 i_offset, U64 i_count)
 		{
 			cublasSaxpy_v2(
 				this->cublasHandle,
-				this->m_parameterCount,
+				(int)i_count,
 				&this->m_learnCoeff,
-				i_lpDParameter,
+				&i_lpDParameter[i_offset],
 				1,
-				io_lpParameter,
+				&io_lpParameter[i_offset],
 				1);
 
 			return ErrorCode::ERROR_CODE_NONE;
 		}
+
+		/** ωʂŝ݂w肵ăp[^XV.
+			GPUł͑ŜXV. w肳ĂȂs̕ωʂ0̂ߌʂ͕ςȂ. */
+		ErrorCode UpdateParameterSparse(F32 io_lpParameter[], const F32 i_lpDParameter[], U32 i_rowCount, U32 i_rowSize, const U32 i_lpRowNum[], U32 i_rowNumCount)
+		{
+			return this->UpdateParameter(io_lpParameter, i_lpDParameter);
+		}
+		/** aȍXVŒxĂsSčŐV̏Ԃɂ.
+			GPUł͏ɑŜXV邽߁AxĂs݂͑Ȃ. */
+		ErrorCode ApplyLaggingUpdate(F32 io_lpParameter[])
+		{
+			return ErrorCode::ERROR_CODE_NONE;
+		}
 	};
 
 	/** IveB}CU쐬 */
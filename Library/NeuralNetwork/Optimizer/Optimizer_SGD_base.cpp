@@ -4,6 +4,7 @@
 #include"stdafx.h"
 
 #include"Optimizer_SGD_base.h"
+#include"Library/NeuralNetwork/Optimizer.h"
 
 namespace Gravisbell {
 namespace Layer {
@@ -15,6 +16,7 @@ namespace NeuralNetwork {
 	Optimizer_SGD_base::Optimizer_SGD_base(U64 i_parameterCount)
 		:	m_parameterCount	(i_parameterCount)
 		,	m_learnCoeff		(1.0f)
+		,	m_asyncUpdate		(false)
 	{
 	}
 	/** fXgN^ */
@@ -30,6 +32,12 @@ namespace NeuralNetwork {
 	const wchar_t* Optimizer_SGD_base::GetOptimizerID()const
 	{
 		return OPTIMIZER_ID.c_str();
+	}
+
+	/** p[^擾 */
+	U64 Optimizer_SGD_base::GetParameterCount()const
+	{
+		return this->m_parameterCount;
 	}
 
 	/** nCp[p[^ݒ肷
@@ -54,7 +62,21 @@ namespace NeuralNetwork {
 		@param	i_value			p[^. */
 	ErrorCode Optimizer_SGD_base::SetHyperParameter(const wchar_t i_parameterID[], S32 i_value)
 	{
-		return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+		std::wstring parameter = i_parameterID;
+		if(parameter == L"AsyncUpdate")
+		{
+			// W񃋁[`͍ƃobt@XbhԂŋL邽߁AW񂷂ꍇ͔񓯊XVłȂ
+			if(i_value != 0 && GetGradientReducer_CPU() != NULL)
+				return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+
+			this->m_asyncUpdate = (i_value != 0);
+		}
+		else
+		{
+			return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+		}
+
+		return ErrorCode::ERROR_CODE_NONE;
 	}
 	/** nCp[p[^ݒ肷
 		@param	i_parameterID	p[^ʗpID
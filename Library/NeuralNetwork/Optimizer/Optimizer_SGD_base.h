@@ -19,6 +19,8 @@ namespace NeuralNetwork {
 		U64 m_parameterCount;	/**< p[^ */
 		F32 m_learnCoeff;	/**< wKW */
 
+		bool m_asyncUpdate;	/**< 񓯊XVtO. Xbh烍bNɓp[^XV(Hogwild!) */
+
 	public:
 		/** RXgN^ */
 		Optimizer_SGD_base(U64 i_parameterCount);
@@ -31,6 +33,9 @@ namespace NeuralNetwork {
 		//===========================
 		/** ID̎擾 */
 		const wchar_t* GetOptimizerID()const;
+
+		/** p[^擾 */
+		U64 GetParameterCount()const;
 
 		/** nCp[p[^ݒ肷
 			@param	i_parameterID	p[^ʗpID
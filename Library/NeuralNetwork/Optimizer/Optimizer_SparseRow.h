@@ -0,0 +1,175 @@
+//===============================================
+// œK[`̑aȍsXV̊Ǘ
+// sƂ̍ŏIXV񐔂L^AXVȗs̓Ԃ̌ォ甽f
+//===============================================
+#ifndef __GRAVISBELL_NN_OPTIMIZER_SPARSE_ROW_H__
+#define __GRAVISBELL_NN_OPTIMIZER_SPARSE_ROW_H__
+
+#include"Layer/NeuralNetwork/IOptimizer.h"
+
+#include<math.h>
+#include<vector>
+
+namespace Gravisbell {
+namespace Layer {
+namespace NeuralNetwork {
+
+	/** aȍsXV̊Ǘ.(CPU)
+		p[^[ubN][s][s̗vf]̔zƂ݂ȂAsPʂōXV񐔂L^.
+		aȍXVԂ͍XVȂsxꂽԂƂȂA
+		Ŝ̍XVsƊevf̒x𔽉fɋL^j. */
+	class OptimizerSparseRow
+	{
+	private:
+		U32 m_rowCount;		/**< s */
+		U32 m_rowSize;		/**< 1s̗vf */
+
+		U32 m_step;						/**< aȍXVJnĂ̍XV */
+		std::vector<U32> m_lpLastStep;	/**< sƂ̍ŏIXV̍XV */
+
+		bool m_onLagging;	/**< xĂs݂ */
+		bool m_onFlushing;	/**< Ŝ̍XVŒx𔽉fĂŒ */
+
+	public:
+		/** RXgN^ */
+		OptimizerSparseRow()
+			:	m_rowCount	(0)
+			,	m_rowSize	(0)
+			,	m_step		(0)
+			,	m_onLagging	(false)
+			,	m_onFlushing(false)
+		{
+		}
+
+	public:
+		/** aȍXVJn.
+			@param	i_parameterCount	p[^.
+			@param	i_rowCount			s.
+			@param	i_rowSize			1s̗vf.
+			@return	aȍXV\ȏꍇtrue. falsȅꍇ͑ŜXV邱. */
+		bool BeginSparse(U64 i_parameterCount, U32 i_rowCount, U32 i_rowSize)
+		{
+			if(this->m_onFlushing)
+				this->Reset();
+
+			if(i_rowCount == 0 || i_rowSize == 0 || i_parameterCount % ((U64)i_rowCount * i_rowSize) != 0)
+				return false;
+
+			if(this->m_onLagging)
+			{
+				// xĂsԂ͍s̍\ύXłȂ
+				if(this->m_rowCount != i_rowCount || this->m_rowSize != i_rowSize)
+					return false;
+			}
+			else
+			{
+				this->m_rowCount = i_rowCount;
+				this->m_rowSize  = i_rowSize;
+				this->m_step = 0;
+				this->m_lpLastStep.assign(i_rowCount, 0);
+				this->m_onLagging = true;
+			}
+
+			this->m_step++;
+
+			return true;
+		}
+		/** aȍXVōsXVς݂ƂċL^.
+			@param	i_rowNum				sԍ.
+			@param	o_skippedStepCount		̍XV̑OɏȗꂽXV񐔂̊i[.
+			@return	XVKvꍇtrue. ͈͊O̍s⓯̍XVŋL^ς݂̍sfalse. */
+		bool TouchRow(U32 i_rowNum, U32& o_skippedStepCount)
+		{
+			if(i_rowNum >= this->m_rowCount || this->m_lpLastStep[i_rowNum] == this->m_step)
+				return false;
+
+			o_skippedStepCount = this->m_step - 1 - this->m_lpLastStep[i_rowNum];
+			this->m_lpLastStep[i_rowNum] = this->m_step;
+
+			return true;
+		}
+
+		/** Ŝ̍XVJn.
+			xĂsꍇ͔f̏ԂƂȂA̍XV̊JnɋL^j. */
+		void BeginDense()
+		{
+			if(this->m_onFlushing)
+				this->Reset();
+			else if(this->m_onLagging)
+				this->m_onFlushing = true;
+		}
+		/** L^j */
+		void Reset()
+		{
+			this->m_onLagging  = false;
+			this->m_onFlushing = false;
+		}
+
+		/** xĂs݂AԂŐVłȂ */
+		bool IsLagging()const
+		{
+			return this->m_onLagging && !this->m_onFlushing;
+		}
+		/** Ŝ̍XVŒx𔽉fKv邩 */
+		bool IsFlushing()const
+		{
+			return this->m_onFlushing;
+		}
+
+		/** s擾 */
+		U32 GetRowCount()const
+		{
+			return this->m_rowCount;
+		}
+		/** 1s̗vf擾 */
+		U32 GetRowSize()const
+		{
+			return this->m_rowSize;
+		}
+		/** s̒xĂXV񐔂擾.
+			@param	i_rowNum	sԍ. */
+		U32 GetRowSkippedStepCount(U32 i_rowNum)const
+		{
+			return this->m_step - this->m_lpLastStep[i_rowNum];
+		}
+
+		/** vf̒xĂXV񐔂擾.
+			@param	i_paramNum	p[^Ŝł̗vfԍ. */
+		U32 GetSkippedStepCount(U64 i_paramNum)const
+		{
+			return this->m_step - this->m_lpLastStep[(i_paramNum / this->m_rowSize) % this->m_rowCount];
+		}
+
+		/** xĂXV񐔕̌Ԃɔf.
+			x = decay^k * x
+			@param	io_lpState	Ԃ̐擪. i_offsetԖڂ̗vfw.
+			@param	i_offset	擪vf̃p[^Ŝł̗vfԍ.
+			@param	i_count		vf.
+			@param	i_decay		1̍XV̌. */
+		void DecayLaggingState(F32 io_lpState[], U64 i_offset, U64 i_count, F32 i_decay)const
+		{
+			U32 lastSkippedCount = 0;
+			F32 lastDecay = 1.0f;
+			for(U64 paramNum=0; paramNum<i_count; paramNum++)
+			{
+				U32 skippedCount = this->GetSkippedStepCount(i_offset + paramNum);
+				if(skippedCount == 0)
+					continue;
+
+				// sꍇ͌g
+				if(skippedCount != lastSkippedCount)
+				{
+					lastSkippedCount = skippedCount;
+					lastDecay = powf(i_decay, (F32)skippedCount);
+				}
+
+				io_lpState[paramNum] *= lastDecay;
+			}
+		}
+	};
+
+}	// NeuralNetwork
+}	// Layer
+}	// Gravisbell
+
+#endif	// __GRAVISBELL_NN_OPTIMIZER_SPARSE_ROW_H__
@@ -0,0 +1,130 @@
+//===============================================
+// œK[`̓Ԃ̊i[x
+//===============================================
+#include"stdafx.h"
+
+#include<string>
+
+#include"Optimizer_StateType.h"
+
+namespace Gravisbell {
+namespace Layer {
+namespace NeuralNetwork {
+
+	/** nCp[p[^̕񂩂i[x擾.
+		@param	i_value			"F32", "BF16", "FP16"̂ꂩ.
+		@param	o_stateType		i[x̊i[.
+		@return	Ήi[x݂ꍇtrue */
+	bool GetOptimizerStateTypeFromString(const wchar_t i_value[], OptimizerStateType& o_stateType)
+	{
+		std::wstring value = i_value;
+		if(value == L"F32")
+		{
+			o_stateType = OPTIMIZER_STATE_TYPE_F32;
+		}
+		else if(value == L"BF16")
+		{
+			o_stateType = OPTIMIZER_STATE_TYPE_BF16;
+		}
+		else if(value == L"FP16")
+		{
+			o_stateType = OPTIMIZER_STATE_TYPE_FP16;
+		}
+		else
+		{
+			return false;
+		}
+
+		return true;
+	}
+
+	/** 1z̕ۑɕKvȃoCg擾.
+		kx̏ꍇ4oCgEɑ. */
+	U64 GetOptimizerStateByteCount(OptimizerStateType i_stateType, U64 i_parameterCount)
+	{
+		if(i_stateType == OPTIMIZER_STATE_TYPE_F32)
+			return sizeof(F32) * i_parameterCount;
+
+		return (sizeof(U16) * i_parameterCount + 3) / 4 * 4;
+	}
+
+	/** 1z̊i[xύX.(CPU)
+		Px̏ꍇio_lpStateAkx̏ꍇio_lpReducedStategpAgpȂ͉.
+		@param	io_lpState			Px̓.
+		@param	io_lpReducedState	kx̓.
+		@param	i_parameterCount	vf.
+		@param	i_currentStateType	݂̊i[x.
+		@param	i_newStateType		ύX̊i[x.
+		@param	i_seed				mIۂ߂̗̎. */
+	void ChangeOptimizerStateType_CPU(std::vector<F32>& io_lpState, std::vector<U16>& io_lpReducedState, U64 i_parameterCount, OptimizerStateType i_currentStateType, OptimizerStateType i_newStateType, U32 i_seed)
+	{
+		if(i_currentStateType == i_newStateType)
+			return;
+
+		// PxɓWJ
+		if(i_currentStateType != OPTIMIZER_STATE_TYPE_F32)
+		{
+			io_lpState.resize(i_parameterCount);
+			for(U64 paramNum=0; paramNum<i_parameterCount; paramNum++)
+				io_lpState[paramNum] = ConvertOptimizerStateToF32(io_lpReducedState[paramNum], i_currentStateType);
+
+			std::vector<U16>().swap(io_lpReducedState);
+		}
+
+		// kxɊi[
+		if(i_newStateType != OPTIMIZER_STATE_TYPE_F32)
+		{
+			io_lpReducedState.resize(i_parameterCount);
+			for(U64 paramNum=0; paramNum<i_parameterCount; paramNum++)
+				io_lpReducedState[paramNum] = ConvertF32ToOptimizerState(io_lpState[paramNum], i_newStateType, GetOptimizerStateNoise(paramNum, i_seed));
+
+			std::vector<F32>().swap(io_lpState);
+		}
+	}
+
+	/** 1zobt@ɏ.(CPU)
+		@return	񂾃oCg. GetOptimizerStateByteCount̖߂lƈv. */
+	U64 WriteOptimizerStateToBuffer_CPU(BYTE* o_lpBuffer, const std::vector<F32>& i_lpState, const std::vector<U16>& i_lpReducedState, U64 i_parameterCount, OptimizerStateType i_stateType)
+	{
+		U64 byteCount = GetOptimizerStateByteCount(i_stateType, i_parameterCount);
+		if(byteCount == 0)
+			return 0;
+
+		if(i_stateType == OPTIMIZER_STATE_TYPE_F32)
+		{
+			memcpy(o_lpBuffer, &i_lpState[0], sizeof(F32)*i_parameterCount);
+		}
+		else
+		{
+			// E̗]0Ŗ߂
+			memset(o_lpBuffer, 0, byteCount);
+			memcpy(o_lpBuffer, &i_lpReducedState[0], sizeof(U16)*i_parameterCount);
+		}
+
+		return byteCount;
+	}
+	/** 1zobt@ǂݍ.(CPU)
+		@return	ǂݍ񂾃oCg. GetOptimizerStateByteCount̖߂lƈv. */
+	U64 ReadOptimizerStateFromBuffer_CPU(const BYTE* i_lpBuffer, std::vector<F32>& o_lpState, std::vector<U16>& o_lpReducedState, U64 i_parameterCount, OptimizerStateType i_stateType)
+	{
+		U64 byteCount = GetOptimizerStateByteCount(i_stateType, i_parameterCount);
+		if(byteCount == 0)
+			return 0;
+
+		if(i_stateType == OPTIMIZER_STATE_TYPE_F32)
+		{
+			o_lpState.resize(i_parameterCount);
+			memcpy(&o_lpState[0], i_lpBuffer, sizeof(F32)*i_parameterCount);
+		}
+		else
+		{
+			o_lpReducedState.resize(i_parameterCount);
+			memcpy(&o_lpReducedState[0], i_lpBuffer, sizeof(U16)*i_parameterCount);
+		}
+
+		return byteCount;
+	}
+
+}	// NeuralNetwork
+}	// Layer
+}	// Gravisbell
@@ -0,0 +1,186 @@
+//===============================================
+// œK[`̓Ԃ̊i[x
+// CPU/GPUʂŎgpϊ
+//===============================================
+#ifndef __GRAVISBELL_NN_OPTIMIZER_STATE_TYPE_H__
+#define __GRAVISBELL_NN_OPTIMIZER_STATE_TYPE_H__
+
+#include"Layer/NeuralNetwork/IOptimizer.h"
+
+#ifdef __CUDACC__
+#pragma warning(push)
+#pragma warning(disable : 4267)
+#include <thrust/device_vector.h>
+#pragma warning(pop)
+#define OPTIMIZER_STATE_FUNC	__host__ __device__ inline
+#else
+#include<vector>
+#define OPTIMIZER_STATE_FUNC	inline
+#endif
+
+namespace Gravisbell {
+namespace Layer {
+namespace NeuralNetwork {
+
+	/** Ԃ̊i[x.
+		l̓obt@ɕۑ邽ߕύXȂ. */
+	enum OptimizerStateType
+	{
+		OPTIMIZER_STATE_TYPE_F32  = 0,	/**< Px */
+		OPTIMIZER_STATE_TYPE_BF16 = 1,	/**< bfloat16. w͒PxƓŉ7bit */
+		OPTIMIZER_STATE_TYPE_FP16 = 2,	/**< IEEEx. 10bitŔ͈͂́}65504 */
+
+		OPTIMIZER_STATE_TYPE_COUNT
+	};
+
+	/** nCp[p[^̕񂩂i[x擾.
+		@param	i_value			"F32", "BF16", "FP16"̂ꂩ.
+		@param	o_stateType		i[x̊i[.
+		@return	Ήi[x݂ꍇtrue */
+	bool GetOptimizerStateTypeFromString(const wchar_t i_value[], OptimizerStateType& o_stateType);
+
+	/** 1z̕ۑɕKvȃoCg擾.
+		kx̏ꍇ4oCgEɑ. */
+	U64 GetOptimizerStateByteCount(OptimizerStateType i_stateType, U64 i_parameterCount);
+
+#ifndef __CUDACC__
+	/** 1z̊i[xύX.(CPU)
+		Px̏ꍇio_lpStateAkx̏ꍇio_lpReducedStategpAgpȂ͉.
+		@param	io_lpState			Px̓.
+		@param	io_lpReducedState	kx̓.
+		@param	i_parameterCount	vf.
+		@param	i_currentStateType	݂̊i[x.
+		@param	i_newStateType		ύX̊i[x.
+		@param	i_seed				mIۂ߂̗̎. */
+	void ChangeOptimizerStateType_CPU(std::vector<F32>& io_lpState, std::vector<U16>& io_lpReducedState, U64 i_parameterCount, OptimizerStateType i_currentStateType, OptimizerStateType i_newStateType, U32 i_seed);
+
+	/** 1zobt@ɏ.(CPU)
+		@return	񂾃oCg. GetOptimizerStateByteCount̖߂lƈv. */
+	U64 WriteOptimizerStateToBuffer_CPU(BYTE* o_lpBuffer, const std::vector<F32>& i_lpState, const std::vector<U16>& i_lpReducedState, U64 i_parameterCount, OptimizerStateType i_stateType);
+	/** 1zobt@ǂݍ.(CPU)
+		@return	ǂݍ񂾃oCg. GetOptimizerStateByteCount̖߂lƈv. */
+	U64 ReadOptimizerStateFromBuffer_CPU(const BYTE* i_lpBuffer, std::vector<F32>& o_lpState, std::vector<U16>& o_lpReducedState, U64 i_parameterCount, OptimizerStateType i_stateType);
+#else
+	/** 1z̊i[xύX.(GPU)
+		Px̏ꍇio_lpStateAkx̏ꍇio_lpReducedStategpAgpȂ͉.
+		@param	io_lpState			Px̓.
+		@param	io_lpReducedState	kx̓.
+		@param	i_parameterCount	vf.
+		@param	i_currentStateType	݂̊i[x.
+		@param	i_newStateType		ύX̊i[x.
+		@param	i_seed				mIۂ߂̗̎. */
+	void ChangeOptimizerStateType_GPU(thrust::device_vector<F32>& io_lpState, thrust::device_vector<U16>& io_lpReducedState, U64 i_parameterCount, OptimizerStateType i_currentStateType, OptimizerStateType i_newStateType, U32 i_seed);
+
+	/** 1zobt@ɏ.(GPU)
+		@return	񂾃oCg. GetOptimizerStateByteCount̖߂lƈv. */
+	U64 WriteOptimizerStateToBuffer_GPU(BYTE* o_lpBuffer, const thrust::device_vector<F32>& i_lpState, const thrust::device_vector<U16>& i_lpReducedState, U64 i_parameterCount, OptimizerStateType i_stateType);
+	/** 1zobt@ǂݍ.(GPU)
+		@return	ǂݍ񂾃oCg. GetOptimizerStateByteCount̖߂lƈv. */
+	U64 ReadOptimizerStateFromBuffer_GPU(const BYTE* i_lpBuffer, thrust::device_vector<F32>& o_lpState, thrust::device_vector<U16>& o_lpReducedState, U64 i_parameterCount, OptimizerStateType i_stateType);
+#endif
+
+
+	/** mIۂ߂Ɏgp闐擾.
+		vfԍƎ킩狁߂邽߁AXV͈͂̕@Xbhɂ炸ʂ͈v. */
+	OPTIMIZER_STATE_FUNC U32 GetOptimizerStateNoise(U64 i_index, U32 i_seed)
+	{
+		U32 x = (U32)i_index ^ ((U32)(i_index >> 32) * 0x9E3779B9u) ^ (i_seed * 0x85EBCA6Bu);
+		x ^= x >> 16;
+		x *= 0x7FEB352Du;
+		x ^= x >> 15;
+		x *= 0x846CA68Bu;
+		x ^= x >> 16;
+
+		return x;
+	}
+
+	/** Px̃rbg擾 */
+	OPTIMIZER_STATE_FUNC U32 GetOptimizerStateF32Bits(F32 i_value)
+	{
+		union { F32 value; U32 bits; } convert;
+		convert.value = i_value;
+		return convert.bits;
+	}
+	/** rbg񂩂Px擾 */
+	OPTIMIZER_STATE_FUNC F32 GetOptimizerStateF32FromBits(U32 i_bits)
+	{
+		union { F32 value; U32 bits; } convert;
+		convert.bits = i_bits;
+		return convert.value;
+	}
+
+	/** kx̒lPxɕϊ */
+	OPTIMIZER_STATE_FUNC F32 ConvertOptimizerStateToF32(U16 i_value, OptimizerStateType i_stateType)
+	{
+		if(i_stateType == OPTIMIZER_STATE_TYPE_BF16)
+			return GetOptimizerStateF32FromBits((U32)i_value << 16);
+
+		// FP16
+		U32 sign     = (U32)(i_value & 0x8000) << 16;
+		U32 exponent = (i_value >> 10) & 0x1F;
+		U32 mantissa = i_value & 0x3FF;
+
+		if(exponent == 0)
+		{
+			// 񐳋K. mantissa * 2^-24
+			F32 value = (F32)mantissa * (1.0f / 16777216.0f);
+			return sign ? -value : value;
+		}
+		if(exponent == 0x1F)
+			return GetOptimizerStateF32FromBits(sign | 0x7F800000 | (mantissa << 13));
+
+		return GetOptimizerStateF32FromBits(sign | ((exponent + (127 - 15)) << 23) | (mantissa << 13));
+	}
+
+	/** Px̒lkxɊmIۂ߂ŕϊ.
+		؂̂ĂrbgɈlĂ؂̂Ă邽߁Aۂ߂̊Ғl͌̒lƈv.
+		͈͊O̒l͍őLlɖOa.
+		@param	i_noise		GetOptimizerStateNoiseŎ擾. */
+	OPTIMIZER_STATE_FUNC U16 ConvertF32ToOptimizerState(F32 i_value, OptimizerStateType i_stateType, U32 i_noise)
+	{
+		U32 bits    = GetOptimizerStateF32Bits(i_value);
+		U32 sign    = bits & 0x80000000;
+		U32 absBits = bits & 0x7FFFFFFF;
+
+		if(i_stateType == OPTIMIZER_STATE_TYPE_BF16)
+		{
+			// ,NaN͂̂܂
+			if(absBits >= 0x7F800000)
+				return (U16)((bits >> 16) | (absBits > 0x7F800000 ? 0x0040 : 0x0000));
+
+			absBits = (absBits + (i_noise & 0xFFFF)) >> 16;
+			if(absBits >= 0x7F80)
+				absBits = 0x7F7F;
+
+			return (U16)((sign >> 16) | absBits);
+		}
+
+		// FP16
+		if(absBits >= 0x7F800000)
+			return (U16)((sign >> 16) | (absBits > 0x7F800000 ? 0x7E00 : 0x7C00));
+
+		if(absBits >= 0x38800000)
+		{
+			// K. w̃oCAXtւẢ13bitۂ߂
+			U32 value = (absBits - ((127 - 15) << 23) + (i_noise & 0x1FFF)) >> 13;
+			if(value >= 0x7C00)
+				value = 0x7BFF;
+
+			return (U16)((sign >> 16) | value);
+		}
+
+		// 񐳋K. 2^-24Pʂ̐Ɋۂ߂
+		F32 scaled   = GetOptimizerStateF32FromBits(absBits) * 16777216.0f;
+		U32 integer  = (U32)scaled;
+		U32 fraction = (U32)((scaled - (F32)integer) * 16777216.0f);
+		if((i_noise & 0xFFFFFF) < fraction)
+			integer++;
+
+		return (U16)((sign >> 16) | integer);
+	}
+
+}	// NeuralNetwork
+}	// Layer
+}	// Gravisbell
+
+#endif	// __GRAVISBELL_NN_OPTIMIZER_STATE_TYPE_H__
@@ -0,0 +1,132 @@
+//===============================================
+// œK[`̓Ԃ̊i[x(GPU)
+//===============================================
+#include"stdafx.h"
+
+#include"Optimizer_StateType.h"
+
+// CUDAp
+#pragma warning(push)
+#pragma warning(disable : 4267)
+#include <cuda.h>
+#include <thrust/device_vector.h>
+#include "device_launch_parameters.h"
+#pragma warning(pop)
+
+#define BLOCK_SIZE	(32)
+
+namespace Gravisbell {
+namespace Layer {
+namespace NeuralNetwork {
+
+	namespace
+	{
+		/** kx̓ԂPxɓWJ. */
+		__global__ void cuda_func_decodeState(const U16* i_lpState, F32* o_lpValue, const U64 i_bufferSize, OptimizerStateType i_stateType)
+		{
+			const U32 paramNum = blockIdx.x * BLOCK_SIZE + threadIdx.x;
+			if(paramNum >= i_bufferSize)	// 򂷂邪warpȂ̂ŁAxɉe͂Ȃ͂...
+				return;
+
+			o_lpValue[paramNum] = ConvertOptimizerStateToF32(i_lpState[paramNum], i_stateType);
+		}
+		/** Px̒lkx̓ԂɊmIۂ߂Ŋi[. */
+		__global__ void cuda_func_encodeState(const F32* i_lpValue, U16* o_lpState, const U64 i_bufferSize, OptimizerStateType i_stateType, U32 i_seed)
+		{
+			const U32 paramNum = blockIdx.x * BLOCK_SIZE + threadIdx.x;
+			if(paramNum >= i_bufferSize)	// 򂷂邪warpȂ̂ŁAxɉe͂Ȃ͂...
+				return;
+
+			o_lpState[paramNum] = ConvertF32ToOptimizerState(i_lpValue[paramNum], i_stateType, GetOptimizerStateNoise(paramNum, i_seed));
+		}
+	}
+
+	/** 1z̊i[xύX.(GPU)
+		Px̏ꍇio_lpStateAkx̏ꍇio_lpReducedStategpAgpȂ͉.
+		@param	io_lpState			Px̓.
+		@param	io_lpReducedState	kx̓.
+		@param	i_parameterCount	vf.
+		@param	i_currentStateType	݂̊i[x.
+		@param	i_newStateType		ύX̊i[x.
+		@param	i_seed				mIۂ߂̗̎. */
+	void ChangeOptimizerStateType_GPU(thrust::device_vector<F32>& io_lpState, thrust::device_vector<U16>& io_lpReducedState, U64 i_parameterCount, OptimizerStateType i_currentStateType, OptimizerStateType i_newStateType, U32 i_seed)
+	{
+		if(i_currentStateType == i_newStateType || i_parameterCount == 0)
+			return;
+
+		dim3 grid((U32)((i_parameterCount +(BLOCK_SIZE - 1))/BLOCK_SIZE), 1, 1);
+		dim3 block(BLOCK_SIZE, 1, 1);
+
+		// PxɓWJ
+		if(i_currentStateType != OPTIMIZER_STATE_TYPE_F32)
+		{
+			io_lpState.resize(i_parameterCount);
+			cuda_func_decodeState<<<grid, block>>>(
+				thrust::raw_pointer_cast(&io_lpReducedState[0]),
+				thrust::raw_pointer_cast(&io_lpState[0]),
+				i_parameterCount,
+				i_currentStateType);
+
+			thrust::device_vector<U16>().swap(io_lpReducedState);
+		}
+
+		// kxɊi[
+		if(i_newStateType != OPTIMIZER_STATE_TYPE_F32)
+		{
+			io_lpReducedState.resize(i_parameterCount);
+			cuda_func_encodeState<<<grid, block>>>(
+				thrust::raw_pointer_cast(&io_lpState[0]),
+				thrust::raw_pointer_cast(&io_lpReducedState[0]),
+				i_parameterCount,
+				i_newStateType, i_seed);
+
+			thrust::device_vector<F32>().swap(io_lpState);
+		}
+	}
+
+	/** 1zobt@ɏ.(GPU)
+		@return	񂾃oCg. GetOptimizerStateByteCount̖߂lƈv. */
+	U64 WriteOptimizerStateToBuffer_GPU(BYTE* o_lpBuffer, const thrust::device_vector<F32>& i_lpState, const thrust::device_vector<U16>& i_lpReducedState, U64 i_parameterCount, OptimizerStateType i_stateType)
+	{
+		U64 byteCount = GetOptimizerStateByteCount(i_stateType, i_parameterCount);
+		if(byteCount == 0)
+			return 0;
+
+		if(i_stateType == OPTIMIZER_STATE_TYPE_F32)
+		{
+			cudaMemcpy(o_lpBuffer, thrust::raw_pointer_cast(&i_lpState[0]), sizeof(F32)*i_parameterCount, cudaMemcpyDeviceToHost);
+		}
+		else
+		{
+			// E̗]0Ŗ߂
+			memset(o_lpBuffer, 0, byteCount);
+			cudaMemcpy(o_lpBuffer, thrust::raw_pointer_cast(&i_lpReducedState[0]), sizeof(U16)*i_parameterCount, cudaMemcpyDeviceToHost);
+		}
+
+		return byteCount;
+	}
+	/** 1zobt@ǂݍ.(GPU)
+		@return	ǂݍ񂾃oCg. GetOptimizerStateByteCount̖߂lƈv. */
+	U64 ReadOptimizerStateFromBuffer_GPU(const BYTE* i_lpBuffer, thrust::device_vector<F32>& o_lpState, thrust::device_vector<U16>& o_lpReducedState, U64 i_parameterCount, OptimizerStateType i_stateType)
+	{
+		U64 byteCount = GetOptimizerStateByteCount(i_stateType, i_parameterCount);
+		if(byteCount == 0)
+			return 0;
+
+		if(i_stateType == OPTIMIZER_STATE_TYPE_F32)
+		{
+			o_lpState.resize(i_parameterCount);
+			cudaMemcpy(thrust::raw_pointer_cast(&o_lpState[0]), i_lpBuffer, sizeof(F32)*i_parameterCount, cudaMemcpyHostToDevice);
+		}
+		else
+		{
+			o_lpReducedState.resize(i_parameterCount);
+			cudaMemcpy(thrust::raw_pointer_cast(&o_lpReducedState[0]), i_lpBuffer, sizeof(U16)*i_parameterCount, cudaMemcpyHostToDevice);
+		}
+
+		return byteCount;
+	}
+
+}	// NeuralNetwork
+}	// Layer
+}	// Gravisbell
@@ -5,8 +5,12 @@
 #include"stdafx.h"
 
 #include<vector>
+#include<string>
+#include<mutex>
 
 #include"WeightData_Default.h"
+#include"WeightData_ParameterBuffer.h"
+#include"WeightData_PackedWeight.h"
 
 #include<Layer/NeuralNetwork/IOptimizer.h>
 #include<Library/NeuralNetwork/Optimizer.h>
@@ -20,11 +24,27 @@ namespace NeuralNetwork {
 	class WeightData_Default_CPU : public IWeightData
 	{
 	private:
-		std::vector<F32> lpWeight;
-		std::vector<F32> lpBias;
+		mutable ParameterBuffer<ParameterBufferTraits_CPU> lpWeight;	/**< _p͔jAQƂꂽ_ŕ */
+		ParameterBuffer<ParameterBufferTraits_CPU> lpBias;
+
+		F32* pDWeight;	/**< Ǒ덷̈. 蓖ĂĂȂꍇNULL */
+		F32* pDBias;	/**< Ǒ덷̈. 蓖ĂĂȂꍇNULL */
 
+		ParameterBufferTraits_CPU::VectorType lpDWeight;	/**< ꊇXVp̌덷̈. Ǒ덷̈悪蓖ĂĂȂꍇɎgp */
+		ParameterBufferTraits_CPU::VectorType lpDBias;		/**< ꊇXVp̌덷̈. Ǒ덷̈悪蓖ĂĂȂꍇɎgp */
+
+		bool onDeferredUpdate;	/**< XVxtO */
+		bool onUpdatePending;	/**< fĂȂ덷i[ĂtO */
+
 		IOptimizer* m_pOptimizer_weight;	/**< dݍXVpIveB}CU */
 		IOptimizer* m_pOptimizer_bias;		/**< oCAXXVpIveB}CU */
+
+		mutable U64 dataVersion;		/**< Weight,Bias̔Ő */
+		mutable bool onSparseLagging;	/**< aȍXVŃIveB}CUɒxĂs݂\ */
+		bool onInferenceOnly;			/**< _ptO */
+		std::vector<PackedWeight_CPU> lpPackedWeight;	/**< ϊςWeight. [layout] */
+		mutable bool onPlainWeightUsed;	/**< _pɂɌ̕тWeightQƂꂽ. QƂꂽꍇ͔jȂ */
+		mutable std::mutex packMutex;	/**< ϊςWeightƁA̕тWeight̔j/̔r */
 
 
 	public:
@@ -35,8 +55,17 @@ namespace NeuralNetwork {
 		WeightData_Default_CPU(U32 i_neuronCount, U32 i_inputCount)
 			:	lpWeight			(i_neuronCount * i_inputCount)
 			,	lpBias				(i_neuronCount)
+			,	pDWeight			(NULL)
+			,	pDBias				(NULL)
+			,	onDeferredUpdate	(false)
+			,	onUpdatePending		(false)
 			,	m_pOptimizer_weight	(NULL)
 			,	m_pOptimizer_bias	(NULL)
+			,	dataVersion			(0)
+			,	onSparseLagging		(false)
+			,	onInferenceOnly		(false)
+			,	onPlainWeightUsed	(false)
+			,	lpPackedWeight		(WEIGHT_LAYOUT_COUNT, PackedWeight_CPU(i_neuronCount, i_inputCount))
 		{
 		}
 		/** fXgN^ */
@@ -56,6 +85,10 @@ namespace NeuralNetwork {
 		{
 			auto& initializer = Gravisbell::Layer::NeuralNetwork::GetInitializerManager().GetInitializer(i_initializerID);
 
+			this->ApplyLaggingUpdate();
+			this->RestoreWeight();
+			this->dataVersion++;
+
 			// j[
 			for(unsigned int weightNum=0; weightNum<this->lpWeight.size(); weightNum++)
 			{
@@ -72,6 +105,10 @@ namespace NeuralNetwork {
 		S64 InitializeFromBuffer(const BYTE* i_lpBuffer, U64 i_bufferSize)
 		{
 			S64 readBufferByte = 0;
+
+			this->ApplyLaggingUpdate();
+			this->RestoreWeight();
+			this->dataVersion++;
 			
 			// j[W
 			memcpy(&this->lpWeight[0], &i_lpBuffer[readBufferByte], this->lpWeight.size() * sizeof(F32));
@@ -81,7 +118,6 @@ namespace NeuralNetwork {
 			memcpy(&this->lpBias[0], &i_lpBuffer[readBufferByte], this->lpBias.size() * sizeof(F32));
 			readBufferByte += (int)this->lpBias.size() * sizeof(F32);
 
-
 			// IveB}CU
 			S64 useBufferSize = 0;
 			// weight
@@ -94,6 +130,10 @@ namespace NeuralNetwork {
 				delete this->m_pOptimizer_bias;
 			this->m_pOptimizer_bias = CreateOptimizerFromBuffer_CPU(&i_lpBuffer[readBufferByte], i_bufferSize-readBufferByte, useBufferSize);
 			readBufferByte += useBufferSize;
+
+			// _pŕۑĂꍇ͕ϊς݂Weight̂ݕێ
+			if(this->m_pOptimizer_bias)
+				this->SetInferenceOnlyFlag(std::wstring(this->m_pOptimizer_bias->GetOptimizerID()) == L"Frozen");
 
 			return readBufferByte;
 		}
@@ -120,6 +160,11 @@ namespace NeuralNetwork {
 		/** Weight擾 */
 		const F32* GetWeight()const
 		{
+			std::lock_guard<std::mutex> lock(this->packMutex);
+
+			this->RestoreWeightWithoutLock();
+			this->onPlainWeightUsed = true;
+
 			return &this->lpWeight[0];
 		}
 		/** Bias擾 */
@@ -137,9 +182,13 @@ namespace NeuralNetwork {
 			@param	lpBias		ݒ肷Bias̒l. */
 		ErrorCode SetData(const F32* i_lpWeight, const F32* i_lpBias)
 		{
+			this->ApplyLaggingUpdate();
+			this->RestoreWeight();
+			this->dataVersion++;
+
 			memcpy(&this->lpWeight[0], i_lpWeight, sizeof(F32)*this->lpWeight.size());
 			memcpy(&this->lpBias[0],   i_lpBias,   sizeof(F32)*this->lpBias.size());
-
+
 			return ErrorCode::ERROR_CODE_NONE;
 		}
 		/** Weight,BiasXV.
@@ -147,13 +196,200 @@ namespace NeuralNetwork {
 			@param	lpDBias		Biashω. */
 		ErrorCode UpdateData(const F32* i_lpDWeight, const F32* i_lpDBias)
 		{
-			// 덷𔽉f
+			this->RestoreWeight();
+
+			// XVxꍇ͌덷i[ďI
+			if(this->onDeferredUpdate)
+			{
+				// fĂȂ덷ꍇ͐ɔf
+				if(this->onUpdatePending)
+					this->ApplyPendingUpdate();
+
+				ParameterBufferTraits_CPU::Copy(this->GetDWeightBuffer(), i_lpDWeight, this->lpWeight.size());
+				ParameterBufferTraits_CPU::Copy(this->GetDBiasBuffer(),   i_lpDBias,   this->lpBias.size());
+				this->onUpdatePending = true;
+
+				return ErrorCode::ERROR_CODE_NONE;
+			}
+
+			// Ǒ덷̈悪蓖ĂĂꍇ́A덷i[Ă甽f
+			if(this->pDWeight)
+			{
+				ParameterBufferTraits_CPU::Copy(this->pDWeight, i_lpDWeight, this->lpWeight.size());
+				ParameterBufferTraits_CPU::Copy(this->pDBias,   i_lpDBias,   this->lpBias.size());
+
+				i_lpDWeight = this->pDWeight;
+				i_lpDBias   = this->pDBias;
+			}
+
+			// 덷𔽉f. Ŝ̍XVŒxĂsŐVɂȂ
+			this->dataVersion++;
+			this->onSparseLagging = false;
 			if(this->m_pOptimizer_weight)
 				this->m_pOptimizer_weight->UpdateParameter(&this->lpWeight[0], i_lpDWeight);
+			if(this->m_pOptimizer_bias)
+				this->m_pOptimizer_bias->UpdateParameter(&this->lpBias[0],   i_lpDBias);
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+		/** ωʂŝ݂w肵Weight,BiasXV.
+			Weight̍XV̓IveB}CUɍsw肵čsABias͑ŜXV.
+			XVxꍇ͈ꊇXVőŜXV邽߁AUpdateDataƓlɌ덷i[.
+			@param	i_lpDWeight				Weight̕ω. w肳ĂȂs̕ωʂ0łȂ΂ȂȂ.
+			@param	i_lpDBias				Bias̕ω.
+			@param	i_weightRowCount		Weight1ubN̍s.
+			@param	i_weightRowSize			Weight1s̗vf.
+			@param	i_lpWeightRowNum		ωʂWeight̍sԍ̔z. dȂ.
+			@param	i_weightRowNumCount		sԍ̐. */
+		ErrorCode UpdateDataSparse(const F32* i_lpDWeight, const F32* i_lpDBias, U32 i_weightRowCount, U32 i_weightRowSize, const U32 i_lpWeightRowNum[], U32 i_weightRowNumCount)
+		{
+			if(this->onDeferredUpdate)
+				return this->UpdateData(i_lpDWeight, i_lpDBias);
+
+			this->RestoreWeight();
+
+			// Ǒ덷̈悪蓖ĂĂꍇ́A덷i[Ă甽f
+			if(this->pDWeight)
+			{
+				ParameterBufferTraits_CPU::Copy(this->pDWeight, i_lpDWeight, this->lpWeight.size());
+				ParameterBufferTraits_CPU::Copy(this->pDBias,   i_lpDBias,   this->lpBias.size());
+
+				i_lpDWeight = this->pDWeight;
+				i_lpDBias   = this->pDBias;
+			}
+
+			// 덷𔽉f. XVȂs̓IveB}CUŒxꂽԂƂȂꍇ
+			this->dataVersion++;
+			this->onSparseLagging = true;
+			if(this->m_pOptimizer_weight)
+				this->m_pOptimizer_weight->UpdateParameterSparse(&this->lpWeight[0], i_lpDWeight, i_weightRowCount, i_weightRowSize, i_lpWeightRowNum, i_weightRowNumCount);
 			if(this->m_pOptimizer_bias)
 				this->m_pOptimizer_bias->UpdateParameter(&this->lpBias[0],   i_lpDBias);
 
 			return ErrorCode::ERROR_CODE_NONE;
+		}
+
+
+
+		//===========================
+		// ϊςWeight
+		//===========================
+		/** Weight,Bias̔Ő擾 */
+		U64 GetDataVersion()const
+		{
+			return this->dataVersion;
+		}
+		/** w̕тɕϊWeight擾.
+			O̕ϊȍ~ɔŐωĂꍇ̂ݕϊ.
+			_pŌ̕тWeightQƂĂȂꍇ́AϊɌ̕тWeightj */
+		const F32* GetPackedWeight(WeightLayout i_layout)
+		{
+			if(i_layout == WEIGHT_LAYOUT_PLAIN)
+				return this->GetWeight();
+			if(i_layout >= WEIGHT_LAYOUT_COUNT)
+				return NULL;
+
+			this->ApplyLaggingUpdate();
+
+			std::lock_guard<std::mutex> lock(this->packMutex);
+
+			PackedWeight_CPU& packedWeight = this->lpPackedWeight[i_layout];
+			if(!packedWeight.IsValid(i_layout, this->dataVersion))
+			{
+				this->RestoreWeightWithoutLock();
+				if(!packedWeight.Pack(&this->lpWeight[0], i_layout, this->dataVersion))
+					return NULL;
+
+				if(this->onInferenceOnly && !this->onPlainWeightUsed)
+					this->ReleaseWeightWithoutLock();
+			}
+
+			return packedWeight.Get();
+		}
+		/** _pɂ邩ݒ肷.
+			LɂꍇAϊς݂WeightێĂΌ̕тWeightj.
+			ϊς݂WeightێĂȂꍇ́AϊтQƂ܂Ō̕тWeightێ */
+		ErrorCode SetInferenceOnlyFlag(bool i_onInferenceOnly)
+		{
+			std::lock_guard<std::mutex> lock(this->packMutex);
+
+			this->onInferenceOnly = i_onInferenceOnly;
+			this->onPlainWeightUsed = false;
+			if(!this->onInferenceOnly)
+				this->RestoreWeightWithoutLock();
+			else if(this->FindPackedWeight() != NULL)
+				this->ReleaseWeightWithoutLock();
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+		/** ݂̔Ő̕ϊςWeight擾.
+			@return	ێĂȂꍇNULL. */
+		const PackedWeight_CPU* FindPackedWeight()const
+		{
+			for(U32 layout=0; layout<this->lpPackedWeight.size(); layout++)
+			{
+				if(this->lpPackedWeight[layout].IsValid((WeightLayout)layout, this->dataVersion))
+					return &this->lpPackedWeight[layout];
+			}
+			return NULL;
+		}
+		/** aȍXVŃIveB}CUɒxĂsꍇ́AWeightɔf.
+			WeightŜQƂO(ۑA_p̕ϊ)ɌĂяo. wK̉Z͒x܂܂Ȃlgp */
+		void ApplyLaggingUpdate()const
+		{
+			if(!this->onSparseLagging)
+				return;
+
+			std::lock_guard<std::mutex> lock(this->packMutex);
+
+			this->RestoreWeightWithoutLock();
+			if(this->m_pOptimizer_weight)
+				this->m_pOptimizer_weight->ApplyLaggingUpdate(&this->lpWeight[0]);
+			this->dataVersion++;
+			this->onSparseLagging = false;
+		}
+		/** ̕тWeightjĂꍇ́Aϊς݂̒l畜 */
+		void RestoreWeight()const
+		{
+			std::lock_guard<std::mutex> lock(this->packMutex);
+
+			this->RestoreWeightWithoutLock();
+		}
+		/** ̕тWeightj. Ö̗ɔzuĂꍇ͔jȂ. packMutex擾ς݂ł邱 */
+		void ReleaseWeightWithoutLock()
+		{
+			this->lpWeight.Release();
+		}
+		/** ̕тWeightjĂꍇ́Aϊς݂̒l畜. packMutex擾ς݂ł邱 */
+		void RestoreWeightWithoutLock()const
+		{
+			if(!this->lpWeight.IsReleased())
+				return;
+
+			this->lpWeight.Reallocate();
+			this->FindPackedWeight()->Unpack(&this->lpWeight[0]);
+		}
+
+
+		/** ꊇXVp̏ď݂덷̊i[擾 */
+		F32* GetDWeightBuffer()
+		{
+			if(this->pDWeight)
+				return this->pDWeight;
+
+			if(this->lpDWeight.size() != this->lpWeight.size())
+				this->lpDWeight.resize((size_t)this->lpWeight.size());
+			return ParameterBufferTraits_CPU::GetPointer(this->lpDWeight);
+		}
+		/** ꊇXVp̃oCAX̌덷̊i[擾 */
+		F32* GetDBiasBuffer()
+		{
+			if(this->pDBias)
+				return this->pDBias;
+
+			if(this->lpDBias.size() != this->lpBias.size())
+				this->lpDBias.resize((size_t)this->lpBias.size());
+			return ParameterBufferTraits_CPU::GetPointer(this->lpDBias);
 		}
 
 
@@ -163,9 +399,15 @@ namespace NeuralNetwork {
 		/** IveB}CU[ύX */
 		ErrorCode ChangeOptimizer(const wchar_t i_optimizerID[])
 		{
+			// ύXÕIveB}CUŒxĂs𔽉f
+			this->ApplyLaggingUpdate();
+
 			ChangeOptimizer_CPU(&this->m_pOptimizer_bias,   i_optimizerID, (U32)this->lpBias.size());
 			ChangeOptimizer_CPU(&this->m_pOptimizer_weight, i_optimizerID, (U32)this->lpWeight.size());
 
+			// _p("Frozen")ł͕ϊς݂Weight̂ݕێ
+			this->SetInferenceOnlyFlag(std::wstring(i_optimizerID) == L"Frozen");
+
 			return ErrorCode::ERROR_CODE_NONE;
 		}
 
@@ -197,8 +439,143 @@ namespace NeuralNetwork {
 
 			return ErrorCode::ERROR_CODE_NONE;
 		}
+		/** ێĂSẴIveB}CU[wIDł邩mF */
+		bool CheckOptimizerID(const wchar_t i_optimizerID[])const
+		{
+			std::wstring optimizerID = i_optimizerID;
+			if(this->m_pOptimizer_bias && optimizerID != this->m_pOptimizer_bias->GetOptimizerID())
+				return false;
+			if(this->m_pOptimizer_weight && optimizerID != this->m_pOptimizer_weight->GetOptimizerID())
+				return false;
+
+			return true;
+		}
 		
 		//===========================
+		// p[^̈
+		//===========================
+		/** Õp[^̈ɔzuꍇɕKvȗvf擾 */
+		U64 GetParameterCount()const
+		{
+			return GetParameterAlignedCount(this->lpWeight.size()) + GetParameterAlignedCount(this->lpBias.size());
+		}
+		/** p[^ƌ덷̊i[Ö̗ɕύX.
+			@param	io_lpParameter	p[^̊i[. [weight][bias]̏ɔzu.
+			@param	io_lpDParameter	덷̊i[. */
+		ErrorCode BindParameterBuffer(F32* io_lpParameter, F32* io_lpDParameter)
+		{
+			if((io_lpParameter == NULL) != (io_lpDParameter == NULL))
+				return ErrorCode::ERROR_CODE_COMMON_NULL_REFERENCE;
+
+			// i[悪ς邽߁AfĂȂ덷͐ɔf
+			if(this->onUpdatePending)
+				this->ApplyPendingUpdate();
+			this->RestoreWeight();
+
+			if(io_lpParameter == NULL)
+			{
+				this->lpWeight.Bind(NULL);
+				this->lpBias.Bind(NULL);
+				this->pDWeight = NULL;
+				this->pDBias   = NULL;
+			}
+			else
+			{
+				U64 biasOffset = GetParameterAlignedCount(this->lpWeight.size());
+
+				this->lpWeight.Bind(&io_lpParameter[0]);
+				this->lpBias.Bind(&io_lpParameter[biasOffset]);
+				this->pDWeight = &io_lpDParameter[0];
+				this->pDBias   = &io_lpDParameter[biasOffset];
+			}
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+
+
+		//===========================
+		// ꊇXV
+		//===========================
+		/** XVx邩ݒ肷 */
+		ErrorCode SetDeferredUpdateFlag(bool i_onDeferredUpdate)
+		{
+			// fĂȂ덷ꍇ͔f
+			if(!i_onDeferredUpdate && this->onUpdatePending)
+				this->ApplyPendingUpdate();
+
+			this->onDeferredUpdate = i_onDeferredUpdate;
+			if(!this->onDeferredUpdate)
+			{
+				ParameterBufferTraits_CPU::VectorType().swap(this->lpDWeight);
+				ParameterBufferTraits_CPU::VectorType().swap(this->lpDBias);
+			}
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+		/** ꊇXV̑Ώې擾. [weight][bias] */
+		U32 GetUpdateTargetCount()const
+		{
+			return 2;
+		}
+		/** ꊇXV̑Ώۂ擾 */
+		ErrorCode GetUpdateTarget(U32 i_targetNum, OptimizerUpdateTarget& o_target)
+		{
+			o_target.pOptimizer   = NULL;
+			o_target.lpParameter  = NULL;
+			o_target.lpDParameter = NULL;
+
+			switch(i_targetNum)
+			{
+			case 0:
+				if(this->onUpdatePending)
+				{
+					this->RestoreWeight();
+
+					o_target.pOptimizer   = this->m_pOptimizer_weight;
+					o_target.lpParameter  = &this->lpWeight[0];
+					o_target.lpDParameter = this->GetDWeightBuffer();
+				}
+				break;
+			case 1:
+				if(this->onUpdatePending)
+				{
+					o_target.pOptimizer   = this->m_pOptimizer_bias;
+					o_target.lpParameter  = &this->lpBias[0];
+					o_target.lpDParameter = this->GetDBiasBuffer();
+				}
+				break;
+			default:
+				return ErrorCode::ERROR_CODE_COMMON_OUT_OF_ARRAYRANGE;
+			}
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+		/** ꊇXV̊ʒm */
+		ErrorCode CompleteUpdate()
+		{
+			if(this->onUpdatePending)
+			{
+				this->dataVersion++;
+				this->onSparseLagging = false;
+			}
+			this->onUpdatePending = false;
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+		/** fĂȂ덷𔽉f */
+		void ApplyPendingUpdate()
+		{
+			for(U32 targetNum=0; targetNum<this->GetUpdateTargetCount(); targetNum++)
+			{
+				OptimizerUpdateTarget target;
+				this->GetUpdateTarget(targetNum, target);
+				if(target.pOptimizer)
+					target.pOptimizer->UpdateParameter(target.lpParameter, target.lpDParameter);
+			}
+			this->CompleteUpdate();
+		}
+
+		//===========================
 		// C[ۑ
 		//===========================
 		/** C[̕ۑɕKvȃobt@BYTEPʂŎ擾 */
@@ -223,8 +600,18 @@ namespace NeuralNetwork {
 		{
 			S64 writeBufferByte = 0;
 
-			// j[W
-			memcpy(&o_lpBuffer[writeBufferByte], &this->lpWeight[0], this->lpWeight.size() * sizeof(F32));
+			// aȍXVŒxĂs𔽉fĂۑ
+			this->ApplyLaggingUpdate();
+
+			// j[W. ̕тjĂꍇ͕ϊς݂̒l珑
+			{
+				std::lock_guard<std::mutex> lock(this->packMutex);
+
+				if(this->lpWeight.IsReleased())
+					this->FindPackedWeight()->Unpack((F32*)&o_lpBuffer[writeBufferByte]);
+				else
+					memcpy(&o_lpBuffer[writeBufferByte], &this->lpWeight[0], this->lpWeight.size() * sizeof(F32));
+			}
 			writeBufferByte += (int)this->lpWeight.size() * sizeof(F32);
 			// oCAX
 			memcpy(&o_lpBuffer[writeBufferByte], &this->lpBias[0], this->lpBias.size() * sizeof(F32));
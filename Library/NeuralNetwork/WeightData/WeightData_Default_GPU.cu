@@ -4,7 +4,10 @@
 //=====================================
 #include<thrust/device_vector.h>
 
+#include<string>
+
 #include"WeightData_Default.h"
+#include"WeightData_ParameterBuffer.h"
 
 #include<Layer/NeuralNetwork/IOptimizer.h>
 #include<Library/NeuralNetwork/Optimizer.h>
@@ -18,12 +21,23 @@ namespace NeuralNetwork {
 	class WeightData_Default_GPU : public IWeightData
 	{
 	private:
-		thrust::device_vector<F32> lpWeight;
-		thrust::device_vector<F32> lpBias;
+		ParameterBuffer<ParameterBufferTraits_GPU> lpWeight;
+		ParameterBuffer<ParameterBufferTraits_GPU> lpBias;
+
+		F32* pDWeight;	/**< Ǒ덷̈. 蓖ĂĂȂꍇNULL */
+		F32* pDBias;	/**< Ǒ덷̈. 蓖ĂĂȂꍇNULL */
 
+		ParameterBufferTraits_GPU::VectorType lpDWeight;	/**< ꊇXVp̌덷̈. Ǒ덷̈悪蓖ĂĂȂꍇɎgp */
+		ParameterBufferTraits_GPU::VectorType lpDBias;		/**< ꊇXVp̌덷̈. Ǒ덷̈悪蓖ĂĂȂꍇɎgp */
+
+		bool onDeferredUpdate;	/**< XVxtO */
+		bool onUpdatePending;	/**< fĂȂ덷i[ĂtO */
+
 		IOptimizer* m_pOptimizer_weight;	/**< dݍXVpIveB}CU */
 		IOptimizer* m_pOptimizer_bias;		/**< oCAXXVpIveB}CU */
 
+		U64 dataVersion;	/**< Weight,Bias̔Ő */
+
 
 	public:
 		//===========================
@@ -33,8 +47,13 @@ namespace NeuralNetwork {
 		WeightData_Default_GPU(U32 i_neuronCount, U32 i_inputCount)
 			:	lpWeight			(i_neuronCount * i_inputCount)
 			,	lpBias				(i_neuronCount)
+			,	pDWeight			(NULL)
+			,	pDBias				(NULL)
+			,	onDeferredUpdate	(false)
+			,	onUpdatePending		(false)
 			,	m_pOptimizer_weight	(NULL)
 			,	m_pOptimizer_bias	(NULL)
+			,	dataVersion			(0)
 		{
 		}
 		/** fXgN^ */
@@ -54,6 +73,8 @@ namespace NeuralNetwork {
 		{
 			auto& initializer = Gravisbell::Layer::NeuralNetwork::GetInitializerManager().GetInitializer(i_initializerID);
 
+			this->dataVersion++;
+
 			thrust::host_vector<F32> lpTmpWeight(this->lpWeight.size());
 			thrust::host_vector<F32> lpTmpBias(this->lpBias.size());
 
@@ -66,14 +87,16 @@ namespace NeuralNetwork {
 				lpTmpBias[i] = initializer.GetParameter(i_inputCount, i_outputCount);
 			}
 
-			this->lpWeight = lpTmpWeight;
-			this->lpBias   = lpTmpBias;
+			cudaMemcpy(thrust::raw_pointer_cast(&this->lpWeight[0]), &lpTmpWeight[0], sizeof(F32)*this->lpWeight.size(), cudaMemcpyHostToDevice);
+			cudaMemcpy(thrust::raw_pointer_cast(&this->lpBias[0]),   &lpTmpBias[0],   sizeof(F32)*this->lpBias.size(),   cudaMemcpyHostToDevice);
 
 			return ErrorCode::ERROR_CODE_NONE;
 		}
 		S64 InitializeFromBuffer(const BYTE* i_lpBuffer, U64 i_bufferSize)
 		{
 			S64 readBufferByte = 0;
+
+			this->dataVersion++;
 			
 			// obt@Rs[
 			// j[
@@ -149,6 +172,8 @@ namespace NeuralNetwork {
 			@param	lpBias		ݒ肷Bias̒l. */
 		ErrorCode SetData(const F32* i_lpWeight, const F32* i_lpBias)
 		{
+			this->dataVersion++;
+
 			cudaMemcpy(thrust::raw_pointer_cast(&this->lpWeight[0]), i_lpWeight, sizeof(F32)*this->lpWeight.size(), cudaMemcpyDeviceToDevice);
 			cudaMemcpy(thrust::raw_pointer_cast(&this->lpBias[0]),   i_lpBias,   sizeof(F32)*this->lpBias.size(), cudaMemcpyDeviceToDevice);
 
@@ -159,13 +184,91 @@ namespace NeuralNetwork {
 			@param	lpDBias		Biashω. */
 		ErrorCode UpdateData(const F32* i_lpDWeight, const F32* i_lpDBias)
 		{
+			// XVxꍇ͌덷i[ďI
+			if(this->onDeferredUpdate)
+			{
+				// fĂȂ덷ꍇ͐ɔf
+				if(this->onUpdatePending)
+					this->ApplyPendingUpdate();
+
+				ParameterBufferTraits_GPU::Copy(this->GetDWeightBuffer(), i_lpDWeight, this->lpWeight.size());
+				ParameterBufferTraits_GPU::Copy(this->GetDBiasBuffer(),   i_lpDBias,   this->lpBias.size());
+				this->onUpdatePending = true;
+
+				return ErrorCode::ERROR_CODE_NONE;
+			}
+
+			// Ǒ덷̈悪蓖ĂĂꍇ́A덷i[Ă甽f
+			if(this->pDWeight)
+			{
+				ParameterBufferTraits_GPU::Copy(this->pDWeight, i_lpDWeight, this->lpWeight.size());
+				ParameterBufferTraits_GPU::Copy(this->pDBias,   i_lpDBias,   this->lpBias.size());
+
+				i_lpDWeight = this->pDWeight;
+				i_lpDBias   = this->pDBias;
+			}
+
 			// 덷𔽉f
+			this->dataVersion++;
 			if(this->m_pOptimizer_weight)
 				this->m_pOptimizer_weight->UpdateParameter(thrust::raw_pointer_cast(&this->lpWeight[0]), i_lpDWeight);
 			if(this->m_pOptimizer_bias)
 				this->m_pOptimizer_bias->UpdateParameter(thrust::raw_pointer_cast(&this->lpBias[0]),   i_lpDBias);
 
 			return ErrorCode::ERROR_CODE_NONE;
+		}
+
+		/** ωʂŝ݂w肵Weight,BiasXV.
+			GPUł͑ŜXV. w肳ĂȂs̕ωʂ0̂ߌʂ͕ςȂ. */
+		ErrorCode UpdateDataSparse(const F32* i_lpDWeight, const F32* i_lpDBias, U32 i_weightRowCount, U32 i_weightRowSize, const U32 i_lpWeightRowNum[], U32 i_weightRowNumCount)
+		{
+			return this->UpdateData(i_lpDWeight, i_lpDBias);
+		}
+
+
+		//===========================
+		// ϊςWeight
+		//===========================
+		/** Weight,Bias̔Ő擾 */
+		U64 GetDataVersion()const
+		{
+			return this->dataVersion;
+		}
+		/** w̕тɕϊWeight擾.
+			GPUł͕ϊȂ. ̕шȊONULLԂ. */
+		const F32* GetPackedWeight(WeightLayout i_layout)
+		{
+			if(i_layout == WEIGHT_LAYOUT_PLAIN)
+				return this->GetWeight();
+
+			return NULL;
+		}
+		/** _pɂ邩ݒ肷.
+			GPUł͕ϊς݂̒lێȂ߁A̕тWeightێ. */
+		ErrorCode SetInferenceOnlyFlag(bool i_onInferenceOnly)
+		{
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+
+		/** ꊇXVp̏ď݂덷̊i[擾 */
+		F32* GetDWeightBuffer()
+		{
+			if(this->pDWeight)
+				return this->pDWeight;
+
+			if(this->lpDWeight.size() != this->lpWeight.size())
+				this->lpDWeight.resize((size_t)this->lpWeight.size());
+			return ParameterBufferTraits_GPU::GetPointer(this->lpDWeight);
+		}
+		/** ꊇXVp̃oCAX̌덷̊i[擾 */
+		F32* GetDBiasBuffer()
+		{
+			if(this->pDBias)
+				return this->pDBias;
+
+			if(this->lpDBias.size() != this->lpBias.size())
+				this->lpDBias.resize((size_t)this->lpBias.size());
+			return ParameterBufferTraits_GPU::GetPointer(this->lpDBias);
 		}
 
 
@@ -209,8 +312,137 @@ namespace NeuralNetwork {
 
 			return ErrorCode::ERROR_CODE_NONE;
 		}
+		/** ێĂSẴIveB}CU[wIDł邩mF */
+		bool CheckOptimizerID(const wchar_t i_optimizerID[])const
+		{
+			std::wstring optimizerID = i_optimizerID;
+			if(this->m_pOptimizer_bias && optimizerID != this->m_pOptimizer_bias->GetOptimizerID())
+				return false;
+			if(this->m_pOptimizer_weight && optimizerID != this->m_pOptimizer_weight->GetOptimizerID())
+				return false;
+
+			return true;
+		}
 		
 		//===========================
+		// p[^̈
+		//===========================
+		/** Õp[^̈ɔzuꍇɕKvȗvf擾 */
+		U64 GetParameterCount()const
+		{
+			return GetParameterAlignedCount(this->lpWeight.size()) + GetParameterAlignedCount(this->lpBias.size());
+		}
+		/** p[^ƌ덷̊i[Ö̗ɕύX.
+			@param	io_lpParameter	p[^̊i[. [weight][bias]̏ɔzu.
+			@param	io_lpDParameter	덷̊i[. */
+		ErrorCode BindParameterBuffer(F32* io_lpParameter, F32* io_lpDParameter)
+		{
+			if((io_lpParameter == NULL) != (io_lpDParameter == NULL))
+				return ErrorCode::ERROR_CODE_COMMON_NULL_REFERENCE;
+
+			// i[悪ς邽߁AfĂȂ덷͐ɔf
+			if(this->onUpdatePending)
+				this->ApplyPendingUpdate();
+
+			if(io_lpParameter == NULL)
+			{
+				this->lpWeight.Bind(NULL);
+				this->lpBias.Bind(NULL);
+				this->pDWeight = NULL;
+				this->pDBias   = NULL;
+			}
+			else
+			{
+				U64 biasOffset = GetParameterAlignedCount(this->lpWeight.size());
+
+				this->lpWeight.Bind(&io_lpParameter[0]);
+				this->lpBias.Bind(&io_lpParameter[biasOffset]);
+				this->pDWeight = &io_lpDParameter[0];
+				this->pDBias   = &io_lpDParameter[biasOffset];
+			}
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+
+
+		//===========================
+		// ꊇXV
+		//===========================
+		/** XVx邩ݒ肷 */
+		ErrorCode SetDeferredUpdateFlag(bool i_onDeferredUpdate)
+		{
+			// fĂȂ덷ꍇ͔f
+			if(!i_onDeferredUpdate && this->onUpdatePending)
+				this->ApplyPendingUpdate();
+
+			this->onDeferredUpdate = i_onDeferredUpdate;
+			if(!this->onDeferredUpdate)
+			{
+				ParameterBufferTraits_GPU::VectorType().swap(this->lpDWeight);
+				ParameterBufferTraits_GPU::VectorType().swap(this->lpDBias);
+			}
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+		/** ꊇXV̑Ώې擾. [weight][bias] */
+		U32 GetUpdateTargetCount()const
+		{
+			return 2;
+		}
+		/** ꊇXV̑Ώۂ擾 */
+		ErrorCode GetUpdateTarget(U32 i_targetNum, OptimizerUpdateTarget& o_target)
+		{
+			o_target.pOptimizer   = NULL;
+			o_target.lpParameter  = NULL;
+			o_target.lpDParameter = NULL;
+
+			switch(i_targetNum)
+			{
+			case 0:
+				if(this->onUpdatePending)
+				{
+					o_target.pOptimizer   = this->m_pOptimizer_weight;
+					o_target.lpParameter  = thrust::raw_pointer_cast(&this->lpWeight[0]);
+					o_target.lpDParameter = this->GetDWeightBuffer();
+				}
+				break;
+			case 1:
+				if(this->onUpdatePending)
+				{
+					o_target.pOptimizer   = this->m_pOptimizer_bias;
+					o_target.lpParameter  = thrust::raw_pointer_cast(&this->lpBias[0]);
+					o_target.lpDParameter = this->GetDBiasBuffer();
+				}
+				break;
+			default:
+				return ErrorCode::ERROR_CODE_COMMON_OUT_OF_ARRAYRANGE;
+			}
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+		/** ꊇXV̊ʒm */
+		ErrorCode CompleteUpdate()
+		{
+			if(this->onUpdatePending)
+				this->dataVersion++;
+			this->onUpdatePending = false;
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+		/** fĂȂ덷𔽉f */
+		void ApplyPendingUpdate()
+		{
+			for(U32 targetNum=0; targetNum<this->GetUpdateTargetCount(); targetNum++)
+			{
+				OptimizerUpdateTarget target;
+				this->GetUpdateTarget(targetNum, target);
+				if(target.pOptimizer)
+					target.pOptimizer->UpdateParameter(target.lpParameter, target.lpDParameter);
+			}
+			this->CompleteUpdate();
+		}
+
+		//===========================
 		// C[ۑ
 		//===========================
 		/** C[̕ۑɕKvȃobt@BYTEPʂŎ擾 */
@@ -0,0 +1,107 @@
+//=====================================
+// d݃f[^CPUZ
+//=====================================
+#include"stdafx.h"
+
+#include<math.h>
+#include<xmmintrin.h>
+
+#include"WeightData_Kernel_CPU.h"
+
+namespace Gravisbell {
+namespace Layer {
+namespace NeuralNetwork {
+
+	namespace
+	{
+		/** xɏvf */
+		static const U32 SIMD_WIDTH = 4;
+
+		/** 4vf̑a߂ */
+		inline F32 HorizontalSum(__m128 x)
+		{
+			F32 lpValue[SIMD_WIDTH];
+			_mm_storeu_ps(lpValue, x);
+
+			return (lpValue[0] + lpValue[1]) + (lpValue[2] + lpValue[3]);
+		}
+	}
+
+
+	/** d݂̐KŁAď݂덷XP[ƃxN^[̌덷ɕ. 1j[ */
+	F32 DecomposeDWeightKernel_WeightNormalization_CPU(const F32 i_lpVector[], const F32 i_lpDWeight[], F32 o_lpDVector[], U32 i_inputCount, F32 i_scale, F32 i_vectorScale)
+	{
+		// XP[덷
+		__m128 vSum = _mm_setzero_ps();
+		U32 inputNum = 0;
+		for(; inputNum+SIMD_WIDTH<=i_inputCount; inputNum+=SIMD_WIDTH)
+		{
+			vSum = _mm_add_ps(vSum, _mm_mul_ps(_mm_loadu_ps(&i_lpVector[inputNum]), _mm_loadu_ps(&i_lpDWeight[inputNum])));
+		}
+		F32 sumValue = HorizontalSum(vSum);
+		for(; inputNum<i_inputCount; inputNum++)
+		{
+			sumValue += i_lpVector[inputNum] * i_lpDWeight[inputNum];
+		}
+		F32 dScale = sumValue / i_vectorScale;
+
+		// xNg덷
+		const F32 vectorCoeff = i_scale / i_vectorScale;
+		const F32 dScaleCoeff = dScale / i_vectorScale;
+		const __m128 vVectorCoeff = _mm_set1_ps(vectorCoeff);
+		const __m128 vDScaleCoeff = _mm_set1_ps(dScaleCoeff);
+
+		inputNum = 0;
+		for(; inputNum+SIMD_WIDTH<=i_inputCount; inputNum+=SIMD_WIDTH)
+		{
+			__m128 vector  = _mm_loadu_ps(&i_lpVector[inputNum]);
+			__m128 dWeight = _mm_loadu_ps(&i_lpDWeight[inputNum]);
+
+			_mm_storeu_ps(&o_lpDVector[inputNum], _mm_mul_ps(vVectorCoeff, _mm_sub_ps(dWeight, _mm_mul_ps(vDScaleCoeff, vector))));
+		}
+		for(; inputNum<i_inputCount; inputNum++)
+		{
+			o_lpDVector[inputNum] = vectorCoeff * (i_lpDWeight[inputNum] - dScaleCoeff * i_lpVector[inputNum]);
+		}
+
+		return dScale;
+	}
+
+	/** d݂̐KŁAxN^[̑傫߂ďd݂. 1j[ */
+	F32 ComposeWeightKernel_WeightNormalization_CPU(const F32 i_lpVector[], F32 o_lpWeight[], U32 i_inputCount, F32 i_scale)
+	{
+		// xN^[̑傫
+		__m128 vSum = _mm_setzero_ps();
+		U32 inputNum = 0;
+		for(; inputNum+SIMD_WIDTH<=i_inputCount; inputNum+=SIMD_WIDTH)
+		{
+			__m128 vector = _mm_loadu_ps(&i_lpVector[inputNum]);
+			vSum = _mm_add_ps(vSum, _mm_mul_ps(vector, vector));
+		}
+		F32 sumValue = HorizontalSum(vSum);
+		for(; inputNum<i_inputCount; inputNum++)
+		{
+			sumValue += i_lpVector[inputNum] * i_lpVector[inputNum];
+		}
+		F32 vectorScale = sqrtf(sumValue);
+
+		// d. 1j[̃xN^[̓LbVɂ邽ߑč
+		const F32 weightCoeff = i_scale / vectorScale;
+		const __m128 vWeightCoeff = _mm_set1_ps(weightCoeff);
+
+		inputNum = 0;
+		for(; inputNum+SIMD_WIDTH<=i_inputCount; inputNum+=SIMD_WIDTH)
+		{
+			_mm_storeu_ps(&o_lpWeight[inputNum], _mm_mul_ps(vWeightCoeff, _mm_loadu_ps(&i_lpVector[inputNum])));
+		}
+		for(; inputNum<i_inputCount; inputNum++)
+		{
+			o_lpWeight[inputNum] = weightCoeff * i_lpVector[inputNum];
+		}
+
+		return vectorScale;
+	}
+
+}	// NeuralNetwork
+}	// Layer
+}	// Gravisbell
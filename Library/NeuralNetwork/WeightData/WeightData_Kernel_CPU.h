@@ -0,0 +1,68 @@
+//=====================================
+// d݃f[^CPUZ
+// SSE4vfA[͒
+//=====================================
+#ifndef __GRAVISBELL_NN_WEIGHTDATA_KERNEL_CPU_H__
+#define __GRAVISBELL_NN_WEIGHTDATA_KERNEL_CPU_H__
+
+#include"Layer/NeuralNetwork/IWeightData.h"
+
+#include<vector>
+#include<thread>
+#include<algorithm>
+
+namespace Gravisbell {
+namespace Layer {
+namespace NeuralNetwork {
+
+	/** j[Pʂ̏𕡐Xbhōsŏ̗vf. ꖢ̏ꍇ͌ĂяõXbĥ݂ŏ */
+	static const U64 WEIGHTDATA_MULTITHREAD_MIN_COUNT = 262144;
+
+	/** j[A͈͂ɕA͈͂Ƃɏ.
+		vfȂꍇ͌ĂяõXbhőS͈͂.
+		@param	i_neuronCount	j[.
+		@param	i_inputCount	1j[̗vf.
+		@param	i_proc			. i_proc(Jnj[ԍ, Ij[ԍ)̌`ŌĂяo. */
+	template<class Proc>
+	void ForEachNeuronRange_CPU(U32 i_neuronCount, U32 i_inputCount, Proc i_proc)
+	{
+		U32 threadCount = std::thread::hardware_concurrency();
+		if(threadCount == 0 || (U64)i_neuronCount * i_inputCount < WEIGHTDATA_MULTITHREAD_MIN_COUNT)
+			threadCount = 1;
+		threadCount = std::min<U32>(threadCount, i_neuronCount);
+		if(threadCount <= 1)
+		{
+			i_proc(0, i_neuronCount);
+			return;
+		}
+
+		std::vector<std::thread> lpThread;
+		for(U32 threadNum=1; threadNum<threadCount; threadNum++)
+		{
+			U32 neuronBegin = (U32)((U64)i_neuronCount *  threadNum    / threadCount);
+			U32 neuronEnd   = (U32)((U64)i_neuronCount * (threadNum+1) / threadCount);
+			lpThread.push_back(std::thread(i_proc, neuronBegin, neuronEnd));
+		}
+		i_proc(0, (U32)((U64)i_neuronCount / threadCount));
+		for(auto& thread : lpThread)
+			thread.join();
+	}
+
+	/** d݂̐KŁAď݂덷XP[ƃxN^[̌덷ɕ. 1j[.
+		dScale = dot(v, dW) / |v|
+		dV     = (scale / |v|) * (dW - dScale * v / |v|)
+		@param	i_vectorScale	xN^[̑傫|v|.
+		@return	XP[̌덷dScale. */
+	F32 DecomposeDWeightKernel_WeightNormalization_CPU(const F32 i_lpVector[], const F32 i_lpDWeight[], F32 o_lpDVector[], U32 i_inputCount, F32 i_scale, F32 i_vectorScale);
+
+	/** d݂̐KŁAxN^[̑傫߂ďd݂. 1j[.
+		|v| = sqrt(sum(v^2))
+		w   = scale * v / |v|
+		@return	xN^[̑傫|v|. */
+	F32 ComposeWeightKernel_WeightNormalization_CPU(const F32 i_lpVector[], F32 o_lpWeight[], U32 i_inputCount, F32 i_scale);
+
+}	// NeuralNetwork
+}	// Layer
+}	// Gravisbell
+
+#endif	// __GRAVISBELL_NN_WEIGHTDATA_KERNEL_CPU_H__
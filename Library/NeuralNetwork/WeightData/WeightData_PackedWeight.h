@@ -0,0 +1,140 @@
+//=====================================
+// ϊςWeight̕ێ.
+// ZgpтɕϊWeightAŐω܂ōėp.
+//=====================================
+#ifndef __GRAVISBELL_NN_WEIGHTDATA_PACKEDWEIGHT_H__
+#define __GRAVISBELL_NN_WEIGHTDATA_PACKEDWEIGHT_H__
+
+#include<vector>
+
+#include"Layer/NeuralNetwork/IWeightData.h"
+
+namespace Gravisbell {
+namespace Layer {
+namespace NeuralNetwork {
+
+	/** т1pl̃j[擾.
+		@return	plPʂ̕тłȂꍇ0. */
+	inline U32 GetWeightLayoutPanelSize(WeightLayout i_layout)
+	{
+		switch(i_layout)
+		{
+		case WEIGHT_LAYOUT_PANEL4:	return 4;
+		case WEIGHT_LAYOUT_PANEL8:	return 8;
+		default:					return 0;
+		}
+	}
+
+	/** ϊςWeight̕ێ.(CPU)
+		1̕тێ. тƂɍ쐬Ďgp. */
+	class PackedWeight_CPU
+	{
+	private:
+		U32 neuronCount;
+		U32 inputCount;
+
+		WeightLayout layout;				/**< ێĂ */
+		U64 version;						/**< ϊ_Weight̔Ő */
+		bool onValid;						/**< ϊς݂̒lێĂ */
+		std::vector<F32> lpPackedWeight;	/**< ϊς݂̒l */
+
+	public:
+		/** RXgN^ */
+		PackedWeight_CPU(U32 i_neuronCount, U32 i_inputCount)
+			:	neuronCount	(i_neuronCount)
+			,	inputCount	(i_inputCount)
+			,	layout		(WEIGHT_LAYOUT_PLAIN)
+			,	version		(0)
+			,	onValid		(false)
+		{
+		}
+
+	public:
+		/** Weightϊĕێ.
+			@param	i_lpWeight	[neuron][input]̕тWeight.
+			@param	i_layout	. plPʂ̕т̂ݑΉ.
+			@param	i_version	Weight̔Ő.
+			@return	ϊꍇtrue. ΉĂȂт̏ꍇfalseԂAێĂl͕ύXȂ. */
+		bool Pack(const F32 i_lpWeight[], WeightLayout i_layout, U64 i_version)
+		{
+			U32 panelSize = GetWeightLayoutPanelSize(i_layout);
+			if(panelSize == 0 || i_lpWeight == NULL || this->neuronCount == 0 || this->inputCount == 0)
+				return false;
+
+			U32 panelCount = (this->neuronCount + panelSize - 1) / panelSize;
+			this->lpPackedWeight.assign((size_t)panelCount * this->inputCount * panelSize, 0.0f);
+
+			for(U32 neuronNum=0; neuronNum<this->neuronCount; neuronNum++)
+			{
+				U32 panelNum = neuronNum / panelSize;
+				U32 laneNum  = neuronNum % panelSize;
+
+				const F32* lpNeuronWeight = &i_lpWeight[(U64)neuronNum * this->inputCount];
+				F32* lpPanel = &this->lpPackedWeight[(U64)panelNum * this->inputCount * panelSize];
+				for(U32 inputNum=0; inputNum<this->inputCount; inputNum++)
+				{
+					lpPanel[(U64)inputNum * panelSize + laneNum] = lpNeuronWeight[inputNum];
+				}
+			}
+
+			this->layout  = i_layout;
+			this->version = i_version;
+			this->onValid = true;
+
+			return true;
+		}
+
+		/** ϊς݂̒l擾.
+			@return	ێĂȂꍇNULL. */
+		const F32* Get()const
+		{
+			if(!this->onValid)
+				return NULL;
+
+			return &this->lpPackedWeight[0];
+		}
+
+		/** w̕тƔŐ̕ϊς݂̒lێĂ邩 */
+		bool IsValid(WeightLayout i_layout, U64 i_version)const
+		{
+			return this->onValid && this->layout == i_layout && this->version == i_version;
+		}
+		/** ϊς݂̒lێĂ邩 */
+		bool IsValid()const
+		{
+			return this->onValid;
+		}
+
+		/** ϊς݂̒l[neuron][input]̕тɖ߂.
+			@param	o_lpWeight	i[. neuron*inputvfKv. */
+		void Unpack(F32 o_lpWeight[])const
+		{
+			U32 panelSize = GetWeightLayoutPanelSize(this->layout);
+
+			for(U32 neuronNum=0; neuronNum<this->neuronCount; neuronNum++)
+			{
+				U32 panelNum = neuronNum / panelSize;
+				U32 laneNum  = neuronNum % panelSize;
+
+				F32* lpNeuronWeight = &o_lpWeight[(U64)neuronNum * this->inputCount];
+				const F32* lpPanel = &this->lpPackedWeight[(U64)panelNum * this->inputCount * panelSize];
+				for(U32 inputNum=0; inputNum<this->inputCount; inputNum++)
+				{
+					lpNeuronWeight[inputNum] = lpPanel[(U64)inputNum * panelSize + laneNum];
+				}
+			}
+		}
+
+		/** ϊς݂̒lj */
+		void Clear()
+		{
+			std::vector<F32>().swap(this->lpPackedWeight);
+			this->onValid = false;
+		}
+	};
+
+}	// NeuralNetwork
+}	// Layer
+}	// Gravisbell
+
+#endif	// __GRAVISBELL_NN_WEIGHTDATA_PACKEDWEIGHT_H__
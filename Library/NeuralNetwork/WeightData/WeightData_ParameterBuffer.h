@@ -0,0 +1,166 @@
+//=====================================
+// d݃f[^̃p[^i[̈.
+// ̗̈ƊO犄蓖Ăꂽ̈؂ւĎgp.
+//=====================================
+#ifndef __GRAVISBELL_NN_WEIGHTDATA_PARAMETERBUFFER_H__
+#define __GRAVISBELL_NN_WEIGHTDATA_PARAMETERBUFFER_H__
+
+#include<vector>
+#include<string.h>
+
+#include"Layer/NeuralNetwork/IWeightData.h"
+
+#ifdef __CUDACC__
+#include<thrust/device_vector.h>
+#endif
+
+namespace Gravisbell {
+namespace Layer {
+namespace NeuralNetwork {
+
+	/** vfp[^̈̋EPʂɐ؂グ */
+	inline U64 GetParameterAlignedCount(U64 i_count)
+	{
+		return (i_count + (WEIGHTDATA_PARAMETER_ALIGNMENT-1)) / WEIGHTDATA_PARAMETER_ALIGNMENT * WEIGHTDATA_PARAMETER_ALIGNMENT;
+	}
+
+	/** i[̈̒`(CPU) */
+	struct ParameterBufferTraits_CPU
+	{
+		typedef std::vector<F32> VectorType;
+
+		/** ̈̐擪擾 */
+		static F32* GetPointer(VectorType& i_lpBuffer)
+		{
+			if(i_lpBuffer.empty())
+				return NULL;
+			return &i_lpBuffer[0];
+		}
+		/** l𕡎ʂ */
+		static void Copy(F32* o_lpBuffer, const F32* i_lpBuffer, U64 i_count)
+		{
+			memcpy(o_lpBuffer, i_lpBuffer, sizeof(F32) * i_count);
+		}
+	};
+
+#ifdef __CUDACC__
+	/** i[̈̒`(GPU) */
+	struct ParameterBufferTraits_GPU
+	{
+		typedef thrust::device_vector<F32> VectorType;
+
+		/** ̈̐擪擾 */
+		static F32* GetPointer(VectorType& i_lpBuffer)
+		{
+			if(i_lpBuffer.empty())
+				return NULL;
+			return thrust::raw_pointer_cast(&i_lpBuffer[0]);
+		}
+		/** l𕡎ʂ */
+		static void Copy(F32* o_lpBuffer, const F32* i_lpBuffer, U64 i_count)
+		{
+			cudaMemcpy(o_lpBuffer, i_lpBuffer, sizeof(F32) * i_count, cudaMemcpyDeviceToDevice);
+		}
+	};
+#endif
+
+	/** p[^̊i[̈.
+		Ö̗蓖Ăꍇ͓̗̈JAÖ̗QƂ. */
+	template<class Traits>
+	class ParameterBuffer
+	{
+	private:
+		typename Traits::VectorType lpBuffer;	/**< ̗̈ */
+		F32* pBuffer;	/**< gp̗̈̐擪 */
+		U64 count;		/**< vf */
+
+	public:
+		/** RXgN^ */
+		ParameterBuffer(U64 i_count)
+			:	lpBuffer	((size_t)i_count)
+			,	pBuffer		(NULL)
+			,	count		(i_count)
+		{
+			this->pBuffer = Traits::GetPointer(this->lpBuffer);
+		}
+
+	private:
+		/** Rs[֎~ */
+		ParameterBuffer(const ParameterBuffer&);
+		const ParameterBuffer& operator=(const ParameterBuffer&);
+
+	public:
+		/** vf擾 */
+		U64 size()const
+		{
+			return this->count;
+		}
+
+		/** vf擾 */
+		F32& operator[](U64 i_num)
+		{
+			return this->pBuffer[i_num];
+		}
+		const F32& operator[](U64 i_num)const
+		{
+			return this->pBuffer[i_num];
+		}
+
+		/** i[ύX.
+			݂̒lVi[ɕʂ. NULLw肵ꍇ͓̗̈ɖ߂. */
+		void Bind(F32* io_lpBuffer)
+		{
+			if(io_lpBuffer == this->pBuffer)
+				return;
+
+			if(io_lpBuffer == NULL)
+			{
+				this->lpBuffer.resize((size_t)this->count);
+				F32* pInternalBuffer = Traits::GetPointer(this->lpBuffer);
+
+				Traits::Copy(pInternalBuffer, this->pBuffer, this->count);
+				this->pBuffer = pInternalBuffer;
+			}
+			else
+			{
+				Traits::Copy(io_lpBuffer, this->pBuffer, this->count);
+				this->pBuffer = io_lpBuffer;
+
+				typename Traits::VectorType().swap(this->lpBuffer);
+			}
+		}
+
+		/** ̗̈J. vf͕ێ.
+			Ö̗蓖ĂĂꍇ͊JȂ.
+			@return	Jꍇtrue. */
+		bool Release()
+		{
+			if(this->pBuffer == NULL || this->pBuffer != Traits::GetPointer(this->lpBuffer))
+				return false;
+
+			typename Traits::VectorType().swap(this->lpBuffer);
+			this->pBuffer = NULL;
+
+			return true;
+		}
+		/** J̗̈mۂ. l͕s. */
+		void Reallocate()
+		{
+			if(this->pBuffer != NULL)
+				return;
+
+			this->lpBuffer.resize((size_t)this->count);
+			this->pBuffer = Traits::GetPointer(this->lpBuffer);
+		}
+		/** ̈JĂ邩 */
+		bool IsReleased()const
+		{
+			return this->pBuffer == NULL && this->count > 0;
+		}
+	};
+
+}	// NeuralNetwork
+}	// Layer
+}	// Gravisbell
+
+#endif	// __GRAVISBELL_NN_WEIGHTDATA_PARAMETERBUFFER_H__
@@ -5,8 +5,13 @@
 #include"stdafx.h"
 
 #include<vector>
+#include<string>
+#include<mutex>
 
 #include"WeightData_WeightNormalization.h"
+#include"WeightData_ParameterBuffer.h"
+#include"WeightData_Kernel_CPU.h"
+#include"WeightData_PackedWeight.h"
 
 #include<Layer/NeuralNetwork/IOptimizer.h>
 #include<Library/NeuralNetwork/Optimizer.h>
@@ -20,16 +25,21 @@ namespace NeuralNetwork {
 	class WeightData_WeightNormalization_CPU : public IWeightData
 	{
 	private:
-		std::vector<F32> lpWeight;
-		std::vector<F32> lpBias;
+		mutable std::vector<F32> lpWeight;	/**< _p͔jAQƂꂽ_ŕ */
+		ParameterBuffer<ParameterBufferTraits_CPU> lpBias;
 
-		std::vector<F32> lpScale;			/**< neuron */
-		std::vector<F32> lpVector;			/**< neuron*input */
+		ParameterBuffer<ParameterBufferTraits_CPU> lpScale;		/**< neuron */
+		ParameterBuffer<ParameterBufferTraits_CPU> lpVector;	/**< neuron*input */
 		std::vector<F32> lpVectorScale;		/**< vectoȓ傫 neuron */
 
 		// 덷p
-		std::vector<F32> lpDScale;
-		std::vector<F32> lpDVector;
+		ParameterBuffer<ParameterBufferTraits_CPU> lpDScale;
+		ParameterBuffer<ParameterBufferTraits_CPU> lpDVector;
+		F32* pDBias;	/**< Ǒ덷̈. 蓖ĂĂȂꍇNULL */
+		ParameterBufferTraits_CPU::VectorType lpDBias;	/**< ꊇXVp̌덷̈. Ǒ덷̈悪蓖ĂĂȂꍇɎgp */
+
+		bool onDeferredUpdate;	/**< XVxtO */
+		bool onUpdatePending;	/**< fĂȂ덷i[ĂtO */
 
 		IOptimizer* m_pOptimizer_scale;		/**< XJ[̍XVpIveB}CU */
 		IOptimizer* m_pOptimizer_vector;	/**< xN^[̍XVpIveB}CU */
@@ -38,6 +48,12 @@ namespace NeuralNetwork {
 		U32 neuronCount;
 		U32 inputCount;
 
+		U64 dataVersion;				/**< Weight,Bias̔Ő */
+		bool onInferenceOnly;			/**< _ptO */
+		std::vector<PackedWeight_CPU> lpPackedWeight;	/**< ϊςWeight. [layout] */
+		mutable bool onPlainWeightUsed;	/**< _pɂɌ̕тWeightQƂꂽ. QƂꂽꍇ͔jȂ */
+		mutable std::mutex packMutex;	/**< ϊςWeightƁA̕тWeight̔j/̔r */
+
 	public:
 		//===========================
 		// RXgN^/fXgN^
@@ -53,6 +69,10 @@ namespace NeuralNetwork {
 
 			,	lpDScale			(i_neuronCount)
 			,	lpDVector			(i_neuronCount * i_inputCount)
+			,	pDBias				(NULL)
+
+			,	onDeferredUpdate	(false)
+			,	onUpdatePending		(false)
 
 			,	m_pOptimizer_scale	(NULL)
 			,	m_pOptimizer_vector	(NULL)
@@ -60,6 +80,11 @@ namespace NeuralNetwork {
 
 			,	neuronCount			(i_neuronCount)
 			,	inputCount			(i_inputCount)
+
+			,	dataVersion			(0)
+			,	onInferenceOnly		(false)
+			,	onPlainWeightUsed	(false)
+			,	lpPackedWeight		(WEIGHT_LAYOUT_COUNT, PackedWeight_CPU(i_neuronCount, i_inputCount))
 		{
 		}
 		/** fXgN^ */
@@ -82,7 +107,7 @@ namespace NeuralNetwork {
 			auto& initializer = Gravisbell::Layer::NeuralNetwork::GetInitializerManager().GetInitializer(i_initializerID);
 
 			// d
-			std::vector<F32> lpTmpWeight(this->lpWeight.size());
+			std::vector<F32> lpTmpWeight(this->GetWeigthSize());
 			for(unsigned int weightNum=0; weightNum<lpTmpWeight.size(); weightNum++)
 			{
 				lpTmpWeight[weightNum] = initializer.GetParameter(i_inputCount, i_outputCount);
@@ -132,23 +157,13 @@ namespace NeuralNetwork {
 			this->m_pOptimizer_bias = CreateOptimizerFromBuffer_CPU(&i_lpBuffer[readBufferByte], i_bufferSize-readBufferByte, useBufferSize);
 			readBufferByte += useBufferSize;
 
-			// xN^[̃XP[ČvZ
-			for(U32 neuronNum=0; neuronNum<this->neuronCount; neuronNum++)
-			{
-				// XP[Zo
-				F32 sumValue = 0.0f;
-				for(U32 inputNum=0; inputNum<this->inputCount; inputNum++)
-				{
-					F32 value = this->lpVector[neuronNum*this->inputCount + inputNum];
-
-					sumValue += (value * value);
-				}
-				this->lpVectorScale[neuronNum] = sqrtf(sumValue);
-			}
-
-			// d݂XV
+			// xN^[̃XP[Əd݂ČvZ
 			this->UpdateWeight();
 
+			// _pŕۑĂꍇ͕ϊς݂Weight̂ݕێ
+			if(this->m_pOptimizer_bias)
+				this->SetInferenceOnlyFlag(std::wstring(this->m_pOptimizer_bias->GetOptimizerID()) == L"Frozen");
+
 			return readBufferByte;
 		}
 
@@ -159,7 +174,7 @@ namespace NeuralNetwork {
 		/** Weight̃TCY擾 */
 		U64 GetWeigthSize()const
 		{
-			return this->lpWeight.size();
+			return (U64)this->neuronCount * this->inputCount;
 		}
 		/** Bias̃TCY擾 */
 		U64 GetBiasSize()const
@@ -174,6 +189,11 @@ namespace NeuralNetwork {
 		/** Weight擾 */
 		const F32* GetWeight()const
 		{
+			std::lock_guard<std::mutex> lock(this->packMutex);
+
+			this->RestoreWeightWithoutLock();
+			this->onPlainWeightUsed = true;
+
 			return &this->lpWeight[0];
 		}
 		/** Bias擾 */
@@ -213,10 +233,9 @@ namespace NeuralNetwork {
 				{
 					this->lpVector[neuronNum*this->inputCount + inputNum] = i_lpWeight[neuronNum*this->inputCount + inputNum] / scale;
 				}
-				this->lpVectorScale[neuronNum] = 1.0f;
 			}
 
-			// d݂ČvZ
+			// XP[Əd݂ČvZ
 			this->UpdateWeight();
 
 			return ErrorCode::ERROR_CODE_NONE;
@@ -226,31 +245,40 @@ namespace NeuralNetwork {
 			@param	lpDBias		Biashω. */
 		ErrorCode UpdateData(const F32* i_lpDWeight, const F32* i_lpDBias)
 		{
-			// 덷vZ
-			for(U32 neuronNum=0; neuronNum<this->neuronCount; neuronNum++)
+			// fĂȂ덷ꍇ͐ɔf
+			if(this->onUpdatePending)
+				this->ApplyPendingUpdate();
+
+			// 덷vZ. j[ƂɃXP[덷ƃxNg덷𑱂ċ߂
+			ForEachNeuronRange_CPU(this->neuronCount, this->inputCount, [this, i_lpDWeight](U32 i_neuronBegin, U32 i_neuronEnd)
 			{
-				F32 vectorScale = this->lpVectorScale[neuronNum];
-
-				// XP[덷
-				F32 sumValue = 0.0f;
-				for(U32 inputNum=0; inputNum<this->inputCount; inputNum++)
-				{
-					U32 offset = neuronNum*this->inputCount + inputNum;
-
-					sumValue += this->lpVector[offset] * i_lpDWeight[offset];
-				}
-				this->lpDScale[neuronNum] = sumValue / vectorScale;
+				for(U32 neuronNum=i_neuronBegin; neuronNum<i_neuronEnd; neuronNum++)
+				{
+					U64 offset = (U64)neuronNum*this->inputCount;
 
-				// xNg덷
-				for(U32 inputNum=0; inputNum<this->inputCount; inputNum++)
-				{
-					U32 offset = neuronNum*this->inputCount + inputNum;
-
-					this->lpDVector[offset] = (this->lpScale[neuronNum] / vectorScale) * (i_lpDWeight[offset] - this->lpDScale[neuronNum]*this->lpVector[offset]/vectorScale);
+					this->lpDScale[neuronNum] = DecomposeDWeightKernel_WeightNormalization_CPU(
+						&this->lpVector[offset], &i_lpDWeight[offset], &this->lpDVector[offset], this->inputCount,
+						this->lpScale[neuronNum], this->lpVectorScale[neuronNum]);
 				}
-			}
+			});
 
+
+			// XVxꍇ̓oCAX̌덷i[ďI
+			if(this->onDeferredUpdate)
+			{
+				ParameterBufferTraits_CPU::Copy(this->GetDBiasBuffer(), i_lpDBias, this->lpBias.size());
+				this->onUpdatePending = true;
+
+				return ErrorCode::ERROR_CODE_NONE;
+			}
 
+			// Ǒ덷̈悪蓖ĂĂꍇ́AoCAX̌덷i[
+			if(this->pDBias)
+			{
+				ParameterBufferTraits_CPU::Copy(this->pDBias, i_lpDBias, this->lpBias.size());
+				i_lpDBias = this->pDBias;
+			}
+
 			// 덷𔽉f
 			if(this->m_pOptimizer_scale)
 				this->m_pOptimizer_scale->UpdateParameter(&this->lpScale[0], &this->lpDScale[0]);
@@ -259,36 +287,134 @@ namespace NeuralNetwork {
 			if(this->m_pOptimizer_bias)
 				this->m_pOptimizer_bias->UpdateParameter(&this->lpBias[0],   i_lpDBias);
 
-			// XP[ČvZ
-			for(U32 neuronNum=0; neuronNum<this->neuronCount; neuronNum++)
-			{
-				// XP[Zo
-				F32 sumValue = 0.0f;
-				for(U32 inputNum=0; inputNum<this->inputCount; inputNum++)
-				{
-					F32 value = this->lpVector[neuronNum*this->inputCount + inputNum];
-
-					sumValue += (value * value);
-				}
-				this->lpVectorScale[neuronNum] = sqrtf(sumValue);
-			}
-
-			// d݂ČvZ
+			// XP[Əd݂ČvZ
 			this->UpdateWeight();
 
 			return ErrorCode::ERROR_CODE_NONE;
 		}
 
-		/** WeightXV */
+		/** ωʂŝ݂w肵Weight,BiasXV.
+			d݂̍ČvZ͑SvfΏۂƂ邽ߑŜXV. w肳ĂȂs̕ωʂ0̂ߌʂ͕ςȂ. */
+		ErrorCode UpdateDataSparse(const F32* i_lpDWeight, const F32* i_lpDBias, U32 i_weightRowCount, U32 i_weightRowSize, const U32 i_lpWeightRowNum[], U32 i_weightRowNumCount)
+		{
+			return this->UpdateData(i_lpDWeight, i_lpDBias);
+		}
+		/** WeightXV.
+			j[ƂɃxN^[̑傫߁Aďd݂. */
 		void UpdateWeight()
 		{
-			for(U32 neuronNum=0; neuronNum<this->neuronCount; neuronNum++)
+			// jĂꍇ͊mۂ. l͑Sď㏑
+			{
+				std::lock_guard<std::mutex> lock(this->packMutex);
+				this->lpWeight.resize((size_t)this->GetWeigthSize());
+			}
+			this->dataVersion++;
+
+			ForEachNeuronRange_CPU(this->neuronCount, this->inputCount, [this](U32 i_neuronBegin, U32 i_neuronEnd)
 			{
-				for(U32 inputNum=0; inputNum<this->inputCount; inputNum++)
+				for(U32 neuronNum=i_neuronBegin; neuronNum<i_neuronEnd; neuronNum++)
 				{
-					this->lpWeight[neuronNum*this->inputCount + inputNum] = this->lpScale[neuronNum] * this->lpVector[neuronNum*this->inputCount + inputNum] / this->lpVectorScale[neuronNum];
+					U64 offset = (U64)neuronNum*this->inputCount;
+
+					this->lpVectorScale[neuronNum] = ComposeWeightKernel_WeightNormalization_CPU(
+						&this->lpVector[offset], &this->lpWeight[offset], this->inputCount, this->lpScale[neuronNum]);
 				}
-			}
+			});
+		}
+
+
+		//===========================
+		// ϊςWeight
+		//===========================
+		/** Weight,Bias̔Ő擾 */
+		U64 GetDataVersion()const
+		{
+			return this->dataVersion;
+		}
+		/** w̕тɕϊWeight擾.
+			O̕ϊȍ~ɔŐωĂꍇ̂ݕϊ.
+			_pŌ̕тWeightQƂĂȂꍇ́AϊɌ̕тWeightj */
+		const F32* GetPackedWeight(WeightLayout i_layout)
+		{
+			if(i_layout == WEIGHT_LAYOUT_PLAIN)
+				return this->GetWeight();
+			if(i_layout >= WEIGHT_LAYOUT_COUNT)
+				return NULL;
+
+			std::lock_guard<std::mutex> lock(this->packMutex);
+
+			PackedWeight_CPU& packedWeight = this->lpPackedWeight[i_layout];
+			if(!packedWeight.IsValid(i_layout, this->dataVersion))
+			{
+				this->RestoreWeightWithoutLock();
+				if(!packedWeight.Pack(&this->lpWeight[0], i_layout, this->dataVersion))
+					return NULL;
+
+				if(this->onInferenceOnly && !this->onPlainWeightUsed)
+					this->ReleaseWeightWithoutLock();
+			}
+
+			return packedWeight.Get();
+		}
+		/** _pɂ邩ݒ肷.
+			LɂꍇAϊς݂WeightێĂΌ̕тWeightj.
+			ϊς݂WeightێĂȂꍇ́AϊтQƂ܂Ō̕тWeightێ */
+		ErrorCode SetInferenceOnlyFlag(bool i_onInferenceOnly)
+		{
+			std::lock_guard<std::mutex> lock(this->packMutex);
+
+			this->onInferenceOnly = i_onInferenceOnly;
+			this->onPlainWeightUsed = false;
+			if(!this->onInferenceOnly)
+				this->RestoreWeightWithoutLock();
+			else if(this->FindPackedWeight() != NULL)
+				this->ReleaseWeightWithoutLock();
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+		/** ݂̔Ő̕ϊςWeight擾.
+			@return	ێĂȂꍇNULL. */
+		const PackedWeight_CPU* FindPackedWeight()const
+		{
+			for(U32 layout=0; layout<this->lpPackedWeight.size(); layout++)
+			{
+				if(this->lpPackedWeight[layout].IsValid((WeightLayout)layout, this->dataVersion))
+					return &this->lpPackedWeight[layout];
+			}
+			return NULL;
+		}
+		/** ̕тWeightjĂꍇ́Aϊς݂̒l畜 */
+		void RestoreWeight()const
+		{
+			std::lock_guard<std::mutex> lock(this->packMutex);
+
+			this->RestoreWeightWithoutLock();
+		}
+		/** ̕тWeightj. packMutex擾ς݂ł邱 */
+		void ReleaseWeightWithoutLock()
+		{
+			std::vector<F32>().swap(this->lpWeight);
+		}
+		/** ̕тWeightjĂꍇ́Aϊς݂̒l畜. packMutex擾ς݂ł邱 */
+		void RestoreWeightWithoutLock()const
+		{
+			const PackedWeight_CPU* pPackedWeight = this->FindPackedWeight();
+			if(!this->lpWeight.empty() || pPackedWeight == NULL)
+				return;
+
+			this->lpWeight.resize((size_t)this->GetWeigthSize());
+			pPackedWeight->Unpack(&this->lpWeight[0]);
+		}
+
+		/** ꊇXVp̃oCAX̌덷̊i[擾 */
+		F32* GetDBiasBuffer()
+		{
+			if(this->pDBias)
+				return this->pDBias;
+
+			if(this->lpDBias.size() != this->lpBias.size())
+				this->lpDBias.resize((size_t)this->lpBias.size());
+			return ParameterBufferTraits_CPU::GetPointer(this->lpDBias);
 		}
 
 		//===========================
@@ -301,6 +427,9 @@ namespace NeuralNetwork {
 			ChangeOptimizer_CPU(&this->m_pOptimizer_vector, i_optimizerID, (U32)this->lpVector.size());
 			ChangeOptimizer_CPU(&this->m_pOptimizer_bias,   i_optimizerID, (U32)this->lpBias.size());
 
+			// _p("Frozen")ł͕ϊς݂Weight̂ݕێ
+			this->SetInferenceOnlyFlag(std::wstring(i_optimizerID) == L"Frozen");
+
 			return ErrorCode::ERROR_CODE_NONE;
 		}
 
@@ -338,8 +467,154 @@ namespace NeuralNetwork {
 
 			return ErrorCode::ERROR_CODE_NONE;
 		}
+		/** ێĂSẴIveB}CU[wIDł邩mF */
+		bool CheckOptimizerID(const wchar_t i_optimizerID[])const
+		{
+			std::wstring optimizerID = i_optimizerID;
+			if(this->m_pOptimizer_scale && optimizerID != this->m_pOptimizer_scale->GetOptimizerID())
+				return false;
+			if(this->m_pOptimizer_vector && optimizerID != this->m_pOptimizer_vector->GetOptimizerID())
+				return false;
+			if(this->m_pOptimizer_bias && optimizerID != this->m_pOptimizer_bias->GetOptimizerID())
+				return false;
+
+			return true;
+		}
 		
 		//===========================
+		// p[^̈
+		//===========================
+		/** Õp[^̈ɔzuꍇɕKvȗvf擾 */
+		U64 GetParameterCount()const
+		{
+			return GetParameterAlignedCount(this->lpScale.size()) + GetParameterAlignedCount(this->lpVector.size()) + GetParameterAlignedCount(this->lpBias.size());
+		}
+
+		/** p[^ƌ덷̊i[Ö̗ɕύX.
+			@param	io_lpParameter	p[^̊i[. [scale][vector][bias]̏ɔzu.
+			@param	io_lpDParameter	덷̊i[. */
+		ErrorCode BindParameterBuffer(F32* io_lpParameter, F32* io_lpDParameter)
+		{
+			if((io_lpParameter == NULL) != (io_lpDParameter == NULL))
+				return ErrorCode::ERROR_CODE_COMMON_NULL_REFERENCE;
+
+			// i[悪ς邽߁AfĂȂ덷͐ɔf
+			if(this->onUpdatePending)
+				this->ApplyPendingUpdate();
+
+			if(io_lpParameter == NULL)
+			{
+				this->lpScale.Bind(NULL);
+				this->lpVector.Bind(NULL);
+				this->lpBias.Bind(NULL);
+				this->lpDScale.Bind(NULL);
+				this->lpDVector.Bind(NULL);
+				this->pDBias = NULL;
+			}
+			else
+			{
+				U64 vectorOffset = GetParameterAlignedCount(this->lpScale.size());
+				U64 biasOffset   = vectorOffset + GetParameterAlignedCount(this->lpVector.size());
+
+				this->lpScale.Bind(&io_lpParameter[0]);
+				this->lpVector.Bind(&io_lpParameter[vectorOffset]);
+				this->lpBias.Bind(&io_lpParameter[biasOffset]);
+				this->lpDScale.Bind(&io_lpDParameter[0]);
+				this->lpDVector.Bind(&io_lpDParameter[vectorOffset]);
+				this->pDBias = &io_lpDParameter[biasOffset];
+			}
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+
+
+		//===========================
+		// ꊇXV
+		//===========================
+		/** XVx邩ݒ肷 */
+		ErrorCode SetDeferredUpdateFlag(bool i_onDeferredUpdate)
+		{
+			// fĂȂ덷ꍇ͔f
+			if(!i_onDeferredUpdate && this->onUpdatePending)
+				this->ApplyPendingUpdate();
+
+			this->onDeferredUpdate = i_onDeferredUpdate;
+			if(!this->onDeferredUpdate)
+				ParameterBufferTraits_CPU::VectorType().swap(this->lpDBias);
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+		/** ꊇXV̑Ώې擾. [scale][vector][bias] */
+		U32 GetUpdateTargetCount()const
+		{
+			return 3;
+		}
+		/** ꊇXV̑Ώۂ擾 */
+		ErrorCode GetUpdateTarget(U32 i_targetNum, OptimizerUpdateTarget& o_target)
+		{
+			o_target.pOptimizer   = NULL;
+			o_target.lpParameter  = NULL;
+			o_target.lpDParameter = NULL;
+
+			switch(i_targetNum)
+			{
+			case 0:
+				if(this->onUpdatePending)
+				{
+					o_target.pOptimizer   = this->m_pOptimizer_scale;
+					o_target.lpParameter  = &this->lpScale[0];
+					o_target.lpDParameter = &this->lpDScale[0];
+				}
+				break;
+			case 1:
+				if(this->onUpdatePending)
+				{
+					o_target.pOptimizer   = this->m_pOptimizer_vector;
+					o_target.lpParameter  = &this->lpVector[0];
+					o_target.lpDParameter = &this->lpDVector[0];
+				}
+				break;
+			case 2:
+				if(this->onUpdatePending)
+				{
+					o_target.pOptimizer   = this->m_pOptimizer_bias;
+					o_target.lpParameter  = &this->lpBias[0];
+					o_target.lpDParameter = this->GetDBiasBuffer();
+				}
+				break;
+			default:
+				return ErrorCode::ERROR_CODE_COMMON_OUT_OF_ARRAYRANGE;
+			}
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+		/** ꊇXV̊ʒm.
+			XVXP[ƃxN^[d݂ČvZ. */
+		ErrorCode CompleteUpdate()
+		{
+			if(!this->onUpdatePending)
+				return ErrorCode::ERROR_CODE_NONE;
+			this->onUpdatePending = false;
+
+			// XP[Əd݂ČvZ
+			this->UpdateWeight();
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+		/** fĂȂ덷𔽉f */
+		void ApplyPendingUpdate()
+		{
+			for(U32 targetNum=0; targetNum<this->GetUpdateTargetCount(); targetNum++)
+			{
+				OptimizerUpdateTarget target;
+				this->GetUpdateTarget(targetNum, target);
+				if(target.pOptimizer)
+					target.pOptimizer->UpdateParameter(target.lpParameter, target.lpDParameter);
+			}
+			this->CompleteUpdate();
+		}
+
+		//===========================
 		// C[ۑ
 		//===========================
 		/** C[̕ۑɕKvȃobt@BYTEPʂŎ擾 */
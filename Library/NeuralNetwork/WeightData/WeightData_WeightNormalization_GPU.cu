@@ -5,6 +5,7 @@
 #include"stdafx.h"
 
 #include<vector>
+#include<string>
 
 #pragma warning(push)
 #pragma warning(disable : 4267)
@@ -17,6 +18,7 @@
 #pragma warning(pop)
 
 #include"WeightData_WeightNormalization.h"
+#include"WeightData_ParameterBuffer.h"
 
 #include<Layer/NeuralNetwork/IOptimizer.h>
 #include<Library/NeuralNetwork/Optimizer.h>
@@ -218,15 +220,20 @@ namespace NeuralNetwork {
 	{
 	private:
 		thrust::device_vector<F32> lpWeight;
-		thrust::device_vector<F32> lpBias;
+		ParameterBuffer<ParameterBufferTraits_GPU> lpBias;
 
-		thrust::device_vector<F32> lpScale;			/**< neuron */
-		thrust::device_vector<F32> lpVector;		/**< neuron*input */
+		ParameterBuffer<ParameterBufferTraits_GPU> lpScale;		/**< neuron */
+		ParameterBuffer<ParameterBufferTraits_GPU> lpVector;	/**< neuron*input */
 		thrust::device_vector<F32> lpVectorScale;	/**< vectoȓ傫 neuron */
 
 		// 덷p
-		thrust::device_vector<F32> lpDScale;
-		thrust::device_vector<F32> lpDVector;
+		ParameterBuffer<ParameterBufferTraits_GPU> lpDScale;
+		ParameterBuffer<ParameterBufferTraits_GPU> lpDVector;
+		F32* pDBias;	/**< Ǒ덷̈. 蓖ĂĂȂꍇNULL */
+		ParameterBufferTraits_GPU::VectorType lpDBias;	/**< ꊇXVp̌덷̈. Ǒ덷̈悪蓖ĂĂȂꍇɎgp */
+
+		bool onDeferredUpdate;	/**< XVxtO */
+		bool onUpdatePending;	/**< fĂȂ덷i[ĂtO */
 
 #if 0
 		thrust::device_vector<F32> lpTmpValue;
@@ -244,6 +251,8 @@ namespace NeuralNetwork {
 		U32 neuronCount;
 		U32 inputCount;
 
+		U64 dataVersion;	/**< Weight,Bias̔Ő */
+
 		cublasHandle_t cublasHandle;
 
 	public:
@@ -261,6 +270,10 @@ namespace NeuralNetwork {
 
 			,	lpDScale			(i_neuronCount)
 			,	lpDVector			(i_neuronCount * i_inputCount)
+			,	pDBias				(NULL)
+
+			,	onDeferredUpdate	(false)
+			,	onUpdatePending		(false)
 
 #if 0
 			,	lpTmpValue			(i_neuronCount * i_inputCount)
@@ -276,6 +289,8 @@ namespace NeuralNetwork {
 
 			,	neuronCount			(i_neuronCount)
 			,	inputCount			(i_inputCount)
+
+			,	dataVersion			(0)
 		{
 			cublasCreate(&cublasHandle);
 		}
@@ -497,6 +512,10 @@ namespace NeuralNetwork {
 			@param	lpDBias		Biashω. */
 		ErrorCode UpdateData(const F32* i_lpDWeight, const F32* i_lpDBias)
 		{
+			// fĂȂ덷ꍇ͐ɔf
+			if(this->onUpdatePending)
+				this->ApplyPendingUpdate();
+
 #ifdef _DEBUG
 			std::vector<F32> lpTmpVector(this->lpVector.size());
 			std::vector<F32> lpTmpDWeight(this->lpVector.size());
@@ -545,8 +564,24 @@ namespace NeuralNetwork {
 					thrust::raw_pointer_cast(&this->lpVectorScale[0]),
 					i_lpDWeight,
 					thrust::raw_pointer_cast(&this->lpDScale[0]));
+			}
+
+			// XVxꍇ̓oCAX̌덷i[ďI
+			if(this->onDeferredUpdate)
+			{
+				ParameterBufferTraits_GPU::Copy(this->GetDBiasBuffer(), i_lpDBias, this->lpBias.size());
+				this->onUpdatePending = true;
+
+				return ErrorCode::ERROR_CODE_NONE;
 			}
 
+			// Ǒ덷̈悪蓖ĂĂꍇ́AoCAX̌덷i[
+			if(this->pDBias)
+			{
+				ParameterBufferTraits_GPU::Copy(this->pDBias, i_lpDBias, this->lpBias.size());
+				i_lpDBias = this->pDBias;
+			}
+
 			// 덷𔽉f
 			if(this->m_pOptimizer_scale)
 				this->m_pOptimizer_scale->UpdateParameter(thrust::raw_pointer_cast(&this->lpScale[0]), thrust::raw_pointer_cast(&this->lpDScale[0]));
@@ -609,9 +644,17 @@ namespace NeuralNetwork {
 			return ErrorCode::ERROR_CODE_NONE;
 		}
 
+		/** ωʂŝ݂w肵Weight,BiasXV.
+			d݂̍ČvZ͑SvfΏۂƂ邽ߑŜXV. w肳ĂȂs̕ωʂ0̂ߌʂ͕ςȂ. */
+		ErrorCode UpdateDataSparse(const F32* i_lpDWeight, const F32* i_lpDBias, U32 i_weightRowCount, U32 i_weightRowSize, const U32 i_lpWeightRowNum[], U32 i_weightRowNumCount)
+		{
+			return this->UpdateData(i_lpDWeight, i_lpDBias);
+		}
 		/** WeightXV */
 		void UpdateWeight()
 		{
+			this->dataVersion++;
+
 #if 0
 			device_UpdateWeight<<<this->neuronCount, this->inputCount>>>(
 				thrust::raw_pointer_cast(&this->lpWeight[0]),
@@ -633,8 +676,44 @@ namespace NeuralNetwork {
 			std::vector<F32> lpTmpWeight(this->lpWeight.size());
 			cudaMemcpy(&lpTmpWeight[0], thrust::raw_pointer_cast(&this->lpWeight[0]), sizeof(F32)*lpTmpWeight.size(), cudaMemcpyDeviceToHost);
 #endif
+		}
+
+		//===========================
+		// ϊςWeight
+		//===========================
+		/** Weight,Bias̔Ő擾 */
+		U64 GetDataVersion()const
+		{
+			return this->dataVersion;
+		}
+		/** w̕тɕϊWeight擾.
+			GPUł͕ϊȂ. ̕шȊONULLԂ. */
+		const F32* GetPackedWeight(WeightLayout i_layout)
+		{
+			if(i_layout == WEIGHT_LAYOUT_PLAIN)
+				return this->GetWeight();
+
+			return NULL;
+		}
+		/** _pɂ邩ݒ肷.
+			GPUł͕ϊς݂̒lێȂ߁A̕тWeightێ. */
+		ErrorCode SetInferenceOnlyFlag(bool i_onInferenceOnly)
+		{
+			return ErrorCode::ERROR_CODE_NONE;
 		}
 
+		/** ꊇXVp̃oCAX̌덷̊i[擾 */
+		F32* GetDBiasBuffer()
+		{
+			if(this->pDBias)
+				return this->pDBias;
+
+			if(this->lpDBias.size() != this->lpBias.size())
+				this->lpDBias.resize((size_t)this->lpBias.size());
+			return ParameterBufferTraits_GPU::GetPointer(this->lpDBias);
+		}
+
+
 		//===========================
 		// IveB}CU[ݒ
 		//===========================
@@ -682,8 +761,163 @@ namespace NeuralNetwork {
 
 			return ErrorCode::ERROR_CODE_NONE;
 		}
+		/** ێĂSẴIveB}CU[wIDł邩mF */
+		bool CheckOptimizerID(const wchar_t i_optimizerID[])const
+		{
+			std::wstring optimizerID = i_optimizerID;
+			if(this->m_pOptimizer_scale && optimizerID != this->m_pOptimizer_scale->GetOptimizerID())
+				return false;
+			if(this->m_pOptimizer_vector && optimizerID != this->m_pOptimizer_vector->GetOptimizerID())
+				return false;
+			if(this->m_pOptimizer_bias && optimizerID != this->m_pOptimizer_bias->GetOptimizerID())
+				return false;
+
+			return true;
+		}
 		
 		//===========================
+		// p[^̈
+		//===========================
+		/** Õp[^̈ɔzuꍇɕKvȗvf擾 */
+		U64 GetParameterCount()const
+		{
+			return GetParameterAlignedCount(this->lpScale.size()) + GetParameterAlignedCount(this->lpVector.size()) + GetParameterAlignedCount(this->lpBias.size());
+		}
+		/** p[^ƌ덷̊i[Ö̗ɕύX.
+			@param	io_lpParameter	p[^̊i[. [scale][vector][bias]̏ɔzu.
+			@param	io_lpDParameter	덷̊i[. */
+		ErrorCode BindParameterBuffer(F32* io_lpParameter, F32* io_lpDParameter)
+		{
+			if((io_lpParameter == NULL) != (io_lpDParameter == NULL))
+				return ErrorCode::ERROR_CODE_COMMON_NULL_REFERENCE;
+
+			// i[悪ς邽߁AfĂȂ덷͐ɔf
+			if(this->onUpdatePending)
+				this->ApplyPendingUpdate();
+
+			if(io_lpParameter == NULL)
+			{
+				this->lpScale.Bind(NULL);
+				this->lpVector.Bind(NULL);
+				this->lpBias.Bind(NULL);
+				this->lpDScale.Bind(NULL);
+				this->lpDVector.Bind(NULL);
+				this->pDBias = NULL;
+			}
+			else
+			{
+				U64 vectorOffset = GetParameterAlignedCount(this->lpScale.size());
+				U64 biasOffset   = vectorOffset + GetParameterAlignedCount(this->lpVector.size());
+
+				this->lpScale.Bind(&io_lpParameter[0]);
+				this->lpVector.Bind(&io_lpParameter[vectorOffset]);
+				this->lpBias.Bind(&io_lpParameter[biasOffset]);
+				this->lpDScale.Bind(&io_lpDParameter[0]);
+				this->lpDVector.Bind(&io_lpDParameter[vectorOffset]);
+				this->pDBias = &io_lpDParameter[biasOffset];
+			}
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+
+
+		//===========================
+		// ꊇXV
+		//===========================
+		/** XVx邩ݒ肷 */
+		ErrorCode SetDeferredUpdateFlag(bool i_onDeferredUpdate)
+		{
+			// fĂȂ덷ꍇ͔f
+			if(!i_onDeferredUpdate && this->onUpdatePending)
+				this->ApplyPendingUpdate();
+
+			this->onDeferredUpdate = i_onDeferredUpdate;
+			if(!this->onDeferredUpdate)
+				ParameterBufferTraits_GPU::VectorType().swap(this->lpDBias);
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+		/** ꊇXV̑Ώې擾. [scale][vector][bias] */
+		U32 GetUpdateTargetCount()const
+		{
+			return 3;
+		}
+		/** ꊇXV̑Ώۂ擾 */
+		ErrorCode GetUpdateTarget(U32 i_targetNum, OptimizerUpdateTarget& o_target)
+		{
+			o_target.pOptimizer   = NULL;
+			o_target.lpParameter  = NULL;
+			o_target.lpDParameter = NULL;
+
+			switch(i_targetNum)
+			{
+			case 0:
+				if(this->onUpdatePending)
+				{
+					o_target.pOptimizer   = this->m_pOptimizer_scale;
+					o_target.lpParameter  = thrust::raw_pointer_cast(&this->lpScale[0]);
+					o_target.lpDParameter = thrust::raw_pointer_cast(&this->lpDScale[0]);
+				}
+				break;
+			case 1:
+				if(this->onUpdatePending)
+				{
+					o_target.pOptimizer   = this->m_pOptimizer_vector;
+					o_target.lpParameter  = thrust::raw_pointer_cast(&this->lpVector[0]);
+					o_target.lpDParameter = thrust::raw_pointer_cast(&this->lpDVector[0]);
+				}
+				break;
+			case 2:
+				if(this->onUpdatePending)
+				{
+					o_target.pOptimizer   = this->m_pOptimizer_bias;
+					o_target.lpParameter  = thrust::raw_pointer_cast(&this->lpBias[0]);
+					o_target.lpDParameter = this->GetDBiasBuffer();
+				}
+				break;
+			default:
+				return ErrorCode::ERROR_CODE_COMMON_OUT_OF_ARRAYRANGE;
+			}
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+		/** ꊇXV̊ʒm.
+			XVXP[ƃxN^[d݂ČvZ. */
+		ErrorCode CompleteUpdate()
+		{
+			if(!this->onUpdatePending)
+				return ErrorCode::ERROR_CODE_NONE;
+			this->onUpdatePending = false;
+
+			// xNg̃XP[vZ
+			{
+				U32 loopCount = (this->inputCount + CALCULATE_DSCALE_BLOCK_SIZE-1) / CALCULATE_DSCALE_BLOCK_SIZE;
+				device_CalculateScale<<<this->neuronCount, CALCULATE_DSCALE_BLOCK_SIZE>>>(
+					thrust::raw_pointer_cast(&this->lpVectorScale[0]),
+					thrust::raw_pointer_cast(&this->lpVector[0]),
+					this->inputCount,
+					loopCount);
+			}
+
+			// d݂ČvZ
+			this->UpdateWeight();
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+		/** fĂȂ덷𔽉f */
+		void ApplyPendingUpdate()
+		{
+			for(U32 targetNum=0; targetNum<this->GetUpdateTargetCount(); targetNum++)
+			{
+				OptimizerUpdateTarget target;
+				this->GetUpdateTarget(targetNum, target);
+				if(target.pOptimizer)
+					target.pOptimizer->UpdateParameter(target.lpParameter, target.lpDParameter);
+			}
+			this->CompleteUpdate();
+		}
+
+		//===========================
 		// C[ۑ
 		//===========================
 		/** C[̕ۑɕKvȃobt@BYTEPʂŎ擾 */
@@ -0,0 +1,218 @@
+//==================================
+// j[lbg[N̔񓯊spUtility
+// Calculate/Training̃[J[XbhŏɎsA
+// Ăяo͊҂Ɏ̃ob`̏s
+//==================================
+#include"stdafx.h"
+
+#include"Utility/NeuralNetworkAsyncExecutor.h"
+
+#include<vector>
+#include<deque>
+#include<mutex>
+#include<condition_variable>
+#include<thread>
+
+namespace Gravisbell {
+namespace Utility {
+namespace NeuralNetworkLayer {
+
+	/** 񓯊̎ */
+	enum AsyncTaskType
+	{
+		ASYNC_TASK_TYPE_CALCULATE,	/**< Z */
+		ASYNC_TASK_TYPE_TRAINING,	/**< wK */
+	};
+
+	/** 񓯊̗v */
+	struct AsyncTask
+	{
+		AsyncTaskType type;
+
+		std::vector<CONST_BATCH_BUFFER_POINTER> lppInputBuffer;	/**< Z: ̓f[^ */
+		BATCH_BUFFER_POINTER lpOutputBuffer;					/**< Z: o̓f[^i[ */
+
+		std::vector<BATCH_BUFFER_POINTER> lppDInputBuffer;		/**< wK: ͌덷i[. ̏ꍇ͏o͂Ȃ */
+		CONST_BATCH_BUFFER_POINTER lpDOutputBuffer;				/**< wK: o͌덷 */
+
+		std::promise<Gravisbell::ErrorCode> result;				/**<  */
+	};
+
+	class NeuralNetworkAsyncExecutor : public INeuralNetworkAsyncExecutor
+	{
+	private:
+		Layer::NeuralNetwork::INeuralNetwork& m_neuralNetwork;	/**< Ώۂ̃lbg[N */
+
+		std::thread m_workerThread;		/**< [J[Xbh */
+
+		mutable std::mutex m_mutex;
+		std::condition_variable m_taskCondition;	/**< v̒ǉA~vʒm */
+		std::condition_variable m_doneCondition;	/**< ̊ʒm */
+		std::deque<AsyncTask*> m_lpTaskQueue;		/**< s̗v */
+		U32 m_pendingCount;							/**< ̏. s̏܂ */
+		Gravisbell::ErrorCode m_firstError;			/**< OWaitAllȍ~ɍŏɔG[ */
+		bool m_onStop;								/**< ~vtO */
+
+	public:
+		/** RXgN^ */
+		NeuralNetworkAsyncExecutor(Layer::NeuralNetwork::INeuralNetwork& i_neuralNetwork)
+			:	m_neuralNetwork	(i_neuralNetwork)
+			,	m_pendingCount	(0)
+			,	m_firstError	(ErrorCode::ERROR_CODE_NONE)
+			,	m_onStop		(false)
+		{
+			this->m_workerThread = std::thread(&NeuralNetworkAsyncExecutor::WorkerThread, this);
+		}
+		/** fXgN^ */
+		virtual ~NeuralNetworkAsyncExecutor()
+		{
+			{
+				std::lock_guard<std::mutex> lock(this->m_mutex);
+				this->m_onStop = true;
+			}
+			this->m_taskCondition.notify_all();
+			this->m_workerThread.join();
+		}
+
+	public:
+		//===========================
+		// 
+		//===========================
+		/** Zv. */
+		AsyncHandle CalculateAsync(CONST_BATCH_BUFFER_POINTER i_lppInputBuffer[], BATCH_BUFFER_POINTER o_lpOutputBuffer)
+		{
+			if(i_lppInputBuffer == NULL)
+				return this->CreateErrorHandle(ErrorCode::ERROR_CODE_COMMON_NULL_REFERENCE);
+
+			AsyncTask* pTask = new AsyncTask();
+			pTask->type = ASYNC_TASK_TYPE_CALCULATE;
+			pTask->lppInputBuffer.assign(i_lppInputBuffer, i_lppInputBuffer + this->m_neuralNetwork.GetInputDataCount());
+			pTask->lpOutputBuffer = o_lpOutputBuffer;
+			pTask->lpDOutputBuffer = NULL;
+
+			return this->PushTask(pTask);
+		}
+
+		/** wKv. */
+		AsyncHandle TrainingAsync(BATCH_BUFFER_POINTER o_lppDInputBuffer[], CONST_BATCH_BUFFER_POINTER i_lppDOutputBuffer)
+		{
+			if(i_lppDOutputBuffer == NULL)
+				return this->CreateErrorHandle(ErrorCode::ERROR_CODE_COMMON_NULL_REFERENCE);
+
+			AsyncTask* pTask = new AsyncTask();
+			pTask->type = ASYNC_TASK_TYPE_TRAINING;
+			pTask->lpOutputBuffer = NULL;
+			if(o_lppDInputBuffer)
+				pTask->lppDInputBuffer.assign(o_lppDInputBuffer, o_lppDInputBuffer + this->m_neuralNetwork.GetInputDataCount());
+			pTask->lpDOutputBuffer = i_lppDOutputBuffer;
+
+			return this->PushTask(pTask);
+		}
+
+		/** vς݂̏SĊ܂őҋ@. */
+		Gravisbell::ErrorCode WaitAll()
+		{
+			std::unique_lock<std::mutex> lock(this->m_mutex);
+			this->m_doneCondition.wait(lock, [this](){ return this->m_pendingCount == 0; });
+
+			Gravisbell::ErrorCode err = this->m_firstError;
+			this->m_firstError = ErrorCode::ERROR_CODE_NONE;
+
+			return err;
+		}
+
+		/** ̏擾 */
+		U32 GetPendingCount()const
+		{
+			std::lock_guard<std::mutex> lock(this->m_mutex);
+			return this->m_pendingCount;
+		}
+
+	private:
+		/** vL[ɒǉ */
+		AsyncHandle PushTask(AsyncTask* pTask)
+		{
+			AsyncHandle handle = pTask->result.get_future().share();
+			{
+				std::lock_guard<std::mutex> lock(this->m_mutex);
+				this->m_lpTaskQueue.push_back(pTask);
+				this->m_pendingCount++;
+			}
+			this->m_taskCondition.notify_one();
+
+			return handle;
+		}
+		/** ς݂̃nh쐬 */
+		AsyncHandle CreateErrorHandle(Gravisbell::ErrorCode i_err)
+		{
+			std::promise<Gravisbell::ErrorCode> result;
+			result.set_value(i_err);
+			return result.get_future().share();
+		}
+
+		/** [J[Xbh̏.
+			~vĂAvς݂̏SĎsĂI. */
+		void WorkerThread()
+		{
+			// ỎŽ. ZɎsꍇAwK͂̌ʂgpłȂߎsȂ
+			Gravisbell::ErrorCode calculateError = ErrorCode::ERROR_CODE_NONE;
+
+			for(;;)
+			{
+				AsyncTask* pTask = NULL;
+				{
+					std::unique_lock<std::mutex> lock(this->m_mutex);
+					this->m_taskCondition.wait(lock, [this](){ return this->m_onStop || !this->m_lpTaskQueue.empty(); });
+					if(this->m_lpTaskQueue.empty())
+						break;
+
+					pTask = this->m_lpTaskQueue.front();
+					this->m_lpTaskQueue.pop_front();
+				}
+
+				Gravisbell::ErrorCode err = ErrorCode::ERROR_CODE_NONE;
+				switch(pTask->type)
+				{
+				case ASYNC_TASK_TYPE_CALCULATE:
+					err = this->m_neuralNetwork.Calculate(&pTask->lppInputBuffer[0]);
+					if(err == ErrorCode::ERROR_CODE_NONE && pTask->lpOutputBuffer)
+						err = this->m_neuralNetwork.GetOutputBuffer(pTask->lpOutputBuffer);
+					calculateError = err;
+					break;
+
+				case ASYNC_TASK_TYPE_TRAINING:
+					if(calculateError != ErrorCode::ERROR_CODE_NONE)
+					{
+						err = calculateError;
+						break;
+					}
+					err = this->m_neuralNetwork.Training(pTask->lppDInputBuffer.empty() ? NULL : &pTask->lppDInputBuffer[0], pTask->lpDOutputBuffer);
+					break;
+				}
+
+				// ʒm. ʒm͗vobt@ėpł
+				pTask->result.set_value(err);
+				delete pTask;
+				{
+					std::lock_guard<std::mutex> lock(this->m_mutex);
+					if(err != ErrorCode::ERROR_CODE_NONE && this->m_firstError == ErrorCode::ERROR_CODE_NONE)
+						this->m_firstError = err;
+					this->m_pendingCount--;
+				}
+				this->m_doneCondition.notify_all();
+			}
+		}
+	};
+
+	/** 񓯊s쐬. */
+	INeuralNetworkAsyncExecutor* CreateAsyncExecutor(Layer::NeuralNetwork::INeuralNetwork& neuralNetwork)
+	{
+		if(neuralNetwork.GetInputDataCount() == 0)
+			return NULL;
+
+		return new NeuralNetworkAsyncExecutor(neuralNetwork);
+	}
+
+}	// NeuralNetworkLayer
+}	// Utility
+}	// Gravisbell
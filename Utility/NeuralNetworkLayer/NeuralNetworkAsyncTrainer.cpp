@@ -0,0 +1,160 @@
+//==================================
+// j[lbg[N̔񓯊wKpUtility
+// ̃C[f[^쐬̃lbg[N
+// ʃXbhŊwKAd݂bNɋLXV(Hogwild!)
+//==================================
+#include"stdafx.h"
+
+#include"Utility/NeuralNetworkAsyncTrainer.h"
+
+#include<vector>
+#include<thread>
+#include<atomic>
+
+#include<boost/uuid/uuid_generators.hpp>
+
+namespace Gravisbell {
+namespace Utility {
+namespace NeuralNetworkLayer {
+
+	/** 񓯊wK̃[J[ */
+	struct AsyncTrainingWorker
+	{
+		U32 workerNo;										/**< [J[ԍ */
+		Layer::NeuralNetwork::INeuralNetwork* pNeuralNetwork;	/**< [J[p̃lbg[N */
+		Gravisbell::ErrorCode errorCode;					/**< s */
+	};
+
+	/** 񓯊wK̋L */
+	struct AsyncTrainingShareInfo
+	{
+		std::atomic<U64> stepNo;		/**< ɎsXebvԍ */
+		std::atomic<bool> onError;		/**< ꂩ̃[J[ŃG[tO */
+		U64 stepCount;					/**< sXebv */
+
+		AsyncTrainingStepFunc stepFunc;	/**< 1Xebv̏ */
+		void* pUserData;				/**< [U[f[^ */
+	};
+
+	/** [J[Xbh̏ */
+	static void AsyncTrainingWorkerProc(AsyncTrainingWorker* io_pWorker, AsyncTrainingShareInfo* io_pShareInfo)
+	{
+		while(!io_pShareInfo->onError.load(std::memory_order_relaxed))
+		{
+			U64 stepNo = io_pShareInfo->stepNo.fetch_add(1);
+			if(stepNo >= io_pShareInfo->stepCount)
+				break;
+
+			Gravisbell::ErrorCode err = io_pShareInfo->stepFunc(io_pWorker->workerNo, stepNo, *io_pWorker->pNeuralNetwork, io_pShareInfo->pUserData);
+			if(err != ErrorCode::ERROR_CODE_NONE)
+			{
+				io_pWorker->errorCode = err;
+				io_pShareInfo->onError = true;
+				break;
+			}
+		}
+	}
+
+	/** 񓯊wKs. */
+	Gravisbell::ErrorCode ExecuteAsyncTraining(
+		Layer::Connect::ILayerConnectData& neuralNetworkData, const IODataStruct i_lpInputDataStruct[], U32 i_inputCount,
+		U32 i_batchSize, U32 i_workerCount, U64 i_stepCount,
+		AsyncTrainingStepFunc i_stepFunc, void* i_pUserData)
+	{
+		if(i_stepFunc == NULL)
+			return ErrorCode::ERROR_CODE_COMMON_NULL_REFERENCE;
+		if(i_workerCount == 0 || i_batchSize == 0)
+			return ErrorCode::ERROR_CODE_COMMON_OUT_OF_VALUERANGE;
+
+		// bNɍXVł̂͏ԂȂSGD̂.
+		// Adam̃[gAÄ̌덷AxXV̌덷̓[J[ԂŋLĂ܂ߑΏۊOƂ
+		if(!neuralNetworkData.CheckOptimizerID(L"SGD"))
+			return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+		if(neuralNetworkData.GetFlatParameterFlag() || neuralNetworkData.GetDeferredUpdateFlag())
+			return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+
+		Gravisbell::ErrorCode err = ErrorCode::ERROR_CODE_NONE;
+
+		// [J[ƂɃlbg[N쐬.
+		// d݂̓C[f[^ɂ邽ߑS[J[ŋL
+		std::vector<AsyncTrainingWorker> lpWorker(i_workerCount);
+		for(U32 workerNo=0; workerNo<i_workerCount; workerNo++)
+		{
+			lpWorker[workerNo].workerNo = workerNo;
+			lpWorker[workerNo].pNeuralNetwork = NULL;
+			lpWorker[workerNo].errorCode = ErrorCode::ERROR_CODE_NONE;
+		}
+		for(U32 workerNo=0; workerNo<i_workerCount; workerNo++)
+		{
+			Layer::ILayerBase* pLayer = neuralNetworkData.CreateLayer(boost::uuids::random_generator()().data, i_lpInputDataStruct, i_inputCount);
+			lpWorker[workerNo].pNeuralNetwork = dynamic_cast<Layer::NeuralNetwork::INeuralNetwork*>(pLayer);
+			if(lpWorker[workerNo].pNeuralNetwork == NULL)
+			{
+				if(pLayer)
+					delete pLayer;
+				err = ErrorCode::ERROR_CODE_LAYER_CREATE;
+				break;
+			}
+
+			err = lpWorker[workerNo].pNeuralNetwork->PreProcessLearn(i_batchSize);
+			if(err != ErrorCode::ERROR_CODE_NONE)
+				break;
+			err = lpWorker[workerNo].pNeuralNetwork->PreProcessLoop();
+			if(err != ErrorCode::ERROR_CODE_NONE)
+				break;
+		}
+
+		// d݂̔񓯊XVL.
+		// ωʂ̏W񃋁[`ݒ肳Ăꍇ̓IveB}CUۂ
+		bool onAsyncUpdate = false;
+		if(err == ErrorCode::ERROR_CODE_NONE)
+		{
+			onAsyncUpdate = true;
+			err = neuralNetworkData.SetOptimizerHyperParameter(L"AsyncUpdate", (S32)1);
+		}
+
+		if(err == ErrorCode::ERROR_CODE_NONE)
+		{
+
+			AsyncTrainingShareInfo shareInfo;
+			shareInfo.stepNo = 0;
+			shareInfo.onError = false;
+			shareInfo.stepCount = i_stepCount;
+			shareInfo.stepFunc = i_stepFunc;
+			shareInfo.pUserData = i_pUserData;
+
+			// [J[s
+			std::vector<std::thread> lpThread;
+			for(U32 workerNo=0; workerNo<i_workerCount; workerNo++)
+				lpThread.push_back(std::thread(AsyncTrainingWorkerProc, &lpWorker[workerNo], &shareInfo));
+			for(auto& thread : lpThread)
+				thread.join();
+
+			// ŏɔG[Ԃ
+			for(U32 workerNo=0; workerNo<i_workerCount; workerNo++)
+			{
+				if(lpWorker[workerNo].errorCode != ErrorCode::ERROR_CODE_NONE)
+				{
+					err = lpWorker[workerNo].errorCode;
+					break;
+				}
+			}
+		}
+
+		// d݂̔񓯊XV𖳌. ꕔ̃C[̂ݗLɐꍇ߂
+		if(onAsyncUpdate)
+			neuralNetworkData.SetOptimizerHyperParameter(L"AsyncUpdate", (S32)0);
+
+		// lbg[N폜
+		for(U32 workerNo=0; workerNo<i_workerCount; workerNo++)
+		{
+			if(lpWorker[workerNo].pNeuralNetwork)
+				delete lpWorker[workerNo].pNeuralNetwork;
+		}
+
+		return err;
+	}
+
+}	// NeuralNetworkLayer
+}	// Utility
+}	// Gravisbell
@@ -0,0 +1,123 @@
+//==================================
+// d݂L鐄_psReLXgpUtility
+// ̃C[f[^畡̃ReLXg쐬A
+// ʃXbh瓯ɐ_s
+//==================================
+#include"stdafx.h"
+
+#include"Utility/NeuralNetworkInferenceContext.h"
+
+#include<boost/uuid/uuid_generators.hpp>
+
+namespace Gravisbell {
+namespace Utility {
+namespace NeuralNetworkLayer {
+
+	class NeuralNetworkInferenceContext : public INeuralNetworkInferenceContext
+	{
+	private:
+		Layer::NeuralNetwork::INeuralNetwork* m_pNeuralNetwork;	/**< ReLXgp̃lbg[N. Zpobt@ێ */
+
+	public:
+		/** RXgN^ */
+		NeuralNetworkInferenceContext(Layer::NeuralNetwork::INeuralNetwork* i_pNeuralNetwork)
+			:	m_pNeuralNetwork	(i_pNeuralNetwork)
+		{
+		}
+		/** fXgN^ */
+		virtual ~NeuralNetworkInferenceContext()
+		{
+			if(this->m_pNeuralNetwork)
+				delete this->m_pNeuralNetwork;
+		}
+
+	public:
+		//===========================
+		// {
+		//===========================
+		/** ob`TCY擾 */
+		U32 GetBatchSize()const
+		{
+			return this->m_pNeuralNetwork->GetBatchSize();
+		}
+		/** őob`TCY擾 */
+		U32 GetMaxBatchSize()const
+		{
+			return this->m_pNeuralNetwork->GetMaxBatchSize();
+		}
+
+		/** ̓f[^\擾 */
+		IODataStruct GetInputDataStruct(U32 i_inputNum)const
+		{
+			return this->m_pNeuralNetwork->GetInputDataStruct(i_inputNum);
+		}
+		/** o̓f[^\擾 */
+		IODataStruct GetOutputDataStruct()const
+		{
+			return this->m_pNeuralNetwork->GetOutputDataStruct();
+		}
+
+	public:
+		//===========================
+		// 
+		//===========================
+		/** Zs. */
+		Gravisbell::ErrorCode Calculate(CONST_BATCH_BUFFER_POINTER i_lppInputBuffer[])
+		{
+			return this->m_pNeuralNetwork->Calculate(i_lppInputBuffer);
+		}
+
+		/** ZɎgpob`TCYύX. */
+		Gravisbell::ErrorCode SetBatchSize(U32 i_batchSize)
+		{
+			return this->m_pNeuralNetwork->SetBatchSize(i_batchSize);
+		}
+
+		/** o̓f[^obt@擾. */
+		CONST_BATCH_BUFFER_POINTER GetOutputBuffer()const
+		{
+			return this->m_pNeuralNetwork->GetOutputBuffer();
+		}
+		/** o̓f[^obt@擾. */
+		Gravisbell::ErrorCode GetOutputBuffer(BATCH_BUFFER_POINTER o_lpOutputBuffer)const
+		{
+			return this->m_pNeuralNetwork->GetOutputBuffer(o_lpOutputBuffer);
+		}
+	};
+
+	/** _psReLXg쐬. */
+	INeuralNetworkInferenceContext* CreateInferenceContext(
+		Layer::Connect::ILayerConnectData& neuralNetworkData, const IODataStruct i_lpInputDataStruct[], U32 i_inputCount, U32 i_batchSize)
+	{
+		if(i_batchSize == 0)
+			return NULL;
+
+		// lbg[N쐬.
+		// d݂̓C[f[^ɂ邽߁A쐬͉̂Zpobt@̂
+		Layer::ILayerBase* pLayer = neuralNetworkData.CreateLayer(boost::uuids::random_generator()().data, i_lpInputDataStruct, i_inputCount);
+		Layer::NeuralNetwork::INeuralNetwork* pNeuralNetwork = dynamic_cast<Layer::NeuralNetwork::INeuralNetwork*>(pLayer);
+		if(pNeuralNetwork == NULL)
+		{
+			if(pLayer)
+				delete pLayer;
+			return NULL;
+		}
+
+		// Zpobt@mۂ
+		if(pNeuralNetwork->PreProcessCalculate(i_batchSize) != ErrorCode::ERROR_CODE_NONE)
+		{
+			delete pNeuralNetwork;
+			return NULL;
+		}
+		if(pNeuralNetwork->PreProcessLoop() != ErrorCode::ERROR_CODE_NONE)
+		{
+			delete pNeuralNetwork;
+			return NULL;
+		}
+
+		return new NeuralNetworkInferenceContext(pNeuralNetwork);
+	}
+
+}	// NeuralNetworkLayer
+}	// Utility
+}	// Gravisbell
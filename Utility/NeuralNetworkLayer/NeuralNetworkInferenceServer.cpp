@@ -0,0 +1,552 @@
+//==================================
+// Iob`s_T[o[pUtility
+// 1TvPʂ̗v܂Ƃ߂ăob`A
+// ̐_ReLXgŕɉZ
+//==================================
+#include"stdafx.h"
+
+#include"Utility/NeuralNetworkInferenceServer.h"
+
+#include<string>
+#include<vector>
+#include<deque>
+#include<mutex>
+#include<condition_variable>
+#include<future>
+#include<thread>
+#include<chrono>
+#include<algorithm>
+
+#ifndef _WIN32
+#include<sys/socket.h>
+#include<sys/un.h>
+#include<unistd.h>
+#include<cerrno>
+#include<cstring>
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+#endif
+
+namespace Gravisbell {
+namespace Utility {
+namespace NeuralNetworkLayer {
+
+	/** ԂWv钼߂̗v */
+	static const U32 LATENCY_SAMPLE_COUNT = 4096;
+
+	/** _v */
+	struct InferenceRequest
+	{
+		const F32* lpInputBuffer;								/**< ̓f[^ */
+		F32* lpOutputBuffer;									/**< o̓f[^i[ */
+		std::chrono::steady_clock::time_point requestTime;		/**< v󂯕t */
+		std::promise<Gravisbell::ErrorCode> result;				/**<  */
+	};
+
+	/** SʐvZ.
+		@param	io_lpValue	Ώۂ̒l. ёւ.
+		@param	i_rate		0.0`1.0 */
+	static F32 CalculatePercentile(std::vector<F32>& io_lpValue, F32 i_rate)
+	{
+		if(io_lpValue.empty())
+			return 0.0f;
+
+		size_t pos = std::min<size_t>(io_lpValue.size() - 1, (size_t)(i_rate * io_lpValue.size()));
+		std::nth_element(io_lpValue.begin(), io_lpValue.begin() + pos, io_lpValue.end());
+
+		return io_lpValue[pos];
+	}
+
+#ifndef _WIN32
+	/** wTCYMI܂őҋ@.
+		@return	ڑؒfꂽꍇfalse */
+	static bool ReceiveAll(int i_socket, void* o_lpBuffer, size_t i_size)
+	{
+		BYTE* lpBuffer = (BYTE*)o_lpBuffer;
+		while(i_size > 0)
+		{
+			ssize_t receiveSize = recv(i_socket, lpBuffer, i_size, 0);
+			if(receiveSize < 0 && errno == EINTR)
+				continue;
+			if(receiveSize <= 0)
+				return false;
+
+			lpBuffer += receiveSize;
+			i_size   -= receiveSize;
+		}
+		return true;
+	}
+	/** wTCY𑗐MI܂őҋ@.
+		@return	ڑؒfꂽꍇfalse */
+	static bool SendAll(int i_socket, const void* i_lpBuffer, size_t i_size)
+	{
+		const BYTE* lpBuffer = (const BYTE*)i_lpBuffer;
+		while(i_size > 0)
+		{
+			ssize_t sendSize = send(i_socket, lpBuffer, i_size, MSG_NOSIGNAL);
+			if(sendSize < 0 && errno == EINTR)
+				continue;
+			if(sendSize <= 0)
+				return false;
+
+			lpBuffer += sendSize;
+			i_size   -= sendSize;
+		}
+		return true;
+	}
+#endif
+
+
+	class NeuralNetworkInferenceServer : public INeuralNetworkInferenceServer
+	{
+	private:
+		U32 m_maxBatchSize;							/**< xɉZőv */
+		std::chrono::microseconds m_maxLatency;		/**< ŏ̗v牉ZJn܂łɑҋ@ő厞 */
+
+		std::vector<U32> m_lpInputBufferCount;		/**< ͂Ƃ1v̗vf */
+		U32 m_inputBufferCount;						/**< 1v̓͗vf */
+		U32 m_outputBufferCount;					/**< 1v̏o͗vf */
+
+		std::vector<INeuralNetworkInferenceContext*> m_lppContext;	/**< _ReLXg */
+		std::vector<std::thread> m_lpWorkerThread;					/**< ReLXgƂ̉ZXbh */
+
+		// vL[
+		std::mutex m_queueMutex;
+		std::condition_variable m_queueCondition;
+		std::deque<InferenceRequest*> m_lpRequestQueue;	/**< Z҂̗v */
+		bool m_onStop;									/**< ~vtO */
+
+		// v
+		mutable std::mutex m_statisticsMutex;
+		U64 m_requestCount;				/**< v */
+		U64 m_errorCount;				/**< Ɏsv */
+		U64 m_batchCount;				/**< sob` */
+		U64 m_batchRequestCount;		/**< ob`ŏv̍v */
+		std::vector<F32> m_lpLatency;	/**< ߂̉[ms]. Oobt@ */
+		U64 m_latencyCount;				/**< L^Ԃ̐ */
+		std::chrono::steady_clock::time_point m_statisticsStartTime;	/**< v̏WvJn */
+
+#ifndef _WIN32
+		// \Pbg
+		std::mutex m_socketMutex;
+		std::condition_variable m_socketCondition;
+		int m_listenSocket;						/**< tp\Pbg. tĂȂꍇ-1 */
+		std::string m_socketPath;				/**< \Pbgt@C̃pX */
+		bool m_onSocketStop;					/**< t~tO */
+		std::thread m_acceptThread;				/**< tXbh */
+		std::vector<int> m_lpConnectionSocket;	/**< ڑ̃\Pbg */
+#endif
+
+	public:
+		/** RXgN^ */
+		NeuralNetworkInferenceServer(const IODataStruct i_lpInputDataStruct[], U32 i_inputCount, const IODataStruct& i_outputDataStruct, U32 i_maxBatchSize, U32 i_maxLatency)
+			:	m_maxBatchSize		(i_maxBatchSize)
+			,	m_maxLatency		(i_maxLatency)
+			,	m_lpInputBufferCount(i_inputCount)
+			,	m_inputBufferCount	(0)
+			,	m_outputBufferCount	(i_outputDataStruct.GetDataCount())
+			,	m_onStop			(false)
+			,	m_requestCount		(0)
+			,	m_errorCount		(0)
+			,	m_batchCount		(0)
+			,	m_batchRequestCount	(0)
+			,	m_lpLatency			(LATENCY_SAMPLE_COUNT)
+			,	m_latencyCount		(0)
+			,	m_statisticsStartTime	(std::chrono::steady_clock::now())
+#ifndef _WIN32
+			,	m_listenSocket		(-1)
+			,	m_onSocketStop		(false)
+#endif
+		{
+			for(U32 inputNum=0; inputNum<i_inputCount; inputNum++)
+			{
+				this->m_lpInputBufferCount[inputNum] = i_lpInputDataStruct[inputNum].GetDataCount();
+				this->m_inputBufferCount += this->m_lpInputBufferCount[inputNum];
+			}
+		}
+		/** fXgN^ */
+		virtual ~NeuralNetworkInferenceServer()
+		{
+			this->StopSocketServer();
+
+			// ZXbh~. tς݂̗v͏ĂI
+			{
+				std::lock_guard<std::mutex> lock(this->m_queueMutex);
+				this->m_onStop = true;
+			}
+			this->m_queueCondition.notify_all();
+			for(auto& thread : this->m_lpWorkerThread)
+				thread.join();
+
+			for(auto pContext : this->m_lppContext)
+				delete pContext;
+		}
+
+	public:
+		//===========================
+		// 
+		//===========================
+		/** _ReLXgǉ */
+		void AddContext(INeuralNetworkInferenceContext* i_pContext)
+		{
+			this->m_lppContext.push_back(i_pContext);
+		}
+		/** ZXbhJn */
+		void Start()
+		{
+			for(auto pContext : this->m_lppContext)
+				this->m_lpWorkerThread.push_back(std::thread(&NeuralNetworkInferenceServer::WorkerThread, this, pContext));
+		}
+
+	public:
+		//===========================
+		// {
+		//===========================
+		/** xɉZőv擾 */
+		U32 GetMaxBatchSize()const
+		{
+			return this->m_maxBatchSize;
+		}
+
+		/** 1v̓͗vf擾 */
+		U32 GetInputBufferCount()const
+		{
+			return this->m_inputBufferCount;
+		}
+		/** 1v̏o͗vf擾 */
+		U32 GetOutputBufferCount()const
+		{
+			return this->m_outputBufferCount;
+		}
+
+	public:
+		//===========================
+		// 
+		//===========================
+		/** 1Tv̐_vA܂őҋ@. */
+		Gravisbell::ErrorCode Calculate(const F32 i_lpInputBuffer[], F32 o_lpOutputBuffer[])
+		{
+			if(i_lpInputBuffer == NULL || o_lpOutputBuffer == NULL)
+				return ErrorCode::ERROR_CODE_COMMON_NULL_REFERENCE;
+
+			InferenceRequest request;
+			request.lpInputBuffer  = i_lpInputBuffer;
+			request.lpOutputBuffer = o_lpOutputBuffer;
+			request.requestTime    = std::chrono::steady_clock::now();
+			std::future<Gravisbell::ErrorCode> result = request.result.get_future();
+
+			// vL[ɒǉ
+			{
+				std::lock_guard<std::mutex> lock(this->m_queueMutex);
+				if(this->m_onStop)
+					return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+				this->m_lpRequestQueue.push_back(&request);
+			}
+			this->m_queueCondition.notify_one();
+
+			// Z҂
+			Gravisbell::ErrorCode err = result.get();
+			F32 latency = std::chrono::duration<F32, std::milli>(std::chrono::steady_clock::now() - request.requestTime).count();
+
+			// vL^
+			{
+				std::lock_guard<std::mutex> lock(this->m_statisticsMutex);
+				this->m_requestCount++;
+				if(err != ErrorCode::ERROR_CODE_NONE)
+					this->m_errorCount++;
+				this->m_lpLatency[this->m_latencyCount % LATENCY_SAMPLE_COUNT] = latency;
+				this->m_latencyCount++;
+			}
+
+			return err;
+		}
+
+	private:
+		/** ZXbh̏.
+			vob`ăReLXgŉZAʂevɏ߂. */
+		void WorkerThread(INeuralNetworkInferenceContext* pContext)
+		{
+			U32 inputCount = (U32)this->m_lpInputBufferCount.size();
+
+			// ob`̓f[^
+			std::vector<std::vector<F32>> lppBatchInputBuffer(inputCount);
+			std::vector<CONST_BATCH_BUFFER_POINTER> lppInputBuffer(inputCount);
+			for(U32 inputNum=0; inputNum<inputCount; inputNum++)
+			{
+				lppBatchInputBuffer[inputNum].resize(this->m_maxBatchSize * this->m_lpInputBufferCount[inputNum]);
+				lppInputBuffer[inputNum] = &lppBatchInputBuffer[inputNum][0];
+			}
+
+			std::vector<InferenceRequest*> lpBatch;
+			lpBatch.reserve(this->m_maxBatchSize);
+
+			for(;;)
+			{
+				// vo
+				{
+					std::unique_lock<std::mutex> lock(this->m_queueMutex);
+					this->m_queueCondition.wait(lock, [this](){ return this->m_onStop || !this->m_lpRequestQueue.empty(); });
+					if(this->m_lpRequestQueue.empty())
+						break;
+
+					// őob`TCYɒB邩Aŏ̗v̑ҋ@܂ő҂
+					auto deadline = this->m_lpRequestQueue.front()->requestTime + this->m_maxLatency;
+					while(!this->m_onStop && !this->m_lpRequestQueue.empty() && this->m_lpRequestQueue.size() < this->m_maxBatchSize)
+					{
+						if(this->m_queueCondition.wait_until(lock, deadline) == std::cv_status::timeout)
+							break;
+					}
+					// ҋ@ɑ̃Xbho
+					if(this->m_lpRequestQueue.empty())
+						continue;
+
+					size_t batchSize = std::min<size_t>(this->m_lpRequestQueue.size(), this->m_maxBatchSize);
+					lpBatch.assign(this->m_lpRequestQueue.begin(), this->m_lpRequestQueue.begin() + batchSize);
+					this->m_lpRequestQueue.erase(this->m_lpRequestQueue.begin(), this->m_lpRequestQueue.begin() + batchSize);
+
+					// cv͑̃XbhɔC
+					if(!this->m_lpRequestQueue.empty())
+						this->m_queueCondition.notify_one();
+				}
+				U32 batchSize = (U32)lpBatch.size();
+
+				// ̓f[^ob`
+				for(U32 batchNum=0; batchNum<batchSize; batchNum++)
+				{
+					const F32* lpInputBuffer = lpBatch[batchNum]->lpInputBuffer;
+					for(U32 inputNum=0; inputNum<inputCount; inputNum++)
+					{
+						memcpy(&lppBatchInputBuffer[inputNum][batchNum * this->m_lpInputBufferCount[inputNum]], lpInputBuffer, sizeof(F32)*this->m_lpInputBufferCount[inputNum]);
+						lpInputBuffer += this->m_lpInputBufferCount[inputNum];
+					}
+				}
+
+				// Z
+				Gravisbell::ErrorCode err = pContext->SetBatchSize(batchSize);
+				if(err == ErrorCode::ERROR_CODE_NONE)
+					err = pContext->Calculate(&lppInputBuffer[0]);
+
+				// o̓f[^evɏ߂
+				if(err == ErrorCode::ERROR_CODE_NONE)
+				{
+					CONST_BATCH_BUFFER_POINTER lpOutputBuffer = pContext->GetOutputBuffer();
+					for(U32 batchNum=0; batchNum<batchSize; batchNum++)
+						memcpy(lpBatch[batchNum]->lpOutputBuffer, &lpOutputBuffer[batchNum * this->m_outputBufferCount], sizeof(F32)*this->m_outputBufferCount);
+				}
+
+				// vL^
+				{
+					std::lock_guard<std::mutex> lock(this->m_statisticsMutex);
+					this->m_batchCount++;
+					this->m_batchRequestCount += batchSize;
+				}
+
+				// ʒm. ʒm̗v͗vj邽ߎQƂĂ͂ȂȂ
+				for(U32 batchNum=0; batchNum<batchSize; batchNum++)
+					lpBatch[batchNum]->result.set_value(err);
+				lpBatch.clear();
+			}
+		}
+
+	public:
+		/** UNIXhC\Pbgł̗v̎tJn. */
+		Gravisbell::ErrorCode StartSocketServer(const char i_socketPath[])
+		{
+#ifdef _WIN32
+			return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+#else
+			if(i_socketPath == NULL)
+				return ErrorCode::ERROR_CODE_COMMON_NULL_REFERENCE;
+
+			std::lock_guard<std::mutex> lock(this->m_socketMutex);
+
+			// Ɏt
+			if(this->m_listenSocket >= 0)
+				return ErrorCode::ERROR_CODE_COMMON_ADD_ALREADY_SAMEID;
+
+			sockaddr_un address;
+			memset(&address, 0, sizeof(address));
+			address.sun_family = AF_UNIX;
+			if(strlen(i_socketPath) >= sizeof(address.sun_path))
+				return ErrorCode::ERROR_CODE_COMMON_OUT_OF_VALUERANGE;
+			strcpy(address.sun_path, i_socketPath);
+
+			// OُIۂ̃\Pbgt@CcĂꍇ͍폜
+			unlink(i_socketPath);
+
+			int listenSocket = socket(AF_UNIX, SOCK_STREAM, 0);
+			if(listenSocket < 0)
+				return ErrorCode::ERROR_CODE_COMMON_FILE_NOT_FOUND;
+			if(bind(listenSocket, (sockaddr*)&address, sizeof(address)) != 0 || listen(listenSocket, SOMAXCONN) != 0)
+			{
+				close(listenSocket);
+				return ErrorCode::ERROR_CODE_COMMON_FILE_NOT_FOUND;
+			}
+
+			this->m_listenSocket = listenSocket;
+			this->m_socketPath   = i_socketPath;
+			this->m_onSocketStop = false;
+			this->m_acceptThread = std::thread(&NeuralNetworkInferenceServer::AcceptThread, this);
+
+			return ErrorCode::ERROR_CODE_NONE;
+#endif
+		}
+		/** \Pbgł̎t~ASĂ̐ڑؒf. */
+		Gravisbell::ErrorCode StopSocketServer()
+		{
+#ifdef _WIN32
+			return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+#else
+			std::unique_lock<std::mutex> lock(this->m_socketMutex);
+			if(this->m_listenSocket < 0)
+				return ErrorCode::ERROR_CODE_NONE;
+
+			// tXbh~
+			this->m_onSocketStop = true;
+			shutdown(this->m_listenSocket, SHUT_RDWR);
+			lock.unlock();
+			this->m_acceptThread.join();
+			lock.lock();
+
+			close(this->m_listenSocket);
+			this->m_listenSocket = -1;
+			unlink(this->m_socketPath.c_str());
+
+			// M̂ݕA̗v̉͑MĂeڑXbhI
+			for(int connectionSocket : this->m_lpConnectionSocket)
+				shutdown(connectionSocket, SHUT_RD);
+			this->m_socketCondition.wait(lock, [this](){ return this->m_lpConnectionSocket.empty(); });
+
+			return ErrorCode::ERROR_CODE_NONE;
+#endif
+		}
+
+#ifndef _WIN32
+	private:
+		/** tXbh̏ */
+		void AcceptThread()
+		{
+			for(;;)
+			{
+				int connectionSocket = accept(this->m_listenSocket, NULL, NULL);
+				if(connectionSocket < 0)
+				{
+					if(errno == EINTR || errno == ECONNABORTED)
+						continue;
+					break;
+				}
+
+				std::lock_guard<std::mutex> lock(this->m_socketMutex);
+				if(this->m_onSocketStop)
+				{
+					close(connectionSocket);
+					break;
+				}
+				this->m_lpConnectionSocket.push_back(connectionSocket);
+				std::thread(&NeuralNetworkInferenceServer::ConnectionThread, this, connectionSocket).detach();
+			}
+		}
+		/** ڑƂ̃Xbh̏.
+			ؒf܂ŗv̎MA_ȂMJԂ. */
+		void ConnectionThread(int i_socket)
+		{
+			std::vector<F32> lpInputBuffer(this->m_inputBufferCount);
+			std::vector<F32> lpOutputBuffer(this->m_outputBufferCount);
+
+			while(ReceiveAll(i_socket, &lpInputBuffer[0], sizeof(F32)*this->m_inputBufferCount))
+			{
+				S32 err = (S32)this->Calculate(&lpInputBuffer[0], &lpOutputBuffer[0]);
+
+				if(!SendAll(i_socket, &err, sizeof(S32)))
+					break;
+				if(!SendAll(i_socket, &lpOutputBuffer[0], sizeof(F32)*this->m_outputBufferCount))
+					break;
+			}
+
+			// ڑ
+			std::lock_guard<std::mutex> lock(this->m_socketMutex);
+			this->m_lpConnectionSocket.erase(std::find(this->m_lpConnectionSocket.begin(), this->m_lpConnectionSocket.end(), i_socket));
+			close(i_socket);
+			this->m_socketCondition.notify_all();
+		}
+#endif
+
+	public:
+		//===========================
+		// v
+		//===========================
+		/** v擾 */
+		InferenceServerStatistics GetStatistics()const
+		{
+			InferenceServerStatistics statistics;
+			std::vector<F32> lpLatency;
+			F32 elapsedTime;
+			U64 batchRequestCount;
+			{
+				std::lock_guard<std::mutex> lock(this->m_statisticsMutex);
+
+				statistics.requestCount = this->m_requestCount;
+				statistics.errorCount   = this->m_errorCount;
+				statistics.batchCount   = this->m_batchCount;
+				batchRequestCount       = this->m_batchRequestCount;
+
+				lpLatency.assign(this->m_lpLatency.begin(), this->m_lpLatency.begin() + (size_t)std::min<U64>(this->m_latencyCount, LATENCY_SAMPLE_COUNT));
+				elapsedTime = std::chrono::duration<F32>(std::chrono::steady_clock::now() - this->m_statisticsStartTime).count();
+			}
+
+			statistics.averageBatchSize = statistics.batchCount > 0 ? (F32)batchRequestCount / statistics.batchCount : 0.0f;
+			statistics.latencyP50 = CalculatePercentile(lpLatency, 0.50f);
+			statistics.latencyP99 = CalculatePercentile(lpLatency, 0.99f);
+			statistics.throughput = elapsedTime > 0.0f ? statistics.requestCount / elapsedTime : 0.0f;
+
+			return statistics;
+		}
+		/** vZbg */
+		void ResetStatistics()
+		{
+			std::lock_guard<std::mutex> lock(this->m_statisticsMutex);
+
+			this->m_requestCount      = 0;
+			this->m_errorCount        = 0;
+			this->m_batchCount        = 0;
+			this->m_batchRequestCount = 0;
+			this->m_latencyCount      = 0;
+			this->m_statisticsStartTime = std::chrono::steady_clock::now();
+		}
+	};
+
+	/** _T[o[쐬. */
+	INeuralNetworkInferenceServer* CreateInferenceServer(
+		Layer::Connect::ILayerConnectData& neuralNetworkData, const IODataStruct i_lpInputDataStruct[], U32 i_inputCount,
+		U32 i_maxBatchSize, U32 i_maxLatency, U32 i_contextCount)
+	{
+		if(i_lpInputDataStruct == NULL || i_inputCount == 0 || i_maxBatchSize == 0 || i_contextCount == 0)
+			return NULL;
+
+		// _ReLXg쐬
+		std::vector<INeuralNetworkInferenceContext*> lppContext;
+		for(U32 contextNum=0; contextNum<i_contextCount; contextNum++)
+		{
+			INeuralNetworkInferenceContext* pContext = CreateInferenceContext(neuralNetworkData, i_lpInputDataStruct, i_inputCount, i_maxBatchSize);
+			if(pContext == NULL)
+			{
+				for(auto pCreatedContext : lppContext)
+					delete pCreatedContext;
+				return NULL;
+			}
+			lppContext.push_back(pContext);
+		}
+
+		NeuralNetworkInferenceServer* pServer = new NeuralNetworkInferenceServer(i_lpInputDataStruct, i_inputCount, lppContext[0]->GetOutputDataStruct(), i_maxBatchSize, i_maxLatency);
+		for(auto pContext : lppContext)
+			pServer->AddContext(pContext);
+		pServer->Start();
+
+		return pServer;
+	}
+
+}	// NeuralNetworkLayer
+}	// Utility
+}	// Gravisbell
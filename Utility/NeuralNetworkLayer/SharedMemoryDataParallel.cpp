@@ -0,0 +1,534 @@
+//==================================
+// LgpP}Ṽ}`vZXf[^wKpUtility
+// evZXg̃lbg[Nƃf[^A
+// p[^̕ωʂ݂̂Lŕω
+//==================================
+#include"stdafx.h"
+
+#include"Utility/SharedMemoryDataParallel.h"
+
+#include<string>
+#include<atomic>
+#include<thread>
+#include<chrono>
+#include<algorithm>
+
+#ifndef _WIN32
+#include<sys/mman.h>
+#include<sys/stat.h>
+#include<sys/syscall.h>
+#include<linux/futex.h>
+#include<fcntl.h>
+#include<unistd.h>
+#include<signal.h>
+#include<climits>
+#include<cerrno>
+#endif
+
+namespace Gravisbell {
+namespace Utility {
+namespace NeuralNetworkLayer {
+
+	/** L̏l */
+	static const U32 SHAREDMEMORY_INITIALIZED_CODE = 0x47425350;	// "GBSP"
+	/** Lւ̐ڑҋ@ő厞[ms] */
+	static const U32 SHAREDMEMORY_CONNECT_TIMEOUT = 60 * 1000;
+
+	/** L̐擪ɔzuwb_ */
+	struct SharedMemoryHeader
+	{
+		std::atomic<U32> initialized;			/**< tO */
+		std::atomic<U32> barrierCount;			/**< oAɓBvZX */
+		std::atomic<U32> barrierGeneration;		/**< oA̐ԍ. SvZXB邽тɉZ */
+		std::atomic<U32> aborted;				/**< ꂩ̃vZX𒆒ftO */
+		std::atomic<S32> checkpointErrorCode;	/**< N0ۑ */
+
+		U32 processCount;						/**< QvZX */
+		U64 maxParameterCount;					/**< xɏW񂷂ővf */
+		U64 ownerProcessID;						/**< LN0̃vZXID */
+	};
+
+	/** wb_̃TCY. 㑱̕ωʃobt@64byteEɑ */
+	static const U64 SHAREDMEMORY_HEADER_SIZE = (sizeof(SharedMemoryHeader) + 63) / 64 * 64;
+
+	/** vZXID擾 */
+	static U64 GetCurrentProcessID()
+	{
+#ifdef _WIN32
+		return (U64)GetCurrentProcessId();
+#else
+		return (U64)getpid();
+#endif
+	}
+	/** vZXsmF */
+	static bool IsProcessAlive(U64 i_processID)
+	{
+#ifdef _WIN32
+		HANDLE hProcess = OpenProcess(SYNCHRONIZE, FALSE, (DWORD)i_processID);
+		if(hProcess == NULL)
+			return false;
+		bool isAlive = (WaitForSingleObject(hProcess, 0) == WAIT_TIMEOUT);
+		CloseHandle(hProcess);
+
+		return isAlive;
+#else
+		return kill((pid_t)i_processID, 0) == 0 || errno == EPERM;
+#endif
+	}
+
+
+	class SharedMemoryDataParallel : public ISharedMemoryDataParallel
+	{
+	private:
+		U32 m_rank;					/**< vZX̔ԍ */
+		U32 m_processCount;			/**< QvZX */
+		U64 m_maxParameterCount;	/**< xɏW񂷂ővf */
+		U32 m_barrierTimeout;		/**< oAőҋ@ő厞[ms]. 0̏ꍇ͖ */
+
+		std::wstring m_name;		/**< L */
+		U64 m_sharedMemorySize;		/**< L̃oCg */
+
+#ifdef _WIN32
+		HANDLE m_hFileMapping;		/**< t@C}bsOnh */
+#else
+		std::string m_posixName;	/**< POSIXL */
+#endif
+		BYTE* m_pSharedMemory;		/**< L̐擪AhX */
+
+		SharedMemoryHeader* m_pHeader;	/**< L̃wb_ */
+		F32* m_lpSlotBuffer;			/**< evZX̕ωʏݐ. [vZX][ővf] */
+		F32* m_lpResultBuffer;			/**< W񌋉. [ővf] */
+
+	public:
+		/** RXgN^ */
+		SharedMemoryDataParallel(const wchar_t i_name[], U32 i_rank, U32 i_processCount, U64 i_maxParameterCount, U32 i_barrierTimeout)
+			:	m_rank				(i_rank)
+			,	m_processCount		(i_processCount)
+			,	m_maxParameterCount	(i_maxParameterCount)
+			,	m_barrierTimeout	(i_barrierTimeout)
+			,	m_name				(i_name)
+			,	m_sharedMemorySize	(SHAREDMEMORY_HEADER_SIZE + sizeof(F32) * i_maxParameterCount * (i_processCount + 1))
+#ifdef _WIN32
+			,	m_hFileMapping		(NULL)
+#endif
+			,	m_pSharedMemory		(NULL)
+			,	m_pHeader			(NULL)
+			,	m_lpSlotBuffer		(NULL)
+			,	m_lpResultBuffer	(NULL)
+		{
+#ifndef _WIN32
+			this->m_posixName = "/Gravisbell_";
+			for(auto c : this->m_name)
+				this->m_posixName += (c < 0x80 && c != L'/') ? (char)c : '_';
+#endif
+		}
+		/** fXgN^ */
+		virtual ~SharedMemoryDataParallel()
+		{
+			this->Close();
+		}
+
+	public:
+		//===========================
+		// 
+		//===========================
+		/** L쐬A܂͐ڑ */
+		Gravisbell::ErrorCode Open()
+		{
+			if(this->m_rank == 0)
+			{
+				Gravisbell::ErrorCode err = this->CreateSharedMemory();
+				if(err != ErrorCode::ERROR_CODE_NONE)
+					return err;
+
+				// wb_.
+				// ̋LėpꍇɔAtOɉ낵Ăelݒ肷
+				this->m_pHeader->initialized.store(0, std::memory_order_release);
+				this->m_pHeader->barrierCount = 0;
+				this->m_pHeader->barrierGeneration = 0;
+				this->m_pHeader->aborted = 0;
+				this->m_pHeader->checkpointErrorCode = (S32)ErrorCode::ERROR_CODE_NONE;
+				this->m_pHeader->processCount = this->m_processCount;
+				this->m_pHeader->maxParameterCount = this->m_maxParameterCount;
+				this->m_pHeader->ownerProcessID = GetCurrentProcessID();
+				this->m_pHeader->initialized.store(SHAREDMEMORY_INITIALIZED_CODE, std::memory_order_release);
+			}
+			else
+			{
+				// N0񏉊Lɐڑł܂ő҂.
+				// OُIۂ̋L͏ς݂̂܂܎cĂ邪AvZXIĂ邽ߐڑ
+				U32 waitTime = 0;
+				for(;;)
+				{
+					Gravisbell::ErrorCode err = this->ConnectSharedMemory();
+					if(err != ErrorCode::ERROR_CODE_NONE)
+						return err;
+
+					if(this->m_pHeader->initialized.load(std::memory_order_acquire) == SHAREDMEMORY_INITIALIZED_CODE && IsProcessAlive(this->m_pHeader->ownerProcessID))
+						break;
+					this->Close();
+
+					if(waitTime >= SHAREDMEMORY_CONNECT_TIMEOUT)
+						return ErrorCode::ERROR_CODE_COMMON_NOT_EXIST;
+					std::this_thread::sleep_for(std::chrono::milliseconds(10));
+					waitTime += 10;
+				}
+
+				// \v邩mF
+				if(this->m_pHeader->processCount != this->m_processCount || this->m_pHeader->maxParameterCount != this->m_maxParameterCount)
+					return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+			}
+
+			// SvZX̐ڑ҂
+			return this->Barrier();
+		}
+
+	private:
+		/** L̊eobt@̃AhXݒ肷 */
+		void SetBufferAddress()
+		{
+			this->m_pHeader        = reinterpret_cast<SharedMemoryHeader*>(this->m_pSharedMemory);
+			this->m_lpSlotBuffer   = reinterpret_cast<F32*>(&this->m_pSharedMemory[SHAREDMEMORY_HEADER_SIZE]);
+			this->m_lpResultBuffer = &this->m_lpSlotBuffer[this->m_maxParameterCount * this->m_processCount];
+		}
+
+#ifdef _WIN32
+		/** L쐬 */
+		Gravisbell::ErrorCode CreateSharedMemory()
+		{
+			std::wstring mappingName = L"Local\\Gravisbell_" + this->m_name;
+
+			this->m_hFileMapping = CreateFileMappingW(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE, (DWORD)(this->m_sharedMemorySize >> 32), (DWORD)(this->m_sharedMemorySize & 0xFFFFFFFF), mappingName.c_str());
+			if(this->m_hFileMapping == NULL)
+				return ErrorCode::ERROR_CODE_COMMON_ALLOCATION_MEMORY;
+
+			this->m_pSharedMemory = (BYTE*)MapViewOfFile(this->m_hFileMapping, FILE_MAP_ALL_ACCESS, 0, 0, (SIZE_T)this->m_sharedMemorySize);
+			if(this->m_pSharedMemory == NULL)
+				return ErrorCode::ERROR_CODE_COMMON_ALLOCATION_MEMORY;
+			this->SetBufferAddress();
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+		/** Lɐڑ */
+		Gravisbell::ErrorCode ConnectSharedMemory()
+		{
+			std::wstring mappingName = L"Local\\Gravisbell_" + this->m_name;
+
+			U32 waitTime = 0;
+			while((this->m_hFileMapping = OpenFileMappingW(FILE_MAP_ALL_ACCESS, FALSE, mappingName.c_str())) == NULL)
+			{
+				if(waitTime >= SHAREDMEMORY_CONNECT_TIMEOUT)
+					return ErrorCode::ERROR_CODE_COMMON_NOT_EXIST;
+				std::this_thread::sleep_for(std::chrono::milliseconds(10));
+				waitTime += 10;
+			}
+
+			this->m_pSharedMemory = (BYTE*)MapViewOfFile(this->m_hFileMapping, FILE_MAP_ALL_ACCESS, 0, 0, (SIZE_T)this->m_sharedMemorySize);
+			if(this->m_pSharedMemory == NULL)
+				return ErrorCode::ERROR_CODE_COMMON_ALLOCATION_MEMORY;
+			this->SetBufferAddress();
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+		/** L */
+		void Close()
+		{
+			if(this->m_pSharedMemory)
+				UnmapViewOfFile(this->m_pSharedMemory);
+			this->m_pSharedMemory = NULL;
+			if(this->m_hFileMapping)
+				CloseHandle(this->m_hFileMapping);
+			this->m_hFileMapping = NULL;
+			this->m_pHeader = NULL;
+		}
+
+		/** oA̐ԍω܂őҋ@.
+			@param	i_generation	ҋ@Jn̐ԍ.
+			@param	i_startTime		ҋ@Jn. */
+		Gravisbell::ErrorCode WaitGeneration(U32 i_generation, std::chrono::steady_clock::time_point i_startTime)
+		{
+			while(this->m_pHeader->barrierGeneration.load(std::memory_order_acquire) == i_generation)
+			{
+				Gravisbell::ErrorCode err = this->CheckWaitState(i_startTime);
+				if(err != ErrorCode::ERROR_CODE_NONE)
+					return err;
+				SwitchToThread();
+			}
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+		/** oȂҋ@ */
+		void WakeGeneration()
+		{
+		}
+#else
+		/** L쐬 */
+		Gravisbell::ErrorCode CreateSharedMemory()
+		{
+			// OُIۂ̋LcĂꍇ͍폜
+			shm_unlink(this->m_posixName.c_str());
+
+			int fd = shm_open(this->m_posixName.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+			if(fd < 0)
+				return ErrorCode::ERROR_CODE_COMMON_ALLOCATION_MEMORY;
+			if(ftruncate(fd, (off_t)this->m_sharedMemorySize) != 0)
+			{
+				close(fd);
+				return ErrorCode::ERROR_CODE_COMMON_ALLOCATION_MEMORY;
+			}
+
+			return this->MapSharedMemory(fd);
+		}
+		/** Lɐڑ */
+		Gravisbell::ErrorCode ConnectSharedMemory()
+		{
+			U32 waitTime = 0;
+			for(;;)
+			{
+				int fd = shm_open(this->m_posixName.c_str(), O_RDWR, 0600);
+				if(fd >= 0)
+				{
+					// N0TCYݒ肷܂ł͐ڑȂ
+					struct stat fileStat;
+					if(fstat(fd, &fileStat) == 0 && (U64)fileStat.st_size >= this->m_sharedMemorySize)
+						return this->MapSharedMemory(fd);
+					close(fd);
+				}
+
+				if(waitTime >= SHAREDMEMORY_CONNECT_TIMEOUT)
+					return ErrorCode::ERROR_CODE_COMMON_NOT_EXIST;
+				std::this_thread::sleep_for(std::chrono::milliseconds(10));
+				waitTime += 10;
+			}
+		}
+		/** L}bsO */
+		Gravisbell::ErrorCode MapSharedMemory(int fd)
+		{
+			void* pAddress = mmap(NULL, (size_t)this->m_sharedMemorySize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+			close(fd);
+			if(pAddress == MAP_FAILED)
+				return ErrorCode::ERROR_CODE_COMMON_ALLOCATION_MEMORY;
+
+			this->m_pSharedMemory = (BYTE*)pAddress;
+			this->SetBufferAddress();
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+		/** L */
+		void Close()
+		{
+			if(this->m_pSharedMemory)
+			{
+				if(this->m_rank == 0)
+					this->m_pHeader->initialized = 0;
+				munmap(this->m_pSharedMemory, (size_t)this->m_sharedMemorySize);
+			}
+			this->m_pSharedMemory = NULL;
+			this->m_pHeader = NULL;
+
+			if(this->m_rank == 0)
+				shm_unlink(this->m_posixName.c_str());
+		}
+
+		/** oA̐ԍω܂őҋ@.
+			@param	i_generation	ҋ@Jn̐ԍ.
+			@param	i_startTime		ҋ@Jn. */
+		Gravisbell::ErrorCode WaitGeneration(U32 i_generation, std::chrono::steady_clock::time_point i_startTime)
+		{
+			while(this->m_pHeader->barrierGeneration.load(std::memory_order_acquire) == i_generation)
+			{
+				Gravisbell::ErrorCode err = this->CheckWaitState(i_startTime);
+				if(err != ErrorCode::ERROR_CODE_NONE)
+					return err;
+
+				// vZXԂŋL邽PRIVATEłȂfutexgp.
+				// fƃ^CAEgmF邽߈莞ԂƂɋN
+				struct timespec waitTime = {0, 100 * 1000 * 1000};
+				syscall(SYS_futex, reinterpret_cast<U32*>(&this->m_pHeader->barrierGeneration), FUTEX_WAIT, i_generation, &waitTime, NULL, 0);
+			}
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+		/** oȂҋ@ */
+		void WakeGeneration()
+		{
+			syscall(SYS_futex, reinterpret_cast<U32*>(&this->m_pHeader->barrierGeneration), FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+		}
+#endif
+
+		/** oAł̑ҋ@𑱂Ă悢mF.
+			@param	i_startTime	ҋ@Jn. */
+		Gravisbell::ErrorCode CheckWaitState(std::chrono::steady_clock::time_point i_startTime)const
+		{
+			if(this->m_pHeader->aborted.load(std::memory_order_acquire))
+				return ErrorCode::ERROR_CODE_COMMON_ABORTED;
+
+			if(this->m_barrierTimeout > 0)
+			{
+				auto waitTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - i_startTime).count();
+				if(waitTime >= this->m_barrierTimeout)
+					return ErrorCode::ERROR_CODE_COMMON_TIMEOUT;
+			}
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+
+	public:
+		//===========================
+		// {
+		//===========================
+		/** vZX̔ԍ擾 */
+		U32 GetRank()const
+		{
+			return this->m_rank;
+		}
+		/** QvZX擾 */
+		U32 GetProcessCount()const
+		{
+			return this->m_processCount;
+		}
+
+	public:
+		//===========================
+		// 
+		//===========================
+		/** SvZXB܂őҋ@.
+			^CAEgꍇ͑SvZX̏𒆒f. */
+		Gravisbell::ErrorCode Barrier()
+		{
+			if(this->m_pHeader == NULL)
+				return ErrorCode::ERROR_CODE_COMMON_NULL_REFERENCE;
+			if(this->m_pHeader->aborted.load(std::memory_order_acquire))
+				return ErrorCode::ERROR_CODE_COMMON_ABORTED;
+
+			auto startTime = std::chrono::steady_clock::now();
+
+			U32 generation = this->m_pHeader->barrierGeneration.load(std::memory_order_acquire);
+			if(this->m_pHeader->barrierCount.fetch_add(1, std::memory_order_acq_rel) + 1 == this->m_processCount)
+			{
+				// ŌɓBvZXi߂đSvZXN
+				this->m_pHeader->barrierCount.store(0, std::memory_order_relaxed);
+				this->m_pHeader->barrierGeneration.fetch_add(1, std::memory_order_release);
+				this->WakeGeneration();
+			}
+			else
+			{
+				Gravisbell::ErrorCode err = this->WaitGeneration(generation, startTime);
+				if(err != ErrorCode::ERROR_CODE_NONE)
+				{
+					// BȂvZX邽߁Aҋ@̑̃vZXf
+					this->Abort();
+					return err;
+				}
+			}
+
+			if(this->m_pHeader->aborted.load(std::memory_order_acquire))
+				return ErrorCode::ERROR_CODE_COMMON_ABORTED;
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+
+		/** SvZX̏𒆒f.
+			ȍ~͑SvZXBarrierERROR_CODE_COMMON_ABORTEDԂ. */
+		void Abort()
+		{
+			if(this->m_pHeader == NULL)
+				return;
+
+			this->m_pHeader->aborted.store(1, std::memory_order_release);
+			this->WakeGeneration();
+		}
+
+		/** p[^̕ωʂW񂷂.
+			evZXg̕ωʂLɏ݁Avf𓙕ԂƂɒSvZXςvZ(reduce-scatter)A
+			SvZXʂǂݖ߂(all-gather).
+			@param	io_lpDParameter		W񂷂ω. W񌋉ʂŏ㏑.
+			@param	i_parameterCount	ωʂ̗vf. */
+		Gravisbell::ErrorCode ReduceGradient(F32 io_lpDParameter[], U64 i_parameterCount)
+		{
+			if(this->m_pHeader == NULL)
+				return ErrorCode::ERROR_CODE_COMMON_NULL_REFERENCE;
+			if(this->m_processCount <= 1)
+				return ErrorCode::ERROR_CODE_NONE;
+
+			F32 scale = 1.0f / this->m_processCount;
+			F32* lpSlot = &this->m_lpSlotBuffer[this->m_maxParameterCount * this->m_rank];
+
+			for(U64 offset=0; offset<i_parameterCount; offset+=this->m_maxParameterCount)
+			{
+				U64 count = std::min<U64>(this->m_maxParameterCount, i_parameterCount - offset);
+
+				// g̕ωʂ
+				memcpy(lpSlot, &io_lpDParameter[offset], sizeof(F32)*count);
+				Gravisbell::ErrorCode err = this->Barrier();
+				if(err != ErrorCode::ERROR_CODE_NONE)
+					return err;
+
+				// SԂ𕽋ω
+				U64 begin = count * this->m_rank / this->m_processCount;
+				U64 end   = count * (this->m_rank+1) / this->m_processCount;
+				for(U64 paramNum=begin; paramNum<end; paramNum++)
+				{
+					F32 sum = 0.0f;
+					for(U32 processNum=0; processNum<this->m_processCount; processNum++)
+						sum += this->m_lpSlotBuffer[this->m_maxParameterCount * processNum + paramNum];
+					this->m_lpResultBuffer[paramNum] = sum * scale;
+				}
+				err = this->Barrier();
+				if(err != ErrorCode::ERROR_CODE_NONE)
+					return err;
+
+				// ʂǂݖ߂.
+				// ̏WŌʃobt@㏑̂͑SvZX̏݌̃oAɓBĂȂ̂ŁAł̑ҋ@͕sv
+				memcpy(&io_lpDParameter[offset], this->m_lpResultBuffer, sizeof(F32)*count);
+			}
+
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+
+		/** j[lbg[NoCit@Cɕۑ.
+			ۑ̓N0̃vZX݂̂sAۑ܂őSvZXҋ@. */
+		Gravisbell::ErrorCode WriteNetworkToBinaryFile(const Layer::ILayerData& neuralNetwork, const wchar_t i_filePath[])
+		{
+			if(this->m_pHeader == NULL)
+				return ErrorCode::ERROR_CODE_COMMON_NULL_REFERENCE;
+
+			if(this->m_rank == 0)
+			{
+				Gravisbell::ErrorCode err = Gravisbell::Utility::NeuralNetworkLayer::WriteNetworkToBinaryFile(neuralNetwork, i_filePath);
+				this->m_pHeader->checkpointErrorCode = (S32)err;
+			}
+			Gravisbell::ErrorCode barrierErr = this->Barrier();
+			if(barrierErr != ErrorCode::ERROR_CODE_NONE)
+				return barrierErr;
+
+			Gravisbell::ErrorCode err = (Gravisbell::ErrorCode)this->m_pHeader->checkpointErrorCode.load();
+
+			// SvZXʂǂݎ܂ŃN0̕ۑJnȂ悤ɂ
+			barrierErr = this->Barrier();
+			if(barrierErr != ErrorCode::ERROR_CODE_NONE)
+				return barrierErr;
+
+			return err;
+		}
+	};
+
+	/** Lgpf[^wKNX쐬. */
+	ISharedMemoryDataParallel* CreateSharedMemoryDataParallel(const wchar_t i_name[], U32 i_rank, U32 i_processCount, U64 i_maxParameterCount, U32 i_barrierTimeout)
+	{
+		if(i_name == NULL || i_processCount == 0 || i_rank >= i_processCount || i_maxParameterCount == 0)
+			return NULL;
+
+		SharedMemoryDataParallel* pDataParallel = new SharedMemoryDataParallel(i_name, i_rank, i_processCount, i_maxParameterCount, i_barrierTimeout);
+		if(pDataParallel->Open() != ErrorCode::ERROR_CODE_NONE)
+		{
+			delete pDataParallel;
+			return NULL;
+		}
+
+		return pDataParallel;
+	}
+
+}	// NeuralNetworkLayer
+}	// Utility
+}	// Gravisbell
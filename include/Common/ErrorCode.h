@@ -23,6 +23,8 @@ namespace Gravisbell {
 		ERROR_CODE_COMMON_NOT_EXIST,				///< ݂Ȃ
 		ERROR_CODE_COMMON_ADD_ALREADY_SAMEID,		///< ɓIDo^ς
 		ERROR_CODE_COMMON_NOT_COMPATIBLE,			///< Ή
+		ERROR_CODE_COMMON_TIMEOUT,					///< ҋ@Ԃ𒴉߂
+		ERROR_CODE_COMMON_ABORTED,					///< fꂽ
 
 		// DLLnG[
 		ERROR_CODE_DLL = 0x02000000,
@@ -6,6 +6,8 @@
 
 #include"Common.h"
 
+#include<cstddef>
+
 namespace Gravisbell {
 
 	typedef struct _GUID {
@@ -98,6 +100,22 @@ namespace Gravisbell {
 
 	} GUID;
 
+	/** 񏇏ReiGUIDL[Ɏgp邽߂̃nbV֐ */
+	struct GUIDHash
+	{
+		size_t operator()(const GUID& i_guid)const
+		{
+			// FNV-1a
+			U64 hash = 14695981039346656037ULL;
+			for(U32 i=0; i<16; i++)
+			{
+				hash ^= i_guid.data[i];
+				hash *= 1099511628211ULL;
+			}
+			return (size_t)hash;
+		}
+	};
+
 
 }	// Gravisbell
 
@@ -9,6 +9,14 @@
 
 namespace Gravisbell {
 namespace Common {
+
+	/** ꎞobt@̃nh.
+		ZOœo^Ɏ擾AZ/wK̗\ƊJɎgp. */
+	typedef U32 TemporaryBufferHandle;
+	static const TemporaryBufferHandle INVALID_TEMPORARY_BUFFER_HANDLE = 0xFFFFFFFF;
+
+	/** ꎞobt@̐擪AhX̋E. oCgP. obt@TCY̒Pʂɐ؂グĊmۂ */
+	static const U32 TEMPORARY_BUFFER_ALIGNMENT = 64;
 
 	class ITemporaryMemoryManager
 	{
@@ -31,13 +39,70 @@ namespace Common {
 			@param	i_bufferSize	obt@̃TCY. oCgP. */
 		virtual U32 GetBufferSize(GUID i_layerGUID, const wchar_t i_szCode[])const = 0;
 
+		/** o^ς݂̃obt@TCYgpʂς.
+			R[h̃obt@̓C[ԂŋL邽߁AR[hƂ̍őTCY̍vƂȂ.
+			L̈̔zuς݂̏ꍇ͋L̈̃TCYƂȂ.
+			@return	oCgP */
+		virtual U64 GetEstimatedByteCount()const = 0;
+
 		/** obt@擾 */
 //		virtual BYTE* GetBuffer(GUID i_layerGUID, const wchar_t i_szCode[]) = 0;
 
-		/** obt@\񂵂Ď擾 */
+		/** obt@\񂵂Ď擾.
+			Z/wK̓nhẘ֐gp邱. */
 		virtual BYTE* ReserveBuffer(GUID i_layerGUID, const wchar_t i_szCode[]) = 0;
-		/** \ς݃obt@J */
+		/** \ς݃obt@J.
+			Z/wK̓nhẘ֐gp邱. */
 		virtual void RestoreBuffer(GUID i_layerGUID, const wchar_t i_szCode[]) = 0;
+
+
+		//====================================
+		// nhw
+		//====================================
+		/** obt@TCYo^A\/JɎgpnh擾.
+			ZOŌĂяo. o^ς݂̃C[,R[h̏ꍇ̓TCYXVAnhԂ.
+			@param	i_layerGUID		C[GUID.
+			@param	i_szCode		gp@`ID.
+			@param	i_bufferSize	obt@̃TCY. oCgP.
+			@return	nh */
+		virtual TemporaryBufferHandle RegisterBuffer(GUID i_layerGUID, const wchar_t i_szCode[], U32 i_bufferSize) = 0;
+
+		/** obt@TCY擾.
+			@param	i_handle	o^Ɏ擾nh.
+			@return	oCgP. ȃnh̏ꍇ0 */
+		virtual U32 GetBufferSize(TemporaryBufferHandle i_handle)const = 0;
+
+		/** obt@\񂵂Ď擾.
+			L̈ɔzuς݂ŁA\񒆂̑̃obt@ƏdȂȂꍇ͋L̈gp.
+			ȊȌꍇ͓R[h̋󂫃obt@ėp. nhŗ\ς݂̏ꍇ͗\񒆂̃obt@Ԃ.
+			@param	i_handle	o^Ɏ擾nh.
+			@return	TEMPORARY_BUFFER_ALIGNMENTEɑobt@̐擪. ȃnh̏ꍇNULL */
+		virtual BYTE* ReserveBuffer(TemporaryBufferHandle i_handle) = 0;
+		/** \ς݃obt@J.
+			@param	i_handle	o^Ɏ擾nh. */
+		virtual void RestoreBuffer(TemporaryBufferHandle i_handle) = 0;
+
+		/** ɗ\񂳂ꂽobt@̍vTCY̍ől擾.
+			@return	oCgP */
+		virtual U64 GetPeakReservedByteCount()const = 0;
+		/** ɗ\񂳂ꂽobt@̍vTCY̍őlA݂̗\ʂŏ */
+		virtual void ResetPeakReservedByteCount() = 0;
+
+
+		//====================================
+		// ɊÂL̈
+		//====================================
+		/** obt@̎̋L^Jn.
+			L^̗\/J̏eobt@̎gpԂ߁AgpԂdȂȂobt@ʒug悤L̈ւ̔zu肷.
+			zǔɓo^eύXĂȂꍇ͉Ȃ. */
+		virtual void BeginLifetimeRecord() = 0;
+		/** obt@̎̋L^IAL̈mۂ.
+			L^ɗ\񂳂ꂽobt@JĂȂꍇ́ASĊJꂽ_Ŋmۂ. */
+		virtual void EndLifetimeRecord() = 0;
+
+		/** L̈̃TCY擾.
+			@return	oCgP. mۂĂȂꍇ0 */
+		virtual U64 GetArenaByteCount()const = 0;
 	};
 
 }	// Layer
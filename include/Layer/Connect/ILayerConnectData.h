@@ -129,6 +129,25 @@ namespace Connect {
 			@param	o_postLayerGUID	C[ɐڑĂ郌C[GUIDi[. */
 		virtual ErrorCode GetBypassLayerGUIDbyNum(const Gravisbell::GUID& i_layerGUID, U32 i_inputNum, Gravisbell::GUID& o_postLayerGUID) = 0;
 
+
+		//====================================
+		// p[^̈
+		//====================================
+	public:
+		/** C[̃p[^ƌ덷AꂼA1̗̈ɔzu邩ݒ肷.
+			LȏꍇAÖ̗ɔzułC[͗̈̈ꕔQƂ.
+			C[̒ǉ/폜AAC[쐬ɔzu. */
+		virtual ErrorCode SetFlatParameterFlag(bool i_onFlatParameter) = 0;
+		/** Äɔzu邩擾 */
+		virtual bool GetFlatParameterFlag()const = 0;
+
+		/** p[^̗̈擾.
+			foCX̃. vfGetParameterCount̖߂l. zuĂȂꍇNULL */
+		virtual F32* GetFlatParameterBuffer() = 0;
+		/** 덷̗̈擾.
+			foCX̃. vfGetParameterCount̖߂l. zuĂȂꍇNULL */
+		virtual F32* GetFlatDParameterBuffer() = 0;
+
 	public:
 		//===========================
 		// C[쐬
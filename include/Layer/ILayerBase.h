@@ -8,6 +8,7 @@
 #include"../Common/ErrorCode.h"
 #include"../Common/IODataStruct.h"
 #include"../Common/Guiddef.h"
+#include"../Common/ITemporaryMemoryManager.h"
 
 #include"../SettingData/Standard/IData.h"
 
@@ -98,6 +99,64 @@ namespace Layer {
 			@return ɉZsob`̃TCY */
 		virtual unsigned int GetBatchSize()const = 0;
 
+		/** ZɎgpob`TCYύX.
+			ZOŎw肵ob`TCYȉł΁Aobt@̍Ċmۂڑ̍Ċms킸ɕύXł.
+			ȍ~Calculate͕ύX̃ob`TCỸf[^݂̂.
+			Zp̎O(PreProcessCalculate)sĂꍇ̂ݗL.
+			@param batchSize	ɉZsob`̃TCY. 1`GetMaxBatchSize()̖߂l.
+			@return Ή̃C[̏ꍇERROR_CODE_COMMON_NOT_COMPATIBLE */
+		virtual ErrorCode SetBatchSize(unsigned int batchSize)
+		{
+			return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+		}
+		/** őob`TCY擾.
+			@return ZOŎw肵ob`̃TCY */
+		virtual unsigned int GetMaxBatchSize()const
+		{
+			return this->GetBatchSize();
+		}
+
+		/** ZʂČvZŕł邩mF.
+			͂łΉxZĂo͂ƂȂAZɂԂωȂC[true.
+			gp郌C[AwK̉ZœvXV郌C[falseԂ. */
+		virtual bool CheckCanRecompute()const
+		{
+			return true;
+		}
+		/** ZO(wKp)œo^ꎞobt@̃TCYAobt@mۂɓo^.
+			gpʂ̌ςɎgp. o^͉ZɎgpꎞobt@ǗNXƂ͕ʂ̂̂w肷邱.
+			@param	o_temporaryMemoryManager	o^.
+			@param	i_batchSize					ςob`TCY. */
+		virtual ErrorCode RegisterPlannedTemporaryBuffer(Gravisbell::Common::ITemporaryMemoryManager& o_temporaryMemoryManager, U32 i_batchSize)const
+		{
+			return ErrorCode::ERROR_CODE_NONE;
+		}
+		/** Z̒ԒlwKɍėpꍇɁAZwK܂ŕێꎞobt@̃TCY߂.
+			ێobt@͑SC[ɑ݂邽߁ARegisterPlannedTemporaryBufferƂ͕ʂɃC[Ƃɍv.
+			gpʂ̌ςɎgp.
+			@param	i_batchSize	ςob`TCY.
+			@return	oCgP */
+		virtual U64 GetPlannedReuseIntermediateByteCount(U32 i_batchSize)const
+		{
+			return 0;
+		}
+		/** Zʂ͂ƈv邩mF.
+			݂̎sݒŁAo͂ɓ͂ƓlɂȂ郌C[true.
+			truȅꍇAj[lbg[N͉Zp̎Oł̃C[̉ZȗA̓obt@o͂ƂĈƂ. */
+		virtual bool CheckIsIdentity()
+		{
+			return false;
+		}
+
+		/** Z̒ԒlwKɍėp邩ݒ肷.
+			trueݒ肵ĂԂ́ACalculate̒ɓob`ɑ΂CalculateDInput܂Trainings邱ƂĂяoۏ؂.
+			Ή郌C[͉ZɐKlől̈ʒuꎞobt@ɕێAwK̍ČvZȗ.
+			ZO(wKp)sĂꍇ̂ݗL. ZOsfalseɖ߂.
+			@param	i_onReuse	truȅꍇAԒlėp. */
+		virtual void SetReuseIntermediateFlag(bool i_onReuse)
+		{
+		}
+
 	public:
 		//=======================================
 		// Z[vO
@@ -14,6 +14,7 @@
 #include"../SettingData/Standard/IData.h"
 
 #include"./ILayerBase.h"
+#include"./NeuralNetwork/IOptimizer.h"
 
 namespace Gravisbell {
 namespace Layer {
@@ -94,12 +95,74 @@ namespace Layer {
 		//===========================
 		// IveB}CU[ݒ
 		//===========================
-		/** IveB}CU[ύX */
+		/** IveB}CU[ύX.
+			"Frozen"w肵ꍇ͐_pƂȂAIveB}CU[̓Ԃăp[^̍XVۂ.
+			ēxwKꍇ"SGD","Adam"w肵. */
 		virtual ErrorCode ChangeOptimizer(const wchar_t i_optimizerID[]) = 0;
 		/** IveB}CU[̃nCp[p[^ύX */
 		virtual ErrorCode SetOptimizerHyperParameter(const wchar_t i_parameterID[], F32 i_value) = 0;
 		virtual ErrorCode SetOptimizerHyperParameter(const wchar_t i_parameterID[], S32 i_value) = 0;
 		virtual ErrorCode SetOptimizerHyperParameter(const wchar_t i_parameterID[], const wchar_t i_value[]) = 0;
+		/** ێĂSẴIveB}CU[wIDł邩mF.
+			IveB}CU[ێĂȂC[trueԂ. */
+		virtual bool CheckOptimizerID(const wchar_t i_optimizerID[])const
+		{
+			return true;
+		}
+
+	public:
+		//===========================
+		// p[^̈
+		//===========================
+		/** Õp[^̈ɔzuꍇɕKvȗvf擾.
+			Ö̗ɔzułȂC[0Ԃ */
+		virtual U64 GetParameterCount()const
+		{
+			return 0;
+		}
+		/** p[^ƌ덷̊i[Ö̗ɕύX.
+			݂̒lVi[ɕʂ. NULLw肵ꍇ͓̗̈ɖ߂.
+			@param	io_lpParameter	p[^̊i[. foCX̃GetParameterCount̖߂l̗vfKv.
+			@param	io_lpDParameter	덷̊i[. foCX̃GetParameterCount̖߂l̗vfKv. */
+		virtual ErrorCode BindParameterBuffer(F32* io_lpParameter, F32* io_lpDParameter)
+		{
+			return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+		}
+
+	public:
+		//===========================
+		// ꊇXV
+		//===========================
+		/** XVx邩ݒ肷.
+			LȏꍇAwK̍XV͌덷i[݂̂ƂȂAGetUpdateTargetŎ擾ΏۂꊇōXV.
+			xłȂC[NOT_COMPATIBLEԂA]ʂ葦ɍXV. */
+		virtual ErrorCode SetDeferredUpdateFlag(bool i_onDeferredUpdate)
+		{
+			return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+		}
+		/** XVxĂ邩擾 */
+		virtual bool GetDeferredUpdateFlag()const
+		{
+			return false;
+		}
+		/** ꊇXV̑Ώې擾 */
+		virtual U32 GetUpdateTargetCount()const
+		{
+			return 0;
+		}
+		/** ꊇXV̑Ώۂ擾.
+			fĂȂ덷ȂꍇpOptimizerNULLƂ.
+			@param	i_targetNum	Ώ۔ԍ.
+			@param	o_target	Ώۂ̊i[. */
+		virtual ErrorCode GetUpdateTarget(U32 i_targetNum, NeuralNetwork::OptimizerUpdateTarget& o_target)
+		{
+			return ErrorCode::ERROR_CODE_COMMON_OUT_OF_ARRAYRANGE;
+		}
+		/** ꊇXV̊ʒm */
+		virtual ErrorCode CompleteUpdate()
+		{
+			return ErrorCode::ERROR_CODE_NONE;
+		}
 	};
 
 }	// Layer
@@ -0,0 +1,44 @@
+//========================================
+// p[^ωʂ̏W񃋁[`
+// f[^wKŕ̃vZXԂ̕ωʂ𕽋ω
+//========================================
+#ifndef __GRAVISBELL_I_NN_GRADIENT_REDUCER_H__
+#define __GRAVISBELL_I_NN_GRADIENT_REDUCER_H__
+
+#include"../../Common/Common.h"
+#include"../../Common/ErrorCode.h"
+
+namespace Gravisbell {
+namespace Layer {
+namespace NeuralNetwork {
+
+	/** ωʏW񃋁[` */
+	class IGradientReducer
+	{
+	public:
+		//===========================
+		// RXgN^/fXgN^
+		//===========================
+		/** RXgN^ */
+		IGradientReducer(){}
+		/** fXgN^ */
+		virtual ~IGradientReducer(){}
+
+	public:
+		//===========================
+		// 
+		//===========================
+		/** p[^̕ωʂW񂷂.
+			SĂ̎Q҂ԁAvfŌĂяoKv.
+			@param	io_lpDParameter		W񂷂ω. W񌋉ʂŏ㏑.
+			@param	i_parameterCount	ωʂ̗vf. */
+		virtual ErrorCode ReduceGradient(F32 io_lpDParameter[], U64 i_parameterCount) = 0;
+	};
+
+}	// NeuralNetwork
+}	// Layer
+}	// Gravisbell
+
+
+
+#endif	// __GRAVISBELL_I_NN_GRADIENT_REDUCER_H__
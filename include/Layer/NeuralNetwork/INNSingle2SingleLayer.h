@@ -81,6 +81,48 @@ namespace NeuralNetwork {
 			@param	i_lppDOutputBuffer	o͌덷=C[̓͌덷.	[GetBatchSize()̖߂l][GetOutputBufferCount()̖߂l]̗vfKv.
 			ǑvZʂgp */
 		virtual ErrorCode Training_device(CONST_BATCH_BUFFER_POINTER i_lppInputBuffer, BATCH_BUFFER_POINTER o_lppDInputBuffer, CONST_BATCH_BUFFER_POINTER i_lppOutputBuffer, CONST_BATCH_BUFFER_POINTER i_lppDOutputBuffer) = 0;
+
+
+	public:
+		//==========================================
+		// ㏈̓.
+		// o͂͏ˑ
+		//==========================================
+		/** vfƂɓƗẐ݂sÃC[̏o̓obt@ɒړKpł邩mF.
+			truȅꍇAÕC[̌㏈Ƃē邱Ƃ. */
+		virtual bool CheckCanEpilogue()
+		{
+			return false;
+		}
+		/** ㏈Ƃďo̓obt@ɉZKp.
+			foCXˑ̃n.
+			@param	io_lpBuffer		ZΏۂ̃obt@. Zʂŏ㏑.
+			@param	i_bufferCount	ZΏۂ̗vf. ̓obt@̔{Ƃ͌Ȃ. */
+		virtual ErrorCode CalculateEpilogue_device(BATCH_BUFFER_POINTER io_lpBuffer, U32 i_bufferCount)
+		{
+			return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+		}
+		/** ㏈̔lo͌덷ɏZ.
+			foCXˑ̃n.
+			@param	i_lpOutputBuffer	㏈̓Kp̏o̓obt@.
+			@param	i_lpDOutputBuffer	㏈̏o͌덷.
+			@param	o_lpDInputBuffer	㏈̓͌덷̊i[. i_lpDOutputBufferƓAhXł悢.
+			@param	i_bufferCount		ZΏۂ̗vf. */
+		virtual ErrorCode CalculateDEpilogue_device(CONST_BATCH_BUFFER_POINTER i_lpOutputBuffer, CONST_BATCH_BUFFER_POINTER i_lpDOutputBuffer, BATCH_BUFFER_POINTER o_lpDInputBuffer, U32 i_bufferCount)
+		{
+			return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+		}
+
+		/** o͂ɓēKp㏈C[ݒ肷.
+			ݒ肵C[̉Z͏o̓obt@ւ̏ݒɓKpAwK͏o͌덷Ɍ㏈̔lZĂ덷vZ.
+			@param	i_pEpilogueLayer	㏈C[. NULL̏ꍇ͉. ݒ蒆͍폜Ă͂ȂȂ.
+			@return ΉĂȂC[̏ꍇERROR_CODE_COMMON_NOT_COMPATIBLE */
+		virtual ErrorCode SetEpilogueLayer(INNSingle2SingleLayer* i_pEpilogueLayer)
+		{
+			if(i_pEpilogueLayer == NULL)
+				return ErrorCode::ERROR_CODE_NONE;
+			return ErrorCode::ERROR_CODE_COMMON_NOT_COMPATIBLE;
+		}
 	};
 
 
@@ -9,6 +9,13 @@
 namespace Gravisbell {
 namespace Layer {
 namespace NeuralNetwork {
+
+	/** o͌덷vZ֐.
+		CalculateAndTrainingŉZAwKOɌĂяo.
+		@param	i_lppOutputBuffer	o̓f[^. [GetBatchSize()̖߂l][GetOutputBufferCount()̖߂l]̗vf.
+		@param	i_pUserData			CalculateAndTrainingɓnCӂ̃f[^.
+		@return	o͌덷. [GetBatchSize()̖߂l][GetOutputBufferCount()̖߂l]̗vfKv. sꍇNULL */
+	typedef CONST_BATCH_BUFFER_POINTER (*CalculateDOutputFunc)(CONST_BATCH_BUFFER_POINTER i_lppOutputBuffer, void* i_pUserData);
 
 	class INeuralNetwork : public INNMult2SingleLayer
 	{
@@ -56,6 +63,82 @@ namespace NeuralNetwork {
 		virtual ErrorCode SetRuntimeParameter(const Gravisbell::GUID& guid, const wchar_t* i_dataID, const wchar_t* i_param) = 0;
 
 	public:
+		//====================================
+		// _p[h
+		//====================================
+		/** _p[hɐݒ肷.
+			C[f[^̃IveB}CU["Frozen"ɕύXēԂA͌덷obt@.
+			ȍ~PreProcessLearn, CalculateDInput, Trainings.
+			ݒPreProcessCalculates. */
+		virtual ErrorCode Freeze() = 0;
+		/** _p[hmF */
+		virtual bool IsFrozen()const = 0;
+
+	public:
+		//====================================
+		// ČvZ(`FbN|Cg)
+		//====================================
+		/** C[ČvZΏۂɐݒ肷.
+			ŘAČvZΏۂ̃C[1ԂƂAwK͋Ԃ̍Ō̃C[ȊȌo̓obt@ێȂ.
+			덷`ɋԂ̉ZĎsďo͂𕜌邽߁AZʂƈɊwK̃gpʂ팸ł.
+			ẐтɌʂς郌C[(Dropout)≉ZɓvXV郌C[(BatchNormalization)ɂ͐ݒłȂ.
+			ݒPreProcessLearnĂяoۂɓKp.
+			@param	i_layerGUID		ݒΏۃC[GUID.
+			@param	i_onRecompute	truȅꍇČvZΏ. */
+		virtual ErrorCode SetLayerRecomputeFlag(const Gravisbell::GUID& i_layerGUID, bool i_onRecompute) = 0;
+		/** C[ČvZΏۂmF */
+		virtual bool GetLayerRecomputeFlag(const Gravisbell::GUID& i_layerGUID)const = 0;
+
+	public:
+		//====================================
+		// gp
+		//====================================
+		/** gpʂ̏ob`TCY肵AZO(wKp)s.
+			d݁AIveB}CU[AeC[̏o̓obt@A͌덷obt@Aꎞobt@̍vi_maxByteCountȉƂȂő̃ob`TCYI.
+			ꎞobt@ɂCalculateAndTrainingŊeC[ZwK܂ŕێ钆Ԓl܂.
+			ݒς݂̍ČvZΏۂ̂܂܂ł͍őob`TCYɓ͂Ȃꍇ́AČvZ\ȃC[Ԋuŋ؂čČvZΏۂɒǉA傫ȃob`TCYIłꍇ̂ݍ̗p.
+			ǉČvZΏۂGetLayerRecomputeFlagŊmFł.
+			ς̓obt@mۂɊeobt@̊蓖Čv悩sAZO͌肵ob`TCYňxs.
+			@param	i_maxByteCount	gpʂ̏. oCgP.
+			@param	i_maxBatchSize	ob`TCY̏.
+			@param	o_batchSize		Iob`TCY̊i[.
+			@return	ob`TCY1ł𒴂ꍇERROR_CODE_COMMON_ALLOCATION_MEMORY */
+		virtual ErrorCode PreProcessLearnWithMemoryLimit(U64 i_maxByteCount, U32 i_maxBatchSize, U32& o_batchSize) = 0;
+		/** ỎZOŊmۂobt@烁gpʂς.
+			@return	oCgP */
+		virtual U64 GetEstimatedMemoryByteCount()const = 0;
+
+	public:
+		//====================================
+		// OtœK
+		//====================================
+		/** OtœKpX̐擾.
+			ZOł͐ڑ̊mAobt@̊蓖đOɗLȃpXԍɓKp.
+			W̃pX͈ȉ̒ʂ.
+			DeadLayerElimination	: o̓C[瓞BłȂ߉ZȂC[񍐂.
+			IdentityElimination		: Zp̎OŁAZʂ͂ƈv郌C[(jA֐̊, hbvAEggpȂDropout, mCY0GaussianNoise)̉Zȗ.
+			EpilogueFusion			: SoftMaxnȊO̊֐A͌̑S,􍞂݃C[̏o͂̌㏈Ƃē. ͌̏o͂̃C[QƂꍇAČvZΏۂ̏ꍇ͓Ȃ. */
+		virtual U32 GetGraphPassCount()const = 0;
+		/** OtœKpX̖O擾.
+			@param	i_passNum	pX̔ԍ.
+			@return	͈͊ȌꍇNULL */
+		virtual const wchar_t* GetGraphPassName(U32 i_passNum)const = 0;
+		/** OtœKpX̗L/ݒ肷.
+			ݒ͎̉ZOœKp.
+			@param	i_passName	pX̖O.
+			@param	i_onEnable	truȅꍇL.
+			@return	YpXꍇERROR_CODE_COMMON_NOT_EXIST */
+		virtual ErrorCode SetGraphPassEnableFlag(const wchar_t i_passName[], bool i_onEnable) = 0;
+		/** ỎZOŃpXύXC[̐擾.
+			@param	i_passNum	pX̔ԍ. */
+		virtual U32 GetGraphPassChangeLayerCount(U32 i_passNum)const = 0;
+		/** ỎZOŃpXύXC[GUIDԍwŎ擾.
+			@param	i_passNum		pX̔ԍ.
+			@param	i_layerNum		Ԗڂ̃C[擾邩̎w.
+			@param	o_layerGUID		C[GUID̊i[. */
+		virtual ErrorCode GetGraphPassChangeLayerGUID(U32 i_passNum, U32 i_layerNum, Gravisbell::GUID& o_layerGUID)const = 0;
+
+	public:
 		//==========================================
 		// Z.
 		// o͂CPŨ[
@@ -78,8 +161,35 @@ namespace NeuralNetwork {
 			ǑvZʂgp */
 		virtual ErrorCode Training(BATCH_BUFFER_POINTER o_lppDInputBuffer[], CONST_BATCH_BUFFER_POINTER i_lppDOutputBuffer) = 0;
 
+		/** ZƊwKAĎs.
+			ZƊwKob`ɑ΂Ďs邱Ƃۏ؂邽߁AeC[͉Z̒ԒlwKɍėp.
+			ZO(wKp)sĂꍇ̂ݗL.
+			@param	i_lppInputBuffer		̓f[^obt@. [GetBatchSize()̖߂l][GetInputBufferCount()̖߂l]̗vfKv
+			@param	o_lppDInputBuffer		͌덷i[. NULL̏ꍇ͏o͂Ȃ.
+			@param	i_calculateDOutputFunc	Zʂo͌덷vZ֐.
+			@param	i_pUserData				i_calculateDOutputFuncɓnCӂ̃f[^.
+			@return ꍇ0Ԃ */
+		virtual ErrorCode CalculateAndTraining(CONST_BATCH_BUFFER_POINTER i_lppInputBuffer[], BATCH_BUFFER_POINTER o_lppDInputBuffer[], CalculateDOutputFunc i_calculateDOutputFunc, void* i_pUserData) = 0;
+
 	public:
 		//==========================================
+		// Z.
+		// ͂CPŨ[
+		//==========================================
+		/** w肵C[̏o͂vZ.
+			w背C[̌vZɕKvȃC[݂̂ZAȍ~̃C[͉ZȂ.
+			o͂̓Rs[AeC[̏o̓obt@̃AhXԂ(foCXˑ. GPUłł̓foCX). ̉Zs܂ŗL.
+			zXgޔłGPUł́Ao̓obt@L郌C[𓯎Ɏw肵ꍇɐɎ擾AhX̓e㏑邱Ƃ.
+			lbg[NŜ̏o͍͂XVȂ߁AsCalculateDInput, TrainingsĂ͂ȂȂ.
+			@param	i_lppInputBuffer	̓f[^obt@. [GetBatchSize()̖߂l][GetInputBufferCount()̖߂l]̗vfKv
+			@param	i_lpLayerGUID		o͂擾郌C[GUIDz.
+			@param	i_layerCount		o͂擾郌C[.
+			@param	o_lppOutputBuffer	eC[̏o̓obt@̃AhXi[. [i_layerCount]̗vfKv. eobt@[GetBatchSize()̖߂l][C[̏o̓obt@]̗vf.
+			@return ꍇ0Ԃ. ČvZΏۂ̃C[w肵ꍇERROR_CODE_COMMON_NOT_COMPATIBLE */
+		virtual ErrorCode CalculateLayerOutput(CONST_BATCH_BUFFER_POINTER i_lppInputBuffer[], const Gravisbell::GUID i_lpLayerGUID[], U32 i_layerCount, CONST_BATCH_BUFFER_POINTER o_lppOutputBuffer[]) = 0;
+
+	public:
+		//==========================================
 		// o̓obt@̎擾
 		//==========================================		
 		/** o̓f[^obt@擾.
@@ -53,6 +53,37 @@ namespace NeuralNetwork {
 			@param io_lpDParameter	p[^̕ω. */
 		virtual ErrorCode UpdateParameter(F32 io_lpParameter[], const F32 i_lpDParameter[]) = 0;
 
+		/** p[^擾 */
+		virtual U64 GetParameterCount()const = 0;
+
+		/** p[^̕XVJn.
+			1̍XVɂ1xĂяoAωʂ̏WƍXV񐔂̋L^s.
+			@param	i_lpDParameter	p[^̕ω.
+			@param	o_lpDParameter	UpdateParameterRangeɓnωʂ̊i[. */
+		virtual ErrorCode BeginUpdateParameter(const F32 i_lpDParameter[], const F32*& o_lpDParameter) = 0;
+		/** p[^̈ꕔXV.
+			BeginUpdateParameteřɌĂяo. dȂ͈͂łΕXbh瓯ɌĂяo.
+			@param	io_lpParamter	XVp[^̐擪.
+			@param	i_lpDParameter	BeginUpdateParameterŎ擾ωʂ̐擪.
+			@param	i_offset		XV͈͂̊Jnʒu.
+			@param	i_count			XV͈̗͂vf. */
+		virtual ErrorCode UpdateParameterRange(F32 io_lpParameter[], const F32 i_lpDParameter[], U64 i_offset, U64 i_count) = 0;
+
+		/** ωʂŝ݂w肵ăp[^XV.
+			p[^[ubN][s][s̗vf]̔zƂ݂ȂAw肳ꂽŝ݂XV.
+			w肳ĂȂs̕ωʂ0łȂ΂ȂȂ. aȍXVɑΉȂꍇ͑ŜXV.
+			@param	io_lpParamter	XVp[^.
+			@param	i_lpDParameter	p[^̕ω. p[^̗vf.
+			@param	i_rowCount		1ubN̍s.
+			@param	i_rowSize		1s̗vf.
+			@param	i_lpRowNum		ωʂsԍ̔z. dȂ.
+			@param	i_rowNumCount	sԍ̐. */
+		virtual ErrorCode UpdateParameterSparse(F32 io_lpParameter[], const F32 i_lpDParameter[], U32 i_rowCount, U32 i_rowSize, const U32 i_lpRowNum[], U32 i_rowNumCount) = 0;
+		/** aȍXVŒxĂsSčŐV̏Ԃɂ.
+			p[^ŜQƂO(ۑA_)ɌĂяo. xĂsȂꍇ͉Ȃ.
+			@param	io_lpParamter	XVp[^. */
+		virtual ErrorCode ApplyLaggingUpdate(F32 io_lpParameter[]) = 0;
+
 	public:
 		//===========================
 		// ۑ
@@ -65,6 +96,14 @@ namespace NeuralNetwork {
 			@return ꍇ񂾃obt@TCY.sꍇ͕̒l */
 		virtual S64 WriteToBuffer(BYTE* o_lpBuffer)const = 0;
 	};
+
+	/** ̃p[^ꊇōXVۂ̍XVΏ */
+	struct OptimizerUpdateTarget
+	{
+		IOptimizer* pOptimizer;		/**< XVɎgpIveB}CU. p[^͑Ώۂ̗vfƈv */
+		F32* lpParameter;			/**< XVp[^ */
+		const F32* lpDParameter;	/**< p[^̕ω */
+	};
 
 	/** SGD */
 	class iOptimizer_SGD : public IOptimizer
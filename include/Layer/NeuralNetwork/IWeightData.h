@@ -8,11 +8,26 @@
 #include"../../Common/ErrorCode.h"
 #include"../../Common/Guiddef.h"
 #include"../../Common/IODataStruct.h"
+
+#include"./IOptimizer.h"
 
 namespace Gravisbell {
 namespace Layer {
 namespace NeuralNetwork {
 
+	/** p[^̈̊ee\̐擪̋E. vfP. 64oCgEƂȂ */
+	static const U32 WEIGHTDATA_PARAMETER_ALIGNMENT = 16;
+
+	/** ϊςWeight̕ */
+	enum WeightLayout : U32
+	{
+		WEIGHT_LAYOUT_PLAIN,	/**< [neuron][input]. GetWeightƓ */
+		WEIGHT_LAYOUT_PANEL4,	/**< [neuron/4][input][4]. 4j[͂Ƃɕׂ. [̃j[0Ŗ߂ */
+		WEIGHT_LAYOUT_PANEL8,	/**< [neuron/8][input][8]. 8j[͂Ƃɕׂ. [̃j[0Ŗ߂ */
+
+		WEIGHT_LAYOUT_COUNT
+	};
+
 	/** [` */
 	class IWeightData
 	{
@@ -63,6 +78,33 @@ namespace NeuralNetwork {
 			@param	lpDWeight	Weight̕ω.
 			@param	lpDBias		Biashω. */
 		virtual ErrorCode UpdateData(const F32* i_lpDWeight, const F32* i_lpDBias) = 0;
+		/** ωʂŝ݂w肵Weight,BiasXV.
+			Weight[ubN][s][s̗vf]̔zƂ݂ȂAw肳ꂽŝ݂XV. Bias͑ŜXV.
+			@param	i_lpDWeight				Weight̕ω. w肳ĂȂs̕ωʂ0łȂ΂ȂȂ.
+			@param	i_lpDBias				Bias̕ω.
+			@param	i_weightRowCount		Weight1ubN̍s.
+			@param	i_weightRowSize			Weight1s̗vf.
+			@param	i_lpWeightRowNum		ωʂWeight̍sԍ̔z. dȂ.
+			@param	i_weightRowNumCount		sԍ̐. */
+		virtual ErrorCode UpdateDataSparse(const F32* i_lpDWeight, const F32* i_lpDBias, U32 i_weightRowCount, U32 i_weightRowSize, const U32 i_lpWeightRowNum[], U32 i_weightRowNumCount) = 0;
+
+
+		//===========================
+		// ϊςWeight
+		//===========================
+		/** Weight,Bias̔Ő擾.
+			SetData,UpdateDataŒlω邽тɑ. */
+		virtual U64 GetDataVersion()const = 0;
+		/** w̕тɕϊWeight擾.
+			ϊʂтƂɕێAO̕ϊȍ~ɔŐωĂȂꍇ͕ϊȗ.
+			Xbh瓯ɌĂяoĂ悢.
+			@param	i_layout	.
+			@return	ϊWeight. ΉĂȂт̏ꍇNULL. */
+		virtual const F32* GetPackedWeight(WeightLayout i_layout) = 0;
+		/** _pɂ邩ݒ肷.
+			LȏꍇAGetPackedWeightŕϊ͌̕тWeightjAϊς݂̒l݂̂ێ.
+			GetWeightŌ̕тWeightQƂꂽꍇ́Aȍ~͔jȂ. */
+		virtual ErrorCode SetInferenceOnlyFlag(bool i_onInferenceOnly) = 0;
 
 
 		//===========================
@@ -74,9 +116,44 @@ namespace NeuralNetwork {
 		virtual ErrorCode SetOptimizerHyperParameter(const wchar_t i_parameterID[], F32 i_value) = 0;
 		virtual ErrorCode SetOptimizerHyperParameter(const wchar_t i_parameterID[], S32 i_value) = 0;
 		virtual ErrorCode SetOptimizerHyperParameter(const wchar_t i_parameterID[], const wchar_t i_value[]) = 0;
+		/** ێĂSẴIveB}CU[wIDł邩mF */
+		virtual bool CheckOptimizerID(const wchar_t i_optimizerID[])const = 0;
 
 
 		//===========================
+		// p[^̈
+		//===========================
+		/** Õp[^̈ɔzuꍇɕKvȗvf擾.
+			ee\̐擪WEIGHTDATA_PARAMETER_ALIGNMENTvf̋Eɑ邽߁A]܂ */
+		virtual U64 GetParameterCount()const = 0;
+		/** p[^ƌ덷̊i[Ö̗ɕύX.
+			݂̒lVi[ɕʂ. NULLw肵ꍇ͓̗̈ɖ߂.
+			@param	io_lpParameter	p[^̊i[. foCX̃GetParameterCount̖߂l̗vfKv.
+			@param	io_lpDParameter	덷̊i[. foCX̃GetParameterCount̖߂l̗vfKv. XVɌ덷i[. */
+		virtual ErrorCode BindParameterBuffer(F32* io_lpParameter, F32* io_lpDParameter) = 0;
+
+
+		//===========================
+		// ꊇXV
+		//===========================
+		/** XVx邩ݒ肷.
+			LȏꍇAUpdateData͌덷i[݂̂Ńp[^͍XVȂ.
+			GetUpdateTargetŎ擾ΏۂꊇōXVACompleteUpdateĂяo.
+			ɂۂɔfĂȂ덷ꍇ́ȀŔf. */
+		virtual ErrorCode SetDeferredUpdateFlag(bool i_onDeferredUpdate) = 0;
+		/** ꊇXV̑Ώې擾 */
+		virtual U32 GetUpdateTargetCount()const = 0;
+		/** ꊇXV̑Ώۂ擾.
+			fĂȂ덷ȂꍇpOptimizerNULLƂ.
+			@param	i_targetNum	Ώ۔ԍ.
+			@param	o_target	Ώۂ̊i[. */
+		virtual ErrorCode GetUpdateTarget(U32 i_targetNum, OptimizerUpdateTarget& o_target) = 0;
+		/** ꊇXV̊ʒm.
+			XVp[^瓱olČvZ. */
+		virtual ErrorCode CompleteUpdate() = 0;
+
+
+		//===========================
 		// C[ۑ
 		//===========================
 		/** C[̕ۑɕKvȃobt@BYTEPʂŎ擾 */
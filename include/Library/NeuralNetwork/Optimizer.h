@@ -13,6 +13,7 @@
 #endif
 
 #include"Layer/NeuralNetwork/IOptimizer.h"
+#include"Layer/NeuralNetwork/IGradientReducer.h"
 
 namespace Gravisbell {
 namespace Layer {
@@ -26,6 +27,38 @@ namespace NeuralNetwork {
 	Optimizer_API IOptimizer* CreateOptimizerFromBuffer_CPU(const BYTE* i_lpBuffer, Gravisbell::S64 i_bufferSize, Gravisbell::S64& o_useBufferSize);
 	Optimizer_API IOptimizer* CreateOptimizerFromBuffer_GPU(const BYTE* i_lpBuffer, Gravisbell::S64 i_bufferSize, Gravisbell::S64& o_useBufferSize);
 
+	/** ̃p[^ꊇōXV.
+		SΏۂ̗vf̑傫ɕAXbhōXV.
+		eΏۂ̃nCp[p[^͑Ώۂ̃IveB}CU̐ݒɏ].
+		@param	i_lpTarget		XVΏۂ̔z.
+		@param	i_targetCount	XVΏۂ̐. */
+	Optimizer_API ErrorCode UpdateParameterMulti_CPU(const OptimizerUpdateTarget i_lpTarget[], U32 i_targetCount);
+	/** ̃p[^ꊇōXV.
+		eΏۂ̍XVɔs.
+		@param	i_lpTarget		XVΏۂ̔z.
+		@param	i_targetCount	XVΏۂ̐. */
+	Optimizer_API ErrorCode UpdateParameterMulti_GPU(const OptimizerUpdateTarget i_lpTarget[], U32 i_targetCount);
+
+	/** ꊇXVɎgpXbhݒ肷.
+		@param	i_threadCount	Xbh. 0̏ꍇ͘_RAgp. */
+	Optimizer_API void SetUpdateThreadCount_CPU(U32 i_threadCount);
+	/** ꊇXVɎgpXbhv[~.
+		DLL̉̓Xbh̏Iҋ@łȂ߁ADLLOɌĂяo. ȍ~̈ꊇXVōēx쐬. */
+	Optimizer_API void ReleaseUpdateThreadPool_CPU(void);
+
+	/** CPUł̍XVɊgp邩ݒ肷.
+		LȏꍇAeIveB}CU͏]̒vZōXVAʂ̓rbgPʂŏ]ƈv.
+		ȏꍇ()SSEŕvf𓯎ɌvZArsqrt̋ߎl␳ċ߂.
+		@param	i_onReferenceMode	gpꍇtrue. */
+	Optimizer_API void SetReferenceMode_CPU(bool i_onReferenceMode);
+
+	/** ωʏW񃋁[`ݒ肷.
+		ݒ肷CPUŃIveB}CU̓p[^XV̒OɕωʂW񂷂.
+		@param	i_pGradientReducer	W񃋁[`. NULL̏ꍇ͏W񂵂Ȃ. L͈ړȂ. */
+	Optimizer_API void SetGradientReducer_CPU(IGradientReducer* i_pGradientReducer);
+	/** ωʏW񃋁[`擾 */
+	Optimizer_API IGradientReducer* GetGradientReducer_CPU(void);
+
 }	// NeuralNetwork
 }	// Layer
 }	// Gravisbell
@@ -0,0 +1,71 @@
+//==================================
+// j[lbg[N̔񓯊spUtility
+// Calculate/Training̃[J[XbhŏɎsA
+// Ăяo͊҂Ɏ̃ob`̏s
+//==================================
+#ifndef __GRAVISBELL_UTILITY_NEURALNETWORK_ASYNC_EXECUTOR_H__
+#define __GRAVISBELL_UTILITY_NEURALNETWORK_ASYNC_EXECUTOR_H__
+
+#include"NeuralNetworkLayer.h"
+
+#include<future>
+
+namespace Gravisbell {
+namespace Utility {
+namespace NeuralNetworkLayer {
+
+	/** 񓯊̊nh.
+		get()Ŋ҂Aʂ̃G[R[h擾. */
+	typedef std::shared_future<Gravisbell::ErrorCode> AsyncHandle;
+
+	/** j[lbg[N̔񓯊s.
+		vꂽ1̃[J[XbhŗvɎs邽߁ACalculateAsynčɗvTrainingAsync͂CalculatěʂQƂ.
+		ɓnobt@͊nh܂ŎQƂꑱ邽߁A܂ŉ⏑sĂ͂ȂȂ.
+		obt@2gpӂAɎ̃ob`̃f[^֏邱.
+		܂s͑Ώۂ̃lbg[N𒼐ڑ삵Ă͂ȂȂ. */
+	class INeuralNetworkAsyncExecutor
+	{
+	public:
+		/** RXgN^ */
+		INeuralNetworkAsyncExecutor(){}
+		/** fXgN^.
+			vς݂̏SĊĂI. */
+		virtual ~INeuralNetworkAsyncExecutor(){}
+
+	public:
+		//===========================
+		// 
+		//===========================
+		/** Zv.
+			@param	i_lppInputBuffer	̓f[^obt@̔z. ̓f[^\̗vfKv. z񎩑̂͌ĂяôݎQƂ.
+										eobt@͊wKɂQƂ邽߁ATrainingAsync܂ŕێ邱.
+			@param	o_lpOutputBuffer	o̓f[^i[. [ob`TCY][o̓obt@]̗vfKv. ɏo͂Rs[. NULL̏ꍇ̓Rs[Ȃ.
+			@return	nh */
+		virtual AsyncHandle CalculateAsync(CONST_BATCH_BUFFER_POINTER i_lppInputBuffer[], BATCH_BUFFER_POINTER o_lpOutputBuffer) = 0;
+
+		/** wKv.
+			OɗvCalculateAsynčʂgp.
+			@param	o_lppDInputBuffer	͌덷i[̔z. NULL̏ꍇ͓͌덷o͂Ȃ. z񎩑̂͌ĂяôݎQƂ.
+			@param	i_lppDOutputBuffer	o͌덷. [ob`TCY][o̓obt@]̗vfKv.
+			@return	nh */
+		virtual AsyncHandle TrainingAsync(BATCH_BUFFER_POINTER o_lppDInputBuffer[], CONST_BATCH_BUFFER_POINTER i_lppDOutputBuffer) = 0;
+
+		/** vς݂̏SĊ܂őҋ@.
+			@return	ҋ@Ɋ̂ŏɎs̃G[R[h */
+		virtual Gravisbell::ErrorCode WaitAll() = 0;
+
+		/** ̏擾 */
+		virtual U32 GetPendingCount()const = 0;
+	};
+
+	/** 񓯊s쐬.
+		@param	neuralNetwork	Ώۂ̃lbg[N. O(PreProcessLearn/PreProcessCalculate, PreProcessLoop)sς݂ł邱. 񓯊sɍ폜Ă͂ȂȂ.
+		@return	sꍇNULL. */
+	GRAVISBELL_UTILITY_NEURALNETWORKLAYER_API
+	INeuralNetworkAsyncExecutor* CreateAsyncExecutor(Layer::NeuralNetwork::INeuralNetwork& neuralNetwork);
+
+}	// NeuralNetworkLayer
+}	// Utility
+}	// Gravisbell
+
+#endif
@@ -0,0 +1,50 @@
+//==================================
+// j[lbg[N̔񓯊wKpUtility
+// ̃C[f[^쐬̃lbg[N
+// ʃXbhŊwKAd݂bNɋLXV(Hogwild!)
+//==================================
+#ifndef __GRAVISBELL_UTILITY_NEURALNETWORK_ASYNC_TRAINER_H__
+#define __GRAVISBELL_UTILITY_NEURALNETWORK_ASYNC_TRAINER_H__
+
+#include"NeuralNetworkLayer.h"
+
+namespace Gravisbell {
+namespace Utility {
+namespace NeuralNetworkLayer {
+
+	/** 񓯊wK1Xebv̏.
+		[J[ƂɕʃXbhĂяo.
+		̓f[^̐؂ւACalculateA덷vZATraining܂łs.
+		@param	i_workerNo			[J[ԍ.
+		@param	i_stepNo			S[J[ʂł̃Xebvԍ.
+		@param	io_neuralNetwork	[J[p̃lbg[N. d݂͑S[J[ŋLĂ.
+		@param	i_pUserData			ExecuteAsyncTrainingɓnꂽ[U[f[^. */
+	typedef Gravisbell::ErrorCode (*AsyncTrainingStepFunc)(U32 i_workerNo, U64 i_stepNo, Layer::NeuralNetwork::INeuralNetwork& io_neuralNetwork, void* i_pUserData);
+
+	/** 񓯊wKs.
+		C[f[^烏[J[̃lbg[N쐬Ae[J[ʃXbhi_stepFuncs.
+		s̓IveB}CŨnCp[p[^"AsyncUpdate"LɂAd݂̍XVbNɍs.
+		aȓ(one-hot)FullyConnectƂlbg[NŗL. "AsyncUpdate"ɑΉĂIveB}CUSGD̂.
+		ȉ̏ꍇERROR_CODE_COMMON_NOT_COMPATIBLEԂ.
+		ESGDȊÕIveB}CUێĂꍇ. MomentumAAdam̓p[^Ƃ̏Ԃ[J[Ԃŋ邽ߑΉȂ.
+		Ep[^ÄɔzuĂꍇAXVxĂꍇ.
+		ESetGradientReducer_CPUŕωʂ̏W񃋁[`ݒ肵Ăꍇ. Wp̍ƃobt@[J[ԂŋL邽.
+		@param	neuralNetworkData	wKΏۂ̃C[f[^. OChangeOptimizer(L"SGD")sĂ.
+		@param	i_lpInputDataStruct	̓f[^\̔z.
+		@param	i_inputCount		̓f[^\̐.
+		@param	i_batchSize			[J[1̃ob`TCY.
+		@param	i_workerCount		[J[(Xbh).
+		@param	i_stepCount			S[J[vŎsXebv.
+		@param	i_stepFunc			1Xebv̏.
+		@param	i_pUserData			i_stepFuncɓn郆[U[f[^. */
+	GRAVISBELL_UTILITY_NEURALNETWORKLAYER_API
+	Gravisbell::ErrorCode ExecuteAsyncTraining(
+		Layer::Connect::ILayerConnectData& neuralNetworkData, const IODataStruct i_lpInputDataStruct[], U32 i_inputCount,
+		U32 i_batchSize, U32 i_workerCount, U64 i_stepCount,
+		AsyncTrainingStepFunc i_stepFunc, void* i_pUserData);
+
+}	// NeuralNetworkLayer
+}	// Utility
+}	// Gravisbell
+
+#endif
@@ -0,0 +1,79 @@
+//==================================
+// d݂L鐄_psReLXgpUtility
+// ̃C[f[^畡̃ReLXg쐬A
+// ʃXbh瓯ɐ_s
+//==================================
+#ifndef __GRAVISBELL_UTILITY_NEURALNETWORK_INFERENCE_CONTEXT_H__
+#define __GRAVISBELL_UTILITY_NEURALNETWORK_INFERENCE_CONTEXT_H__
+
+#include"NeuralNetworkLayer.h"
+
+namespace Gravisbell {
+namespace Utility {
+namespace NeuralNetworkLayer {
+
+	/** _psReLXg.
+		d݂͍쐬̃C[f[^ێAReLXg̓Rs[Ȃ.
+		o̓obt@̉Zpobt@̓ReLXgƂɊmۂ邽߁AقȂReLXg͕ʃXbh瓯Ɏgpł.
+		ReLXg𕡐Xbh瓯Ɏgp邱Ƃ͂łȂ.
+		܂gpɍ쐬̃C[f[^̏d݂ύX(wK,ChangeOptimizer)Ă͂ȂȂ. */
+	class INeuralNetworkInferenceContext
+	{
+	public:
+		/** RXgN^ */
+		INeuralNetworkInferenceContext(){}
+		/** fXgN^ */
+		virtual ~INeuralNetworkInferenceContext(){}
+
+	public:
+		//===========================
+		// {
+		//===========================
+		/** ob`TCY擾 */
+		virtual U32 GetBatchSize()const = 0;
+		/** őob`TCY擾. 쐬Ɏw肵ob`TCY */
+		virtual U32 GetMaxBatchSize()const = 0;
+
+		/** ̓f[^\擾 */
+		virtual IODataStruct GetInputDataStruct(U32 i_inputNum)const = 0;
+		/** o̓f[^\擾 */
+		virtual IODataStruct GetOutputDataStruct()const = 0;
+
+	public:
+		//===========================
+		// 
+		//===========================
+		/** Zs.
+			@param	i_lppInputBuffer	̓f[^obt@̔z. ̓f[^\̗vfKv. eobt@[ob`TCY][̓obt@]. */
+		virtual Gravisbell::ErrorCode Calculate(CONST_BATCH_BUFFER_POINTER i_lppInputBuffer[]) = 0;
+
+		/** ZɎgpob`TCYύX.
+			쐬Ɏw肵ob`TCYȉł΁Aobt@ĊmۂɕύXł.
+			@param	i_batchSize	ob`TCY. 1`GetMaxBatchSize()̖߂l. */
+		virtual Gravisbell::ErrorCode SetBatchSize(U32 i_batchSize) = 0;
+
+		/** o̓f[^obt@擾.
+			z̗vf[GetBatchSize()̖߂l][o̓obt@].
+			Calculates܂ŗL. */
+		virtual CONST_BATCH_BUFFER_POINTER GetOutputBuffer()const = 0;
+		/** o̓f[^obt@擾.
+			@param o_lpOutputBuffer	o̓f[^i[z. [GetBatchSize()̖߂l][o̓obt@]̗vfKv */
+		virtual Gravisbell::ErrorCode GetOutputBuffer(BATCH_BUFFER_POINTER o_lpOutputBuffer)const = 0;
+	};
+
+	/** _psReLXg쐬.
+		쐬͕Xbh瓯ɌĂяoĂ悢.
+		@param	neuralNetworkData	d݂ێ郌C[f[^. ReLXgɍ폜Ă͂ȂȂ.
+		@param	i_lpInputDataStruct	̓f[^\̔z.
+		@param	i_inputCount		̓f[^\̐.
+		@param	i_batchSize			ReLXg̃ob`TCY.
+		@return	sꍇNULL. */
+	GRAVISBELL_UTILITY_NEURALNETWORKLAYER_API
+	INeuralNetworkInferenceContext* CreateInferenceContext(
+		Layer::Connect::ILayerConnectData& neuralNetworkData, const IODataStruct i_lpInputDataStruct[], U32 i_inputCount, U32 i_batchSize);
+
+}	// NeuralNetworkLayer
+}	// Utility
+}	// Gravisbell
+
+#endif
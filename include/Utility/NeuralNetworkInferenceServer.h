@@ -0,0 +1,102 @@
+//==================================
+// Iob`s_T[o[pUtility
+// 1TvPʂ̗v܂Ƃ߂ăob`A
+// ̐_ReLXgŕɉZ
+//==================================
+#ifndef __GRAVISBELL_UTILITY_NEURALNETWORK_INFERENCE_SERVER_H__
+#define __GRAVISBELL_UTILITY_NEURALNETWORK_INFERENCE_SERVER_H__
+
+#include"NeuralNetworkInferenceContext.h"
+
+namespace Gravisbell {
+namespace Utility {
+namespace NeuralNetworkLayer {
+
+	/** _T[o[̓v.
+		ResetStatisticsĂяoĂ̒l. */
+	struct InferenceServerStatistics
+	{
+		U64 requestCount;		/**< v */
+		U64 errorCount;			/**< Ɏsv */
+		U64 batchCount;			/**< sob` */
+		F32 averageBatchSize;	/**< 1ob`̕ϗv */
+		F32 latencyP50;			/**< v牞܂ł̎Ԃ̒l[ms]. ߂̗vWv */
+		F32 latencyP99;			/**< v牞܂ł̎Ԃ99p[Z^Cl[ms]. ߂̗vWv */
+		F32 throughput;			/**< 1b̏v */
+	};
+
+	/** _T[o[.
+		͂vőob`TCYɒB邩Aŏ̗v̑ҋ@ԂɒB܂ŗ߂ĂꊇŉZ.
+		zXgŃf[^肷郌C[f[^gp邱. */
+	class INeuralNetworkInferenceServer
+	{
+	public:
+		/** RXgN^ */
+		INeuralNetworkInferenceServer(){}
+		/** fXgN^.
+			\Pbgł̎t~Atς݂̗vSďĂI. */
+		virtual ~INeuralNetworkInferenceServer(){}
+
+	public:
+		//===========================
+		// {
+		//===========================
+		/** xɉZőv擾 */
+		virtual U32 GetMaxBatchSize()const = 0;
+
+		/** 1v̓͗vf擾.
+			͂̃lbg[N̏ꍇ͑S͂̍v. */
+		virtual U32 GetInputBufferCount()const = 0;
+		/** 1v̏o͗vf擾 */
+		virtual U32 GetOutputBufferCount()const = 0;
+
+	public:
+		//===========================
+		// 
+		//===========================
+		/** 1Tv̐_vA܂őҋ@.
+			Xbh瓯ɌĂяoĂ悢.
+			@param	i_lpInputBuffer		̓f[^. [GetInputBufferCount()̖߂l]̗vfKv. ͂̏ꍇ͓͔ԍɘA.
+			@param	o_lpOutputBuffer	o̓f[^i[. [GetOutputBufferCount()̖߂l]̗vfKv. */
+		virtual Gravisbell::ErrorCode Calculate(const F32 i_lpInputBuffer[], F32 o_lpOutputBuffer[]) = 0;
+
+		/** UNIXhC\Pbgł̗v̎tJn.
+			ڑƂɃXbh쐬A1ڑŕ̗vɏ.
+			vF32̓̓f[^[GetInputBufferCount()̖߂l],
+			S32̃G[R[hF32̏o̓f[^[GetOutputBufferCount()̖߂l]. zXg̃oCgI[_[.
+			Windowsł͖Ή.
+			@param	i_socketPath	\Pbgt@C̃pX. ̃t@C݂ꍇ͍폜. */
+		virtual Gravisbell::ErrorCode StartSocketServer(const char i_socketPath[]) = 0;
+		/** \Pbgł̎t~ASĂ̐ڑؒf.
+			̗v͊҂Ăؒf. */
+		virtual Gravisbell::ErrorCode StopSocketServer() = 0;
+
+	public:
+		//===========================
+		// v
+		//===========================
+		/** v擾 */
+		virtual InferenceServerStatistics GetStatistics()const = 0;
+		/** vZbg */
+		virtual void ResetStatistics() = 0;
+	};
+
+	/** _T[o[쐬.
+		_ReLXgw萔쐬AReLXgƂɉZXbhN.
+		@param	neuralNetworkData	d݂ێ郌C[f[^. T[o[ɍ폜Ă͂ȂȂ.
+		@param	i_lpInputDataStruct	̓f[^\̔z.
+		@param	i_inputCount		̓f[^\̐.
+		@param	i_maxBatchSize		xɉZőv.
+		@param	i_maxLatency		ŏ̗v͂Ă牉ZJn܂łɑҋ@ő厞[s].
+		@param	i_contextCount		_ReLXg(ZXbh).
+		@return	sꍇNULL. */
+	GRAVISBELL_UTILITY_NEURALNETWORKLAYER_API
+	INeuralNetworkInferenceServer* CreateInferenceServer(
+		Layer::Connect::ILayerConnectData& neuralNetworkData, const IODataStruct i_lpInputDataStruct[], U32 i_inputCount,
+		U32 i_maxBatchSize, U32 i_maxLatency, U32 i_contextCount);
+
+}	// NeuralNetworkLayer
+}	// Utility
+}	// Gravisbell
+
+#endif
@@ -0,0 +1,69 @@
+//==================================
+// LgpP}Ṽ}`vZXf[^wKpUtility
+// evZXg̃lbg[Nƃf[^A
+// p[^̕ωʂ݂̂Lŕω
+//==================================
+#ifndef __GRAVISBELL_UTILITY_SHAREDMEMORY_DATAPARALLEL_H__
+#define __GRAVISBELL_UTILITY_SHAREDMEMORY_DATAPARALLEL_H__
+
+#include"NeuralNetworkLayer.h"
+
+#include"../Layer/NeuralNetwork/IGradientReducer.h"
+
+namespace Gravisbell {
+namespace Utility {
+namespace NeuralNetworkLayer {
+
+	/** Lgpf[^wKNX.
+		OptimizerCu SetGradientReducer_CPU ɐݒ肵Ďgp.
+		SvZXlbg[N\Ad(t@Cǂݍޓ)ŊwKJn邱. */
+	class ISharedMemoryDataParallel : public Layer::NeuralNetwork::IGradientReducer
+	{
+	public:
+		/** RXgN^ */
+		ISharedMemoryDataParallel(){}
+		/** fXgN^ */
+		virtual ~ISharedMemoryDataParallel(){}
+
+	public:
+		//===========================
+		// {
+		//===========================
+		/** vZX̔ԍ擾 */
+		virtual U32 GetRank()const = 0;
+		/** QvZX擾 */
+		virtual U32 GetProcessCount()const = 0;
+
+	public:
+		//===========================
+		// 
+		//===========================
+		/** SvZXB܂őҋ@.
+			ҋ@Ԃ𒴉߂ꍇERROR_CODE_COMMON_TIMEOUTԂÃvZX̑ҋ@f.
+			fꂽꍇERROR_CODE_COMMON_ABORTEDԂ. */
+		virtual Gravisbell::ErrorCode Barrier() = 0;
+		/** SvZX̏𒆒f.
+			ُmvZXĂяo. ȍ~͑SvZXBarrierERROR_CODE_COMMON_ABORTEDԂ. */
+		virtual void Abort() = 0;
+
+		/** j[lbg[NoCit@Cɕۑ.
+			SvZXĂяo. ۑ̓N0̃vZX݂̂sAۑ܂őSvZXҋ@. */
+		virtual Gravisbell::ErrorCode WriteNetworkToBinaryFile(const Layer::ILayerData& neuralNetwork, const wchar_t i_filePath[]) = 0;
+	};
+
+	/** Lgpf[^wKNX쐬.
+		N0̃vZXL쐬ÃvZX͍쐬܂őҋ@Ăڑ.
+		@param	i_name				L. SvZXœOw肷.
+		@param	i_rank				vZX̔ԍ. 0`i_processCount-1.
+		@param	i_processCount		QvZX.
+		@param	i_maxParameterCount	xɏW񂷂ωʂ̍ővf. 傫ωʂ͕ďW񂷂.
+		@param	i_barrierTimeout	oAő̃vZX̓B҂ő厞[ms]. 0̏ꍇ͖.
+		@return	sꍇNULL. */
+	GRAVISBELL_UTILITY_NEURALNETWORKLAYER_API
+	ISharedMemoryDataParallel* CreateSharedMemoryDataParallel(const wchar_t i_name[], U32 i_rank, U32 i_processCount, U64 i_maxParameterCount = 1024*1024, U32 i_barrierTimeout = 10*60*1000);
+
+}	// NeuralNetworkLayer
+}	// Utility
+}	// Gravisbell
+
+#endif